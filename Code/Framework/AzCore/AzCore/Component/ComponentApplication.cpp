@@ -930,6 +930,27 @@ namespace AZ
         SettingsRegistryInterface::Specializations specializations;
         SetSettingsRegistrySpecializations(specializations);
 
+        // When enabled, the settings merged by a previous launch that started out with the same settings are used as long as
+        // none of the settings files changed, which avoids parsing all settings files during startup.
+        bool useCompiledRegistry = false;
+        registry.Get(useCompiledRegistry, SettingsRegistryMergeUtils::CompiledRegistryEnabledKey);
+        AZ::IO::FixedMaxPath compiledRegistryPath;
+        AZ::HashValue64 compiledRegistryLaunchKey{};
+        if (useCompiledRegistry)
+        {
+            compiledRegistryPath = SettingsRegistryMergeUtils::GetCompiledRegistryPath(registry, specializations, AZ_TRAIT_OS_PLATFORM_CODENAME);
+            compiledRegistryLaunchKey = SettingsRegistryMergeUtils::GetCompiledRegistryLaunchKey(registry, specializations, AZ_TRAIT_OS_PLATFORM_CODENAME);
+            if (!compiledRegistryPath.empty() && SettingsRegistryMergeUtils::MergeSettingsToRegistry_CompiledRegistry(
+                registry, compiledRegistryPath.Native(), AZ_TRAIT_OS_PLATFORM_CODENAME, compiledRegistryLaunchKey))
+            {
+#if defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
+                // The command line settings are already part of the compiled registry, but the commands still need to run.
+                SettingsRegistryMergeUtils::MergeSettingsToRegistry_CommandLine(registry, m_commandLine, true);
+#endif
+                return;
+            }
+        }
+
         AZStd::vector<char> scratchBuffer;
 #if defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
         // In development builds apply the o3de registry and the command line to allow early overrides. This will
@@ -974,6 +995,12 @@ namespace AZ
 #endif
         // Update the Runtime file paths in case the "{BootstrapSettingsRootKey}/assets" key was overriden by a setting registry
         SettingsRegistryMergeUtils::MergeSettingsToRegistry_AddRuntimeFilePaths(registry);
+
+        if (!compiledRegistryPath.empty())
+        {
+            SettingsRegistryMergeUtils::SaveCompiledRegistry(registry, compiledRegistryPath.Native(), AZ_TRAIT_OS_PLATFORM_CODENAME,
+                compiledRegistryLaunchKey);
+        }
     }
 
     void ComponentApplication::SetSettingsRegistrySpecializations(SettingsRegistryInterface::Specializations& specializations)
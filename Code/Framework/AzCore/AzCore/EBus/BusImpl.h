@@ -19,6 +19,7 @@
 #include <AzCore/Debug/Trace.h>
 
 #include <AzCore/EBus/Internal/BusContainer.h>
+#include <AzCore/EBus/Internal/SnapshotDispatch.h>
 #include <AzCore/EBus/Internal/Debug.h>
 #include <AzCore/EBus/Policies.h>
 
@@ -184,6 +185,12 @@ namespace AZ
             static const bool EventQueueingActiveByDefault = Traits::EventQueueingActiveByDefault;
             static const bool EnableQueuedReferences = Traits::EnableQueuedReferences;
 
+            /**
+             * Specifies whether events are dispatched to a snapshot of the handlers without locking.
+             * @see EBusTraits::SnapshotDispatch
+             */
+            static const bool SnapshotDispatch = Traits::SnapshotDispatch;
+
             /**
              * True if the EBus supports more than one address. Otherwise, false.
              */
@@ -563,7 +570,8 @@ namespace AZ
 
         // This alias is required because you're not allowed to inherit from a nested type.
         template <typename Bus, typename Traits>
-        using EventDispatcher = typename Traits::BusesContainer::template Dispatcher<Bus>;
+        using EventDispatcher = AZStd::conditional_t<Traits::SnapshotDispatch,
+            AZ::Internal::EBusSnapshotDispatcher<Bus, Traits>, typename Traits::BusesContainer::template Dispatcher<Bus>>;
 
         /**
          * Base class that provides eventing, queueing, and enumeration functionality
@@ -199,6 +199,24 @@ namespace AZ
         */
         static const bool LocklessDispatch = false;
 
+        /**
+        * Determines whether events are dispatched to an immutable snapshot of the connected handlers instead of
+        * locking the context mutex for the duration of the dispatch.
+        * This is intended for buses that are sent to from many threads at the same time but where handlers rarely
+        * connect or disconnect, such as notification buses that are dispatched from jobs. Dispatches don't block each
+        * other, or write to memory that's shared between threads, while connecting and disconnecting become more
+        * expensive:
+        * - Connecting marks the snapshot as out of date and the next dispatch publishes a new one.
+        * - Disconnecting removes the handler from the snapshots in use and, if another thread could still be calling
+        *   it, waits for those dispatches to complete after the context mutex has been released.
+        * Handlers that connect while a dispatch is in progress won't receive that event. Handlers that disconnect will
+        * not receive any further events, including from dispatches that are in progress.
+        * Requires a MutexType other than NullMutex and a HandlerPolicy other than EBusHandlerPolicy::Single, and can't
+        * be combined with LocklessDispatch. Enumerating handlers still locks the context mutex.
+        * By default, the standard policy is used, which locks around all dispatches
+        */
+        static const bool SnapshotDispatch = false;
+
         /**
          * Specifies where EBus data is stored.
          * This drives how many instances of this EBus exist at runtime.
@@ -510,6 +528,12 @@ namespace AZ
             "When you use EBusAddressPolicy::Single or EBusAddressPolicy::ById there is no need to define BusIdOrderCompare!");
         static_assert((BusTraits::AddressPolicy != EBusAddressPolicy::ByIdAndOrdered || !AZStd::is_same<BusIdOrderCompare, NullBusIdCompare>::value),
             "When you use EBusAddressPolicy::ByIdAndOrdered you must define BusIdOrderCompare (ex. using BusIdOrderCompare = AZStd::less<BusIdType>)");
+        static_assert((!BusTraits::SnapshotDispatch || !AZStd::is_same<MutexType, NullMutex>::value),
+            "EBusTraits::SnapshotDispatch requires a MutexType to protect connecting and disconnecting handlers.");
+        static_assert((!BusTraits::SnapshotDispatch || BusTraits::HandlerPolicy != EBusHandlerPolicy::Single),
+            "EBusTraits::SnapshotDispatch can't be used with EBusHandlerPolicy::Single.");
+        static_assert((!BusTraits::SnapshotDispatch || !BusTraits::LocklessDispatch),
+            "EBusTraits::SnapshotDispatch and EBusTraits::LocklessDispatch can't be combined.");
         /// @endcond
         /// //////////////////////////////////////////////////////////////////////////
 
@@ -637,10 +661,40 @@ namespace AZ
             */
             using ConnectLockGuard = AZStd::conditional_t<AZStd::is_same_v<ContextMutexType, AZ::NullMutex>, AZ::Internal::NullLockGuard<ContextMutexType>, AZStd::unique_lock<ContextMutexType>>;
 
+            /**
+             * Publishes the handler snapshots that are dispatched to when SnapshotDispatch is set on the EBus.
+             * @see EBusTraits::SnapshotDispatch
+             */
+            using SnapshotState = AZStd::conditional_t<BusTraits::SnapshotDispatch, AZ::Internal::EBusSnapshotState<Interface, Traits>, AZ::Internal::EBusNullSnapshotState>;
+
+            /**
+             * Declared before the context mutex is locked in functions that disconnect handlers. Once the lock has been
+             * released it waits for dispatches on other threads that could still be calling the disconnected handlers.
+             * @see EBusTraits::SnapshotDispatch
+             */
+            class DisconnectSynchronizer
+            {
+            public:
+                explicit DisconnectSynchronizer(Context& context)
+                    : m_context(context)
+                {
+                }
+                ~DisconnectSynchronizer()
+                {
+                    if constexpr (BusTraits::SnapshotDispatch)
+                    {
+                        m_context.WaitForSnapshotReaders();
+                    }
+                }
+            private:
+                Context& m_context;
+            };
+
             BusesContainer          m_buses;         ///< The actual bus container, which is a static map for each bus type.
             ContextMutexType        m_contextMutex;  ///< Mutex to control access when modifying the context
             QueuePolicy             m_queue;
             RouterPolicy            m_routing;
+            SnapshotState           m_snapshots;     ///< Handler snapshots used for dispatching if SnapshotDispatch is set.
 
             Context();
             Context(EBusEnvironment* environment);
@@ -652,6 +706,13 @@ namespace AZ
             Context& operator=(const Context&) = delete;
             Context& operator=(Context&&) = delete;
 
+            /// Returns the snapshot dispatch bookkeeping of the calling thread.
+            AZ::Internal::SnapshotReaderState& GetSnapshotReader();
+            /// Publishes a new handler snapshot if handlers connected or disconnected since the last one.
+            void PublishSnapshot();
+            /// Waits for dispatches that may still call handlers this thread disconnected. Called without the context mutex locked.
+            void WaitForSnapshotReaders();
+
         private:
             using CallstackEntryBase = AZ::Internal::CallstackEntryBase<Interface, Traits>;
             using CallstackEntryRoot = AZ::Internal::CallstackEntryRoot<Interface, Traits>;
@@ -967,6 +1028,41 @@ namespace AZ
         s_callstack = nullptr;
     }
 
+    template <class Interface, class Traits>
+    AZ::Internal::SnapshotReaderState& EBus<Interface, Traits>::Context::GetSnapshotReader()
+    {
+        // The callstack of a thread always starts at the root entry for that thread.
+        return static_cast<CallstackEntryRoot*>(static_cast<CallstackEntryBase*>(s_callstack))->m_snapshotReader;
+    }
+
+    template <class Interface, class Traits>
+    void EBus<Interface, Traits>::Context::PublishSnapshot()
+    {
+        if constexpr (Traits::SnapshotDispatch)
+        {
+            AZStd::scoped_lock<ContextMutexType> lock(m_contextMutex);
+            // Another thread may have published the snapshot while this thread was waiting for the lock.
+            if (m_snapshots.IsDirty())
+            {
+                m_snapshots.Publish(m_buses, m_callstackRoots);
+            }
+        }
+    }
+
+    template <class Interface, class Traits>
+    void EBus<Interface, Traits>::Context::WaitForSnapshotReaders()
+    {
+        if constexpr (Traits::SnapshotDispatch)
+        {
+            AZ::Internal::SnapshotReaderState& reader = GetSnapshotReader();
+            if (reader.m_hasPendingDisconnect)
+            {
+                reader.m_hasPendingDisconnect = false;
+                m_snapshots.WaitForReaders(m_callstackRoots, m_contextMutex, reader);
+            }
+        }
+    }
+
 AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
 
     //=========================================================================
@@ -993,6 +1089,10 @@ AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
 
         // Do the actual connection
         context.m_buses.Connect(handler, id);
+        if constexpr (Traits::SnapshotDispatch)
+        {
+            context.m_snapshots.MarkDirty();
+        }
 
         BusPtr ptr;
         if constexpr (EBus::HasId)
@@ -1012,6 +1112,7 @@ AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
         // To call Disconnect() from a message while being thread safe, you need to make sure the context.m_contextMutex is AZStd::recursive_mutex. Otherwise, a deadlock will occur.
         if (Context* context = GetContext())
         {
+            typename Context::DisconnectSynchronizer synchronizer(*context);
             // scoped lock guard in case of exception / other odd situation
             AZStd::scoped_lock<decltype(context->m_contextMutex)> lock(context->m_contextMutex);
             DisconnectInternal(*context, handler);
@@ -1042,6 +1143,25 @@ AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
 
         CallstackEntry entry(&context, nullptr);
 
+        if constexpr (Traits::SnapshotDispatch)
+        {
+            // Dispatches that are using a snapshot which still holds the handler skip it from here on, but dispatches on
+            // other threads may be calling it right now. Those are waited for once the context mutex is released.
+            bool isHandlerInUse = false;
+            if constexpr (EBus::HasId)
+            {
+                isHandlerInUse = context.m_snapshots.RemoveHandler(handler, handler.GetBusId());
+            }
+            else
+            {
+                isHandlerInUse = context.m_snapshots.RemoveHandler(handler, BusIdType());
+            }
+            if (isHandlerInUse)
+            {
+                context.GetSnapshotReader().m_hasPendingDisconnect = true;
+            }
+        }
+
         // Do the actual disconnection
         context.m_buses.Disconnect(handler);
 
@@ -1264,6 +1384,7 @@ AZ_POP_DISABLE_WARNING
         {
             if (typename BusType::Context* context = BusType::GetContext())
             {
+                typename BusType::Context::DisconnectSynchronizer synchronizer(*context);
                 AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
                 if (BusIsConnected())
                 {
@@ -1278,6 +1399,7 @@ AZ_POP_DISABLE_WARNING
         void IdHandler<Interface, Traits, ContainerType>::BusConnect(const IdType& id)
         {
             typename BusType::Context& context = BusType::GetOrCreateContext();
+            typename BusType::Context::DisconnectSynchronizer synchronizer(context);
             typename BusType::Context::ConnectLockGuard contextLock(context.m_contextMutex);
             if (BusIsConnected())
             {
@@ -1298,6 +1420,7 @@ AZ_POP_DISABLE_WARNING
         {
             if (typename BusType::Context* context = BusType::GetContext())
             {
+                typename BusType::Context::DisconnectSynchronizer synchronizer(*context);
                 AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
                 if (BusIsConnectedId(id))
                 {
@@ -1310,6 +1433,7 @@ AZ_POP_DISABLE_WARNING
         {
             if (typename BusType::Context* context = BusType::GetContext())
             {
+                typename BusType::Context::DisconnectSynchronizer synchronizer(*context);
                 AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
                 if (BusIsConnected())
                 {
@@ -1338,6 +1462,7 @@ AZ_POP_DISABLE_WARNING
         {
             if (typename BusType::Context* context = BusType::GetContext())
             {
+                typename BusType::Context::DisconnectSynchronizer synchronizer(*context);
                 AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
                 auto nodeIt = m_handlerNodes.find(id);
                 if (nodeIt != m_handlerNodes.end())
@@ -1356,6 +1481,7 @@ AZ_POP_DISABLE_WARNING
             decltype(m_handlerNodes) handlerNodesToDisconnect;
             if (typename BusType::Context* context = BusType::GetContext())
             {
+                typename BusType::Context::DisconnectSynchronizer synchronizer(*context);
                 AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
                 handlerNodesToDisconnect = AZStd::move(m_handlerNodes);
 
@@ -9,6 +9,7 @@
 
 #include <AzCore/EBus/Internal/Debug.h>
 
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/lock.h>
 
 namespace AZ
@@ -105,6 +106,31 @@ namespace AZ
             AZStd::native_thread_id_type m_threadId;
         };
 
+        // Dispatches on buses using EBusTraits::SnapshotDispatch that are in progress on a thread, counted per epoch parity.
+        // Only the owning thread changes the counters, other threads read them to find out if a snapshot is still in use.
+        struct SnapshotReaderState
+        {
+            SnapshotReaderState() = default;
+            // Copying is only needed to store the state in containers before it's in use.
+            SnapshotReaderState(const SnapshotReaderState& rhs)
+            {
+                *this = rhs;
+            }
+            SnapshotReaderState& operator=(const SnapshotReaderState& rhs)
+            {
+                m_reads[0].store(rhs.m_reads[0].load());
+                m_reads[1].store(rhs.m_reads[1].load());
+                m_isWaiting.store(rhs.m_isWaiting.load());
+                m_hasPendingDisconnect = rhs.m_hasPendingDisconnect;
+                return *this;
+            }
+
+            AZStd::atomic<AZ::u32> m_reads[2]{ { 0 }, { 0 } };
+            AZStd::atomic_bool m_isWaiting{ false };
+            // Set when this thread disconnected a handler that dispatches on other threads may still be calling.
+            bool m_hasPendingDisconnect = false;
+        };
+
         // One of these will be allocated per thread. It acts as the bottom of any callstack during dispatch within
         // that thread. It has to be stored in the context so that it is shared across DLLs. We accelerate this by
         // caching the root into a thread_local pointer (Context::s_callstack) on first access. Since global bus contexts
@@ -124,6 +150,8 @@ namespace AZ
             void SetRouterProcessingState(typename BusType::RouterProcessingState) override { AZ_Assert(false, "Callstack root should never attempt to alter router processing state"); }
             bool IsRoutingQueuedEvent() const override { return false; }
             bool IsRoutingReverseEvent() const override { return false; }
+
+            SnapshotReaderState m_snapshotReader;
         };
 
         template <class C, bool UseTLS /*= false*/>
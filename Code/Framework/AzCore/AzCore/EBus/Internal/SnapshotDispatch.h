@@ -0,0 +1,608 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/EBus/Internal/BusContainer.h>
+#include <AzCore/EBus/Internal/CallstackEntry.h>
+#include <AzCore/EBus/Internal/Debug.h>
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        // Used instead of an address lookup table by snapshots of single address buses.
+        struct NullSnapshotLookup
+        {
+        };
+
+        // Immutable copy of the handlers that are connected to a bus, stored in dispatch order. The only change that's
+        // made to a published snapshot is clearing the slot of a handler that disconnects, so dispatches that are still
+        // iterating over the snapshot skip it.
+        template <typename Interface, typename Traits>
+        struct EBusHandlerSnapshot
+        {
+            using IdType = typename Traits::BusIdType;
+            static constexpr bool HasId = Traits::AddressPolicy != EBusAddressPolicy::Single;
+
+            struct Address
+            {
+                IdType m_busId;
+                size_t m_begin;
+                size_t m_end;
+            };
+
+            using AddressList = AZStd::vector<Address, typename Traits::AllocatorType>;
+            using AddressLookup = AZStd::conditional_t<HasId,
+                AZStd::unordered_map<IdType, size_t, AZStd::hash<IdType>, AZStd::equal_to<IdType>, typename Traits::AllocatorType>,
+                NullSnapshotLookup>;
+
+            explicit EBusHandlerSnapshot(size_t handlerCount)
+                : m_handlers(handlerCount > 0 ? new AZStd::atomic<Interface*>[handlerCount] : nullptr)
+            {
+            }
+
+            const Address* FindAddress([[maybe_unused]] const IdType& id) const
+            {
+                if constexpr (HasId)
+                {
+                    auto it = m_lookup.find(id);
+                    return it != m_lookup.end() ? &m_addresses[it->second] : nullptr;
+                }
+                else
+                {
+                    return m_addresses.empty() ? nullptr : &m_addresses.front();
+                }
+            }
+
+            // Clears the slot of the handler at the address. Returns true if the handler was found.
+            bool ClearHandler(Interface* handler, const IdType& id)
+            {
+                bool found = false;
+                if (const Address* address = FindAddress(id))
+                {
+                    for (size_t i = address->m_begin; i < address->m_end; ++i)
+                    {
+                        if (m_handlers[i].load(AZStd::memory_order_relaxed) == handler)
+                        {
+                            m_handlers[i].store(nullptr, AZStd::memory_order_relaxed);
+                            found = true;
+                        }
+                    }
+                }
+                return found;
+            }
+
+            AddressList m_addresses;
+            AddressLookup m_lookup;
+            AZStd::unique_ptr<AZStd::atomic<Interface*>[]> m_handlers;
+            EBusHandlerSnapshot* m_nextRetired = nullptr;
+            AZ::u64 m_retiredSequence = 0;
+        };
+
+        // Publishes handler snapshots for buses that set EBusTraits::SnapshotDispatch and tracks the dispatches that read
+        // them. A dispatch registers itself in the counter for the parity of the current epoch in its own thread's
+        // SnapshotReaderState, so dispatching never writes to memory that's shared with other threads. Snapshots that
+        // have been replaced are released once both parities have been seen without readers, and the epoch is advanced
+        // when needed so new dispatches move away from the parity that's being drained.
+        // Unless stated otherwise, functions need to be called with the context mutex locked.
+        template <typename Interface, typename Traits>
+        class EBusSnapshotState
+        {
+        public:
+            using Snapshot = EBusHandlerSnapshot<Interface, Traits>;
+            using IdType = typename Traits::BusIdType;
+
+            EBusSnapshotState() = default;
+            EBusSnapshotState(const EBusSnapshotState&) = delete;
+            EBusSnapshotState& operator=(const EBusSnapshotState&) = delete;
+
+            ~EBusSnapshotState()
+            {
+                delete m_current.load();
+                while (m_retired)
+                {
+                    Snapshot* next = m_retired->m_nextRetired;
+                    delete m_retired;
+                    m_retired = next;
+                }
+            }
+
+            // Registers a dispatch on this thread and returns the snapshot to dispatch to. Doesn't require the context mutex.
+            const Snapshot* BeginRead(SnapshotReaderState& reader, AZ::u32& parity)
+            {
+                for (;;)
+                {
+                    const AZ::u64 epoch = m_epoch.load();
+                    parity = static_cast<AZ::u32>(epoch & 1);
+                    reader.m_reads[parity].fetch_add(1);
+                    // If a writer advanced the epoch in the meantime it may already be checking the other parity.
+                    if (m_epoch.load() == epoch)
+                    {
+                        break;
+                    }
+                    reader.m_reads[parity].fetch_sub(1);
+                }
+                return m_current.load();
+            }
+
+            // Doesn't require the context mutex.
+            void EndRead(SnapshotReaderState& reader, AZ::u32 parity)
+            {
+                reader.m_reads[parity].fetch_sub(1, AZStd::memory_order_release);
+            }
+
+            // Doesn't require the context mutex.
+            bool IsDirty() const
+            {
+                return m_isDirty.load(AZStd::memory_order_acquire);
+            }
+
+            void MarkDirty()
+            {
+                m_isDirty.store(true, AZStd::memory_order_release);
+            }
+
+            // Replaces the current snapshot with a copy of the handlers in the bus container.
+            template <typename Container, typename Readers>
+            void Publish(Container& buses, Readers& readers)
+            {
+                Snapshot* snapshot = nullptr;
+                if constexpr (Snapshot::HasId)
+                {
+                    size_t handlerCount = 0;
+                    for (auto& holder : buses.m_addresses)
+                    {
+                        handlerCount += holder.m_handlers.size();
+                    }
+
+                    snapshot = new Snapshot(handlerCount);
+                    size_t index = 0;
+                    for (auto& holder : buses.m_addresses)
+                    {
+                        if (holder.HasHandlers())
+                        {
+                            snapshot->m_lookup.emplace(holder.m_busId, snapshot->m_addresses.size());
+                            snapshot->m_addresses.push_back({ holder.m_busId, index, index + holder.m_handlers.size() });
+                            for (auto& handler : holder.m_handlers)
+                            {
+                                snapshot->m_handlers[index++].store(handler.m_interface, AZStd::memory_order_relaxed);
+                            }
+                        }
+                    }
+                }
+                else
+                {
+                    const size_t handlerCount = buses.m_handlers.size();
+                    snapshot = new Snapshot(handlerCount);
+                    if (handlerCount > 0)
+                    {
+                        snapshot->m_addresses.push_back({ IdType(), 0, handlerCount });
+                        size_t index = 0;
+                        for (auto& handler : buses.m_handlers)
+                        {
+                            snapshot->m_handlers[index++].store(handler.m_interface, AZStd::memory_order_relaxed);
+                        }
+                    }
+                }
+
+                m_isDirty.store(false, AZStd::memory_order_relaxed);
+                if (Snapshot* previous = m_current.exchange(snapshot))
+                {
+                    previous->m_retiredSequence = ++m_retiredSequence;
+                    previous->m_nextRetired = m_retired;
+                    m_retired = previous;
+                }
+                Reclaim(readers);
+            }
+
+            // Clears the handler from all snapshots that dispatches may still be iterating over. Returns true if the
+            // handler was found in any of them, in which case dispatches on other threads may still be calling it.
+            bool RemoveHandler(Interface* handler, const IdType& id)
+            {
+                bool found = false;
+                if (Snapshot* current = m_current.load())
+                {
+                    found = current->ClearHandler(handler, id);
+                }
+                for (Snapshot* retired = m_retired; retired; retired = retired->m_nextRetired)
+                {
+                    found = retired->ClearHandler(handler, id) || found;
+                }
+                MarkDirty();
+                return found;
+            }
+
+            // Releases retired snapshots that can no longer be in use. Never blocks.
+            template <typename Readers>
+            void Reclaim(Readers& readers)
+            {
+                if (!m_retired)
+                {
+                    return;
+                }
+
+                // Only readers that were registered when a snapshot was retired can be using it, so observations count
+                // towards the snapshots that were retired before the first observation was made.
+                if (m_reclaimSequence == 0)
+                {
+                    m_reclaimSequence = m_retiredSequence;
+                    m_drainedParities = 0;
+                }
+                m_drainedParities |= CollectDrainedParities(readers, m_drainedParities, nullptr);
+                if (m_drainedParities != BothParities)
+                {
+                    return;
+                }
+
+                Snapshot** link = &m_retired;
+                while (*link)
+                {
+                    Snapshot* snapshot = *link;
+                    if (snapshot->m_retiredSequence <= m_reclaimSequence)
+                    {
+                        *link = snapshot->m_nextRetired;
+                        delete snapshot;
+                    }
+                    else
+                    {
+                        link = &snapshot->m_nextRetired;
+                    }
+                }
+                m_reclaimSequence = 0;
+            }
+
+            // Blocks until dispatches on other threads that were in progress when this function was called have finished.
+            // Must be called without the context mutex locked, as those dispatches may need it to complete.
+            template <typename Readers, typename Mutex>
+            void WaitForReaders(Readers& readers, Mutex& mutex, SnapshotReaderState& self)
+            {
+                // A thread that is waiting itself may still be inside one of the cleared handlers, so it's only skipped when
+                // this thread is dispatching as well. In that case it could be waiting on this thread and waiting for it
+                // would deadlock. A thread that isn't dispatching can't be waited on, so it always waits for everyone.
+                self.m_isWaiting.store(true);
+                AZ::u32 drainedParities = 0;
+                for (;;)
+                {
+                    {
+                        AZStd::scoped_lock<Mutex> lock(mutex);
+                        drainedParities |= CollectDrainedParities(readers, drainedParities, &self);
+                        if (drainedParities == BothParities)
+                        {
+                            Reclaim(readers);
+                            break;
+                        }
+                    }
+                    AZStd::this_thread::yield();
+                }
+                self.m_isWaiting.store(false);
+            }
+
+        private:
+            static constexpr AZ::u32 BothParities = 0b11;
+
+            // Returns the parities for which no registered readers were found. If the parity of the current epoch still has
+            // readers the epoch is advanced so new dispatches register with the other parity and the readers can drain.
+            template <typename Readers>
+            AZ::u32 CollectDrainedParities(Readers& readers, AZ::u32 drainedParities, const SnapshotReaderState* self)
+            {
+                for (AZ::u32 parity = 0; parity < 2; ++parity)
+                {
+                    const AZ::u32 parityBit = 1 << parity;
+                    if ((drainedParities & parityBit) == 0 && !HasReaders(readers, parity, self))
+                    {
+                        drainedParities |= parityBit;
+                    }
+                }
+
+                const AZ::u32 currentParityBit = 1 << (m_epoch.load() & 1);
+                if ((drainedParities & currentParityBit) == 0)
+                {
+                    m_epoch.fetch_add(1);
+                }
+                return drainedParities;
+            }
+
+            template <typename Readers>
+            static bool HasReaders(Readers& readers, AZ::u32 parity, const SnapshotReaderState* self)
+            {
+                const bool isSelfReading = self && (self->m_reads[0].load() != 0 || self->m_reads[1].load() != 0);
+                for (auto& entry : readers)
+                {
+                    const SnapshotReaderState& reader = entry.second.m_snapshotReader;
+                    if (&reader == self || (isSelfReading && reader.m_isWaiting.load()))
+                    {
+                        continue;
+                    }
+                    if (reader.m_reads[parity].load() != 0)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            AZStd::atomic<Snapshot*> m_current{ nullptr };
+            AZStd::atomic<AZ::u64> m_epoch{ 0 };
+            AZStd::atomic_bool m_isDirty{ true };
+            Snapshot* m_retired = nullptr;
+            AZ::u64 m_retiredSequence = 0;
+            AZ::u64 m_reclaimSequence = 0;
+            AZ::u32 m_drainedParities = 0;
+        };
+
+        // Used in place of EBusSnapshotState on buses that don't use snapshot dispatch.
+        struct EBusNullSnapshotState
+        {
+        };
+
+        // Registers a dispatch with the snapshot state for its lifetime, first publishing a new snapshot if handlers have
+        // connected or disconnected since the last one was published.
+        template <typename Bus>
+        class EBusSnapshotReadScope
+        {
+        public:
+            using Context = typename Bus::Context;
+            using Snapshot = typename Context::SnapshotState::Snapshot;
+
+            explicit EBusSnapshotReadScope(Context& context)
+                : m_context(context)
+                , m_reader(context.GetSnapshotReader())
+            {
+                if (context.m_snapshots.IsDirty())
+                {
+                    context.PublishSnapshot();
+                }
+                m_snapshot = context.m_snapshots.BeginRead(m_reader, m_parity);
+            }
+
+            ~EBusSnapshotReadScope()
+            {
+                m_context.m_snapshots.EndRead(m_reader, m_parity);
+            }
+
+            EBusSnapshotReadScope(const EBusSnapshotReadScope&) = delete;
+            EBusSnapshotReadScope& operator=(const EBusSnapshotReadScope&) = delete;
+
+            const Snapshot& GetSnapshot() const
+            {
+                return *m_snapshot;
+            }
+
+        private:
+            Context& m_context;
+            SnapshotReaderState& m_reader;
+            const Snapshot* m_snapshot = nullptr;
+            AZ::u32 m_parity = 0;
+        };
+
+        // Replaces the Broadcast family of the container's dispatcher with versions that dispatch to a handler snapshot
+        // without locking the context mutex. Enumeration still goes through the locked container.
+        template <typename Bus, typename ImplTraits, bool hasId = ImplTraits::HasId>
+        struct EBusSnapshotDispatcher
+            : public ImplTraits::BusesContainer::template Dispatcher<Bus>
+        {
+            using Interface = typename ImplTraits::InterfaceType;
+            using Traits = typename ImplTraits::Traits;
+            using Snapshot = EBusHandlerSnapshot<Interface, Traits>;
+            using Address = typename Snapshot::Address;
+
+            template <typename Context, typename Callback>
+            static void DispatchAddress(Context& context, const Snapshot& snapshot, const Address& address, bool isReverse, Callback&& callback)
+            {
+                typename Bus::CallstackEntry entry(&context, ImplTraits::HasId ? &address.m_busId : nullptr);
+                for (size_t i = 0, count = address.m_end - address.m_begin; i < count; ++i)
+                {
+                    const size_t index = isReverse ? address.m_end - 1 - i : address.m_begin + i;
+                    if (Interface* handler = snapshot.m_handlers[index].load(AZStd::memory_order_acquire))
+                    {
+                        callback(handler);
+                    }
+                }
+            }
+
+            template <typename Context, typename Callback>
+            static void DispatchAll(Context& context, bool isReverse, Callback&& callback)
+            {
+                EBusSnapshotReadScope<Bus> read(context);
+                const Snapshot& snapshot = read.GetSnapshot();
+                const size_t addressCount = snapshot.m_addresses.size();
+                for (size_t i = 0; i < addressCount; ++i)
+                {
+                    const Address& address = snapshot.m_addresses[isReverse ? addressCount - 1 - i : i];
+                    DispatchAddress(context, snapshot, address, isReverse, callback);
+                }
+            }
+
+            // Broadcast family
+            template <typename Function, typename... ArgsT>
+            static void Broadcast(Function&& func, ArgsT&&... args)
+            {
+                if (auto* context = Bus::GetContext())
+                {
+                    EBUS_DO_ROUTING(*context, nullptr, false, false);
+                    DispatchAll(*context, false, [&](Interface* handler)
+                    {
+                        Traits::EventProcessingPolicy::Call(func, handler, args...);
+                    });
+                }
+            }
+            template <typename Results, typename Function, typename... ArgsT>
+            static void BroadcastResult(Results& results, Function&& func, ArgsT&&... args)
+            {
+                if (auto* context = Bus::GetContext())
+                {
+                    EBUS_DO_ROUTING(*context, nullptr, false, false);
+                    DispatchAll(*context, false, [&](Interface* handler)
+                    {
+                        Traits::EventProcessingPolicy::CallResult(results, func, handler, args...);
+                    });
+                }
+            }
+            template <typename Function, typename... ArgsT>
+            static void BroadcastReverse(Function&& func, ArgsT&&... args)
+            {
+                if (auto* context = Bus::GetContext())
+                {
+                    EBUS_DO_ROUTING(*context, nullptr, false, true);
+                    DispatchAll(*context, true, [&](Interface* handler)
+                    {
+                        Traits::EventProcessingPolicy::Call(func, handler, args...);
+                    });
+                }
+            }
+            template <typename Results, typename Function, typename... ArgsT>
+            static void BroadcastResultReverse(Results& results, Function&& func, ArgsT&&... args)
+            {
+                if (auto* context = Bus::GetContext())
+                {
+                    EBUS_DO_ROUTING(*context, nullptr, false, true);
+                    DispatchAll(*context, true, [&](Interface* handler)
+                    {
+                        Traits::EventProcessingPolicy::CallResult(results, func, handler, args...);
+                    });
+                }
+            }
+        };
+
+        // Adds the Event family for buses with multiple addresses.
+        template <typename Bus, typename ImplTraits>
+        struct EBusSnapshotDispatcher<Bus, ImplTraits, true>
+            : public EBusSnapshotDispatcher<Bus, ImplTraits, false>
+        {
+            using Base = EBusSnapshotDispatcher<Bus, ImplTraits, false>;
+            using Interface = typename Base::Interface;
+            using Traits = typename Base::Traits;
+            using Address = typename Base::Address;
+            using IdType = typename ImplTraits::BusIdType;
+            using BusPtr = typename ImplTraits::BusPtr;
+
+            template <typename Context, typename Callback>
+            static void DispatchId(Context& context, const IdType& id, bool isReverse, Callback&& callback)
+            {
+                EBusSnapshotReadScope<Bus> read(context);
+                if (const Address* address = read.GetSnapshot().FindAddress(id))
+                {
+                    Base::DispatchAddress(context, read.GetSnapshot(), *address, isReverse, callback);
+                }
+            }
+
+            // Event family
+            template <typename Function, typename... ArgsT>
+            static void Event(const IdType& id, Function&& func, ArgsT&&... args)
+            {
+                if (auto* context = Bus::GetContext())
+                {
+                    EBUS_DO_ROUTING(*context, &id, false, false);
+                    DispatchId(*context, id, false, [&](Interface* handler)
+                    {
+                        Traits::EventProcessingPolicy::Call(func, handler, args...);
+                    });
+                }
+            }
+            template <typename Results, typename Function, typename... ArgsT>
+            static void EventResult(Results& results, const IdType& id, Function&& func, ArgsT&&... args)
+            {
+                if (auto* context = Bus::GetContext())
+                {
+                    EBUS_DO_ROUTING(*context, &id, false, false);
+                    DispatchId(*context, id, false, [&](Interface* handler)
+                    {
+                        Traits::EventProcessingPolicy::CallResult(results, func, handler, args...);
+                    });
+                }
+            }
+            template <typename Function, typename... ArgsT>
+            static void EventReverse(const IdType& id, Function&& func, ArgsT&&... args)
+            {
+                if (auto* context = Bus::GetContext())
+                {
+                    EBUS_DO_ROUTING(*context, &id, false, true);
+                    DispatchId(*context, id, true, [&](Interface* handler)
+                    {
+                        Traits::EventProcessingPolicy::Call(func, handler, args...);
+                    });
+                }
+            }
+            template <typename Results, typename Function, typename... ArgsT>
+            static void EventResultReverse(Results& results, const IdType& id, Function&& func, ArgsT&&... args)
+            {
+                if (auto* context = Bus::GetContext())
+                {
+                    EBUS_DO_ROUTING(*context, &id, false, true);
+                    DispatchId(*context, id, true, [&](Interface* handler)
+                    {
+                        Traits::EventProcessingPolicy::CallResult(results, func, handler, args...);
+                    });
+                }
+            }
+            template <typename Function, typename... ArgsT>
+            static void Event(const BusPtr& busPtr, Function&& func, ArgsT&&... args)
+            {
+                if (busPtr)
+                {
+                    auto* context = Bus::GetContext();
+                    EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
+                    EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
+                    DispatchId(*context, busPtr->m_busId, false, [&](Interface* handler)
+                    {
+                        Traits::EventProcessingPolicy::Call(func, handler, args...);
+                    });
+                }
+            }
+            template <typename Results, typename Function, typename... ArgsT>
+            static void EventResult(Results& results, const BusPtr& busPtr, Function&& func, ArgsT&&... args)
+            {
+                if (busPtr)
+                {
+                    auto* context = Bus::GetContext();
+                    EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
+                    EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
+                    DispatchId(*context, busPtr->m_busId, false, [&](Interface* handler)
+                    {
+                        Traits::EventProcessingPolicy::CallResult(results, func, handler, args...);
+                    });
+                }
+            }
+            template <typename Function, typename... ArgsT>
+            static void EventReverse(const BusPtr& busPtr, Function&& func, ArgsT&&... args)
+            {
+                if (busPtr)
+                {
+                    auto* context = Bus::GetContext();
+                    EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
+                    EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
+                    DispatchId(*context, busPtr->m_busId, true, [&](Interface* handler)
+                    {
+                        Traits::EventProcessingPolicy::Call(func, handler, args...);
+                    });
+                }
+            }
+            template <typename Results, typename Function, typename... ArgsT>
+            static void EventResultReverse(Results& results, const BusPtr& busPtr, Function&& func, ArgsT&&... args)
+            {
+                if (busPtr)
+                {
+                    auto* context = Bus::GetContext();
+                    EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
+                    EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
+                    DispatchId(*context, busPtr->m_busId, true, [&](Interface* handler)
+                    {
+                        Traits::EventProcessingPolicy::CallResult(results, func, handler, args...);
+                    });
+                }
+            }
+        };
+    }
+}
@@ -47,7 +47,7 @@ namespace AZ
             }
 
             auto stackEntry = AZStd::make_shared<BlockCache>(
-                cacheSize, blockSize, aznumeric_caster(hardware.m_maxPhysicalSectorSize), false);
+                cacheSize, blockSize, aznumeric_caster(hardware.m_maxPhysicalSectorSize), false, m_replacementPolicy);
             stackEntry->SetNext(AZStd::move(parent));
             return stackEntry;
         }
@@ -62,16 +62,100 @@ namespace AZ
                     ->Value("MemoryAlignment", BlockSize::MemoryAlignment)
                     ->Value("SizeAlignment", BlockSize::SizeAlignment);
 
-                serializeContext->Class<BlockCacheConfig, IStreamerStackConfig>()
+                serializeContext->Enum<ReplacementPolicy>()
                     ->Version(1)
+                    ->Value("Recency", ReplacementPolicy::Recency)
+                    ->Value("FrequencyAware", ReplacementPolicy::FrequencyAware);
+
+                serializeContext->Class<BlockCacheConfig, IStreamerStackConfig>()
+                    ->Version(2)
                     ->Field("CacheSizeMib", &BlockCacheConfig::m_cacheSizeMib)
-                    ->Field("BlockSize", &BlockCacheConfig::m_blockSize);
+                    ->Field("BlockSize", &BlockCacheConfig::m_blockSize)
+                    ->Field("ReplacementPolicy", &BlockCacheConfig::m_replacementPolicy);
             }
         }
 
         static constexpr char CacheHitRateName[] = "Cache hit rate";
         static constexpr char CacheableName[] = "Cacheable";
 
+        static size_t CalculateBlockKey(const RequestPath& filePath, u64 offset)
+        {
+            // Checking the validity resolves the path, which makes sure the hash of the absolute path is available.
+            size_t key = filePath.IsValid() ? filePath.GetHash() : 0;
+            AZStd::hash_combine(key, offset);
+            return key;
+        }
+
+        void BlockCache::FrequencySketch::Initialize(u32 numBlocks)
+        {
+            // Use a row width of at least 8 counters per block to keep the number of collisions low.
+            size_t rowWidth = 64;
+            while (rowWidth < numBlocks * 8)
+            {
+                rowWidth <<= 1;
+            }
+            m_rowMask = rowWidth - 1;
+            m_counters = AZStd::unique_ptr<u8[]>(new u8[s_numRows * rowWidth]);
+            // Age the counters after roughly 10 requests per block so the sketch follows changes in the access pattern.
+            m_sampleSize = AZStd::max(numBlocks * 10, 64u);
+            Reset();
+        }
+
+        void BlockCache::FrequencySketch::Increment(size_t key)
+        {
+            bool incremented = false;
+            for (u32 row = 0; row < s_numRows; ++row)
+            {
+                u8& counter = m_counters[GetCounterIndex(key, row)];
+                if (counter < s_maxCount)
+                {
+                    counter++;
+                    incremented = true;
+                }
+            }
+
+            if (incremented && ++m_numSamples >= m_sampleSize)
+            {
+                Age();
+            }
+        }
+
+        u8 BlockCache::FrequencySketch::Estimate(size_t key) const
+        {
+            u8 result = s_maxCount;
+            for (u32 row = 0; row < s_numRows; ++row)
+            {
+                result = AZStd::min(result, m_counters[GetCounterIndex(key, row)]);
+            }
+            return result;
+        }
+
+        void BlockCache::FrequencySketch::Reset()
+        {
+            ::memset(m_counters.get(), 0, s_numRows * (m_rowMask + 1));
+            m_numSamples = 0;
+        }
+
+        size_t BlockCache::FrequencySketch::GetCounterIndex(size_t key, u32 row) const
+        {
+            // Derive an independent hash for every row by mixing the key with a different odd constant.
+            static constexpr u64 RowSeeds[s_numRows] = { 0xc3a5c85c97cb3127ull, 0xb492b66fbe98f273ull, 0x9ae16a3b2f90404full,
+                0xcbf29ce484222325ull };
+            u64 hash = (aznumeric_cast<u64>(key) + RowSeeds[row]) * RowSeeds[row];
+            hash ^= hash >> 32;
+            return (row * (m_rowMask + 1)) + (aznumeric_cast<size_t>(hash) & m_rowMask);
+        }
+
+        void BlockCache::FrequencySketch::Age()
+        {
+            size_t numCounters = s_numRows * (m_rowMask + 1);
+            for (size_t i = 0; i < numCounters; ++i)
+            {
+                m_counters[i] >>= 1;
+            }
+            m_numSamples /= 2;
+        }
+
         void BlockCache::Section::Prefix(const Section& section)
         {
             AZ_Assert(section.m_used, "Trying to prefix an unused section");
@@ -100,9 +184,11 @@ namespace AZ
             m_blockOffset = 0; // Two merged sections do not support caching.
         }
         
-        BlockCache::BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites)
+        BlockCache::BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites,
+            BlockCacheConfig::ReplacementPolicy replacementPolicy)
             : StreamStackEntry("Block cache")
             , m_alignment(alignment)
+            , m_replacementPolicy(replacementPolicy)
             , m_onlyEpilogWrites(onlyEpilogWrites)
         {
             AZ_Assert(IStreamerTypes::IsPowerOf2(alignment), "Alignment needs to be a power of 2.");
@@ -122,6 +208,21 @@ namespace AZ
             m_cachedOffsets = AZStd::unique_ptr<u64[]>(new u64[m_numBlocks]);
             m_blockLastTouched = AZStd::unique_ptr<TimePoint[]>(new TimePoint[m_numBlocks]);
             m_inFlightRequests = AZStd::unique_ptr<FileRequest*[]>(new FileRequest*[m_numBlocks]);
+            m_blockSegments = AZStd::unique_ptr<BlockSegment[]>(new BlockSegment[m_numBlocks]);
+            for (u32 i = 0; i < m_numBlocks; ++i)
+            {
+                m_blockSegments[i] = BlockSegment::Unassigned;
+            }
+            m_segmentSizes[static_cast<size_t>(BlockSegment::Unassigned)] = m_numBlocks;
+
+            if (m_replacementPolicy == BlockCacheConfig::ReplacementPolicy::FrequencyAware)
+            {
+                // Reserve about 1% of the cache for the window and 80% of the remainder for the protected segment, as suggested
+                // by the W-TinyLFU paper.
+                m_windowCapacity = AZStd::max(m_numBlocks / 100, 1u);
+                m_protectedCapacity = AZStd::max(((m_numBlocks - AZStd::min(m_windowCapacity, m_numBlocks)) * 4) / 5, 1u);
+                m_frequencySketch.Initialize(m_numBlocks);
+            }
             
             ResetCache();
         }
@@ -380,6 +481,13 @@ namespace AZ
             statistics.push_back(Statistic::CreatePercentage(m_name, CacheHitRateName, CalculateHitRatePercentage()));
             statistics.push_back(Statistic::CreatePercentage(m_name, CacheableName, CalculateCacheableRatePercentage()));
             statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateAvailableRequestSlots()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Hits", aznumeric_cast<s64>(m_cacheHits)));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Misses", aznumeric_cast<s64>(m_cacheMisses)));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Evictions", aznumeric_cast<s64>(m_evictions)));
+            if (m_replacementPolicy == BlockCacheConfig::ReplacementPolicy::FrequencyAware)
+            {
+                statistics.push_back(Statistic::CreateInteger(m_name, "Admission rejections", aznumeric_cast<s64>(m_admissionRejections)));
+            }
 
             StreamStackEntry::CollectStatistics(statistics);
         }
@@ -394,6 +502,21 @@ namespace AZ
             return m_cacheableStat.GetAverage();
         }
 
+        u64 BlockCache::GetCacheHitCount() const
+        {
+            return m_cacheHits;
+        }
+
+        u64 BlockCache::GetCacheMissCount() const
+        {
+            return m_cacheMisses;
+        }
+
+        u64 BlockCache::GetEvictionCount() const
+        {
+            return m_evictions;
+        }
+
         s32 BlockCache::CalculateAvailableRequestSlots() const
         {
             return  aznumeric_cast<s32>(m_numBlocks) - m_numInFlightRequests - m_numMetaDataRetrievalInProgress -
@@ -402,6 +525,7 @@ namespace AZ
 
         BlockCache::CacheResult BlockCache::ReadFromCache(FileRequest* request, Section& section, const RequestPath& filePath)
         {
+            RecordAccess(filePath, section.m_readOffset);
             u32 cacheLocation = FindInCache(filePath, section.m_readOffset);
             if (cacheLocation != s_fileNotCached)
             {
@@ -409,12 +533,15 @@ namespace AZ
             }
             else
             {
+                m_cacheMisses++;
                 return CacheResult::CacheMiss;
             }
         }
 
         BlockCache::CacheResult BlockCache::ReadFromCache(FileRequest* request, Section& section, u32 cacheBlock)
         {
+            m_cacheHits++;
+            PromoteBlock(cacheBlock);
             if (!IsCacheBlockInFlight(cacheBlock))
             {
                 TouchBlock(cacheBlock);
@@ -439,9 +566,20 @@ namespace AZ
         {
             AZ_Assert(m_next, "ServiceFromCache in BlockCache was called when the cache doesn't have a way to read files.");
 
+            // Sections that are retried after being delayed already had their access recorded.
+            bool isRetry = section.m_wait != nullptr;
+            if (!isRetry)
+            {
+                RecordAccess(filePath, section.m_readOffset);
+            }
+
             u32 cacheLocation = FindInCache(filePath, section.m_readOffset);
             if (cacheLocation == s_fileNotCached)
             {
+                if (!isRetry)
+                {
+                    m_cacheMisses++;
+                }
                 m_hitRateStat.PushSample(0.0);
                 Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
 
@@ -677,34 +815,139 @@ namespace AZ
             m_blockLastTouched[index] = AZStd::chrono::high_resolution_clock::now();
         }
 
-        u32 BlockCache::RecycleOldestBlock(const RequestPath& filePath, u64 offset)
+        void BlockCache::RecordAccess(const RequestPath& filePath, u64 offset)
         {
-            AZ_Assert((offset & (m_blockSize - 1)) == 0, "The offset used to recycle a block cache needs to be a multiple of the block size.");
+            if (m_replacementPolicy == BlockCacheConfig::ReplacementPolicy::FrequencyAware)
+            {
+                m_frequencySketch.Increment(CalculateBlockKey(filePath, offset));
+            }
+        }
 
-            // Find the oldest cache block.
-            TimePoint oldest = m_blockLastTouched[0];
-            u32 oldestIndex = 0;
-            for (u32 i = 1; i < m_numBlocks; ++i)
+        void BlockCache::PromoteBlock(u32 index)
+        {
+            AZ_Assert(index < m_numBlocks, "Index for promoting a cache entry in the BlockCache is out of bounds.");
+            if (m_replacementPolicy == BlockCacheConfig::ReplacementPolicy::FrequencyAware &&
+                m_blockSegments[index] == BlockSegment::Probation)
             {
-                if (m_blockLastTouched[i] < oldest && !m_inFlightRequests[i])
+                SetBlockSegment(index, BlockSegment::Protected);
+                if (m_segmentSizes[static_cast<size_t>(BlockSegment::Protected)] > m_protectedCapacity)
+                {
+                    // Make room in the protected segment by giving the oldest protected block another chance in probation.
+                    u32 demoted = FindOldestBlock(BlockSegment::Protected);
+                    if (demoted != s_fileNotCached)
+                    {
+                        SetBlockSegment(demoted, BlockSegment::Probation);
+                    }
+                }
+            }
+        }
+
+        void BlockCache::SetBlockSegment(u32 index, BlockSegment segment)
+        {
+            m_segmentSizes[static_cast<size_t>(m_blockSegments[index])]--;
+            m_segmentSizes[static_cast<size_t>(segment)]++;
+            m_blockSegments[index] = segment;
+        }
+
+        u32 BlockCache::FindOldestBlock(BlockSegment segment) const
+        {
+            u32 oldestIndex = s_fileNotCached;
+            for (u32 i = 0; i < m_numBlocks; ++i)
+            {
+                if (m_blockSegments[i] == segment && !m_inFlightRequests[i] &&
+                    (oldestIndex == s_fileNotCached || m_blockLastTouched[i] < m_blockLastTouched[oldestIndex]))
                 {
-                    oldest = m_blockLastTouched[i];
                     oldestIndex = i;
                 }
             }
+            return oldestIndex;
+        }
+
+        u32 BlockCache::FindFrequencyAwareVictim()
+        {
+            u32 windowCandidate = m_segmentSizes[static_cast<size_t>(BlockSegment::Window)] >= m_windowCapacity
+                ? FindOldestBlock(BlockSegment::Window) : s_fileNotCached;
+
+            u32 victim = FindOldestBlock(BlockSegment::Unassigned);
+            if (victim != s_fileNotCached)
+            {
+                // There's still free space in the cache so the block leaving the window can be admitted without competition.
+                if (windowCandidate != s_fileNotCached)
+                {
+                    SetBlockSegment(windowCandidate, BlockSegment::Probation);
+                    TouchBlock(windowCandidate);
+                }
+                return victim;
+            }
 
-            if (!IsCacheBlockInFlight(oldestIndex))
+            victim = FindOldestBlock(BlockSegment::Probation);
+            if (victim == s_fileNotCached)
             {
-                // Recycle the block.
-                m_cachedPaths[oldestIndex] = filePath;
-                m_cachedOffsets[oldestIndex] = offset;
-                TouchBlock(oldestIndex);
-                return oldestIndex;
+                victim = FindOldestBlock(BlockSegment::Protected);
+            }
+
+            if (windowCandidate == s_fileNotCached)
+            {
+                // There's room in the window, so the new block takes the place of the least valuable block in the main segments.
+                return victim != s_fileNotCached ? victim : FindOldestBlock(BlockSegment::Window);
+            }
+            if (victim == s_fileNotCached)
+            {
+                return windowCandidate;
+            }
+
+            // The oldest block in the window has to leave it and competes with the victim from the main segments for a place in
+            // the cache. Only admit it if it's been requested more often, so a long streaming read only cycles through the window.
+            size_t candidateKey = CalculateBlockKey(m_cachedPaths[windowCandidate], m_cachedOffsets[windowCandidate]);
+            size_t victimKey = CalculateBlockKey(m_cachedPaths[victim], m_cachedOffsets[victim]);
+            if (m_frequencySketch.Estimate(candidateKey) > m_frequencySketch.Estimate(victimKey))
+            {
+                SetBlockSegment(windowCandidate, BlockSegment::Probation);
+                TouchBlock(windowCandidate);
+                return victim;
             }
             else
             {
-                return s_fileNotCached;
+                m_admissionRejections++;
+                return windowCandidate;
+            }
+        }
+
+        u32 BlockCache::RecycleOldestBlock(const RequestPath& filePath, u64 offset)
+        {
+            AZ_Assert((offset & (m_blockSize - 1)) == 0, "The offset used to recycle a block cache needs to be a multiple of the block size.");
+
+            u32 index;
+            if (m_replacementPolicy == BlockCacheConfig::ReplacementPolicy::FrequencyAware)
+            {
+                index = FindFrequencyAwareVictim();
+            }
+            else
+            {
+                // Find the oldest cache block. Blocks that aren't in use have the oldest possible time so are picked first.
+                index = s_fileNotCached;
+                for (u32 i = 0; i < m_numBlocks; ++i)
+                {
+                    if (!m_inFlightRequests[i] && (index == s_fileNotCached || m_blockLastTouched[i] < m_blockLastTouched[index]))
+                    {
+                        index = i;
+                    }
+                }
+            }
+
+            if (index != s_fileNotCached)
+            {
+                if (m_blockSegments[index] != BlockSegment::Unassigned)
+                {
+                    m_evictions++;
+                }
+                // Recycle the block.
+                m_cachedPaths[index] = filePath;
+                m_cachedOffsets[index] = offset;
+                SetBlockSegment(index, BlockSegment::Window);
+                TouchBlock(index);
             }
+            return index;
         }
 
         u32 BlockCache::FindInCache(const RequestPath& filePath, u64 offset) const
@@ -735,6 +978,7 @@ namespace AZ
             m_cachedOffsets[index] = 0;
             m_blockLastTouched[index] = TimePoint::min();
             m_inFlightRequests[index] = nullptr;
+            SetBlockSegment(index, BlockSegment::Unassigned);
         }
 
         void BlockCache::ResetCache()
@@ -46,17 +46,30 @@ namespace AZ
                 SizeAlignment = MemoryAlignment - 1 //!< The minimal read size required by the storage device.
             };
 
+            //! The policy used to decide which cache block to recycle when a new block needs to be cached.
+            enum class ReplacementPolicy : u8
+            {
+                //! Recycles the least recently used block. Cheap, but a single large streaming read can push out small hot blocks.
+                Recency,
+                //! Scan-resistant policy based on W-TinyLFU. New blocks enter a small recency window and are only admitted to the
+                //! main part of the cache if they've been requested more often than the block they would replace.
+                FrequencyAware
+            };
+
             //! The overall size of the cache in megabytes.
             u32 m_cacheSizeMib{ 8 };
             //! The size of the individual blocks inside the cache.
             BlockSize m_blockSize{ BlockSize::MemoryAlignment };
+            //! The policy used to pick the cache block to recycle.
+            ReplacementPolicy m_replacementPolicy{ ReplacementPolicy::Recency };
         };
 
         class BlockCache
             : public StreamStackEntry
         {
         public:
-            BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites);
+            BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites,
+                BlockCacheConfig::ReplacementPolicy replacementPolicy = BlockCacheConfig::ReplacementPolicy::Recency);
             BlockCache(BlockCache&& rhs) = delete;
             BlockCache(const BlockCache& rhs) = delete;
             ~BlockCache() override;
@@ -82,9 +95,46 @@ namespace AZ
             double CalculateCacheableRatePercentage() const;
             s32 CalculateAvailableRequestSlots() const;
 
+            u64 GetCacheHitCount() const;
+            u64 GetCacheMissCount() const;
+            u64 GetEvictionCount() const;
+
         protected:
             static constexpr u32 s_fileNotCached = static_cast<u32>(-1);
 
+            //! The segment of the cache a block belongs to when using the frequency aware replacement policy.
+            enum class BlockSegment : u8
+            {
+                Unassigned, //!< The block doesn't hold any data.
+                Window, //!< Recently added block that hasn't been admitted to the main part of the cache yet.
+                Probation, //!< Block in the main part of the cache that hasn't been requested since it was admitted.
+                Protected, //!< Block in the main part of the cache that has been requested at least once since it was admitted.
+                Count
+            };
+
+            //! Count-min sketch that approximates how often a cache block has been requested. Counters are halved periodically
+            //! so blocks that were popular a long time ago don't stay in the cache forever.
+            class FrequencySketch
+            {
+            public:
+                void Initialize(u32 numBlocks);
+                void Increment(size_t key);
+                u8 Estimate(size_t key) const;
+                void Reset();
+
+            private:
+                static constexpr u32 s_numRows = 4;
+                static constexpr u8 s_maxCount = 15;
+
+                size_t GetCounterIndex(size_t key, u32 row) const;
+                void Age();
+
+                AZStd::unique_ptr<u8[]> m_counters; // Array of s_numRows * (m_rowMask + 1) size.
+                size_t m_rowMask{ 0 };
+                u32 m_numSamples{ 0 };
+                u32 m_sampleSize{ 0 };
+            };
+
             enum class CacheResult
             {
                 ReadFromCache, //!< Data was found in the cache and reused.
@@ -122,6 +172,11 @@ namespace AZ
 
             u8* GetCacheBlockData(u32 index);
             void TouchBlock(u32 index);
+            void RecordAccess(const RequestPath& filePath, u64 offset);
+            void PromoteBlock(u32 index);
+            void SetBlockSegment(u32 index, BlockSegment segment);
+            u32 FindOldestBlock(BlockSegment segment) const;
+            u32 FindFrequencyAwareVictim();
             AZ::u32 RecycleOldestBlock(const RequestPath& filePath, u64 offset);
             u32 FindInCache(const RequestPath& filePath, u64 offset) const;
             bool IsCacheBlockInFlight(u32 index) const;
@@ -135,6 +190,10 @@ namespace AZ
 
             AZ::Statistics::RunningStatistic m_hitRateStat;
             AZ::Statistics::RunningStatistic m_cacheableStat;
+            u64 m_cacheHits{ 0 };
+            u64 m_cacheMisses{ 0 };
+            u64 m_evictions{ 0 };
+            u64 m_admissionRejections{ 0 };
 
             u8* m_cache;
             u64 m_cacheSize;
@@ -150,6 +209,16 @@ namespace AZ
             AZStd::unique_ptr<TimePoint[]> m_blockLastTouched; // Array of m_numBlocks size.
             //! The file request that's currently read data into the cache block. If null, the block has been read.
             AZStd::unique_ptr<FileRequest*[]> m_inFlightRequests; // Array of m_numbBlocks size.
+            //! The segment the cache block belongs to. Only used by the frequency aware replacement policy.
+            AZStd::unique_ptr<BlockSegment[]> m_blockSegments; // Array of m_numBlocks size.
+            //! The number of blocks in each of the segments.
+            u32 m_segmentSizes[static_cast<size_t>(BlockSegment::Count)]{};
+            //! The maximum number of blocks in the window segment before the oldest block has to compete for a place in the main segments.
+            u32 m_windowCapacity{ 1 };
+            //! The maximum number of blocks in the protected segment before the oldest block is moved back to probation.
+            u32 m_protectedCapacity{ 1 };
+            FrequencySketch m_frequencySketch;
+            BlockCacheConfig::ReplacementPolicy m_replacementPolicy;
             
             //! The number of requests waiting for meta data to be retrieved.
             s32 m_numMetaDataRetrievalInProgress{ 0 };
@@ -159,4 +228,5 @@ namespace AZ
     } // namespace IO
 
     AZ_TYPE_INFO_SPECIALIZE(AZ::IO::BlockCacheConfig::BlockSize, "{5D4D597D-4605-462D-A27D-8046115C5381}");
+    AZ_TYPE_INFO_SPECIALIZE(AZ::IO::BlockCacheConfig::ReplacementPolicy, "{C4E2F6A1-7B3D-4E58-9A0C-2D6F8B1E3A47}");
 } // namespace AZ
@@ -13,6 +13,7 @@
 
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/exponential_backoff.h>
 #include <AzCore/std/functional.h>
 
 #include <AzCore/Debug/Profiler.h>
@@ -29,55 +30,173 @@ bool CompareJobPriorities(AZ::s8 value, const Job* job)
     return value > job->GetPriority();
 }
 
+WorkQueue::JobArray::JobArray(AZ::s64 capacity)
+    : m_mask(capacity - 1)
+{
+    AZ_Assert((capacity & m_mask) == 0, "Job array capacity must be a power of two");
+    m_jobs = reinterpret_cast<AZStd::atomic<Job*>*>(azmalloc(sizeof(AZStd::atomic<Job*>) * capacity, alignof(AZStd::atomic<Job*>), AZ::SystemAllocator));
+    for (AZ::s64 i = 0; i < capacity; ++i)
+    {
+        new (&m_jobs[i]) AZStd::atomic<Job*>(nullptr);
+    }
+}
+
+WorkQueue::JobArray::~JobArray()
+{
+    azfree(m_jobs, AZ::SystemAllocator);
+}
+
+WorkQueue::JobArray* WorkQueue::JobArray::Grow(AZ::s64 top, AZ::s64 bottom) const
+{
+    JobArray* newArray = aznew JobArray(GetCapacity() * 2);
+    for (AZ::s64 i = top; i < bottom; ++i)
+    {
+        newArray->Put(i, Get(i));
+    }
+    return newArray;
+}
+
+WorkQueue::WorkQueue()
+{
+    m_array.store(aznew JobArray(InitialCapacity), AZStd::memory_order_relaxed);
+}
+
+WorkQueue::~WorkQueue()
+{
+    delete m_array.load(AZStd::memory_order_relaxed);
+    for (JobArray* retiredArray : m_retiredArrays)
+    {
+        delete retiredArray;
+    }
+}
+
 void WorkQueue::LocalInsert(Job* job)
 {
-    LockGuard lock(m_lock);
-    const AZStd::deque<Job*>::const_iterator locationToinsert = AZStd::upper_bound(m_queue.begin(),
-                                                                                   m_queue.end(),
-                                                                                   job->GetPriority(),
-                                                                                   CompareJobPriorities);
-    m_queue.insert(locationToinsert, job);
+    if (job->GetPriority() != 0)
+    {
+        LockGuard lock(m_prioritizedLock);
+        const AZStd::deque<Job*>::const_iterator locationToinsert = AZStd::upper_bound(m_prioritizedJobs.begin(),
+                                                                                       m_prioritizedJobs.end(),
+                                                                                       job->GetPriority(),
+                                                                                       CompareJobPriorities);
+        m_prioritizedJobs.insert(locationToinsert, job);
+        m_numPrioritizedJobs.fetch_add(1, AZStd::memory_order_release);
+        return;
+    }
+
+    const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_relaxed);
+    const AZ::s64 top = m_top.load(AZStd::memory_order_acquire);
+    JobArray* array = m_array.load(AZStd::memory_order_relaxed);
+    if (bottom - top > array->GetCapacity() - 1)
+    {
+        JobArray* grownArray = array->Grow(top, bottom);
+        m_retiredArrays.push_back(array);
+        m_array.store(grownArray, AZStd::memory_order_release);
+        array = grownArray;
+    }
+    array->Put(bottom, job);
+    AZStd::atomic_thread_fence(AZStd::memory_order_release);
+    m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
 }
 
-Job* WorkQueue::LocalPopFront()
+Job* WorkQueue::LocalPop()
 {
-    LockGuard lock(m_lock);
+    // jobs with a raised priority run before the jobs in the deque, lowered priority jobs only once the deque is empty
+    Job* result = PopPrioritized(PrioritizedJobs::HigherPriority, false);
+    if (result)
+    {
+        return result;
+    }
 
-    Job* result = nullptr;
-    if (!m_queue.empty())
+    const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_relaxed) - 1;
+    JobArray* array = m_array.load(AZStd::memory_order_relaxed);
+    m_bottom.store(bottom, AZStd::memory_order_relaxed);
+    AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+    AZ::s64 top = m_top.load(AZStd::memory_order_relaxed);
+    if (top <= bottom)
     {
-        result = m_queue.front();
-        m_queue.pop_front();
+        result = array->Get(bottom);
+        if (top == bottom)
+        {
+            // last job in the deque, race the stealing threads for it
+            if (!m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+            {
+                result = nullptr;
+            }
+            m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+        }
+    }
+    else
+    {
+        m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
     }
 
+    if (!result)
+    {
+        result = PopPrioritized(PrioritizedJobs::AnyPriority, false);
+    }
     return result;
 }
 
-Job* WorkQueue::TryStealFront()
+Job* WorkQueue::TrySteal()
 {
     AZStd::exponential_backoff backoff;
     for (unsigned attempCount = 0; attempCount < TryStealSpinAttemps; ++attempCount)
     {
-        // Do a bounded spin with backoff to acquire the lock
-        if (m_lock.try_lock())
+        AZ::s64 top = m_top.load(AZStd::memory_order_acquire);
+        AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+        const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_acquire);
+        if (top >= bottom)
         {
-            Job* result = nullptr;
-            if (!m_queue.empty())
-            {
-                result = m_queue.front();
-                m_queue.pop_front();
-            }
+            // the deque is empty, fall back to the prioritized jobs without waiting on the owner
+            return PopPrioritized(PrioritizedJobs::AnyPriority, true);
+        }
 
-            m_lock.unlock();
+        JobArray* array = m_array.load(AZStd::memory_order_acquire);
+        Job* result = array->Get(top);
+        if (m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+        {
             return result;
         }
 
+        // lost the race against the owner or another thief, back off and retry
         backoff.wait();
     }
 
     return nullptr;
 }
 
+Job* WorkQueue::PopPrioritized(PrioritizedJobs which, bool tryLock)
+{
+    if (m_numPrioritizedJobs.load(AZStd::memory_order_acquire) == 0)
+    {
+        return nullptr;
+    }
+
+    if (tryLock)
+    {
+        if (!m_prioritizedLock.try_lock())
+        {
+            return nullptr;
+        }
+    }
+    else
+    {
+        m_prioritizedLock.lock();
+    }
+
+    Job* result = nullptr;
+    if (!m_prioritizedJobs.empty() && (which == PrioritizedJobs::AnyPriority || m_prioritizedJobs.front()->GetPriority() > 0))
+    {
+        result = m_prioritizedJobs.front();
+        m_prioritizedJobs.pop_front();
+        m_numPrioritizedJobs.fetch_sub(1, AZStd::memory_order_relaxed);
+    }
+
+    m_prioritizedLock.unlock();
+    return result;
+}
+
 
 AZ_THREAD_LOCAL JobManagerWorkStealing::ThreadInfo* JobManagerWorkStealing::m_currentThreadInfo = nullptr;
 
@@ -163,6 +282,7 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
                                                                                        job->GetPriority(),
                                                                                        CompareJobPriorities);
             m_globalJobQueue.insert(locationToinsert, job);
+            m_globalJobQueueSize.fetch_add(1, AZStd::memory_order_release);
 
             //checking/changing global queue empty state or worker availability must be done atomically while holding the global queue lock
             ActivateWorker();
@@ -176,6 +296,7 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
                                                                                            job->GetPriority(),
                                                                                            CompareJobPriorities);
                 m_globalJobQueue.insert(locationToinsert, job);
+                m_globalJobQueueSize.fetch_add(1, AZStd::memory_order_release);
             }
 
             //no workers, so must process the jobs right now
@@ -327,7 +448,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
 
     //get thread local job queue
     WorkQueue* pendingJobs = info->m_isWorker ? &info->m_pendingJobs : nullptr;
-    unsigned int victim = ((m_workerThreads.size() > 1) && (m_workerThreads[0] == info)) ? 1 : 0;
+    const unsigned int numWorkers = static_cast<unsigned int>(m_workerThreads.size());
 
     while (true)
     {
@@ -387,23 +508,19 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 return;
             }
 
-            {
-                AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-                if (!m_globalJobQueue.empty())
-                {
-                    job = m_globalJobQueue.front();
-                    m_globalJobQueue.pop_front();
+            job = PopGlobalJob();
 #ifdef JOBMANAGER_ENABLE_STATS
-                    ++info->m_globalJobs;
-#endif
-                }
+            if (job)
+            {
+                ++info->m_globalJobs;
             }
+#endif
         }
 
         if (!job && pendingJobs)
         {
             //nothing on the global queue, try to pop from the local queue
-            job = pendingJobs->LocalPopFront();
+            job = pendingJobs->LocalPop();
         }
 
         bool isTerminated = false;
@@ -433,7 +550,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 //pop a new job from the local queue
                 if (pendingJobs)
                 {
-                    job = pendingJobs->LocalPopFront();
+                    job = pendingJobs->LocalPop();
                     if (job)
                     {
                         // not necessary, just an optimization - wakeup sleeping threads, there's work to be done
@@ -460,7 +577,8 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "JobManagerWorkStealing::ProcessJobsInternal:WorkStealing");
 
                 unsigned int numStealAttempts = 0;
-                const unsigned int maxStealAttempts = (unsigned int)m_workerThreads.size() * 3; //try every thread a few times before giving up
+                const unsigned int maxStealAttempts = numWorkers * 3; //try every thread a few times before giving up
+                AZStd::exponential_backoff backoff;
                 while (!job)
                 {
                     //check if our suspended job is ready, before we try stealing a new job
@@ -470,11 +588,16 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                         return;
                     }
 
-                    //select a victim thread, using the same victim as the previous successful steal if possible
-                    WorkQueue* victimQueue = &m_workerThreads[victim]->m_pendingJobs;
+                    //select a random victim thread, so idle threads don't all hammer the same queue
+                    unsigned int victim = info->m_victimRandom.GetRandom() % numWorkers;
+                    if (m_workerThreads[victim] == info)
+                    {
+                        //don't steal from ourselves
+                        victim = (victim + 1) % numWorkers;
+                    }
 
                     //attempt the steal
-                    job = victimQueue->TryStealFront();
+                    job = m_workerThreads[victim]->m_pendingJobs.TrySteal();
                     if (job)
                     {
                         //success, continue with the stolen job
@@ -485,26 +608,34 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     }
 
                     ++numStealAttempts;
-                    if (numStealAttempts > maxStealAttempts)
+                    if (numStealAttempts % numWorkers == 0)
                     {
-                        //Time to give up, it's likely all the local queues are empty. Note that this does not mean all the jobs
-                        // are done, some jobs may be in progress, or we may have had terrible luck with our steals. There may be
-                        // more jobs coming, another worker could create many new jobs right now. But the only way this thread
-                        // will get a new job is from the global queue or by a steal, so we're going to sleep until a new job is
-                        // queued.
-                        // The important thing to note is that all jobs will be processed, even if this thread goes to sleep while
-                        // jobs are pending.
-
-                        isTerminated = true;
-                        break;
-                    }
-
-                    //steal failed, choose a new victim for next time
-                    victim = (victim + 1) % m_workerThreads.size();
-                    if (m_workerThreads[victim] == info)
-                    {
-                        //don't steal from ourselves
-                        victim = (victim + 1) % m_workerThreads.size();
+                        //a round of steals failed, jobs may have been queued from a non-worker thread in the meantime
+                        job = PopGlobalJob();
+                        if (job)
+                        {
+#ifdef JOBMANAGER_ENABLE_STATS
+                            ++info->m_globalJobs;
+#endif
+                            break;
+                        }
+
+                        if (numStealAttempts > maxStealAttempts)
+                        {
+                            //Time to give up, it's likely all the local queues are empty. Note that this does not mean all the jobs
+                            // are done, some jobs may be in progress, or we may have had terrible luck with our steals. There may be
+                            // more jobs coming, another worker could create many new jobs right now. But the only way this thread
+                            // will get a new job is from the global queue or by a steal, so we're going to sleep until a new job is
+                            // queued.
+                            // The important thing to note is that all jobs will be processed, even if this thread goes to sleep while
+                            // jobs are pending.
+
+                            isTerminated = true;
+                            break;
+                        }
+
+                        //back off before the next round, spinning first and yielding once the wait gets long
+                        backoff.wait();
                     }
                 }
             }
@@ -526,6 +657,7 @@ void JobManagerWorkStealing::ProcessJobsSynchronous(ThreadInfo* info, Job* suspe
     {
         Job* job = m_globalJobQueue.front();
         m_globalJobQueue.pop_front();
+        m_globalJobQueueSize.fetch_sub(1, AZStd::memory_order_relaxed);
 
         info->m_currentJob = job;
         Process(job);
@@ -633,6 +765,7 @@ JobManagerWorkStealing::ThreadList JobManagerWorkStealing::CreateWorkerThreads(c
         info->m_isWorker = true;
         info->m_owningManager = this;
         info->m_workerId = iThread;
+        info->m_victimRandom.SetSeed(iThread + 1);
 
         AZStd::thread_desc threadDesc;
         threadDesc.m_name = "AZ JobManager worker thread";
@@ -660,6 +793,26 @@ JobManagerWorkStealing::ThreadList JobManagerWorkStealing::CreateWorkerThreads(c
     return workerThreads;
 }
 
+Job* JobManagerWorkStealing::PopGlobalJob()
+{
+    //avoid contending on the global queue lock while there is nothing to pop
+    if (m_globalJobQueueSize.load(AZStd::memory_order_acquire) == 0)
+    {
+        return nullptr;
+    }
+
+    AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
+    if (m_globalJobQueue.empty())
+    {
+        return nullptr;
+    }
+
+    Job* job = m_globalJobQueue.front();
+    m_globalJobQueue.pop_front();
+    m_globalJobQueueSize.fetch_sub(1, AZStd::memory_order_relaxed);
+    return job;
+}
+
 inline void JobManagerWorkStealing::ActivateWorker()
 {
     // find an available worker thread (we do it brute force because the number of threads is small)
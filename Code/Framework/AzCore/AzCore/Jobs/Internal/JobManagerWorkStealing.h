@@ -12,10 +12,11 @@
 
 #include <AzCore/Jobs/Internal/JobManagerBase.h>
 #include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/Math/Random.h>
 #include <AzCore/Memory/PoolAllocator.h>
 
 #include <AzCore/std/containers/queue.h>
-#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/semaphore.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
@@ -27,23 +28,77 @@ namespace AZ
 
     namespace Internal
     {
+        /**
+         * Job queue of a single worker thread, a Chase-Lev work stealing deque ("Dynamic Circular Work-Stealing Deque",
+         * Chase and Lev 2005, with the memory orderings from Le et al. 2013). The owning worker pushes and pops jobs at the
+         * bottom without locking, while other threads steal the oldest job from the top with a single CAS.
+         * Jobs with a non-default priority need to be sorted, which the deque can't do, so they are kept in a separate sorted
+         * queue behind a lock. That queue is only locked when it holds jobs.
+         */
         class WorkQueue final
         {
         public:
-            void LocalInsert(Job *job);
-            Job* LocalPopFront();
-            Job* TryStealFront();
+            WorkQueue();
+            ~WorkQueue();
+
+            //! Can only be called by the thread that owns the queue.
+            //! @{
+            void LocalInsert(Job* job);
+            Job* LocalPop();
+            //! @}
+
+            //! Can be called by any thread.
+            Job* TrySteal();
 
         private:
             enum
             {
                 TryStealSpinAttemps = 16,
+                InitialCapacity = 256,
             };
-            using LockType = AZStd::shared_mutex;
+            using LockType = AZStd::mutex;
             using LockGuard = AZStd::lock_guard<LockType>;
 
-            AZStd::deque<Job*> m_queue;
-            LockType m_lock;
+            //! Ring buffer holding the jobs of the deque, the capacity is always a power of two
+            class JobArray
+            {
+            public:
+                AZ_CLASS_ALLOCATOR(JobArray, ThreadPoolAllocator, 0)
+
+                explicit JobArray(AZ::s64 capacity);
+                ~JobArray();
+
+                AZ::s64 GetCapacity() const { return m_mask + 1; }
+                Job* Get(AZ::s64 index) const { return m_jobs[index & m_mask].load(AZStd::memory_order_relaxed); }
+                void Put(AZ::s64 index, Job* job) { m_jobs[index & m_mask].store(job, AZStd::memory_order_relaxed); }
+
+                //! Creates an array with double the capacity that holds the jobs in [top, bottom)
+                JobArray* Grow(AZ::s64 top, AZ::s64 bottom) const;
+
+            private:
+                AZ_DISABLE_COPY_MOVE(JobArray);
+
+                AZ::s64 m_mask;
+                AZStd::atomic<Job*>* m_jobs;
+            };
+
+            enum class PrioritizedJobs
+            {
+                HigherPriority, // only return a job with a priority above the default
+                AnyPriority,
+            };
+            Job* PopPrioritized(PrioritizedJobs which, bool tryLock);
+
+            // top is written by the stealing threads and bottom by the owner, the padding keeps them on separate cache lines
+            AZStd::atomic<AZ::s64> m_top{ 0 };
+            char m_topPadding[64];
+            AZStd::atomic<AZ::s64> m_bottom{ 0 };
+            AZStd::atomic<JobArray*> m_array{ nullptr };
+            AZStd::vector<JobArray*> m_retiredArrays; // steals can still be reading from arrays that have been grown, so they're kept until the queue is destroyed
+
+            AZStd::atomic<AZ::u32> m_numPrioritizedJobs{ 0 };
+            AZStd::deque<Job*> m_prioritizedJobs;
+            LockType m_prioritizedLock;
         };
 
         /**
@@ -83,6 +138,7 @@ namespace AZ
         private:
 
             void ActivateWorker();
+            Job* PopGlobalJob();
 
             struct ThreadInfo
             {
@@ -98,6 +154,7 @@ namespace AZ
                 AZStd::atomic_bool m_isAvailable{false};
                 AZStd::binary_semaphore m_waitEvent;
                 WorkQueue m_pendingJobs;
+                SimpleLcgRandom m_victimRandom; // picks the worker to steal from
                 unsigned int m_workerId = JobManagerBase::InvalidWorkerThreadId;
 
 #ifdef JOBMANAGER_ENABLE_STATS
@@ -136,6 +193,7 @@ namespace AZ
 
             GlobalJobQueue              m_globalJobQueue;
             GlobalQueueMutexType        m_globalJobQueueMutex;
+            AZStd::atomic_uint          m_globalJobQueueSize{0}; // lets workers skip the global queue lock while the queue is empty
 
             volatile bool               m_quitRequested = false;
             AZStd::atomic_uint          m_numAvailableWorkers{0};
@@ -111,11 +111,12 @@ namespace AZ
 
         struct AllocatorStats
         {
-            AllocatorStats(const char* name, const char* aliasOrDescription, size_t allocatedBytes, size_t capacityBytes, bool isAlias)
+            AllocatorStats(const char* name, const char* aliasOrDescription, size_t allocatedBytes, size_t capacityBytes, bool isAlias, size_t threadCachedBytes = 0)
                 : m_name(name)
                 , m_aliasOrDescription(aliasOrDescription)
                 , m_allocatedBytes(allocatedBytes)
                 , m_capacityBytes(capacityBytes)
+                , m_threadCachedBytes(threadCachedBytes)
                 , m_isAlias(isAlias)
             {}
 
@@ -123,6 +124,7 @@ namespace AZ
             AZStd::string m_aliasOrDescription;
             size_t m_allocatedBytes;
             size_t m_capacityBytes;
+            size_t m_threadCachedBytes; ///< Part of the capacity held in per thread caches.
             bool   m_isAlias;
         };
 
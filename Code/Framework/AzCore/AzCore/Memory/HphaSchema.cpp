@@ -11,6 +11,7 @@
 
 #include <AzCore/Math/Random.h>
 #include <AzCore/Memory/OSAllocator.h> // required by certain platforms
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/containers/intrusive_set.h>
@@ -468,6 +469,60 @@ namespace AZ {
         size_t bucket_get_unused_memory(bool isPrint) const;
         void bucket_purge();
 
+#ifdef MULTITHREADED
+        // per thread cache of small allocations. Every thread keeps a free list per bucket which is refilled from and
+        // flushed to the bucket in batches, so most small allocations and frees don't need to take the bucket lock.
+        // The caches are allocated from the OS, so they can outlive the HpAllocator they belong to.
+        struct thread_cache
+            : public intrusive_list<thread_cache>::node
+        {
+            struct cached_bucket
+            {
+                free_link*  mHead = nullptr;
+                unsigned    mCount = 0;
+            };
+            // reset when the HpAllocator is destroyed before the thread exits, the cache can then be reused by the thread
+            AZStd::atomic<HpAllocator*> mAllocator{ nullptr };
+            // only used by the owning thread, to limit the size of its cache
+            size_t mCachedSize = 0;
+            cached_bucket mBuckets[NUM_BUCKETS];
+        };
+        typedef intrusive_list<thread_cache> thread_cache_list;
+        struct thread_cache_slots;
+        struct thread_cache_slots_releaser;
+
+        // max number of HpAllocators a thread can keep a cache for, allocations from other HpAllocators go to the buckets
+        static const unsigned MAX_THREAD_CACHES = 4;
+        // number of bytes moved between a thread cache and a bucket at once, clamped to the min and max batch elements
+        static const size_t THREAD_CACHE_BATCH_SIZE = 1024;
+        static const unsigned THREAD_CACHE_MIN_BATCH = 4;
+        static const unsigned THREAD_CACHE_MAX_BATCH = 32;
+
+        static inline unsigned thread_cache_batch(unsigned bi)
+        {
+            return (unsigned)AZStd::GetMin<size_t>(AZStd::GetMax<size_t>(THREAD_CACHE_BATCH_SIZE / bucket_spacing_function_inverse(bi), THREAD_CACHE_MIN_BATCH), THREAD_CACHE_MAX_BATCH);
+        }
+        // guards the thread cache lists of all HpAllocators and the detaching of the caches
+        static AZStd::mutex& thread_cache_mutex();
+        static void thread_cache_release(thread_cache* cache);
+
+        thread_cache* get_thread_cache();
+        thread_cache* thread_cache_create(thread_cache*& slot, thread_cache_slots& slots);
+        void* thread_cache_alloc(thread_cache* cache, unsigned bi);
+        void thread_cache_free(thread_cache* cache, void* ptr, unsigned bi);
+        bool thread_cache_refill(thread_cache* cache, unsigned bi);
+        void thread_cache_flush(thread_cache* cache, unsigned bi, unsigned count);
+        void thread_cache_flush_all(thread_cache* cache);
+
+        thread_cache_list mThreadCaches;
+        // the bytes held in all the thread caches, kept up to date on every cached allocation and free so the statistics
+        // don't need to visit the caches, which would take the thread cache mutex
+        AZStd::atomic<size_t> mThreadCachedSize{ 0 };
+        AZStd::atomic<unsigned> mNumThreadCaches{ 0 };
+        AZStd::atomic<size_t> mThreadCacheRefills{ 0 };
+        AZStd::atomic<size_t> mThreadCacheFlushes{ 0 };
+#endif
+
         // locate the page information from a pointer
         inline page* ptr_get_page(void* ptr) const
         {
@@ -1047,6 +1102,10 @@ namespace AZ {
         // in all cases memory is never automatically returned to the OS
         void purge()
         {
+#ifdef MULTITHREADED
+            // Only the calling thread's cache can be returned, the other threads keep using theirs
+            thread_cache_flush_current();
+#endif
             // Purge buckets first since they use tree pages
             bucket_purge();
             tree_purge();
@@ -1063,9 +1122,26 @@ namespace AZ {
         // return the total number of allocated memory
         inline  size_t allocated() const
         {
+#ifdef MULTITHREADED
+            if (m_isThreadCacheEnabled)
+            {
+                // the cached bytes are only read once, blocks moving between the caches and the buckets can make it
+                // briefly larger than the bucket total
+                const size_t allocatedSize = mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree;
+                const size_t cachedSize = mThreadCachedSize.load(AZStd::memory_order_relaxed);
+                return allocatedSize > cachedSize ? allocatedSize - cachedSize : 0;
+            }
+#endif
             return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree;
         }
 
+#ifdef MULTITHREADED
+        // return all the blocks in the calling thread's cache to the buckets
+        void thread_cache_flush_current();
+
+        void thread_cache_stats(HphaSchema::ThreadCacheStats& stats) const;
+#endif
+
         /// returns allocation size for the pointer if it belongs to the allocator. result is undefined if the pointer doesn't belong to the allocator.
         size_t  AllocationSize(void* ptr);
         size_t  GetMaxAllocationSize() const;
@@ -1080,6 +1156,8 @@ namespace AZ {
         const size_t m_treePageAlignment;
         const size_t m_poolPageSize;
         bool         m_isPoolAllocations;
+        bool         m_isThreadCacheEnabled;
+        const size_t m_threadCacheSize;
         IAllocatorAllocate* m_subAllocator;
 
 #if !defined (USE_MUTEX_PER_BUCKET)
@@ -1138,6 +1216,7 @@ namespace AZ {
             desc.m_systemChunkSize != 0 ? desc.m_systemChunkSize : OS_VIRTUAL_PAGE_SIZE)
         , m_treePageAlignment(desc.m_pageSize)
         , m_poolPageSize(desc.m_fixedMemoryBlock != NULL ? desc.m_poolPageSize : OS_VIRTUAL_PAGE_SIZE)
+        , m_threadCacheSize(desc.m_threadCacheSize)
         , m_subAllocator(desc.m_subAllocator)
     {
 #ifdef DEBUG_ALLOCATOR
@@ -1150,6 +1229,11 @@ namespace AZ {
         m_fixedBlock = desc.m_fixedMemoryBlock;
         m_fixedBlockSize = desc.m_fixedMemoryBlockByteSize;
         m_isPoolAllocations = desc.m_isPoolAllocations;
+#ifdef MULTITHREADED
+        m_isThreadCacheEnabled = desc.m_isThreadCacheEnabled && desc.m_isPoolAllocations;
+#else
+        m_isThreadCacheEnabled = false;
+#endif
         if (desc.m_fixedMemoryBlock)
         {
             block_header* bl = tree_add_block(m_fixedBlock, m_fixedBlockSize);
@@ -1175,12 +1259,27 @@ namespace AZ {
 
     HpAllocator::~HpAllocator()
     {
+#ifdef MULTITHREADED
+        // Take back the blocks cached by the threads, the threads free their detached caches when they exit
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+            while (!mThreadCaches.empty())
+            {
+                thread_cache* cache = &mThreadCaches.front();
+                thread_cache_flush_all(cache);
+                mThreadCaches.pop_front();
+                mNumThreadCaches.fetch_sub(1, AZStd::memory_order_relaxed);
+                cache->mAllocator.store(nullptr, AZStd::memory_order_release);
+            }
+        }
+#endif
+
 #ifdef DEBUG_ALLOCATOR
         // Check if there are not-freed allocations
         report();
         check();
 #endif
-        
+
         purge();
 
 #ifdef DEBUG_ALLOCATOR 
@@ -1344,6 +1443,10 @@ namespace AZ {
         unsigned bi = bucket_spacing_function(size);
         HPPA_ASSERT(bi < NUM_BUCKETS);
 #ifdef MULTITHREADED
+        if (thread_cache* cache = get_thread_cache())
+        {
+            return thread_cache_alloc(cache, bi);
+        }
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
     #else
@@ -1372,6 +1475,10 @@ namespace AZ {
     {
         HPPA_ASSERT(bi < NUM_BUCKETS);
 #ifdef MULTITHREADED
+        if (thread_cache* cache = get_thread_cache())
+        {
+            return thread_cache_alloc(cache, bi);
+        }
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
     #else
@@ -1439,6 +1546,10 @@ namespace AZ {
         unsigned bi = p->bucket_index();
         HPPA_ASSERT(bi < NUM_BUCKETS);
 #ifdef MULTITHREADED
+        if (thread_cache* cache = get_thread_cache())
+        {
+            return thread_cache_free(cache, ptr, bi);
+        }
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
     #else
@@ -1457,6 +1568,10 @@ namespace AZ {
         // most likely a class needs a base virtual destructor
         HPPA_ASSERT(bi == p->bucket_index());
 #ifdef MULTITHREADED
+        if (thread_cache* cache = get_thread_cache())
+        {
+            return thread_cache_free(cache, ptr, bi);
+        }
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
     #else
@@ -1467,6 +1582,261 @@ namespace AZ {
         mBuckets[bi].free(p, ptr);
     }
 
+#ifdef MULTITHREADED
+    // trivially destructible, so it stays usable while the other thread_locals of an exiting thread are destroyed and free memory
+    struct HpAllocator::thread_cache_slots
+    {
+        thread_cache* mCaches[MAX_THREAD_CACHES] = {};
+        // set while a cache is allocated, in case the OS allocation ends up back in the HpAllocator
+        bool mIsCreating = false;
+        // set when the thread exits, frees after that go straight to the buckets
+        bool mIsDestroyed = false;
+    };
+
+    static thread_local HpAllocator::thread_cache_slots t_threadCacheSlots;
+
+    // returns the cached blocks when the thread exits
+    struct HpAllocator::thread_cache_slots_releaser
+    {
+        ~thread_cache_slots_releaser()
+        {
+            thread_cache_slots& slots = t_threadCacheSlots;
+            slots.mIsDestroyed = true;
+            for (thread_cache*& cache : slots.mCaches)
+            {
+                if (cache)
+                {
+                    thread_cache_release(cache);
+                    cache = nullptr;
+                }
+            }
+        }
+    };
+
+    // constructed with the first cache of the thread, so its destructor is registered
+    static thread_local HpAllocator::thread_cache_slots_releaser t_threadCacheSlotsReleaser;
+
+    AZStd::mutex& HpAllocator::thread_cache_mutex()
+    {
+        static AZStd::mutex s_threadCacheMutex;
+        return s_threadCacheMutex;
+    }
+
+    void HpAllocator::thread_cache_release(thread_cache* cache)
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+            if (HpAllocator* allocator = cache->mAllocator.load(AZStd::memory_order_relaxed))
+            {
+                allocator->thread_cache_flush_all(cache);
+                allocator->mThreadCaches.erase(cache);
+                allocator->mNumThreadCaches.fetch_sub(1, AZStd::memory_order_relaxed);
+                cache->mAllocator.store(nullptr, AZStd::memory_order_relaxed);
+            }
+        }
+        cache->~thread_cache();
+        AZ_OS_FREE(cache);
+    }
+
+    HpAllocator::thread_cache* HpAllocator::get_thread_cache()
+    {
+        if (!m_isThreadCacheEnabled)
+        {
+            return nullptr;
+        }
+
+        thread_cache_slots& slots = t_threadCacheSlots;
+        thread_cache** freeSlot = nullptr;
+        for (thread_cache*& cache : slots.mCaches)
+        {
+            HpAllocator* owner = cache ? cache->mAllocator.load(AZStd::memory_order_relaxed) : nullptr;
+            if (owner == this)
+            {
+                return cache;
+            }
+            if (!owner && !freeSlot)
+            {
+                freeSlot = &cache;
+            }
+        }
+
+        if (!freeSlot || slots.mIsCreating || slots.mIsDestroyed)
+        {
+            return nullptr;
+        }
+        return thread_cache_create(*freeSlot, slots);
+    }
+
+    HpAllocator::thread_cache* HpAllocator::thread_cache_create(thread_cache*& slot, thread_cache_slots& slots)
+    {
+        // reuse the cache detached from a destroyed HpAllocator, it was emptied when it was detached
+        thread_cache* cache = slot;
+        if (!cache)
+        {
+            slots.mIsCreating = true;
+            void* mem = AZ_OS_MALLOC(sizeof(thread_cache), alignof(thread_cache));
+            slots.mIsCreating = false;
+            if (!mem)
+            {
+                return nullptr;
+            }
+            cache = new (mem) thread_cache();
+            slot = cache;
+            static_cast<void>(&t_threadCacheSlotsReleaser);
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_mutex());
+        cache->mAllocator.store(this, AZStd::memory_order_relaxed);
+        mThreadCaches.push_back(cache);
+        mNumThreadCaches.fetch_add(1, AZStd::memory_order_relaxed);
+        return cache;
+    }
+
+    void* HpAllocator::thread_cache_alloc(thread_cache* cache, unsigned bi)
+    {
+        thread_cache::cached_bucket& cached = cache->mBuckets[bi];
+        if (!cached.mHead && !thread_cache_refill(cache, bi))
+        {
+            return nullptr;
+        }
+        free_link* link = cached.mHead;
+        cached.mHead = link->mNext;
+        --cached.mCount;
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        cache->mCachedSize -= elemSize;
+        mThreadCachedSize.fetch_sub(elemSize, AZStd::memory_order_relaxed);
+        return link;
+    }
+
+    void HpAllocator::thread_cache_free(thread_cache* cache, void* ptr, unsigned bi)
+    {
+        thread_cache::cached_bucket& cached = cache->mBuckets[bi];
+        free_link* link = (free_link*)ptr;
+        link->mNext = cached.mHead;
+        cached.mHead = link;
+        ++cached.mCount;
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        const size_t cachedSize = cache->mCachedSize += elemSize;
+        mThreadCachedSize.fetch_add(elemSize, AZStd::memory_order_relaxed);
+
+        // keep up to two batches so alternating allocations and frees don't move a batch every time
+        unsigned batch = thread_cache_batch(bi);
+        if (cached.mCount > batch * 2)
+        {
+            thread_cache_flush(cache, bi, batch);
+        }
+        else if (cachedSize > m_threadCacheSize)
+        {
+            thread_cache_flush(cache, bi, cached.mCount);
+        }
+    }
+
+    bool HpAllocator::thread_cache_refill(thread_cache* cache, unsigned bi)
+    {
+        thread_cache::cached_bucket& cached = cache->mBuckets[bi];
+        const unsigned batch = thread_cache_batch(bi);
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        unsigned count = 0;
+        {
+    #if defined (USE_MUTEX_PER_BUCKET)
+            AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+    #else
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    #endif
+            for (; count < batch; ++count)
+            {
+                page* p = mBuckets[bi].get_free_page();
+                if (!p)
+                {
+                    p = bucket_grow(elemSize, mBuckets[bi].marker());
+                    if (!p)
+                    {
+                        break;
+                    }
+                    mBuckets[bi].add_free_page(p);
+                }
+                free_link* link = (free_link*)mBuckets[bi].alloc(p);
+                link->mNext = cached.mHead;
+                cached.mHead = link;
+            }
+            mTotalAllocatedSizeBuckets += elemSize * count;
+        }
+        // counted as cached only after the bucket total includes the blocks, so allocated() doesn't drop below zero
+        cached.mCount += count;
+        cache->mCachedSize += elemSize * count;
+        mThreadCachedSize.fetch_add(elemSize * count, AZStd::memory_order_relaxed);
+        mThreadCacheRefills.fetch_add(1, AZStd::memory_order_relaxed);
+        return count > 0;
+    }
+
+    void HpAllocator::thread_cache_flush(thread_cache* cache, unsigned bi, unsigned count)
+    {
+        thread_cache::cached_bucket& cached = cache->mBuckets[bi];
+        HPPA_ASSERT(count <= cached.mCount);
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        // no longer counted as cached before the bucket total drops, the reverse of the refill
+        mThreadCachedSize.fetch_sub(elemSize * count, AZStd::memory_order_relaxed);
+        {
+    #if defined (USE_MUTEX_PER_BUCKET)
+            AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+    #else
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    #endif
+            for (unsigned i = 0; i < count; ++i)
+            {
+                free_link* link = cached.mHead;
+                cached.mHead = link->mNext;
+                mBuckets[bi].free(ptr_get_page(link), link);
+            }
+            mTotalAllocatedSizeBuckets -= elemSize * count;
+        }
+        cached.mCount -= count;
+        cache->mCachedSize -= elemSize * count;
+        mThreadCacheFlushes.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+
+    void HpAllocator::thread_cache_flush_all(thread_cache* cache)
+    {
+        for (unsigned bi = 0; bi < NUM_BUCKETS; ++bi)
+        {
+            if (cache->mBuckets[bi].mCount)
+            {
+                thread_cache_flush(cache, bi, cache->mBuckets[bi].mCount);
+            }
+        }
+    }
+
+    void HpAllocator::thread_cache_flush_current()
+    {
+        if (!m_isThreadCacheEnabled)
+        {
+            return;
+        }
+        thread_cache_slots& slots = t_threadCacheSlots;
+        for (thread_cache* cache : slots.mCaches)
+        {
+            if (cache && cache->mAllocator.load(AZStd::memory_order_relaxed) == this)
+            {
+                thread_cache_flush_all(cache);
+                return;
+            }
+        }
+    }
+
+    void HpAllocator::thread_cache_stats(HphaSchema::ThreadCacheStats& stats) const
+    {
+        stats = HphaSchema::ThreadCacheStats();
+        if (!m_isThreadCacheEnabled)
+        {
+            return;
+        }
+        stats.m_cachedBytes = mThreadCachedSize.load(AZStd::memory_order_relaxed);
+        stats.m_numThreadCaches = mNumThreadCaches.load(AZStd::memory_order_relaxed);
+        stats.m_numRefills = mThreadCacheRefills.load(AZStd::memory_order_relaxed);
+        stats.m_numFlushes = mThreadCacheFlushes.load(AZStd::memory_order_relaxed);
+    }
+#endif // MULTITHREADED
+
     size_t HpAllocator::bucket_ptr_size(void* ptr) const
     {
         page* p = ptr_get_page(ptr);
@@ -2687,6 +3057,30 @@ namespace AZ {
         return m_allocator->GetUnAllocatedMemory(isPrint);
     }
 
+    //=========================================================================
+    // GetThreadCachedBytes
+    //=========================================================================
+    HphaSchema::size_type
+    HphaSchema::GetThreadCachedBytes() const
+    {
+        ThreadCacheStats stats;
+        GetThreadCacheStats(stats);
+        return stats.m_cachedBytes;
+    }
+
+    //=========================================================================
+    // GetThreadCacheStats
+    //=========================================================================
+    void
+    HphaSchema::GetThreadCacheStats(ThreadCacheStats& stats) const
+    {
+#ifdef MULTITHREADED
+        m_allocator->thread_cache_stats(stats);
+#else
+        stats = ThreadCacheStats();
+#endif
+    }
+
     //=========================================================================
     // GarbageCollect
     // [2/22/2011]
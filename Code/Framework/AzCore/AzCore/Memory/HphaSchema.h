@@ -39,6 +39,8 @@ namespace AZ
                 , m_subAllocator(nullptr)
                 , m_systemChunkSize(0)
                 , m_capacity(AZ_CORE_MAX_ALLOCATOR_SIZE)
+                , m_isThreadCacheEnabled(false)
+                , m_threadCacheSize(64 * 1024)
             {}
 
             unsigned int            m_fixedMemoryBlockAlignment;
@@ -50,6 +52,17 @@ namespace AZ
             IAllocatorAllocate*     m_subAllocator;                         ///< Allocator that m_memoryBlocks memory was allocated from or should be allocated (if NULL).
             size_t                  m_systemChunkSize;                      ///< Size of chunk to request from the OS when more memory is needed (defaults to m_pageSize)
             size_t                  m_capacity;                             ///< Max size this allocator can grow to
+            bool                    m_isThreadCacheEnabled;                 ///< True to keep a per thread cache of small allocations in front of the pools. Requires m_isPoolAllocations.
+            size_t                  m_threadCacheSize;                      ///< Max bytes each thread can keep cached before returning them to the pools.
+        };
+
+        /// Statistics of the per thread caches, all zero when the thread cache is disabled.
+        struct ThreadCacheStats
+        {
+            size_t                  m_cachedBytes = 0;                      ///< Bytes allocated from the pools that are held in thread caches.
+            size_t                  m_numThreadCaches = 0;                  ///< Number of threads with a cache for this allocator.
+            size_t                  m_numRefills = 0;                       ///< Number of batches moved from the pools to the thread caches.
+            size_t                  m_numFlushes = 0;                       ///< Number of batches moved from the thread caches back to the pools.
         };
 
 
@@ -67,15 +80,18 @@ namespace AZ
         virtual size_type       Capacity() const;
         virtual size_type       GetMaxAllocationSize() const;
         virtual size_type       GetUnAllocatedMemory(bool isPrint = false) const;
+        virtual size_type       GetThreadCachedBytes() const;
         virtual IAllocatorAllocate* GetSubAllocator()                       { return m_desc.m_subAllocator; }
 
         /// Return unused memory to the OS (if we don't use fixed block). Don't call this unless you really need free memory, it is slow.
         virtual void            GarbageCollect();
 
+        void                    GetThreadCacheStats(ThreadCacheStats& stats) const;
+
     private:
         // [LY-84974][sconel@][2018-08-10] SliceStrike integration up to CL 671758
         // this must be at least the max size of HpAllocator (defined in the cpp) + any platform compiler padding
-        static const int hpAllocatorStructureSize = 16584;
+        static const int hpAllocatorStructureSize = 16648;
         // [LY][sconel@] end
         
         Descriptor          m_desc;
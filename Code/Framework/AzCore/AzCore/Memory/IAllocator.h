@@ -69,6 +69,8 @@ namespace AZ
          * that will be reported.
          */
         virtual size_type               GetUnAllocatedMemory(bool isPrint = false) const { (void)isPrint; return 0; }
+        /// Returns memory allocated by the allocator that is held in per thread caches, ready to be reused by the thread that cached it.
+        virtual size_type               GetThreadCachedBytes() const { return 0; }
         /// Returns a pointer to a sub-allocator or NULL.
         virtual IAllocatorAllocate*     GetSubAllocator() = 0;
     };
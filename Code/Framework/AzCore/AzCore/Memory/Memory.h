@@ -844,6 +844,11 @@ namespace AZ
             return AZ::AllocatorInstance<Parent>::Get().GetUnAllocatedMemory(isPrint);
         }
 
+        size_type               GetThreadCachedBytes() const override
+        {
+            return AZ::AllocatorInstance<Parent>::Get().GetThreadCachedBytes();
+        }
+
         virtual IAllocatorAllocate*     GetSubAllocator() override
         {
             return AZ::AllocatorInstance<Parent>::Get().GetSubAllocator();
@@ -185,6 +185,11 @@ namespace AZ
         { 
             return m_schema->GetUnAllocatedMemory(isPrint);
         }
+
+        size_type GetThreadCachedBytes() const override
+        {
+            return m_schema->GetThreadCachedBytes();
+        }
         
         IAllocatorAllocate* GetSubAllocator() override
         {
@@ -111,6 +111,8 @@ SystemAllocator::Create(const Descriptor& desc)
         heapDesc.m_isPoolAllocations = desc.m_heap.m_isPoolAllocations;
         // Fix SystemAllocator from growing in small chunks
         heapDesc.m_systemChunkSize = desc.m_heap.m_systemChunkSize;
+        heapDesc.m_isThreadCacheEnabled = desc.m_heap.m_isThreadCacheEnabled;
+        heapDesc.m_threadCacheSize = desc.m_heap.m_threadCacheSize;
 
 #elif defined(AZCORE_SYS_ALLOCATOR_MALLOC)
         MallocSchema::Descriptor heapDesc;
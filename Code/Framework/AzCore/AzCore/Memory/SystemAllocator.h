@@ -62,11 +62,14 @@ namespace AZ
                     , m_numFixedMemoryBlocks(0)
                     , m_subAllocator(nullptr)
                     , m_systemChunkSize(0)
+                    , m_isThreadCacheEnabled(false)
+                    , m_threadCacheSize(m_defaultThreadCacheSize)
                 {}
                 static const int        m_defaultPageSize = AZ_TRAIT_OS_DEFAULT_PAGE_SIZE;
                 static const int        m_defaultPoolPageSize = 4 * 1024;
                 static const int        m_memoryBlockAlignment = m_defaultPageSize;
                 static const int        m_maxNumFixedBlocks = 3;
+                static const int        m_defaultThreadCacheSize = 64 * 1024;
                 unsigned int            m_pageSize;                                 ///< Page allocation size must be 1024 bytes aligned. (default m_defaultPageSize)
                 unsigned int            m_poolPageSize;                             ///< Page size used to small memory allocations. Must be less or equal to m_pageSize and a multiple of it. (default m_defaultPoolPageSize)
                 bool                    m_isPoolAllocations;                        ///< True (default) if we use pool for small allocations (< 256 bytes), otherwise false. IMPORTANT: Changing this to false will degrade performance!
@@ -75,6 +78,8 @@ namespace AZ
                 size_t                  m_fixedMemoryBlocksByteSize[m_maxNumFixedBlocks]; ///< Sizes of different memory blocks (MUST be multiple of m_pageSize), if m_memoryBlock is 0 the block will be allocated for you with the System Allocator.
                 IAllocatorAllocate*     m_subAllocator;                             ///< Allocator that m_memoryBlocks memory was allocated from or should be allocated (if NULL).
                 size_t                  m_systemChunkSize;                          ///< Size of chunk to request from the OS when more memory is needed (defaults to m_pageSize)
+                bool                    m_isThreadCacheEnabled;                     ///< True to cache small allocations per thread, so most of them don't lock the pools. (default false)
+                size_t                  m_threadCacheSize;                          ///< Max bytes each thread can keep cached. (default m_defaultThreadCacheSize)
             }                           m_heap;
             bool                        m_allocationRecords;    ///< True if we want to track memory allocations, otherwise false.
             unsigned char               m_stackRecordLevels;    ///< If stack recording is enabled, how many stack levels to record.
@@ -104,6 +109,7 @@ namespace AZ
         /// Keep in mind this operation will execute GarbageCollect to make sure it returns, max allocation. This function WILL be slow.
         size_type       GetMaxAllocationSize() const override    { return m_allocator->GetMaxAllocationSize(); }
         size_type       GetUnAllocatedMemory(bool isPrint = false) const override    { return m_allocator->GetUnAllocatedMemory(isPrint); }
+        size_type       GetThreadCachedBytes() const override    { return m_allocator->GetThreadCachedBytes(); }
         IAllocatorAllocate*  GetSubAllocator() override          { return m_isCustom ? m_allocator : m_allocator->GetSubAllocator(); }
 
         //////////////////////////////////////////////////////////////////////////
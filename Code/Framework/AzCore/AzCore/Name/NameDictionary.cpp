@@ -18,10 +18,22 @@
 namespace AZ
 {
     static const char* NameDictionaryInstanceName = "NameDictionaryInstance";
+    static const char* NameDictionaryGenerationName = "NameDictionaryGeneration";
 
     namespace NameDictionaryInternal
     {
         static AZ::EnvironmentVariable<NameDictionary*> s_instance = nullptr;
+        static AZ::EnvironmentVariable<uint64_t> s_generation = nullptr;
+
+        // A small per-thread cache of recently made names, indexed by the hash of their string.
+        // Like the dictionary's shared lookup cache, entries are only hints and are validated on use.
+        static constexpr size_t ThreadCacheSize = 64;
+        struct ThreadNameCache
+        {
+            uint64_t m_generation;
+            Internal::NameData* m_entries[ThreadCacheSize];
+        };
+        static AZ_THREAD_LOCAL ThreadNameCache s_threadCache;
     }
 
     void NameDictionary::Create()
@@ -35,9 +47,16 @@ namespace AZ
             s_instance = AZ::Environment::CreateVariable<NameDictionary*>(NameDictionaryInstanceName);
         }
 
+        if (!s_generation)
+        {
+            s_generation = AZ::Environment::CreateVariable<uint64_t>(NameDictionaryGenerationName, uint64_t(0));
+        }
+
         if (!s_instance.Get())
         {
-            s_instance.Set(aznew NameDictionary());
+            NameDictionary* dictionary = aznew NameDictionary();
+            dictionary->m_generation = ++(*s_generation);
+            s_instance.Set(dictionary);
         }
     }
 
@@ -77,39 +96,89 @@ namespace AZ
     }
     
     NameDictionary::NameDictionary()
-    {}
+    {
+        for (AZStd::atomic<Internal::NameData*>& cacheEntry : m_lookupCache)
+        {
+            cacheEntry.store(nullptr, AZStd::memory_order_relaxed);
+        }
+    }
 
     NameDictionary::~NameDictionary()
     {
         bool leaksDetected = false;
 
-        for (const auto& keyValue : m_dictionary)
+        for (Shard& shard : m_shards)
         {
-            Internal::NameData* nameData = keyValue.second;
-            const int useCount = keyValue.second->m_useCount;
-            const bool hadCollision = keyValue.second->m_hashCollision;
+            for (const auto& keyValue : shard.m_dictionary)
+            {
+                Internal::NameData* nameData = keyValue.second;
+                const int useCount = keyValue.second->m_useCount;
+                const bool hadCollision = keyValue.second->m_hashCollision;
+
+                if (useCount == 0)
+                {
+                    // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
+                    AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
+                    delete nameData;
+                }
+                else
+                {
+                    leaksDetected = true;
+                    AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                }
+            }
 
-            if (useCount == 0)
+            for (Internal::NameData* nameData : shard.m_freeNameData)
             {
-                // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
-                AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
                 delete nameData;
             }
-            else
+        }
+
+        AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
+    }
+
+    NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash)
+    {
+        return m_shards[hash >> ShardHashShift];
+    }
+
+    const NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash) const
+    {
+        return m_shards[hash >> ShardHashShift];
+    }
+
+    namespace NameDictionaryInternal
+    {
+        // Lock the shard mutex, counting how often another thread already held it.
+        // The caller adopts the lock with a shared_lock or unique_lock.
+        static void LockSharedAndCountContention(AZStd::shared_mutex& mutex, AZStd::atomic<uint64_t>& contentionCount)
+        {
+            if (!mutex.try_lock_shared())
             {
-                leaksDetected = true;
-                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                contentionCount.fetch_add(1, AZStd::memory_order_relaxed);
+                mutex.lock_shared();
             }
         }
 
-        AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
+        static void LockAndCountContention(AZStd::shared_mutex& mutex, AZStd::atomic<uint64_t>& contentionCount)
+        {
+            if (!mutex.try_lock())
+            {
+                contentionCount.fetch_add(1, AZStd::memory_order_relaxed);
+                mutex.lock();
+            }
+        }
     }
 
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-        auto iter = m_dictionary.find(hash);
-        if (iter != m_dictionary.end())
+        const Shard& shard = GetShard(hash);
+        NameDictionaryInternal::LockSharedAndCountContention(shard.m_sharedMutex, shard.m_lockContentionCount);
+        AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex, AZStd::adopt_lock);
+        shard.m_lockedLookupCount.fetch_add(1, AZStd::memory_order_relaxed);
+
+        auto iter = shard.m_dictionary.find(hash);
+        if (iter != shard.m_dictionary.end())
         {
             return Name(iter->second);
         }
@@ -118,36 +187,130 @@ namespace AZ
 
     Name NameDictionary::MakeName(AZStd::string_view nameString)
     {
+        using namespace NameDictionaryInternal;
+
         // Null strings should return empty.
         if (nameString.empty())
         {
             return Name();
         }
 
-        Name::Hash hash = CalcHash(nameString);
+        const Name::Hash hash = CalcHash(nameString);
+
+        // Discard this thread's cache if it was filled by a different dictionary instance
+        ThreadNameCache& threadCache = s_threadCache;
+        if (threadCache.m_generation != m_generation)
+        {
+            memset(threadCache.m_entries, 0, sizeof(threadCache.m_entries));
+            threadCache.m_generation = m_generation;
+        }
+
+        // Most names being made already exist, so check the lock-free caches first
+        Internal::NameData*& threadCacheEntry = threadCache.m_entries[hash % ThreadCacheSize];
+        if (threadCacheEntry)
+        {
+            Name name = TryAcquireCachedName(threadCacheEntry, nameString);
+            if (!name.IsEmpty())
+            {
+                return name;
+            }
+        }
 
-        // If we find the same name with the same hash, just return it. 
-        // This path is faster than the loop below because FindName() takes a shared_lock whereas the
-        // loop requires a unique_lock to modify the dictionary.
-        Name name = FindName(hash);
-        if (name.GetStringView() == nameString)
+        AZStd::atomic<Internal::NameData*>& lookupCacheEntry = m_lookupCache[hash & (LookupCacheSize - 1)];
+        if (Internal::NameData* nameData = lookupCacheEntry.load(AZStd::memory_order_acquire))
         {
-            return AZStd::move(name);
+            Name name = TryAcquireCachedName(nameData, nameString);
+            if (!name.IsEmpty())
+            {
+                threadCacheEntry = nameData;
+                return name;
+            }
         }
 
-        // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        Name name = MakeNameLocked(nameString, hash);
+        lookupCacheEntry.store(name.m_data.get(), AZStd::memory_order_release);
+        threadCacheEntry = name.m_data.get();
+        return name;
+    }
+
+    Name NameDictionary::TryAcquireCachedName(Internal::NameData* nameData, AZStd::string_view nameString)
+    {
+        // Only take a reference if the entry is still alive. A count of zero means it is being released, and -1 means it
+        // has been released and is waiting in a free list, so it must not be resurrected here.
+        int32_t useCount = nameData->m_useCount.load(AZStd::memory_order_relaxed);
+        do
+        {
+            if (useCount <= 0)
+            {
+                return Name();
+            }
+        } while (!nameData->m_useCount.compare_exchange_weak(useCount, useCount + 1));
 
-        auto iter = m_dictionary.find(hash);
+        // While we hold a reference the entry can't be reused, so it is safe to check which name it holds
+        Name name;
+        if (nameData->GetName() == nameString)
+        {
+            name = Name(nameData);
+        }
+        nameData->release();
+        return name;
+    }
+
+    Name NameDictionary::MakeNameLocked(AZStd::string_view nameString, Name::Hash hash)
+    {
         bool collisionDetected = false;
         while (true)
         {
+            Shard& shard = GetShard(hash);
+
+            // Start with a shared lock in case another thread has added the name since it was cached, or it's already
+            // known to collide with another name
+            {
+                NameDictionaryInternal::LockSharedAndCountContention(shard.m_sharedMutex, shard.m_lockContentionCount);
+                AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex, AZStd::adopt_lock);
+                shard.m_lockedLookupCount.fetch_add(1, AZStd::memory_order_relaxed);
+
+                auto iter = shard.m_dictionary.find(hash);
+                if (iter != shard.m_dictionary.end())
+                {
+                    if (iter->second->GetName() == nameString)
+                    {
+                        return Name(iter->second);
+                    }
+                    else if (iter->second->m_hashCollision)
+                    {
+                        collisionDetected = true;
+                        ++hash;
+                        continue;
+                    }
+                }
+            }
+
+            // The name doesn't exist in the dictionary, so we have to lock and add it
+            NameDictionaryInternal::LockAndCountContention(shard.m_sharedMutex, shard.m_lockContentionCount);
+            AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex, AZStd::adopt_lock);
+
+            auto iter = shard.m_dictionary.find(hash);
+
             // No existing entry, add a new one and we're done
-            if (iter == m_dictionary.end())
+            if (iter == shard.m_dictionary.end())
             {
-                Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
-                nameData->m_hashCollision = collisionDetected;
-                m_dictionary.emplace(hash, nameData);
+                Internal::NameData* nameData = nullptr;
+                if (!shard.m_freeNameData.empty())
+                {
+                    nameData = shard.m_freeNameData.back();
+                    shard.m_freeNameData.pop_back();
+                    nameData->m_name = nameString;
+                    nameData->m_hash = hash;
+                    nameData->m_hashCollision = collisionDetected;
+                    nameData->m_useCount = 0;
+                }
+                else
+                {
+                    nameData = aznew Internal::NameData(nameString, hash);
+                    nameData->m_hashCollision = collisionDetected;
+                }
+                shard.m_dictionary.emplace(hash, nameData);
                 return Name(nameData);
             }
             // Found the desired entry, return it
@@ -155,13 +318,12 @@ namespace AZ
             {
                 return Name(iter->second);
             }
-            // Hash collision, try a new hash
+            // Hash collision, try a new hash. The next hash may belong to a different shard, so the lock is released first.
             else
             {
                 collisionDetected = true;
                 iter->second->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
                 ++hash;
-                iter = m_dictionary.find(hash);
             }
         }
     }
@@ -185,24 +347,36 @@ namespace AZ
             return;
         }
 
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-
-        // Check m_hashCollision again inside the m_sharedMutex because a new collision could have happened
-        // on another thread before taking the lock.
-        if (nameData->m_hashCollision)
+        // NameData is only ever reused by the shard it was released to, so its hash always selects the same shard
+        Shard& shard = GetShard(nameData->GetHash());
         {
-            return;
-        }
+            NameDictionaryInternal::LockAndCountContention(shard.m_sharedMutex, shard.m_lockContentionCount);
+            AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex, AZStd::adopt_lock);
 
-        // We need to check the count again in here in case
-        // someone was trying to get the name on another thread.
-        // Set it to -1 so only this thread will attempt to clean up the
-        // dictionary and delete the name.
-        int32_t expectedRefCount = 0;
-        if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
-        {
-            m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            // Check m_hashCollision again inside the m_sharedMutex because a new collision could have happened
+            // on another thread before taking the lock.
+            if (nameData->m_hashCollision)
+            {
+                return;
+            }
+
+            // We need to check the count again in here in case
+            // someone was trying to get the name on another thread.
+            // Set it to -1 so only this thread will attempt to clean up the
+            // dictionary and release the name.
+            int32_t expectedRefCount = 0;
+            if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
+            {
+                auto iter = shard.m_dictionary.find(nameData->GetHash());
+                if (iter != shard.m_dictionary.end() && iter->second == nameData)
+                {
+                    shard.m_dictionary.erase(iter);
+                }
+
+                // Keep the NameData for reuse rather than freeing it, since it may still be referenced by the lock-free caches
+                nameData->m_name.clear();
+                shard.m_freeNameData.push_back(nameData);
+            }
         }
 
         ReportStats();
@@ -219,52 +393,76 @@ namespace AZ
         {
             size_t potentialStringMemoryUsed = 0;
             size_t actualStringMemoryUsed = 0;
-
-            Internal::NameData* longestName = nullptr;
-            Internal::NameData* mostRepeatedName = nullptr;
-
-            for (auto& iter : m_dictionary)
+            size_t nameCount = 0;
+            size_t freeNameDataCount = 0;
+            uint64_t lockedLookupCount = 0;
+            uint64_t lockContentionCount = 0;
+            size_t busiestShardIndex = 0;
+            uint64_t busiestShardContentionCount = 0;
+
+            AZStd::string longestName;
+            AZStd::string mostRepeatedName;
+            size_t mostRepeatedNameSavings = 0;
+            int mostRepeatedNameCount = 0;
+
+            for (size_t shardIndex = 0; shardIndex < ShardCount; ++shardIndex)
             {
-                const size_t nameLength = iter.second->m_name.size();
-                actualStringMemoryUsed += nameLength;
-                potentialStringMemoryUsed += (nameLength * iter.second->m_useCount);
+                const Shard& shard = m_shards[shardIndex];
+                AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
 
-                if (!longestName || longestName->m_name.size() < nameLength)
-                {
-                    longestName = iter.second;
-                }
+                nameCount += shard.m_dictionary.size();
+                freeNameDataCount += shard.m_freeNameData.size();
+                lockedLookupCount += shard.m_lockedLookupCount;
 
-                if (!mostRepeatedName)
+                const uint64_t shardContentionCount = shard.m_lockContentionCount;
+                lockContentionCount += shardContentionCount;
+                if (shardContentionCount > busiestShardContentionCount)
                 {
-                    mostRepeatedName = iter.second;
+                    busiestShardIndex = shardIndex;
+                    busiestShardContentionCount = shardContentionCount;
                 }
-                else
+
+                for (auto& iter : shard.m_dictionary)
                 {
-                    const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
-                    const size_t currentIndividualSavings = nameLength * (iter.second->m_useCount - 1);
-                    if (currentIndividualSavings > mostIndividualSavings)
+                    const size_t nameLength = iter.second->m_name.size();
+                    const int useCount = iter.second->m_useCount.load();
+                    actualStringMemoryUsed += nameLength;
+                    potentialStringMemoryUsed += (nameLength * useCount);
+
+                    if (longestName.size() < nameLength)
+                    {
+                        longestName = iter.second->m_name;
+                    }
+
+                    const size_t currentIndividualSavings = nameLength * (useCount - 1);
+                    if (mostRepeatedName.empty() || currentIndividualSavings > mostRepeatedNameSavings)
                     {
-                        mostRepeatedName = iter.second;
+                        mostRepeatedName = iter.second->m_name;
+                        mostRepeatedNameSavings = currentIndividualSavings;
+                        mostRepeatedNameCount = useCount;
                     }
                 }
             }
 
             AZ_TracePrintf("NameDictionary", "NameDictionary Stats\n");
-            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_dictionary.size());
-            AZ_TracePrintf("NameDictionary", "Total chars:        %d\n", actualStringMemoryUsed);
-            AZ_TracePrintf("NameDictionary", "Logical chars:      %d\n", potentialStringMemoryUsed);
-            AZ_TracePrintf("NameDictionary", "Memory saved:       %d\n", potentialStringMemoryUsed - actualStringMemoryUsed);
-            if (longestName)
+            AZ_TracePrintf("NameDictionary", "Names:              %zu\n", nameCount);
+            AZ_TracePrintf("NameDictionary", "Free name data:     %zu\n", freeNameDataCount);
+            AZ_TracePrintf("NameDictionary", "Total chars:        %zu\n", actualStringMemoryUsed);
+            AZ_TracePrintf("NameDictionary", "Logical chars:      %zu\n", potentialStringMemoryUsed);
+            AZ_TracePrintf("NameDictionary", "Memory saved:       %zu\n", potentialStringMemoryUsed - actualStringMemoryUsed);
+            AZ_TracePrintf("NameDictionary", "Locked lookups:     %llu\n", static_cast<unsigned long long>(lockedLookupCount));
+            AZ_TracePrintf("NameDictionary", "Lock contentions:   %llu\n", static_cast<unsigned long long>(lockContentionCount));
+            AZ_TracePrintf("NameDictionary", "Busiest shard:      %zu (%llu contentions)\n", busiestShardIndex, static_cast<unsigned long long>(busiestShardContentionCount));
+            if (!longestName.empty())
             {
-                AZ_TracePrintf("NameDictionary", "Longest name:       \"%.*s\"\n", aznumeric_cast<int>(longestName->m_name.size()), longestName->m_name.data());
-                AZ_TracePrintf("NameDictionary", "Longest name size:  %d\n", longestName->m_name.size());
+                AZ_TracePrintf("NameDictionary", "Longest name:       \"%s\"\n", longestName.c_str());
+                AZ_TracePrintf("NameDictionary", "Longest name size:  %zu\n", longestName.size());
             }
-            if (mostRepeatedName)
+            if (!mostRepeatedName.empty())
             {
-                AZ_TracePrintf("NameDictionary", "Most repeated name:        \"%.*s\"\n", aznumeric_cast<int>(mostRepeatedName->m_name.size()), mostRepeatedName->m_name.data());
-                AZ_TracePrintf("NameDictionary", "Most repeated name size:   %d\n", mostRepeatedName->m_name.size());
-                const int refCount = mostRepeatedName->m_useCount.load();
-                AZ_TracePrintf("NameDictionary", "Most repeated name count:  %d\n", refCount);
+                AZ_TracePrintf("NameDictionary", "Most repeated name:        \"%s\"\n", mostRepeatedName.c_str());
+                AZ_TracePrintf("NameDictionary", "Most repeated name size:   %zu\n", mostRepeatedName.size());
+                AZ_TracePrintf("NameDictionary", "Most repeated name count:  %d\n", mostRepeatedNameCount);
             }
 
             reportUsage = false;
@@ -8,9 +8,12 @@
 
 #pragma once
 
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/OSAllocator.h>
@@ -43,6 +46,10 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't 
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names 
     //! that already exist.
+    //!
+    //! The dictionary is split into shards by hash, each with its own lock, so threads creating unrelated
+    //! names don't contend with each other. Names that already exist are usually found without taking any
+    //! lock at all, through a per-thread cache and a shared cache of recently made names.
     class NameDictionary final
     {
         AZ_CLASS_ALLOCATOR(NameDictionary, AZ::OSAllocator, 0);
@@ -90,8 +97,45 @@ namespace AZ
         // Calculates a hash for the provided name string.
         // Does not attempt to resolve hash collisions; that is handled elsewhere.
         Name::Hash CalcHash(AZStd::string_view name);
-                
-        AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+
+        // Finds or adds the name using the shard locks, resolving any hash collisions.
+        Name MakeNameLocked(AZStd::string_view nameString, Name::Hash hash);
+
+        // Takes a reference to NameData found in one of the lock-free caches. The entry may have been released or
+        // reused for a different name since it was cached, so an empty Name is returned unless it is still alive
+        // and holds the requested string.
+        Name TryAcquireCachedName(Internal::NameData* nameData, AZStd::string_view nameString);
+
+        static constexpr size_t ShardCount = 32;
+        static constexpr size_t ShardHashShift = 27; // Shards are picked by the top 5 bits so probing for a collision usually stays in the same shard
+        static constexpr size_t LookupCacheSize = 4096;
+        static_assert((size_t(1) << (32 - ShardHashShift)) == ShardCount, "ShardHashShift must select ShardCount shards");
+        static_assert((LookupCacheSize & (LookupCacheSize - 1)) == 0, "LookupCacheSize must be a power of two");
+
+        struct Shard
+        {
+            AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
+
+            // Released NameData is kept for reuse by this shard rather than freed, so that pointers held in the lock-free
+            // caches always point to a valid NameData. It is freed when the dictionary is destroyed.
+            AZStd::vector<Internal::NameData*> m_freeNameData;
+
+            mutable AZStd::shared_mutex m_sharedMutex;
+
+            // Stats for ReportStats
+            mutable AZStd::atomic<uint64_t> m_lockedLookupCount{ 0 };
+            mutable AZStd::atomic<uint64_t> m_lockContentionCount{ 0 };
+        };
+
+        Shard& GetShard(Name::Hash hash);
+        const Shard& GetShard(Name::Hash hash) const;
+
+        AZStd::array<Shard, ShardCount> m_shards;
+
+        // Recently made names, indexed by the hash of their string. Entries are only hints and are validated on use.
+        AZStd::array<AZStd::atomic<Internal::NameData*>, LookupCacheSize> m_lookupCache;
+
+        // Uniquely identifies this dictionary instance, so that thread local caches filled by a previous dictionary are discarded.
+        uint64_t m_generation = 0;
     };
 }
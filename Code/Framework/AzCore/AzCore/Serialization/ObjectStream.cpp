@@ -15,6 +15,7 @@
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Slice/SliceAsset.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/bind/bind.h>
 #include <AzCore/std/containers/list.h>
@@ -55,7 +56,14 @@ namespace AZ
 {
     namespace ObjectStreamInternal
     {
-        static const u32 s_objectStreamVersion = 3;
+        static const u32 s_objectStreamVersion = 5;
+        // Binary streams from version 4 on store every type id once, later elements of the same type refer to it by its index
+        // in the stream's type table. The text formats are unchanged, so they are still written with version 3
+        static const u32 s_typeTableStreamVersion = 4;
+        // Binary streams from version 5 on store the elements of containers of fixed size values as a single block of values,
+        // see WritePackedElements
+        static const u32 s_packedElementsStreamVersion = 5;
+        static const u32 s_textObjectStreamVersion = 3;
         static const u8 s_binaryStreamTag = 0;
         static const u8 s_xmlStreamTag = '<';
         static const u8 s_jsonStreamTag = '{';
@@ -87,7 +95,10 @@ namespace AZ
                 ST_BINARYFLAG_EXTRA_SIZE_FIELD  = 1 << 5,
                 ST_BINARYFLAG_HAS_NAME          = 1 << 6,
                 ST_BINARYFLAG_HAS_VERSION       = 1 << 7,
-                ST_BINARYFLAG_ELEMENT_END       = 0
+                ST_BINARYFLAG_ELEMENT_END       = 0,
+                // Starts a block of packed container elements. This is not a flag, but a tag that takes the place of the
+                // header of the first element. It can't be mistaken for a header since ST_BINARYFLAG_ELEMENT_HEADER isn't set.
+                ST_BINARY_PACKED_ELEMENTS       = 1
             };
 
             AZ_CLASS_ALLOCATOR(ObjectStreamImpl, SystemAllocator, 0);
@@ -126,6 +137,24 @@ namespace AZ
             bool WriteElement(const void* elemPtr, const SerializeContext::ClassData* classData, const SerializeContext::ClassElement* classElement);
             bool CloseElement();
 
+            // binary type ids, written as an index into the type table of the stream followed by the id when it is new
+            void WriteTypeId(const Uuid& typeId);
+            bool ReadTypeId(Uuid& typeId);
+
+            // 7 bits per byte, so values below 128 take a single byte
+            void WriteVarUInt(u32 value);
+            bool ReadVarUInt(u32& value);
+
+            // binary containers whose elements all have a value of the same size and no children are written as a block
+            // of values after the layout of the elements, which is stored once per stream in a table like the types
+            bool WritePackedElements(const void* containerPtr, const SerializeContext::ClassData* containerClassData);
+            bool ReadPackedElementsHeader(u32& layoutIndex, u32& numElements);
+            bool ReadPackedElements();
+            bool ReadPackedElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent);
+            // loads the remaining elements of the current block straight into the container, when the layout matches the reflection
+            bool LoadPackedElements(const SerializeContext::DataElement& element, const SerializeContext::ClassData* classData, const SerializeContext::ClassElement* classElement,
+                SerializeContext::IDataContainer* classContainer, void* parentClassPtr, size_t& currentContainerElementIndex);
+
             const char* GetStreamFilename() const;
 
             enum class StorageAddressResult
@@ -220,6 +249,32 @@ namespace AZ
             IO::ByteContainerStream<AZStd::vector<char> > m_inStream;
             IO::ByteContainerStream<AZStd::vector<char> > m_outStream;
 
+            // type table of binary streams, in the order the types first appear in the stream
+            AZStd::unordered_map<Uuid, u32>     m_typeIndices;  // when saving
+            AZStd::vector<Uuid>                 m_typeTable;    // when loading
+
+            struct PackedElementsLayout
+            {
+                bool operator==(const PackedElementsLayout& rhs) const
+                {
+                    return m_typeId == rhs.m_typeId && m_nameCrc == rhs.m_nameCrc && m_version == rhs.m_version && m_valueSize == rhs.m_valueSize;
+                }
+
+                Uuid    m_typeId;
+                u32     m_nameCrc;
+                u8      m_version;
+                u32     m_valueSize;
+            };
+            // layout table of the packed elements of binary streams, in the order the layouts first appear in the stream
+            AZStd::vector<PackedElementsLayout> m_packedLayouts;
+            // values of the block of packed elements that is being written or read
+            AZStd::vector<char>                 m_packedValues;
+            size_t                              m_packedLayoutIndex = 0;
+            size_t                              m_numPackedElements = 0;
+            size_t                              m_nextPackedElement = 0;
+            // the last element read was a packed one, which doesn't have an end tag in the stream
+            bool                                m_isInPackedElement = false;
+
             // other state info
             // keep tracks of the number of WriteElements that have
             // completed successfully to make sure the equivalent amount
@@ -701,6 +756,18 @@ namespace AZ
                     }
                 }
 
+                // Packed elements that match the reflected container element exactly are loaded straight from the block of values,
+                // without going through the element walk for each of them. Anything else, like an element of an older version, is
+                // loaded one element at a time just like elements that weren't packed.
+                if (m_isInPackedElement && classContainer && !isConvertedData
+                    && element.m_id == classElement->m_typeId && element.m_version == classData->m_version && classData->m_serializer
+                    && !classData->m_eventHandler && !(classElement->m_flags & SerializeContext::ClassElement::FLG_POINTER)
+                    && element.m_id != GetAssetClassId())
+                {
+                    result = LoadPackedElements(element, classData, classElement, classContainer, parentClassPtr, currentContainerElementIndex) && result;
+                    continue;
+                }
+
                 // Handle version conversions for non-custom serialized classes
                 if (element.m_version < classData->m_version && !classData->m_serializer)
                 {
@@ -1274,6 +1341,17 @@ namespace AZ
             }
             else /*ST_BINARY*/
             {
+                // Packed elements don't have children, so they don't have an end tag in the stream either
+                if (m_isInPackedElement)
+                {
+                    m_isInPackedElement = false;
+                    return false;
+                }
+                if (m_nextPackedElement < m_numPackedElements)
+                {
+                    return ReadPackedElement(sc, cd, element, parent);
+                }
+
                 if (m_stream->GetCurPos() == m_stream->GetLength())
                 {
                     // Reached the end of the stream. We may reach this state if we just skipped the root element
@@ -1289,6 +1367,10 @@ namespace AZ
                 {
                     return false;
                 }
+                if (flagsSize == ST_BINARY_PACKED_ELEMENTS && m_version >= s_packedElementsStreamVersion)
+                {
+                    return ReadPackedElements() && ReadPackedElement(sc, cd, element, parent);
+                }
 
                 // Read name
                 if (flagsSize & ST_BINARYFLAG_HAS_NAME)
@@ -1310,8 +1392,18 @@ namespace AZ
                 }
 
                 // Read uuid
-                nBytesRead = m_stream->Read(element.m_id.end() - element.m_id.begin(), element.m_id.begin());
-                AZ_Assert(nBytesRead == static_cast<IO::SizeType>(element.m_id.end() - element.m_id.begin()), "Failed trying to read binary element uuid!");
+                if (m_version >= s_typeTableStreamVersion)
+                {
+                    if (!ReadTypeId(element.m_id))
+                    {
+                        return false;
+                    }
+                }
+                else
+                {
+                    nBytesRead = m_stream->Read(element.m_id.end() - element.m_id.begin(), element.m_id.begin());
+                    AZ_Assert(nBytesRead == static_cast<IO::SizeType>(element.m_id.end() - element.m_id.begin()), "Failed trying to read binary element uuid!");
+                }
 
                 // Version 3 of the ObjectStream serializes the specialized type id directly in the data element id field. The data element old id field value is no longer needed
                 if (m_version == 2)
@@ -1422,6 +1514,13 @@ namespace AZ
         {
             if (GetType() == ST_BINARY)
             {
+                // A packed element has no children or end tag to skip
+                if (m_isInPackedElement)
+                {
+                    m_isInPackedElement = false;
+                    return;
+                }
+
                 int endTagsNeeded = 1;
                 while (endTagsNeeded > 0)
                 {
@@ -1434,10 +1533,21 @@ namespace AZ
                     {
                         --endTagsNeeded;
                     }
+                    else if (flagsSize == ST_BINARY_PACKED_ELEMENTS && m_version >= s_packedElementsStreamVersion)
+                    {
+                        // the header still has to be read, the layout may be the first one of its kind in the stream
+                        u32 layoutIndex = 0;
+                        u32 numElements = 0;
+                        if (!ReadPackedElementsHeader(layoutIndex, numElements))
+                        {
+                            return;
+                        }
+                        m_stream->Seek(static_cast<IO::OffsetType>(numElements) * m_packedLayouts[layoutIndex].m_valueSize, IO::GenericStream::ST_SEEK_CUR);
+                    }
                     else
                     {
                         ++endTagsNeeded;
-                        size_t bytesToSkip = sizeof(Uuid);  // this field is guaranteed to be there
+                        size_t bytesToSkip = 0;
                         if (flagsSize & ST_BINARYFLAG_HAS_NAME)
                         {
                             bytesToSkip += sizeof(u32);
@@ -1447,9 +1557,25 @@ namespace AZ
                             bytesToSkip += sizeof(u8);
                         }
 
-                        if (m_version == 2) // need to account for the specialized uuid
+                        if (m_version >= s_typeTableStreamVersion)
                         {
-                            bytesToSkip += sizeof(Uuid);
+                            // the type still has to be read, it may be the first time it appears in the stream
+                            m_stream->Seek(bytesToSkip, IO::GenericStream::ST_SEEK_CUR);
+                            bytesToSkip = 0;
+
+                            Uuid skippedTypeId;
+                            if (!ReadTypeId(skippedTypeId))
+                            {
+                                return;
+                            }
+                        }
+                        else
+                        {
+                            bytesToSkip += sizeof(Uuid);  // this field is guaranteed to be there
+                            if (m_version == 2) // need to account for the specialized uuid
+                            {
+                                bytesToSkip += sizeof(Uuid);
+                            }
                         }
 
                         m_stream->Seek(bytesToSkip, IO::GenericStream::ST_SEEK_CUR);
@@ -1841,7 +1967,7 @@ namespace AZ
                 }
 
                 // Write Uuid
-                m_stream->Write(element.m_id.end() - element.m_id.begin(), element.m_id.begin());
+                WriteTypeId(element.m_id);
 
                 // Write value
                 if (classData->m_serializer)
@@ -1884,6 +2010,13 @@ namespace AZ
 
                     element.m_stream = nullptr;
                 }
+
+                // The elements are already written if the container could be packed, so they must not be enumerated again
+                if (classData->m_container && m_version >= s_packedElementsStreamVersion && WritePackedElements(objectPtr, classData))
+                {
+                    CloseElement();
+                    return false;
+                }
             }
 
             return true;
@@ -1923,6 +2056,316 @@ namespace AZ
             return true;
         }
 
+        //=========================================================================
+        // WriteTypeId
+        //=========================================================================
+        void ObjectStreamImpl::WriteTypeId(const Uuid& typeId)
+        {
+            auto typeIt = m_typeIndices.find(typeId);
+            const bool isNewType = typeIt == m_typeIndices.end();
+            const u32 typeIndex = isNewType ? static_cast<u32>(m_typeIndices.size()) : typeIt->second;
+            if (isNewType)
+            {
+                m_typeIndices.emplace(typeId, typeIndex);
+            }
+
+            WriteVarUInt(typeIndex);
+            if (isNewType)
+            {
+                m_stream->Write(typeId.end() - typeId.begin(), typeId.begin());
+            }
+        }
+
+        //=========================================================================
+        // ReadTypeId
+        //=========================================================================
+        bool ObjectStreamImpl::ReadTypeId(Uuid& typeId)
+        {
+            u32 typeIndex = 0;
+            if (!ReadVarUInt(typeIndex))
+            {
+                m_errorLogger.ReportError("Failed trying to read binary element type index!");
+                return false;
+            }
+
+            if (typeIndex < m_typeTable.size())
+            {
+                typeId = m_typeTable[typeIndex];
+                return true;
+            }
+
+            // an index past the end of the table is only valid for the next new type, which is followed by its id
+            if (typeIndex != m_typeTable.size() ||
+                m_stream->Read(typeId.end() - typeId.begin(), typeId.begin()) != static_cast<IO::SizeType>(typeId.end() - typeId.begin()))
+            {
+                m_errorLogger.ReportError(AZStd::string::format("Invalid binary element type index %u, the stream only has %zu types!", typeIndex, m_typeTable.size()).c_str());
+                return false;
+            }
+
+            m_typeTable.push_back(typeId);
+            return true;
+        }
+
+        //=========================================================================
+        // WriteVarUInt
+        //=========================================================================
+        void ObjectStreamImpl::WriteVarUInt(u32 value)
+        {
+            u8 valueBytes[5];
+            size_t numValueBytes = 0;
+            do
+            {
+                u8 valueByte = static_cast<u8>(value & 0x7F);
+                value >>= 7;
+                valueBytes[numValueBytes++] = value ? (valueByte | 0x80) : valueByte;
+            } while (value);
+            m_stream->Write(numValueBytes, valueBytes);
+        }
+
+        //=========================================================================
+        // ReadVarUInt
+        //=========================================================================
+        bool ObjectStreamImpl::ReadVarUInt(u32& value)
+        {
+            value = 0;
+            for (u32 shift = 0; ; shift += 7)
+            {
+                u8 valueByte = 0;
+                if (shift > 28 || m_stream->Read(sizeof(valueByte), &valueByte) != sizeof(valueByte))
+                {
+                    return false;
+                }
+
+                value |= static_cast<u32>(valueByte & 0x7F) << shift;
+                if (!(valueByte & 0x80))
+                {
+                    return true;
+                }
+            }
+        }
+
+        //=========================================================================
+        // WritePackedElements
+        //=========================================================================
+        bool ObjectStreamImpl::WritePackedElements(const void* containerPtr, const SerializeContext::ClassData* containerClassData)
+        {
+            SerializeContext::IDataContainer* container = containerClassData->m_container;
+            void* containerInstance = const_cast<void*>(containerPtr);
+            if (container->GetAssociativeContainerInterface() || container->Size(containerInstance) == 0)
+            {
+                return false;
+            }
+
+            // Only elements of a single type that are stored by value and only have a value can be packed. Any element that
+            // needs a callback while it's written or loaded has to go through the element walk.
+            const SerializeContext::ClassElement* elementInfo = nullptr;
+            size_t numElementTypes = 0;
+            container->EnumTypes([&elementInfo, &numElementTypes](const Uuid&, const SerializeContext::ClassElement* classElement)
+            {
+                elementInfo = classElement;
+                ++numElementTypes;
+                return true;
+            });
+            if (numElementTypes != 1 || !elementInfo || (elementInfo->m_flags & SerializeContext::ClassElement::FLG_POINTER))
+            {
+                return false;
+            }
+
+            const SerializeContext::ClassData* elementClassData = elementInfo->m_genericClassInfo
+                ? elementInfo->m_genericClassInfo->GetClassData() : m_sc->FindClassData(elementInfo->m_typeId);
+            if (!elementClassData || !elementClassData->m_serializer || elementClassData->m_container || !elementClassData->m_elements.empty()
+                || elementClassData->m_eventHandler || elementClassData->m_doSave || elementClassData->m_version >= 0x100
+                || elementClassData->m_typeId == GetAssetClassId()
+                || elementClassData->FindAttribute(SerializeContextAttributes::ObjectStreamWriteElementOverride))
+            {
+                return false;
+            }
+
+            // The values have to be saved before anything is written, the container can only be packed if they all have the same
+            // size and none of them is overlaid
+            m_packedValues.clear();
+            IO::ByteContainerStream<AZStd::vector<char>> valueStream(&m_packedValues);
+            size_t valueSize = 0;
+            size_t numElements = 0;
+            bool canPack = true;
+            container->EnumElements(containerInstance,
+                [this, elementInfo, elementClassData, &valueStream, &valueSize, &numElements, &canPack]
+                (void* elementPtr, const Uuid&, const SerializeContext::ClassData*, const SerializeContext::ClassElement*)
+            {
+                DataOverlayInfo overlay;
+                EBUS_EVENT_ID_RESULT(overlay, DataOverlayInstanceId(elementPtr, elementInfo->m_typeId), DataOverlayInstanceBus, GetOverlayInfo);
+                const size_t elementValueSize = elementClassData->m_serializer->Save(elementPtr, valueStream, true);
+                canPack = !overlay.m_providerId && elementValueSize > 0 && (numElements == 0 || elementValueSize == valueSize);
+                valueSize = elementValueSize;
+                ++numElements;
+                return canPack;
+            });
+            if (!canPack || valueSize >= 0x100000000 || numElements >= 0x100000000)
+            {
+                return false;
+            }
+
+            const PackedElementsLayout layout{ elementClassData->m_typeId, elementInfo->m_nameCrc, static_cast<u8>(elementClassData->m_version), static_cast<u32>(valueSize) };
+            auto layoutIt = AZStd::find(m_packedLayouts.begin(), m_packedLayouts.end(), layout);
+            const bool isNewLayout = layoutIt == m_packedLayouts.end();
+
+            u8 packedTag = ST_BINARY_PACKED_ELEMENTS;
+            m_stream->Write(sizeof(packedTag), &packedTag);
+            WriteVarUInt(static_cast<u32>(layoutIt - m_packedLayouts.begin()));
+            if (isNewLayout)
+            {
+                m_packedLayouts.push_back(layout);
+
+                WriteTypeId(layout.m_typeId);
+                u32 nameCrc = layout.m_nameCrc;
+                AZStd::endian_swap(nameCrc);
+                m_stream->Write(sizeof(nameCrc), &nameCrc);
+                m_stream->Write(sizeof(layout.m_version), &layout.m_version);
+                WriteVarUInt(layout.m_valueSize);
+            }
+            WriteVarUInt(static_cast<u32>(numElements));
+            m_stream->Write(m_packedValues.size(), m_packedValues.data());
+            return true;
+        }
+
+        //=========================================================================
+        // ReadPackedElementsHeader
+        //=========================================================================
+        bool ObjectStreamImpl::ReadPackedElementsHeader(u32& layoutIndex, u32& numElements)
+        {
+            if (!ReadVarUInt(layoutIndex))
+            {
+                m_errorLogger.ReportError("Failed trying to read binary packed elements layout index!");
+                return false;
+            }
+
+            // an index past the end of the table is only valid for the next new layout, which is followed by the layout
+            if (layoutIndex == m_packedLayouts.size())
+            {
+                PackedElementsLayout layout;
+                if (!ReadTypeId(layout.m_typeId)
+                    || m_stream->Read(sizeof(layout.m_nameCrc), &layout.m_nameCrc) != sizeof(layout.m_nameCrc)
+                    || m_stream->Read(sizeof(layout.m_version), &layout.m_version) != sizeof(layout.m_version)
+                    || !ReadVarUInt(layout.m_valueSize))
+                {
+                    m_errorLogger.ReportError("Failed trying to read binary packed elements layout!");
+                    return false;
+                }
+                AZStd::endian_swap(layout.m_nameCrc);
+                m_packedLayouts.push_back(layout);
+            }
+            else if (layoutIndex > m_packedLayouts.size())
+            {
+                m_errorLogger.ReportError(AZStd::string::format("Invalid binary packed elements layout index %u, the stream only has %zu layouts!", layoutIndex, m_packedLayouts.size()).c_str());
+                return false;
+            }
+
+            const size_t remainingBytes = static_cast<size_t>(m_stream->GetLength() - m_stream->GetCurPos());
+            if (!ReadVarUInt(numElements) || numElements == 0
+                || static_cast<u64>(numElements) * m_packedLayouts[layoutIndex].m_valueSize > remainingBytes)
+            {
+                m_errorLogger.ReportError("Failed trying to read binary packed elements, the number of elements is invalid!");
+                return false;
+            }
+            return true;
+        }
+
+        //=========================================================================
+        // ReadPackedElements
+        //=========================================================================
+        bool ObjectStreamImpl::ReadPackedElements()
+        {
+            u32 layoutIndex = 0;
+            u32 numElements = 0;
+            if (!ReadPackedElementsHeader(layoutIndex, numElements))
+            {
+                return false;
+            }
+
+            const size_t numBytes = static_cast<size_t>(numElements) * m_packedLayouts[layoutIndex].m_valueSize;
+            m_packedValues.resize_no_construct(numBytes);
+            if (m_stream->Read(numBytes, m_packedValues.data()) != numBytes)
+            {
+                m_errorLogger.ReportError("Failed trying to read binary packed element values!");
+                return false;
+            }
+
+            m_packedLayoutIndex = layoutIndex;
+            m_numPackedElements = numElements;
+            m_nextPackedElement = 0;
+            return true;
+        }
+
+        //=========================================================================
+        // ReadPackedElement
+        //=========================================================================
+        bool ObjectStreamImpl::ReadPackedElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent)
+        {
+            // The element is handed out just like one that wasn't packed, so converters and everything else that walks the elements
+            // sees no difference
+            const PackedElementsLayout& layout = m_packedLayouts[m_packedLayoutIndex];
+            element.m_nameCrc = layout.m_nameCrc;
+            element.m_version = layout.m_version;
+            element.m_id = layout.m_typeId;
+            element.m_dataType = SerializeContext::DataElement::DT_BINARY_BE;
+
+            cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
+            if (cd)
+            {
+                // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
+                if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
+                {
+                    element.m_id = genericClassInfo->GetSpecializedTypeId();
+                }
+            }
+
+            element.m_dataSize = layout.m_valueSize;
+            element.m_stream->Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+            element.m_stream->Write(layout.m_valueSize, m_packedValues.data() + m_nextPackedElement * layout.m_valueSize);
+
+            ++m_nextPackedElement;
+            m_isInPackedElement = true;
+            return true;
+        }
+
+        //=========================================================================
+        // LoadPackedElements
+        //=========================================================================
+        bool ObjectStreamImpl::LoadPackedElements(const SerializeContext::DataElement& element, const SerializeContext::ClassData* classData, const SerializeContext::ClassElement* classElement,
+            SerializeContext::IDataContainer* classContainer, void* parentClassPtr, size_t& currentContainerElementIndex)
+        {
+            AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "ObjectStreamImpl::LoadPackedElements");
+
+            bool result = true;
+            const size_t valueSize = m_packedLayouts[m_packedLayoutIndex].m_valueSize;
+            // the element that was handed out by ReadElement is loaded from the block as well
+            for (size_t elementIndex = m_nextPackedElement - 1; elementIndex < m_numPackedElements; ++elementIndex)
+            {
+                StorageAddressElement storageElement{ nullptr, nullptr, result, classContainer, currentContainerElementIndex };
+                if (GetElementStorageAddress(storageElement, classElement, element, classData, parentClassPtr) != StorageAddressResult::Success)
+                {
+                    continue;
+                }
+
+                IO::MemoryStream valueStream(m_packedValues.data() + elementIndex * valueSize, valueSize);
+                if (!classData->m_serializer->Load(storageElement.m_dataAddress, valueStream, element.m_version, true))
+                {
+                    AZStd::string error = AZStd::string::format("Serializer failed for %s '%s'(0x%x).  File %s",
+                        classData->m_name, element.m_name ? element.m_name : "NULL", element.m_nameCrc,
+                        GetStreamFilename());
+
+                    result = result && ((m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0);  // in strict mode, this is a complete failure.
+                    m_errorLogger.ReportError(error.c_str());
+                }
+
+                classContainer->StoreElement(parentClassPtr, storageElement.m_reserveAddress);
+            }
+
+            m_nextPackedElement = m_numPackedElements;
+            m_isInPackedElement = false;
+            return result;
+        }
+
         //=========================================================================
         // Start
         // [6/12/2012]
@@ -1937,6 +2380,11 @@ namespace AZ
 
             if (m_flags & OPF_SAVING)
             {
+                if (m_type != ST_BINARY)
+                {
+                    m_version = s_textObjectStreamVersion;
+                }
+
                 if (m_type == ST_XML)
                 {
                     AZStd::string versionStr = AZStd::string::format("%d", m_version);
@@ -8,6 +8,7 @@
 
 #include <cctype>
 #include <cerrno>
+#include <cstring>
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/JSON/error/en.h>
 #include <AzCore/NativeUI//NativeUIRequests.h>
@@ -19,6 +20,272 @@
 
 namespace AZ
 {
+    namespace
+    {
+        // Snapshots start with a signature and version, followed by the root value. Every value starts with a tag, strings
+        // and member names are stored with their length and arrays and objects with their element count.
+        constexpr char SnapshotSignature[4] = { 'S', 'R', 'S', 'N' };
+        constexpr u32 SnapshotVersion = 1;
+        // Protects the reader against stack overflows from corrupted snapshots. This is far deeper than any settings file goes.
+        constexpr u32 SnapshotMaxDepth = 256;
+
+        enum class SnapshotTag : u8
+        {
+            Null,
+            False,
+            True,
+            Int64,
+            Uint64,
+            Double,
+            String,
+            Array,
+            Object
+        };
+
+        template<typename T>
+        void WriteSnapshotData(AZStd::vector<char>& snapshot, const T& value)
+        {
+            const char* bytes = reinterpret_cast<const char*>(&value);
+            snapshot.insert(snapshot.end(), bytes, bytes + sizeof(T));
+        }
+
+        void WriteSnapshotString(AZStd::vector<char>& snapshot, const char* string, u32 length)
+        {
+            WriteSnapshotData(snapshot, length);
+            snapshot.insert(snapshot.end(), string, string + length);
+        }
+
+        void WriteSnapshotValue(AZStd::vector<char>& snapshot, const rapidjson::Value& value)
+        {
+            switch (value.GetType())
+            {
+            case rapidjson::kNullType:
+                WriteSnapshotData(snapshot, SnapshotTag::Null);
+                break;
+            case rapidjson::kFalseType:
+                WriteSnapshotData(snapshot, SnapshotTag::False);
+                break;
+            case rapidjson::kTrueType:
+                WriteSnapshotData(snapshot, SnapshotTag::True);
+                break;
+            case rapidjson::kNumberType:
+                if (value.IsDouble())
+                {
+                    WriteSnapshotData(snapshot, SnapshotTag::Double);
+                    WriteSnapshotData(snapshot, value.GetDouble());
+                }
+                else if (value.IsInt64())
+                {
+                    WriteSnapshotData(snapshot, SnapshotTag::Int64);
+                    WriteSnapshotData(snapshot, value.GetInt64());
+                }
+                else
+                {
+                    WriteSnapshotData(snapshot, SnapshotTag::Uint64);
+                    WriteSnapshotData(snapshot, value.GetUint64());
+                }
+                break;
+            case rapidjson::kStringType:
+                WriteSnapshotData(snapshot, SnapshotTag::String);
+                WriteSnapshotString(snapshot, value.GetString(), value.GetStringLength());
+                break;
+            case rapidjson::kArrayType:
+                WriteSnapshotData(snapshot, SnapshotTag::Array);
+                WriteSnapshotData(snapshot, aznumeric_cast<u32>(value.Size()));
+                for (const rapidjson::Value& element : value.GetArray())
+                {
+                    WriteSnapshotValue(snapshot, element);
+                }
+                break;
+            case rapidjson::kObjectType:
+                WriteSnapshotData(snapshot, SnapshotTag::Object);
+                WriteSnapshotData(snapshot, aznumeric_cast<u32>(value.MemberCount()));
+                for (const auto& member : value.GetObject())
+                {
+                    WriteSnapshotString(snapshot, member.name.GetString(), member.name.GetStringLength());
+                    WriteSnapshotValue(snapshot, member.value);
+                }
+                break;
+            default:
+                AZ_Assert(false, "Unsupported json type %i found while writing a Settings Registry snapshot.", value.GetType());
+                WriteSnapshotData(snapshot, SnapshotTag::Null);
+                break;
+            }
+        }
+
+        class SnapshotReader
+        {
+        public:
+            SnapshotReader(AZStd::string_view snapshot, rapidjson::Document::AllocatorType& allocator)
+                : m_remaining(snapshot)
+                , m_allocator(allocator)
+            {
+            }
+
+            template<typename T>
+            bool Read(T& value)
+            {
+                if (m_remaining.size() < sizeof(T))
+                {
+                    return false;
+                }
+                memcpy(&value, m_remaining.data(), sizeof(T));
+                m_remaining.remove_prefix(sizeof(T));
+                return true;
+            }
+
+            bool ReadString(AZStd::string_view& string)
+            {
+                u32 length;
+                if (!Read(length) || m_remaining.size() < length)
+                {
+                    return false;
+                }
+                string = m_remaining.substr(0, length);
+                m_remaining.remove_prefix(length);
+                return true;
+            }
+
+            bool ReadValue(rapidjson::Value& value, u32 depth)
+            {
+                SnapshotTag tag;
+                if (!Read(tag))
+                {
+                    return false;
+                }
+
+                switch (tag)
+                {
+                case SnapshotTag::Null:
+                    value.SetNull();
+                    return true;
+                case SnapshotTag::False:
+                    value.SetBool(false);
+                    return true;
+                case SnapshotTag::True:
+                    value.SetBool(true);
+                    return true;
+                case SnapshotTag::Int64:
+                {
+                    int64_t number;
+                    if (!Read(number))
+                    {
+                        return false;
+                    }
+                    value.SetInt64(number);
+                    return true;
+                }
+                case SnapshotTag::Uint64:
+                {
+                    uint64_t number;
+                    if (!Read(number))
+                    {
+                        return false;
+                    }
+                    value.SetUint64(number);
+                    return true;
+                }
+                case SnapshotTag::Double:
+                {
+                    double number;
+                    if (!Read(number))
+                    {
+                        return false;
+                    }
+                    value.SetDouble(number);
+                    return true;
+                }
+                case SnapshotTag::String:
+                {
+                    AZStd::string_view string;
+                    if (!ReadString(string))
+                    {
+                        return false;
+                    }
+                    value.SetString(string.data(), aznumeric_caster(string.length()), m_allocator);
+                    return true;
+                }
+                case SnapshotTag::Array:
+                {
+                    u32 count;
+                    // Every element takes at least one byte, which rejects corrupted counts before reserving memory for them.
+                    if (depth >= SnapshotMaxDepth || !Read(count) || count > m_remaining.size())
+                    {
+                        return false;
+                    }
+                    value.SetArray();
+                    value.Reserve(count, m_allocator);
+                    for (u32 i = 0; i < count; ++i)
+                    {
+                        rapidjson::Value element;
+                        if (!ReadValue(element, depth + 1))
+                        {
+                            return false;
+                        }
+                        value.PushBack(element, m_allocator);
+                    }
+                    return true;
+                }
+                case SnapshotTag::Object:
+                {
+                    u32 count;
+                    if (depth >= SnapshotMaxDepth || !Read(count) || count > m_remaining.size())
+                    {
+                        return false;
+                    }
+                    value.SetObject();
+                    for (u32 i = 0; i < count; ++i)
+                    {
+                        AZStd::string_view name;
+                        rapidjson::Value member;
+                        if (!ReadString(name) || !ReadValue(member, depth + 1))
+                        {
+                            return false;
+                        }
+                        rapidjson::Value memberName(name.data(), aznumeric_caster(name.length()), m_allocator);
+                        value.AddMember(memberName, member, m_allocator);
+                    }
+                    return true;
+                }
+                default:
+                    return false;
+                }
+            }
+
+            bool IsAtEnd() const
+            {
+                return m_remaining.empty();
+            }
+
+        private:
+            AZStd::string_view m_remaining;
+            rapidjson::Document::AllocatorType& m_allocator;
+        };
+
+        // Merges the source into the target by moving its values. Both need to use the same allocator.
+        void MergeSnapshotValue(rapidjson::Value& target, rapidjson::Value& source, rapidjson::Document::AllocatorType& allocator)
+        {
+            if (target.IsObject() && source.IsObject())
+            {
+                for (auto& member : source.GetObject())
+                {
+                    if (auto targetMember = target.FindMember(member.name); targetMember != target.MemberEnd())
+                    {
+                        MergeSnapshotValue(targetMember->value, member.value, allocator);
+                    }
+                    else
+                    {
+                        target.AddMember(member.name.Move(), member.value.Move(), allocator);
+                    }
+                }
+            }
+            else
+            {
+                target = source.Move();
+            }
+        }
+    } // namespace
+
     template<typename T>
     bool SettingsRegistryImpl::SetValueInternal(AZStd::string_view path, T value, SettingsRegistryInterface::Type type)
     {
@@ -1154,6 +1421,58 @@ namespace AZ
         return true;
     }
 
+    bool SettingsRegistryImpl::SaveSnapshot(AZStd::vector<char>& snapshot) const
+    {
+        snapshot.clear();
+        snapshot.insert(snapshot.end(), SnapshotSignature, SnapshotSignature + sizeof(SnapshotSignature));
+        WriteSnapshotData(snapshot, SnapshotVersion);
+
+        AZStd::scoped_lock lock(m_settingMutex);
+        WriteSnapshotValue(snapshot, m_settings);
+        return true;
+    }
+
+    bool SettingsRegistryImpl::MergeSnapshot(AZStd::string_view snapshot)
+    {
+        constexpr size_t headerSize = sizeof(SnapshotSignature) + sizeof(SnapshotVersion);
+        u32 version;
+        if (snapshot.size() < headerSize || memcmp(snapshot.data(), SnapshotSignature, sizeof(SnapshotSignature)) != 0)
+        {
+            AZ_Error("Settings Registry", false, "Unable to merge snapshot because it's not a Settings Registry snapshot.");
+            return false;
+        }
+        memcpy(&version, snapshot.data() + sizeof(SnapshotSignature), sizeof(version));
+        if (version != SnapshotVersion)
+        {
+            AZ_Warning("Settings Registry", false, "Unable to merge snapshot with version %u, only version %u is supported.",
+                version, SnapshotVersion);
+            return false;
+        }
+
+        AZStd::scoped_lock lock(m_settingMutex);
+
+        // The settings are read directly into the allocator of the registry so they can be moved into place. If the snapshot
+        // is corrupted, the memory used by the partially read settings is released together with the registry.
+        rapidjson::Value settings;
+        SnapshotReader reader(snapshot.substr(headerSize), m_settings.GetAllocator());
+        if (!reader.ReadValue(settings, 0) || !reader.IsAtEnd())
+        {
+            AZ_Error("Settings Registry", false, "Unable to merge snapshot because it's corrupted.");
+            return false;
+        }
+        if (!settings.IsObject())
+        {
+            AZ_Error("Settings Registry", false, "Unable to merge snapshot because its root isn't a JSON Object.");
+            return false;
+        }
+
+        MergeSnapshotValue(m_settings, settings, m_settings.GetAllocator());
+
+        m_notifiers.Signal("", Type::Object);
+
+        return true;
+    }
+
     void SettingsRegistryImpl::SetApplyPatchSettings(const AZ::JsonApplyPatchSettings& applyPatchSettings)
     {
         m_applyPatchSettings = applyPatchSettings;
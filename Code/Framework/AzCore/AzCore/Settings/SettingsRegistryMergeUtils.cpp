@@ -8,14 +8,18 @@
 
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/IO/TextStreamWriters.h>
 #include <AzCore/JSON/document.h>
 #include <AzCore/JSON/pointer.h>
 #include <AzCore/JSON/prettywriter.h>
 #include <AzCore/JSON/writer.h>
 #include <AzCore/PlatformId/PlatformDefaults.h>
+#include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/Settings/CommandLine.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/std/string/wildcard.h>
 #include <AzCore/std/tuple.h>
@@ -23,6 +27,7 @@
 #include <AzCore/Utils/Utils.h>
 
 #include <cinttypes>
+#include <cstring>
 #include <locale>
 
 namespace AZ::Internal
@@ -221,6 +226,187 @@ namespace AZ::Internal
         commandLine.Parse(paramContainer);
         AZ::SettingsRegistryMergeUtils::StoreCommandLineToRegistry(settingsRegistry, commandLine);
     }
+
+    // Compiled registries start with a header identifying the launch they can be used for, followed by the settings files and
+    // registry folders the settings were merged from and the snapshot of the settings.
+    constexpr char CompiledRegistrySignature[4] = { 'S', 'R', 'C', 'R' };
+    constexpr AZ::u32 CompiledRegistryVersion = 1;
+    constexpr AZStd::string_view CompiledRegistryFolder = "CompiledRegistry";
+
+    enum class CompiledRegistrySourceType : AZ::u8
+    {
+        File,
+        MissingFile,
+        Folder
+    };
+
+    struct CompiledRegistrySource
+    {
+        AZ::IO::FixedMaxPathString m_path;
+        AZ::u64 m_hash{};
+        CompiledRegistrySourceType m_type{ CompiledRegistrySourceType::File };
+    };
+
+    template<typename T>
+    void AppendCompiledRegistryData(AZStd::vector<char>& output, const T& value)
+    {
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        output.insert(output.end(), bytes, bytes + sizeof(T));
+    }
+
+    template<typename T>
+    bool ConsumeCompiledRegistryData(AZStd::string_view& input, T& value)
+    {
+        if (input.size() < sizeof(T))
+        {
+            return false;
+        }
+        memcpy(&value, input.data(), sizeof(T));
+        input.remove_prefix(sizeof(T));
+        return true;
+    }
+
+    AZ::HashValue64 HashCompiledRegistrySpecializations(const AZ::SettingsRegistryInterface::Specializations& specializations,
+        AZStd::string_view platform)
+    {
+        AZ::HashValue64 hash = AZ::TypeHash64(reinterpret_cast<const uint8_t*>(platform.data()), platform.size());
+        const size_t specializationCount = specializations.GetCount();
+        for (size_t i = 0; i < specializationCount; ++i)
+        {
+            AZStd::string_view name = specializations.GetSpecialization(i);
+            hash = AZ::TypeHash64(reinterpret_cast<const uint8_t*>(name.data()), name.size(), hash);
+        }
+        return hash;
+    }
+
+    bool HashCompiledRegistryFile(AZ::u64& hash, const char* path, AZStd::vector<char>& scratchBuffer)
+    {
+        AZ::IO::SystemFile file;
+        if (!file.Open(path, AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+        {
+            return false;
+        }
+
+        const AZ::IO::SystemFile::SizeType fileSize = file.Length();
+        scratchBuffer.resize_no_construct(fileSize);
+        if (file.Read(fileSize, scratchBuffer.data()) != fileSize)
+        {
+            return false;
+        }
+        hash = static_cast<AZ::u64>(AZ::TypeHash64(reinterpret_cast<const uint8_t*>(scratchBuffer.data()), fileSize));
+        return true;
+    }
+
+    // Hashes the names of the files in a registry folder and its platform folder. The content of the files that were merged is
+    // checked separately, so this only needs to detect files being added or removed.
+    AZ::u64 HashCompiledRegistryFolder(AZStd::string_view folderFilter, AZStd::string_view platform)
+    {
+        AZStd::vector<AZStd::string> fileNames;
+        auto collectFiles = [&fileNames](const char* filename, bool isFile) -> bool
+        {
+            if (isFile)
+            {
+                fileNames.emplace_back(filename);
+            }
+            return true;
+        };
+
+        // The file history stores the folder with a trailing wildcard.
+        AZ::IO::FixedMaxPathString filter{ folderFilter };
+        AZ::IO::SystemFile::FindFiles(filter.c_str(), collectFiles);
+        const size_t folderFileCount = fileNames.size();
+        if (!platform.empty() && !filter.empty() && filter.back() == '*')
+        {
+            filter.pop_back();
+            filter += AZ::SettingsRegistryInterface::PlatformFolder;
+            filter.push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+            filter += platform;
+            filter.push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+            filter.push_back('*');
+            AZ::IO::SystemFile::FindFiles(filter.c_str(), collectFiles);
+        }
+
+        // The order in which files are found isn't guaranteed.
+        AZStd::sort(fileNames.begin(), fileNames.begin() + folderFileCount);
+        AZStd::sort(fileNames.begin() + folderFileCount, fileNames.end());
+
+        AZ::HashValue64 hash = AZ::TypeHash64(folderFileCount);
+        for (const AZStd::string& fileName : fileNames)
+        {
+            hash = AZ::TypeHash64(reinterpret_cast<const uint8_t*>(fileName.c_str()), fileName.size() + 1, hash);
+        }
+        return static_cast<AZ::u64>(hash);
+    }
+
+    // Collects the settings files and registry folders from the file history of the registry.
+    void CollectCompiledRegistrySources(AZ::SettingsRegistryInterface& registry, AZStd::string_view platform,
+        AZStd::vector<CompiledRegistrySource>& sources)
+    {
+        using Type = AZ::SettingsRegistryInterface::Type;
+        using FixedValueString = AZ::SettingsRegistryInterface::FixedValueString;
+
+        AZStd::vector<char> scratchBuffer;
+        for (size_t index = 0;; ++index)
+        {
+            const auto historyKey = FixedValueString::format(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/%zu", index);
+            const Type entryType = registry.GetType(historyKey);
+            if (entryType == Type::NoType)
+            {
+                break;
+            }
+
+            CompiledRegistrySource source;
+            if (entryType == Type::Object && registry.Get(source.m_path, historyKey + "/Folder"))
+            {
+                source.m_type = CompiledRegistrySourceType::Folder;
+            }
+            // Files that failed to merge are stored as objects with the path of the file.
+            else if (!registry.Get(source.m_path, historyKey) && !registry.Get(source.m_path, historyKey + "/Path"))
+            {
+                continue;
+            }
+
+            // Development builds merge some of the folders multiple times.
+            auto sameSource = [&source](const CompiledRegistrySource& existing)
+            {
+                return (existing.m_type == CompiledRegistrySourceType::Folder) == (source.m_type == CompiledRegistrySourceType::Folder) &&
+                    existing.m_path == source.m_path;
+            };
+            if (AZStd::find_if(sources.begin(), sources.end(), sameSource) != sources.end())
+            {
+                continue;
+            }
+
+            if (source.m_type == CompiledRegistrySourceType::Folder)
+            {
+                source.m_hash = HashCompiledRegistryFolder(source.m_path, platform);
+            }
+            else if (!HashCompiledRegistryFile(source.m_hash, source.m_path.c_str(), scratchBuffer))
+            {
+                source.m_type = CompiledRegistrySourceType::MissingFile;
+            }
+            sources.push_back(AZStd::move(source));
+        }
+    }
+
+    bool IsCompiledRegistrySourceUnchanged(const CompiledRegistrySource& source, AZStd::string_view platform,
+        AZStd::vector<char>& scratchBuffer)
+    {
+        switch (source.m_type)
+        {
+        case CompiledRegistrySourceType::File:
+        {
+            AZ::u64 hash;
+            return HashCompiledRegistryFile(hash, source.m_path.c_str(), scratchBuffer) && hash == source.m_hash;
+        }
+        case CompiledRegistrySourceType::MissingFile:
+            return !AZ::IO::SystemFile::Exists(source.m_path.c_str());
+        case CompiledRegistrySourceType::Folder:
+            return HashCompiledRegistryFolder(source.m_path, platform) == source.m_hash;
+        default:
+            return false;
+        }
+    }
 } // namespace AZ::Internal
 
 namespace AZ::SettingsRegistryMergeUtils
@@ -977,6 +1163,171 @@ namespace AZ::SettingsRegistryMergeUtils
         }
     }
 
+    AZ::IO::FixedMaxPath GetCompiledRegistryPath(SettingsRegistryInterface& registry,
+        const SettingsRegistryInterface::Specializations& specializations, AZStd::string_view platform)
+    {
+        // The compiled registry can't be stored in the user registry folder, as adding it would change the content of that folder.
+        AZ::IO::FixedMaxPath compiledRegistryPath;
+        if (!registry.Get(compiledRegistryPath.Native(), FilePathKey_ProjectUserPath))
+        {
+            return {};
+        }
+
+        const AZ::HashValue64 nameHash = AZ::Internal::HashCompiledRegistrySpecializations(specializations, platform);
+        compiledRegistryPath /= AZ::Internal::CompiledRegistryFolder;
+        compiledRegistryPath /= AZ::IO::FixedMaxPathString::format("%016" PRIx64 ".setregbin", static_cast<AZ::u64>(nameHash));
+        return compiledRegistryPath;
+    }
+
+    AZ::HashValue64 GetCompiledRegistryLaunchKey(SettingsRegistryInterface& registry,
+        const SettingsRegistryInterface::Specializations& specializations, AZStd::string_view platform)
+    {
+        AZStd::vector<char> snapshot;
+        if (auto registryImpl = azrtti_cast<SettingsRegistryImpl*>(&registry); registryImpl != nullptr)
+        {
+            registryImpl->SaveSnapshot(snapshot);
+        }
+        return AZ::TypeHash64(reinterpret_cast<const uint8_t*>(snapshot.data()), snapshot.size(),
+            AZ::Internal::HashCompiledRegistrySpecializations(specializations, platform));
+    }
+
+    bool MergeSettingsToRegistry_CompiledRegistry(SettingsRegistryInterface& registry, AZStd::string_view filePath,
+        AZStd::string_view platform, AZ::HashValue64 launchKey)
+    {
+        using namespace AZ::Internal;
+
+        auto registryImpl = azrtti_cast<SettingsRegistryImpl*>(&registry);
+        if (registryImpl == nullptr || filePath.size() > AZ::IO::MaxPathLength)
+        {
+            return false;
+        }
+
+        // The whole compiled registry is read in a single read.
+        const AZ::IO::FixedMaxPathString path{ filePath };
+        const AZ::IO::SystemFile::SizeType fileSize = AZ::IO::SystemFile::Length(path.c_str());
+        if (fileSize == 0)
+        {
+            return false;
+        }
+        AZStd::vector<char> buffer;
+        buffer.resize_no_construct(fileSize);
+        if (AZ::IO::SystemFile::Read(path.c_str(), buffer.data(), fileSize) != fileSize)
+        {
+            return false;
+        }
+
+        AZStd::string_view remaining(buffer.data(), buffer.size());
+        char signature[sizeof(CompiledRegistrySignature)];
+        AZ::u32 version;
+        AZ::u64 storedLaunchKey;
+        AZ::u32 sourceCount;
+        if (!ConsumeCompiledRegistryData(remaining, signature) ||
+            memcmp(signature, CompiledRegistrySignature, sizeof(CompiledRegistrySignature)) != 0 ||
+            !ConsumeCompiledRegistryData(remaining, version) || version != CompiledRegistryVersion ||
+            !ConsumeCompiledRegistryData(remaining, storedLaunchKey) || storedLaunchKey != static_cast<AZ::u64>(launchKey) ||
+            !ConsumeCompiledRegistryData(remaining, sourceCount))
+        {
+            return false;
+        }
+
+        AZStd::vector<char> scratchBuffer;
+        for (AZ::u32 i = 0; i < sourceCount; ++i)
+        {
+            CompiledRegistrySource source;
+            AZ::u32 pathLength;
+            if (!ConsumeCompiledRegistryData(remaining, source.m_type) || !ConsumeCompiledRegistryData(remaining, pathLength) ||
+                pathLength > remaining.size() || pathLength > AZ::IO::MaxPathLength)
+            {
+                return false;
+            }
+            source.m_path.assign(remaining.data(), pathLength);
+            remaining.remove_prefix(pathLength);
+            if (!ConsumeCompiledRegistryData(remaining, source.m_hash))
+            {
+                return false;
+            }
+
+            if (!IsCompiledRegistrySourceUnchanged(source, platform, scratchBuffer))
+            {
+                AZ_TracePrintf("SettingsRegistryMergeUtils", R"(Compiled registry "%s" is out of date because "%s" changed.)" "\n",
+                    path.c_str(), source.m_path.c_str());
+                return false;
+            }
+        }
+
+        if (!registryImpl->MergeSnapshot(remaining))
+        {
+            return false;
+        }
+        registry.Set(CompiledRegistryLoadedPathKey, filePath);
+        return true;
+    }
+
+    bool SaveCompiledRegistry(SettingsRegistryInterface& registry, AZStd::string_view filePath,
+        AZStd::string_view platform, AZ::HashValue64 launchKey)
+    {
+        using namespace AZ::Internal;
+
+        auto registryImpl = azrtti_cast<SettingsRegistryImpl*>(&registry);
+        if (registryImpl == nullptr)
+        {
+            AZ_Warning("SettingsRegistryMergeUtils", false, "Compiled registries can only be saved for a SettingsRegistryImpl.");
+            return false;
+        }
+        if (filePath.empty() || filePath.size() + 4 > AZ::IO::MaxPathLength)
+        {
+            AZ_Warning("SettingsRegistryMergeUtils", false, "Invalid path provided for the compiled registry.");
+            return false;
+        }
+
+        AZStd::vector<CompiledRegistrySource> sources;
+        CollectCompiledRegistrySources(registry, platform, sources);
+
+        AZStd::vector<char> snapshot;
+        if (!registryImpl->SaveSnapshot(snapshot))
+        {
+            return false;
+        }
+
+        AZStd::vector<char> compiledRegistry;
+        compiledRegistry.insert(compiledRegistry.end(), CompiledRegistrySignature,
+            CompiledRegistrySignature + sizeof(CompiledRegistrySignature));
+        AppendCompiledRegistryData(compiledRegistry, CompiledRegistryVersion);
+        AppendCompiledRegistryData(compiledRegistry, static_cast<AZ::u64>(launchKey));
+        AppendCompiledRegistryData(compiledRegistry, aznumeric_cast<AZ::u32>(sources.size()));
+        for (const CompiledRegistrySource& source : sources)
+        {
+            AppendCompiledRegistryData(compiledRegistry, source.m_type);
+            AppendCompiledRegistryData(compiledRegistry, aznumeric_cast<AZ::u32>(source.m_path.size()));
+            compiledRegistry.insert(compiledRegistry.end(), source.m_path.begin(), source.m_path.end());
+            AppendCompiledRegistryData(compiledRegistry, source.m_hash);
+        }
+        compiledRegistry.insert(compiledRegistry.end(), snapshot.begin(), snapshot.end());
+
+        // Write to a temporary file first so a launch never finds a partially written compiled registry.
+        const AZ::IO::FixedMaxPathString path{ filePath };
+        AZ::IO::FixedMaxPathString tempPath{ path };
+        tempPath += ".tmp";
+
+        AZ::IO::SystemFile file;
+        if (!file.Open(tempPath.c_str(),
+            AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("SettingsRegistryMergeUtils", false, R"(Unable to open "%s" to save the compiled registry.)", tempPath.c_str());
+            return false;
+        }
+        const bool written = file.Write(compiledRegistry.data(), compiledRegistry.size()) == compiledRegistry.size();
+        file.Close();
+
+        if (!written || !AZ::IO::SystemFile::Rename(tempPath.c_str(), path.c_str(), true))
+        {
+            AZ_Warning("SettingsRegistryMergeUtils", false, R"(Unable to save the compiled registry to "%s".)", path.c_str());
+            AZ::IO::SystemFile::Delete(tempPath.c_str());
+            return false;
+        }
+        return true;
+    }
+
     bool DumpSettingsRegistryToStream(SettingsRegistryInterface& registry, AZStd::string_view key,
         AZ::IO::GenericStream& stream, const DumperSettings& dumperSettings)
     {
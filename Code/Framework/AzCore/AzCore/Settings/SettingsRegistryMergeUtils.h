@@ -12,6 +12,7 @@
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/Settings/CommandLine.h>
+#include <AzCore/Utils/TypeHash.h>
 
 namespace AZ::IO
 {
@@ -77,6 +78,13 @@ namespace AZ::SettingsRegistryMergeUtils
     //! Root key where raw engine settings (engine.json) file is merged to settings registry
     inline static constexpr char EngineSettingsRootKey[] = "/Amazon/Engine/Settings";
 
+    //! Key which enables the compiled registry. When set to true, the settings merged during startup are stored in a binary
+    //! snapshot which is merged instead of the settings files on the next launch, as long as that launch starts out with the
+    //! same settings and none of the settings files changed.
+    inline static constexpr char CompiledRegistryEnabledKey[] = "/Amazon/AzCore/Settings/CompiledRegistry/Enabled";
+    //! In-Memory only key which stores the path to the compiled registry the settings were merged from
+    inline static constexpr char CompiledRegistryLoadedPathKey[] = "/Amazon/AzCore/Runtime/Registry/CompiledRegistry";
+
     //! Examines the Settings Registry for a "${BootstrapSettingsRootKey}/engine_path" key
     //! to use as an override for the Engine Root.
     //! Otherwise a directory walk upwards from the executable directory is performed
@@ -226,6 +234,30 @@ namespace AZ::SettingsRegistryMergeUtils
     //! Parse a CommandLine and transform certain options into formal "regset" options
     void ParseCommandLine(AZ::CommandLine& commandLine);
 
+    //! Returns the path of the compiled registry for the given specializations and platform, which is stored in the
+    //! project user folder. Returns an empty path if the project user folder isn't known.
+    AZ::IO::FixedMaxPath GetCompiledRegistryPath(SettingsRegistryInterface& registry,
+        const SettingsRegistryInterface::Specializations& specializations, AZStd::string_view platform);
+
+    //! Returns the key that identifies the launches a compiled registry can be used for. The key is calculated from
+    //! the current content of the Settings Registry, such as the command line and runtime file paths, and the specializations
+    //! and platform the settings files are going to be merged with.
+    AZ::HashValue64 GetCompiledRegistryLaunchKey(SettingsRegistryInterface& registry,
+        const SettingsRegistryInterface::Specializations& specializations, AZStd::string_view platform);
+
+    //! Merges a compiled registry stored with SaveCompiledRegistry. The registry is left unchanged and false is returned
+    //! if the file doesn't exist, was stored for a different launch key or if any of the settings files or registry folders
+    //! the settings were merged from changed since it was stored.
+    //! @param platform The platform the registry folders were merged with, used to check the platform folders for changes
+    bool MergeSettingsToRegistry_CompiledRegistry(SettingsRegistryInterface& registry, AZStd::string_view filePath,
+        AZStd::string_view platform, AZ::HashValue64 launchKey);
+
+    //! Stores all settings in a compiled registry, together with the content hashes of the settings files and the
+    //! listings of the registry folders found in the file history of the Settings Registry.
+    //! Only supported for registries of type SettingsRegistryImpl.
+    bool SaveCompiledRegistry(SettingsRegistryInterface& registry, AZStd::string_view filePath,
+        AZStd::string_view platform, AZ::HashValue64 launchKey);
+
     //! Structure for configuring how values should be dumped from the Settings Registry
     struct DumperSettings
     {
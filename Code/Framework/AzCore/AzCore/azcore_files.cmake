@@ -151,6 +151,7 @@ set(FILES
     EBus/Internal/CallstackEntry.h
     EBus/Internal/Debug.h
     EBus/Internal/Handlers.h
+    EBus/Internal/SnapshotDispatch.h
     EBus/Internal/StoragePolicies.h
     Interface/Interface.h
     IO/ByteContainerStream.h
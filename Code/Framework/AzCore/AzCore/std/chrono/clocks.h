@@ -59,6 +59,7 @@ namespace AZStd
         //----------------------------------------------------------------------------//
         typedef system_clock    monotonic_clock;        // as permitted by [time.clock.monotonic]
         typedef monotonic_clock high_resolution_clock;  // as permitted by [time.clock.hires]
+        typedef monotonic_clock steady_clock;           // as permitted by [time.clock.steady]
     }
 }
 
@@ -0,0 +1,1463 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <climits>
+#include <cstring>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/typetraits/decay.h>
+#include <AzCore/StringFunc/StringFunc.h>
+
+namespace AZ::IO
+{
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+    static constexpr char FileSwitchesName[] = "File switches";
+    static constexpr char SeeksName[] = "Seeks";
+    static constexpr char DirectReadsName[] = "Direct reads (no internal alloc)";
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+    const AZStd::chrono::microseconds StorageDriveLinux::s_averageSeekTime =
+        AZStd::chrono::milliseconds(9) + // Common average seek time for desktop hdd drives.
+        AZStd::chrono::milliseconds(3); // Rotational latency for a 7200RPM disk
+
+    // The io_uring system calls are used directly to avoid taking a dependency on liburing for the few calls that are needed.
+    static int IoUringSetup(u32 entries, io_uring_params* params)
+    {
+        return aznumeric_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+    }
+
+    static int IoUringEnter(int ringFile, u32 toSubmit, u32 minComplete, u32 flags)
+    {
+        return aznumeric_cast<int>(::syscall(__NR_io_uring_enter, ringFile, toSubmit, minComplete, flags, nullptr, 0));
+    }
+
+    static int IoUringRegister(int ringFile, u32 opcode, const void* arguments, u32 argumentCount)
+    {
+        return aznumeric_cast<int>(::syscall(__NR_io_uring_register, ringFile, opcode, arguments, argumentCount));
+    }
+
+    //
+    // ConstructionOptions
+    //
+
+    StorageDriveLinux::ConstructionOptions::ConstructionOptions()
+        : m_hasSeekPenalty(true)
+        , m_enableUnbufferedReads(true)
+        , m_minimalReporting(false)
+    {}
+
+    //
+    // FileReadInformation
+    //
+
+    void StorageDriveLinux::FileReadInformation::AllocateAlignedBuffer(size_t size, size_t sectorSize)
+    {
+        AZ_Assert(m_sectorAlignedOutput == nullptr, "Assign a sector aligned buffer when one is already assigned.");
+        m_sectorAlignedOutput = azmalloc(size, sectorSize, AZ::SystemAllocator);
+    }
+
+    void StorageDriveLinux::FileReadInformation::Clear()
+    {
+        if (m_sectorAlignedOutput)
+        {
+            azfree(m_sectorAlignedOutput, AZ::SystemAllocator);
+        }
+        *this = FileReadInformation{};
+    }
+
+    //
+    // StorageDriveLinux
+    //
+    StorageDriveLinux::StorageDriveLinux(const AZStd::vector<AZStd::string_view>& drivePaths,
+        const AZStd::vector<AZStd::string_view>& excludedPaths, u32 maxFileHandles, u32 maxMetaDataCacheEntries,
+        size_t physicalSectorSize, size_t logicalSectorSize, u32 ioChannelCount, s32 overCommit, size_t registeredBufferSize,
+        ConstructionOptions options)
+        : m_maxFileHandles(maxFileHandles)
+        , m_physicalSectorSize(physicalSectorSize)
+        , m_logicalSectorSize(logicalSectorSize)
+        , m_ioChannelCount(ioChannelCount)
+        , m_overCommit(overCommit)
+        , m_constructionOptions(options)
+    {
+        AZ_Assert(!drivePaths.empty(), "StorageDriveLinux requires at least one drive path to work.");
+
+        // Create name for statistics. The name will include all mount points on this physical device
+        // for instance "Storage drive (/,/home)".
+        m_name = "Storage drive (";
+        for (size_t i = 0; i < drivePaths.size(); ++i)
+        {
+            if (i != 0)
+            {
+                m_name += ',';
+            }
+            m_name += drivePaths[i];
+        }
+        m_name += ')';
+
+        // Get the mount points. Erase the trailing slash so the root of the file system becomes an empty string, which
+        // makes matching against the start of a path the same for all mount points.
+        auto addPaths = [](AZStd::vector<AZStd::string>& target, const AZStd::vector<AZStd::string_view>& paths)
+        {
+            target.reserve(paths.size());
+            for (AZStd::string_view path : paths)
+            {
+                if (!path.empty() && (path.back() == AZ_CORRECT_FILESYSTEM_SEPARATOR || path.back() == AZ_WRONG_FILESYSTEM_SEPARATOR))
+                {
+                    path.remove_suffix(1);
+                }
+                target.emplace_back(path);
+            }
+        };
+        addPaths(m_drivePaths, drivePaths);
+        addPaths(m_excludedPaths, excludedPaths);
+
+        if (m_physicalSectorSize == 0)
+        {
+            m_physicalSectorSize = 4_kib;
+            AZ_Error("StorageDriveLinux", false,
+                "Received physical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_physicalSectorSize);
+        }
+        if (m_logicalSectorSize == 0)
+        {
+            m_logicalSectorSize = 512;
+            AZ_Error("StorageDriveLinux", false,
+                "Received logical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_logicalSectorSize);
+        }
+        AZ_Error("StorageDriveLinux", IStreamerTypes::IsPowerOf2(m_physicalSectorSize) && IStreamerTypes::IsPowerOf2(m_logicalSectorSize),
+            "StorageDriveLinux requires power-of-2 sector sizes. Received physical: %zu and logical: %zu",
+            m_physicalSectorSize, m_logicalSectorSize);
+
+        // Cap the IO channels to the maximum
+        if (m_ioChannelCount == 0)
+        {
+            m_ioChannelCount = 32;
+            AZ_Warning("StorageDriveLinux", false,
+                "Received io channel count of 0 for %s. Picking a count of %u instead.\n", m_name.c_str(), m_ioChannelCount);
+        }
+        else
+        {
+            m_ioChannelCount = AZ::GetMin(m_ioChannelCount, MaxIoChannels);
+        }
+        // Make sure that the overCommit isn't so small that no slots are ever reported.
+        if (aznumeric_cast<s32>(m_ioChannelCount) + m_overCommit <= 0)
+        {
+            AZ_Error("StorageDriveLinux", false,
+                "Received overcommit (%i) for %s that subtracts more than the number of IO channels (%u). Setting combined count to 1.\n",
+                m_overCommit, m_name.c_str(), m_ioChannelCount);
+            m_overCommit = 1 - aznumeric_cast<s32>(m_ioChannelCount);
+        }
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+        m_readLatencySizeAverage.PushEntry(1);
+        m_readLatencyAverage.PushEntry(AZStd::chrono::microseconds(1));
+
+        AZ_Assert(IStreamerTypes::IsPowerOf2(maxMetaDataCacheEntries),
+            "StorageDriveLinux requires a power-of-2 for maxMetaDataCacheEntries. Received %u", maxMetaDataCacheEntries);
+        m_metaDataCache_paths.resize(maxMetaDataCacheEntries);
+        m_metaDataCache_fileSize.resize(maxMetaDataCacheEntries);
+
+        if (CreateRing())
+        {
+            if (m_constructionOptions.m_enableUnbufferedReads && registeredBufferSize > 0)
+            {
+                // Register a sector aligned buffer for every io channel once, so unaligned reads don't need to allocate memory
+                // and the kernel doesn't need to map the pages for every read.
+                m_registeredBufferSize = AZ_SIZE_ALIGN_UP(registeredBufferSize, m_physicalSectorSize);
+                m_registeredBuffers = reinterpret_cast<u8*>(
+                    azmalloc(m_registeredBufferSize * m_ioChannelCount, m_physicalSectorSize, AZ::SystemAllocator));
+
+                AZStd::vector<iovec> buffers;
+                buffers.resize(m_ioChannelCount);
+                for (u32 i = 0; i < m_ioChannelCount; ++i)
+                {
+                    buffers[i].iov_base = m_registeredBuffers + (i * m_registeredBufferSize);
+                    buffers[i].iov_len = m_registeredBufferSize;
+                }
+                if (IoUringRegister(m_ring.m_ringFile, IORING_REGISTER_BUFFERS, buffers.data(), m_ioChannelCount) < 0)
+                {
+                    // This commonly happens when the buffers exceed the limit on locked memory (RLIMIT_MEMLOCK). Reads will still
+                    // work, but unaligned reads will allocate a temporary buffer instead.
+                    AZ_Warning("StorageDriveLinux", false, "Unable to register %zu bytes of read buffers for %s (Error: %i).\n",
+                        m_registeredBufferSize * m_ioChannelCount, m_name.c_str(), errno);
+                    azfree(m_registeredBuffers, AZ::SystemAllocator);
+                    m_registeredBuffers = nullptr;
+                    m_registeredBufferSize = 0;
+                }
+            }
+
+            if (!m_constructionOptions.m_minimalReporting)
+            {
+                AZ_Printf("Streamer", "%s created.\n", m_name.c_str());
+            }
+        }
+    }
+
+    StorageDriveLinux::~StorageDriveLinux()
+    {
+        AZ_Assert(m_activeReads_Count == 0, "%s is being destroyed while there are still %u reads in flight.",
+            m_name.c_str(), m_activeReads_Count);
+
+        for (int file : m_fileCache_handles)
+        {
+            if (file != -1)
+            {
+                ::close(file);
+            }
+        }
+
+        bool wasAvailable = IsAvailable();
+        // Destroy the ring first as that releases the kernel's reference to the registered buffers.
+        DestroyRing();
+        if (m_registeredBuffers)
+        {
+            azfree(m_registeredBuffers, AZ::SystemAllocator);
+        }
+
+        if (wasAvailable && !m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s destroyed.\n", m_name.c_str());
+        }
+    }
+
+    bool StorageDriveLinux::CreateRing()
+    {
+        // Reserve space for a cancel request for every read that can be in flight.
+        io_uring_params parameters{};
+        int ringFile = IoUringSetup(m_ioChannelCount * 2, &parameters);
+        if (ringFile < 0)
+        {
+            AZ_Warning("StorageDriveLinux", false,
+                "Unable to create an io_uring instance for %s (Error: %i). Requests will be forwarded to the next entry in the stack.\n",
+                m_name.c_str(), errno);
+            return false;
+        }
+        m_ring.m_ringFile = ringFile;
+
+        // IORING_OP_READ was introduced in the same kernel version as this feature flag.
+        if ((parameters.features & IORING_FEAT_RW_CUR_POS) == 0)
+        {
+            AZ_Warning("StorageDriveLinux", false,
+                "The kernel's io_uring implementation is too old to be used by %s. Requests will be forwarded to the next entry in the "
+                "stack.\n", m_name.c_str());
+            DestroyRing();
+            return false;
+        }
+
+        m_ring.m_submissionRingSize = parameters.sq_off.array + parameters.sq_entries * sizeof(u32);
+        m_ring.m_completionRingSize = parameters.cq_off.cqes + parameters.cq_entries * sizeof(io_uring_cqe);
+        const bool isSingleMap = (parameters.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (isSingleMap)
+        {
+            m_ring.m_submissionRingSize = AZStd::max(m_ring.m_submissionRingSize, m_ring.m_completionRingSize);
+            m_ring.m_completionRingSize = m_ring.m_submissionRingSize;
+        }
+
+        void* submissionRing = ::mmap(nullptr, m_ring.m_submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            ringFile, IORING_OFF_SQ_RING);
+        if (submissionRing == MAP_FAILED)
+        {
+            AZ_Error("StorageDriveLinux", false, "Unable to map the io_uring submission queue for %s (Error: %i).\n", m_name.c_str(), errno);
+            DestroyRing();
+            return false;
+        }
+        m_ring.m_submissionRing = submissionRing;
+
+        if (isSingleMap)
+        {
+            m_ring.m_completionRing = submissionRing;
+        }
+        else
+        {
+            void* completionRing = ::mmap(nullptr, m_ring.m_completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                ringFile, IORING_OFF_CQ_RING);
+            if (completionRing == MAP_FAILED)
+            {
+                AZ_Error("StorageDriveLinux", false, "Unable to map the io_uring completion queue for %s (Error: %i).\n",
+                    m_name.c_str(), errno);
+                DestroyRing();
+                return false;
+            }
+            m_ring.m_completionRing = completionRing;
+        }
+
+        m_ring.m_submissionEntriesSize = parameters.sq_entries * sizeof(io_uring_sqe);
+        void* submissionEntries = ::mmap(nullptr, m_ring.m_submissionEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            ringFile, IORING_OFF_SQES);
+        if (submissionEntries == MAP_FAILED)
+        {
+            AZ_Error("StorageDriveLinux", false, "Unable to map the io_uring submission entries for %s (Error: %i).\n",
+                m_name.c_str(), errno);
+            DestroyRing();
+            return false;
+        }
+        m_ring.m_submissionEntries = reinterpret_cast<io_uring_sqe*>(submissionEntries);
+
+        u8* submissionBase = reinterpret_cast<u8*>(m_ring.m_submissionRing);
+        m_ring.m_submissionHead = reinterpret_cast<u32*>(submissionBase + parameters.sq_off.head);
+        m_ring.m_submissionTail = reinterpret_cast<u32*>(submissionBase + parameters.sq_off.tail);
+        m_ring.m_submissionArray = reinterpret_cast<u32*>(submissionBase + parameters.sq_off.array);
+        m_ring.m_submissionMask = *reinterpret_cast<u32*>(submissionBase + parameters.sq_off.ring_mask);
+        m_ring.m_submissionEntryCount = *reinterpret_cast<u32*>(submissionBase + parameters.sq_off.ring_entries);
+        m_ring.m_queuedTail = *m_ring.m_submissionTail;
+
+        u8* completionBase = reinterpret_cast<u8*>(m_ring.m_completionRing);
+        m_ring.m_completionHead = reinterpret_cast<u32*>(completionBase + parameters.cq_off.head);
+        m_ring.m_completionTail = reinterpret_cast<u32*>(completionBase + parameters.cq_off.tail);
+        m_ring.m_completionMask = *reinterpret_cast<u32*>(completionBase + parameters.cq_off.ring_mask);
+        m_ring.m_completionEntries = reinterpret_cast<io_uring_cqe*>(completionBase + parameters.cq_off.cqes);
+
+        // The kernel signals this event whenever a read completes, which wakes up the Streamer thread if it went to sleep
+        // while there are still reads in flight.
+        m_ring.m_completionEvent = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (m_ring.m_completionEvent == -1 ||
+            IoUringRegister(ringFile, IORING_REGISTER_EVENTFD, &m_ring.m_completionEvent, 1) < 0)
+        {
+            AZ_Error("StorageDriveLinux", false, "Unable to create the completion event for %s (Error: %i).\n", m_name.c_str(), errno);
+            DestroyRing();
+            return false;
+        }
+
+        return true;
+    }
+
+    void StorageDriveLinux::DestroyRing()
+    {
+        if (m_ring.m_submissionEntries)
+        {
+            ::munmap(m_ring.m_submissionEntries, m_ring.m_submissionEntriesSize);
+        }
+        if (m_ring.m_completionRing && m_ring.m_completionRing != m_ring.m_submissionRing)
+        {
+            ::munmap(m_ring.m_completionRing, m_ring.m_completionRingSize);
+        }
+        if (m_ring.m_submissionRing)
+        {
+            ::munmap(m_ring.m_submissionRing, m_ring.m_submissionRingSize);
+        }
+        if (m_ring.m_ringFile != -1)
+        {
+            ::close(m_ring.m_ringFile);
+        }
+        if (m_ring.m_completionEvent != -1)
+        {
+            ::close(m_ring.m_completionEvent);
+        }
+        m_ring = IoRing{};
+    }
+
+    bool StorageDriveLinux::IsAvailable() const
+    {
+        return m_ring.m_ringFile != -1;
+    }
+
+    void StorageDriveLinux::PrepareRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (IsAvailable() && AZStd::holds_alternative<FileRequest::ReadRequestData>(request->GetCommand()))
+        {
+            auto& readRequest = AZStd::get<FileRequest::ReadRequestData>(request->GetCommand());
+            if (IsServicedByThisDrive(readRequest.m_path.GetAbsolutePath()))
+            {
+                FileRequest* read = m_context->GetNewInternalRequest();
+                read->CreateRead(request, readRequest.m_output, readRequest.m_outputSize, readRequest.m_path,
+                    readRequest.m_offset, readRequest.m_size);
+                m_context->PushPreparedRequest(read);
+                return;
+            }
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void StorageDriveLinux::QueueRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        if (!IsAvailable())
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
+                {
+                    m_pendingReadRequests.push_back(request);
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData> ||
+                AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+            {
+                if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
+                {
+                    m_pendingRequests.push_back(request);
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CancelData>)
+            {
+                if (CancelRequest(request, args.m_target))
+                {
+                    // Only forward if this isn't part of the request chain, otherwise the storage device should
+                    // be the last step as it doesn't forward any (sub)requests.
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushData>)
+            {
+                FlushCache(args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushAllData>)
+            {
+                FlushEntireCache();
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::ReportData>)
+            {
+                Report(args);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool StorageDriveLinux::ExecuteRequests()
+    {
+        if (!IsAvailable())
+        {
+            return StreamStackEntry::ExecuteRequests();
+        }
+
+        bool hasFinalizedReads = FinalizeReads();
+        bool hasWorked = false;
+
+        if (!m_pendingReadRequests.empty())
+        {
+            // Fill as many read slots as possible before calling into the kernel so all reads are submitted as a single batch.
+            while (!m_pendingReadRequests.empty())
+            {
+                FileRequest* request = m_pendingReadRequests.front();
+                if (!ReadRequest(request))
+                {
+                    break;
+                }
+                m_pendingReadRequests.pop_front();
+                hasWorked = true;
+            }
+        }
+        else if (!m_pendingRequests.empty())
+        {
+            FileRequest* request = m_pendingRequests.front();
+            hasWorked = AZStd::visit([this, request](auto&& args)
+            {
+                using Command = AZStd::decay_t<decltype(args)>;
+                if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+                {
+                    FileExistsRequest(request);
+                    m_pendingRequests.pop_front();
+                    return true;
+                }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+                {
+                    FileMetaDataRetrievalRequest(request);
+                    m_pendingRequests.pop_front();
+                    return true;
+                }
+                else
+                {
+                    AZ_Assert(false, "A request was added to StorageDriveLinux's pending queue that isn't supported.");
+                    return false;
+                }
+            }, request->GetCommand());
+        }
+
+        // If the kernel couldn't accept all entries, report that work was done so the entries are submitted again on the next
+        // tick instead of the Streamer thread going to sleep.
+        bool hasUnsubmittedEntries = !SubmitEntries();
+
+        return StreamStackEntry::ExecuteRequests() || hasFinalizedReads || hasWorked || hasUnsubmittedEntries;
+    }
+
+    void StorageDriveLinux::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        if (IsAvailable())
+        {
+            status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, CalculateNumAvailableSlots());
+            status.m_isIdle = status.m_isIdle && m_pendingReadRequests.empty() && m_pendingRequests.empty() && (m_activeReads_Count == 0);
+        }
+    }
+
+    void StorageDriveLinux::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+        StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+        if (!IsAvailable())
+        {
+            return;
+        }
+
+        const RequestPath* activeFile = nullptr;
+        if (m_activeCacheSlot != InvalidFileCacheIndex)
+        {
+            activeFile = &m_fileCache_paths[m_activeCacheSlot];
+        }
+        u64 activeOffset = m_activeOffset;
+
+        // Reads in flight share the bandwidth of the drive, so a read not only needs at least its own latency to complete, but
+        // also needs to wait for the reads that were submitted before it to drain at the throughput the drive achieves with the
+        // current queue depth. New requests can only start once the queue has drained enough to free up a slot.
+        AZStd::fixed_vector<size_t, MaxIoChannels> activeSlots;
+        for (size_t i = 0; i < m_readSlots_active.size(); ++i)
+        {
+            if (m_readSlots_active[i])
+            {
+                activeSlots.push_back(i);
+            }
+        }
+        AZStd::sort(activeSlots.begin(), activeSlots.end(), [this](size_t lhs, size_t rhs)
+            {
+                return m_readSlots_readInfo[lhs].m_startTime < m_readSlots_readInfo[rhs].m_startTime;
+            });
+
+        AZStd::chrono::system_clock::time_point drainTime = now;
+        for (size_t readSlot : activeSlots)
+        {
+            const FileReadInformation& read = m_readSlots_readInfo[readSlot];
+            drainTime += EstimateTransferTime(read.m_readSize - read.m_bytesTransferred);
+            AZStd::chrono::system_clock::time_point endTime =
+                AZStd::max(drainTime, read.m_startTime + EstimateReadLatency(read.m_readSize));
+            read.m_request->SetEstimatedCompletion(endTime);
+        }
+        now = drainTime;
+
+        // Estimate requests in this stack entry.
+        for (FileRequest* request : m_pendingReadRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+        for (FileRequest* request : m_pendingRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+
+        // Estimate internally pending requests. Because this call will go from the top of the stack to the bottom,
+        // but estimation is calculated from the bottom to the top, this list should be processed in reverse order.
+        for (auto requestIt = internalPending.rbegin(); requestIt != internalPending.rend(); ++requestIt)
+        {
+            EstimateCompletionTimeForRequestChecked(*requestIt, now, activeFile, activeOffset);
+        }
+
+        // Estimate pending requests that have not been queued yet.
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            EstimateCompletionTimeForRequestChecked(*requestIt, now, activeFile, activeOffset);
+        }
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::system_clock::time_point& startTime,
+        const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        u64 readSize = 0;
+        u64 offset = 0;
+        const RequestPath* targetFile = nullptr;
+
+        AZStd::visit([&](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                targetFile = &args.m_path;
+                readSize = args.m_size;
+                offset = args.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
+            {
+                targetFile = &args.m_compressionInfo.m_archiveFilename;
+                readSize = args.m_compressionInfo.m_compressedSize;
+                offset = args.m_compressionInfo.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+            {
+                readSize = 0;
+                startTime += m_getFileExistsTimeAverage.CalculateAverage();
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+            {
+                readSize = 0;
+                startTime += m_getFileMetaDataRetrievalTimeAverage.CalculateAverage();
+            }
+        }, request->GetCommand());
+
+        if (readSize > 0)
+        {
+            if (activeFile && activeFile != targetFile)
+            {
+                if (FindInFileHandleCache(*targetFile) == InvalidFileCacheIndex)
+                {
+                    startTime += m_fileOpenCloseTimeAverage.CalculateAverage();
+                }
+                activeOffset = std::numeric_limits<u64>::max();
+            }
+
+            if (activeOffset != offset && m_constructionOptions.m_hasSeekPenalty)
+            {
+                startTime += s_averageSeekTime;
+            }
+
+            startTime += EstimateTransferTime(readSize);
+            activeOffset = offset + readSize;
+        }
+        request->SetEstimatedCompletion(startTime);
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequestChecked(FileRequest* request,
+        AZStd::chrono::system_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        AZStd::visit([&, this](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData> ||
+                          AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+            {
+                if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
+                {
+                    EstimateCompletionTimeForRequest(request, startTime, activeFile, activeOffset);
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
+            {
+                if (IsServicedByThisDrive(args.m_compressionInfo.m_archiveFilename.GetAbsolutePath()))
+                {
+                    EstimateCompletionTimeForRequest(request, startTime, activeFile, activeOffset);
+                }
+            }
+        }, request->GetCommand());
+    }
+
+    AZStd::chrono::microseconds StorageDriveLinux::EstimateTransferTime(u64 readSize) const
+    {
+        u64 totalBytesRead = m_readSizeAverage.GetTotal();
+        double totalReadTimeUSec = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+        return AZStd::chrono::microseconds(aznumeric_cast<u64>((readSize * totalReadTimeUSec) / totalBytesRead));
+    }
+
+    AZStd::chrono::microseconds StorageDriveLinux::EstimateReadLatency(u64 readSize) const
+    {
+        u64 totalBytesRead = m_readLatencySizeAverage.GetTotal();
+        double totalLatencyUSec = aznumeric_caster(m_readLatencyAverage.GetTotal().count());
+        return AZStd::chrono::microseconds(aznumeric_cast<u64>((readSize * totalLatencyUSec) / totalBytesRead));
+    }
+
+    s32 StorageDriveLinux::CalculateNumAvailableSlots() const
+    {
+        return (m_overCommit + aznumeric_cast<s32>(m_ioChannelCount)) - aznumeric_cast<s32>(m_pendingReadRequests.size()) -
+            aznumeric_cast<s32>(m_pendingRequests.size()) - m_activeReads_Count;
+    }
+
+    auto StorageDriveLinux::OpenFile(int& fileHandle, size_t& cacheSlot, FileRequest* request, const FileRequest::ReadData& data)
+        -> OpenFileResult
+    {
+        int file = -1;
+
+        // If the file is already opened for use, use that file handle and update it's last touched time.
+        size_t cacheIndex = FindInFileHandleCache(data.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            file = m_fileCache_handles[cacheIndex];
+            AZ_Assert(file != -1, "Found the file '%s' in cache, but file handle is invalid.\n", data.m_path.GetRelativePath());
+        }
+        else
+        {
+            // If the file is not already found in the cache, attempt to claim an available cache entry.
+            cacheIndex = FindAvailableFileHandleCacheIndex();
+            if (cacheIndex == InvalidFileCacheIndex)
+            {
+                // No files ready to be evicted.
+                return OpenFileResult::CacheFull;
+            }
+
+            bool isUnbuffered = m_constructionOptions.m_enableUnbufferedReads;
+            // Adding explicit scope here for profiling file Open & Close
+            {
+                AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::ReadRequest OpenFile %s", m_name.c_str());
+                TIMED_AVERAGE_WINDOW_SCOPE(m_fileOpenCloseTimeAverage);
+
+                // Depending on configuration, reads can be unbuffered, meaning the kernel doesn't use the page cache for these files.
+                constexpr int openFlags = O_RDONLY | O_CLOEXEC;
+                file = ::open(data.m_path.GetAbsolutePath(), isUnbuffered ? (openFlags | O_DIRECT) : openFlags);
+                if (file == -1 && isUnbuffered && errno == EINVAL)
+                {
+                    // The file system doesn't support direct IO, for instance tmpfs, so use buffered reads for this file.
+                    isUnbuffered = false;
+                    file = ::open(data.m_path.GetAbsolutePath(), openFlags);
+                }
+
+                if (file == -1)
+                {
+                    // Failed to open the file, so let the next entry in the stack try.
+                    StreamStackEntry::QueueRequest(request);
+                    return OpenFileResult::RequestForwarded;
+                }
+
+                if (m_fileCache_handles[cacheIndex] != -1)
+                {
+                    ::close(m_fileCache_handles[cacheIndex]);
+                }
+            }
+
+            // Fill the cache entry with data about the new file.
+            m_fileCache_handles[cacheIndex] = file;
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_isUnbuffered[cacheIndex] = isUnbuffered;
+            m_fileCache_paths[cacheIndex] = data.m_path;
+        }
+
+        AZ_Assert(file != -1, "While searching for file '%s' in StorageDriveLinux::OpenFile failed to detect a problem.",
+            data.m_path.GetRelativePath());
+
+        // Set the current request and update timestamp, regardless of cache hit or miss.
+        m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::now();
+        fileHandle = file;
+        cacheSlot = cacheIndex;
+        return OpenFileResult::FileOpened;
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request)
+    {
+        AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::ReadRequest %s", m_name.c_str());
+
+        if (!m_cachesInitialized)
+        {
+            m_fileCache_lastTimeUsed.resize(m_maxFileHandles, AZStd::chrono::system_clock::time_point::min());
+            m_fileCache_paths.resize(m_maxFileHandles);
+            m_fileCache_handles.resize(m_maxFileHandles, -1);
+            m_fileCache_activeReads.resize(m_maxFileHandles, 0);
+            m_fileCache_isUnbuffered.resize(m_maxFileHandles, false);
+
+            m_readSlots_readInfo.resize(m_ioChannelCount);
+            m_readSlots_fileHandleIndex.resize(m_ioChannelCount, InvalidFileCacheIndex);
+            m_readSlots_active.resize(m_ioChannelCount);
+
+            m_cachesInitialized = true;
+        }
+
+        if (m_activeReads_Count >= m_ioChannelCount)
+        {
+            return false;
+        }
+
+        size_t readSlot = FindAvailableReadSlot();
+        AZ_Assert(readSlot != InvalidReadSlotIndex, "Active read slot count indicates there's a read slot available, but no read slot was found.");
+
+        return ReadRequest(request, readSlot);
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request, size_t readSlot)
+    {
+        AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::ReadRequest %s", m_name.c_str());
+
+        if (m_activeReads_Count == 0 && !m_context->GetStreamerThreadSynchronizer().AreEventHandlesAvailable())
+        {
+            // The completion event can't be waited on so delay executing this request until events become available.
+            return false;
+        }
+
+        auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+        AZ_Assert(data, "Read request in StorageDriveLinux doesn't contain read data.");
+
+        int file = -1;
+        size_t fileCacheSlot = InvalidFileCacheIndex;
+        switch (OpenFile(file, fileCacheSlot, request, *data))
+        {
+        case OpenFileResult::FileOpened:
+            break;
+        case OpenFileResult::RequestForwarded:
+            return true;
+        case OpenFileResult::CacheFull:
+            return false;
+        default:
+            AZ_Assert(false, "Unsupported OpenFileRequest returned.");
+        }
+
+        u64 readSize = data->m_size;
+        u64 readOffs = data->m_offset;
+        u8* output = reinterpret_cast<u8*>(data->m_output);
+
+        FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+        readInfo.m_request = request;
+
+        if (m_fileCache_isUnbuffered[fileCacheSlot])
+        {
+            // Check alignment of the file read information: size, offset, and address.
+            // If any are unaligned to the sector sizes, make adjustments and use an aligned buffer.
+            const bool alignedAddr = IStreamerTypes::IsAlignedTo(data->m_output, aznumeric_caster(m_physicalSectorSize));
+            const bool alignedOffs = IStreamerTypes::IsAlignedTo(data->m_offset, aznumeric_caster(m_logicalSectorSize));
+
+            // Adjust the offset if it's misaligned by aligning it down to the next lowest sector and change the size to
+            // compensate. The size of the adjustment is stored in copyBackOffset, which will be used later to copy only
+            // the requested data. See StorageDriveWin for a more detailed description.
+            if (!alignedOffs)
+            {
+                readOffs = AZ_SIZE_ALIGN_DOWN(readOffs, m_logicalSectorSize);
+                u64 offsetCorrection = data->m_offset - readOffs;
+                readInfo.m_copyBackOffset = offsetCorrection;
+                readSize = data->m_size + offsetCorrection;
+            }
+
+            bool alignedSize = IStreamerTypes::IsAlignedTo(readSize, aznumeric_caster(m_logicalSectorSize));
+            if (!alignedSize)
+            {
+                u64 alignedReadSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                if (alignedReadSize <= data->m_outputSize)
+                {
+                    alignedSize = true;
+                    readSize = alignedReadSize;
+                }
+            }
+
+            // Once everything is aligned, use one of the registered buffers if the read fits or allocate a temporary buffer
+            // otherwise. When the read completes only the requested data is copied back.
+            const bool isAligned = (alignedAddr && alignedSize && alignedOffs);
+            if (!isAligned)
+            {
+                readSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                if (m_registeredBuffers && readSize <= m_registeredBufferSize)
+                {
+                    readInfo.m_usesRegisteredBuffer = true;
+                    output = m_registeredBuffers + (readSlot * m_registeredBufferSize);
+                }
+                else
+                {
+                    readInfo.AllocateAlignedBuffer(readSize, m_physicalSectorSize);
+                    output = reinterpret_cast<u8*>(readInfo.m_sectorAlignedOutput);
+                }
+            }
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            m_directReadsPercentageStat.PushSample(isAligned ? 1.0 : 0.0);
+            Statistic::PlotImmediate(m_name, DirectReadsName, m_directReadsPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        }
+
+        AZ_Assert(readSize <= std::numeric_limits<u32>::max(),
+            "Read of %llu bytes for '%s' is too large for a single read. Use a read splitter in front of %s.",
+            readSize, data->m_path.GetRelativePath(), m_name.c_str());
+        readInfo.m_readTarget = output;
+        readInfo.m_readOffset = readOffs;
+        readInfo.m_readSize = aznumeric_cast<size_t>(readSize);
+        readInfo.m_bytesTransferred = 0;
+        m_readSlots_fileHandleIndex[readSlot] = fileCacheSlot;
+
+        if (!QueueRead(readSlot))
+        {
+            AZ_Assert(false, "The io_uring submission queue for %s is full even though a read slot is available.", m_name.c_str());
+            readInfo.Clear();
+            return false;
+        }
+
+        auto now = AZStd::chrono::system_clock::now();
+        if (m_activeReads_Count++ == 0)
+        {
+            m_activeReads_startTime = now;
+            m_context->GetStreamerThreadSynchronizer().RegisterEventHandle(m_ring.m_completionEvent);
+        }
+        readInfo.m_startTime = now;
+        m_readSlots_active[readSlot] = true;
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        if (m_activeCacheSlot == fileCacheSlot)
+        {
+            m_fileSwitchPercentageStat.PushSample(0.0);
+            m_seekPercentageStat.PushSample(m_activeOffset == data->m_offset ? 0.0 : 1.0);
+        }
+        else
+        {
+            m_fileSwitchPercentageStat.PushSample(1.0);
+            m_seekPercentageStat.PushSample(0.0);
+        }
+
+        Statistic::PlotImmediate(m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetMostRecentSample());
+        Statistic::PlotImmediate(m_name, SeeksName, m_seekPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+        m_fileCache_activeReads[fileCacheSlot]++;
+        m_activeCacheSlot = fileCacheSlot;
+        m_activeOffset = readOffs + readSize;
+
+        return true;
+    }
+
+    bool StorageDriveLinux::QueueRead(size_t readSlot)
+    {
+        io_uring_sqe* entry = GetSubmissionEntry();
+        if (!entry)
+        {
+            return false;
+        }
+
+        // Continue where the previous read stopped in case of a partial read.
+        const FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+        const size_t transferred = readInfo.m_bytesTransferred;
+        entry->opcode = readInfo.m_usesRegisteredBuffer ? IORING_OP_READ_FIXED : IORING_OP_READ;
+        entry->fd = m_fileCache_handles[m_readSlots_fileHandleIndex[readSlot]];
+        entry->off = readInfo.m_readOffset + transferred;
+        entry->addr = reinterpret_cast<u64>(readInfo.m_readTarget + transferred);
+        entry->len = aznumeric_cast<u32>(readInfo.m_readSize - transferred);
+        entry->buf_index = readInfo.m_usesRegisteredBuffer ? aznumeric_cast<u16>(readSlot) : 0;
+        entry->user_data = readSlot;
+        return true;
+    }
+
+    io_uring_sqe* StorageDriveLinux::GetSubmissionEntry()
+    {
+        const u32 head = __atomic_load_n(m_ring.m_submissionHead, __ATOMIC_ACQUIRE);
+        if (m_ring.m_queuedTail - head >= m_ring.m_submissionEntryCount)
+        {
+            return nullptr;
+        }
+
+        const u32 index = m_ring.m_queuedTail & m_ring.m_submissionMask;
+        io_uring_sqe* entry = &m_ring.m_submissionEntries[index];
+        memset(entry, 0, sizeof(io_uring_sqe));
+        m_ring.m_submissionArray[index] = index;
+        m_ring.m_queuedTail++;
+        return entry;
+    }
+
+    bool StorageDriveLinux::SubmitEntries()
+    {
+        // Publish the entries that were filled in since the last submission. Only the Streamer thread writes to the tail.
+        if (*m_ring.m_submissionTail != m_ring.m_queuedTail)
+        {
+            __atomic_store_n(m_ring.m_submissionTail, m_ring.m_queuedTail, __ATOMIC_RELEASE);
+        }
+
+        const u32 toSubmit = m_ring.m_queuedTail - __atomic_load_n(m_ring.m_submissionHead, __ATOMIC_ACQUIRE);
+        if (toSubmit == 0)
+        {
+            return true;
+        }
+
+        int result;
+        {
+            AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::SubmitEntries io_uring_enter");
+            result = IoUringEnter(m_ring.m_ringFile, toSubmit, 0, 0);
+        }
+
+        if (result < 0)
+        {
+            // EAGAIN and EBUSY indicate the kernel is temporarily out of resources or the completion queue needs to be drained
+            // first. The entries stay in the submission queue and will be submitted again on the next call.
+            AZ_Error("StorageDriveLinux", errno == EAGAIN || errno == EBUSY || errno == EINTR,
+                "io_uring_enter failed for %s with error: %i\n", m_name.c_str(), errno);
+            return false;
+        }
+
+        m_submissionBatchSizeAverage.PushEntry(aznumeric_cast<u64>(result));
+        return aznumeric_cast<u32>(result) == toSubmit;
+    }
+
+    bool StorageDriveLinux::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
+    {
+        bool ownsRequestChain = false;
+        for (auto it = m_pendingReadRequests.begin(); it != m_pendingReadRequests.end();)
+        {
+            if ((*it)->WorksOn(target))
+            {
+                (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context->MarkRequestAsCompleted(*it);
+                it = m_pendingReadRequests.erase(it);
+                ownsRequestChain = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Pending requests have been accounted for, now address any active reads and ask the kernel to cancel them. The reads
+        // will complete with ECANCELED if they were canceled in time, otherwise they complete as normal.
+        bool hasQueuedCancels = false;
+        for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+        {
+            if (m_readSlots_active[readSlot] && m_readSlots_readInfo[readSlot].m_request->WorksOn(target))
+            {
+                ownsRequestChain = true;
+                if (io_uring_sqe* entry = GetSubmissionEntry(); entry != nullptr)
+                {
+                    entry->opcode = IORING_OP_ASYNC_CANCEL;
+                    entry->fd = -1;
+                    entry->addr = readSlot;
+                    entry->user_data = CancelUserData;
+                    hasQueuedCancels = true;
+                }
+            }
+        }
+        if (hasQueuedCancels)
+        {
+            SubmitEntries();
+        }
+
+        if (ownsRequestChain)
+        {
+            cancelRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(cancelRequest);
+        }
+
+        return ownsRequestChain;
+    }
+
+    void StorageDriveLinux::FileExistsRequest(FileRequest* request)
+    {
+        auto& fileExists = AZStd::get<FileRequest::FileExistsCheckData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::FileExistsRequest %s : %s",
+            m_name.c_str(), fileExists.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileExistsTimeAverage);
+
+        AZ_Assert(IsServicedByThisDrive(fileExists.m_path.GetAbsolutePath()),
+            "FileExistsRequest was queued on a StorageDriveLinux that doesn't service files on the given path '%s'.",
+            fileExists.m_path.GetRelativePath());
+
+        size_t cacheIndex = FindInFileHandleCache(fileExists.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        cacheIndex = FindInMetaDataCache(fileExists.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat fileStatus;
+        if (::stat(fileExists.m_path.GetAbsolutePath(), &fileStatus) == 0 && S_ISREG(fileStatus.st_mode))
+        {
+            cacheIndex = GetNextMetaDataCacheSlot();
+            m_metaDataCache_paths[cacheIndex] = fileExists.m_path;
+            m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(fileStatus.st_size);
+            fileExists.m_found = true;
+
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    void StorageDriveLinux::FileMetaDataRetrievalRequest(FileRequest* request)
+    {
+        auto& command = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::FileMetaDataRetrievalRequest %s : %s",
+            m_name.c_str(), command.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileMetaDataRetrievalTimeAverage);
+
+        size_t cacheIndex = FindInMetaDataCache(command.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            command.m_fileSize = m_metaDataCache_fileSize[cacheIndex];
+            command.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat fileStatus;
+        cacheIndex = FindInFileHandleCache(command.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            AZ_Assert(m_fileCache_handles[cacheIndex] != -1,
+                "File path '%s' doesn't have an associated file handle.", m_fileCache_paths[cacheIndex].GetRelativePath());
+            if (::fstat(m_fileCache_handles[cacheIndex], &fileStatus) != 0)
+            {
+                StreamStackEntry::QueueRequest(request);
+                return;
+            }
+        }
+        else if (::stat(command.m_path.GetAbsolutePath(), &fileStatus) != 0 || !S_ISREG(fileStatus.st_mode))
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        command.m_fileSize = aznumeric_caster(fileStatus.st_size);
+        command.m_found = true;
+
+        cacheIndex = GetNextMetaDataCacheSlot();
+
+        m_metaDataCache_paths[cacheIndex] = command.m_path;
+        m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(fileStatus.st_size);
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void StorageDriveLinux::FlushCache(const RequestPath& filePath)
+    {
+        if (m_cachesInitialized)
+        {
+            size_t cacheIndex = FindInFileHandleCache(filePath);
+            if (cacheIndex != InvalidFileCacheIndex)
+            {
+                if (m_fileCache_handles[cacheIndex] != -1)
+                {
+                    AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Flushing '%s' but it has %u active reads\n",
+                        filePath.GetRelativePath(), m_fileCache_activeReads[cacheIndex]);
+                    ::close(m_fileCache_handles[cacheIndex]);
+                    m_fileCache_handles[cacheIndex] = -1;
+                }
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+
+            cacheIndex = FindInMetaDataCache(filePath);
+            if (cacheIndex != InvalidMetaDataCacheIndex)
+            {
+                m_metaDataCache_paths[cacheIndex].Clear();
+                m_metaDataCache_fileSize[cacheIndex] = 0;
+            }
+        }
+    }
+
+    void StorageDriveLinux::FlushEntireCache()
+    {
+        if (m_cachesInitialized)
+        {
+            // Clear file handle cache
+            for (size_t cacheIndex = 0; cacheIndex < m_maxFileHandles; ++cacheIndex)
+            {
+                if (m_fileCache_handles[cacheIndex] != -1)
+                {
+                    AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Flushing '%s' but it has %u active reads\n",
+                        m_fileCache_paths[cacheIndex].GetRelativePath(), m_fileCache_activeReads[cacheIndex]);
+                    ::close(m_fileCache_handles[cacheIndex]);
+                    m_fileCache_handles[cacheIndex] = -1;
+                }
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+
+            // Clear meta data cache
+            auto metaDataCacheSize = m_metaDataCache_paths.size();
+            m_metaDataCache_paths.clear();
+            m_metaDataCache_fileSize.clear();
+            m_metaDataCache_front = 0;
+            m_metaDataCache_paths.resize(metaDataCacheSize);
+            m_metaDataCache_fileSize.resize(metaDataCacheSize);
+        }
+    }
+
+    bool StorageDriveLinux::FinalizeReads()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        // Completions are picked up directly from the completion queue that's shared with the kernel, so no system call is needed.
+        u32 head = *m_ring.m_completionHead;
+        const u32 tail = __atomic_load_n(m_ring.m_completionTail, __ATOMIC_ACQUIRE);
+        if (head == tail)
+        {
+            return false;
+        }
+
+        bool hasQueuedReads = false;
+        for (; head != tail; ++head)
+        {
+            const io_uring_cqe& completion = m_ring.m_completionEntries[head & m_ring.m_completionMask];
+            if (completion.user_data == CancelUserData)
+            {
+                // The result of the cancel request itself doesn't need processing as the canceled read reports back separately.
+                continue;
+            }
+
+            size_t readSlot = aznumeric_cast<size_t>(completion.user_data);
+            AZ_Assert(readSlot < m_readSlots_active.size() && m_readSlots_active[readSlot],
+                "io_uring completion for %s references read slot %zu which isn't active.", m_name.c_str(), readSlot);
+
+            FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+            if (completion.res > 0)
+            {
+                readInfo.m_bytesTransferred += aznumeric_cast<size_t>(completion.res);
+                auto readCommand = AZStd::get_if<FileRequest::ReadData>(&readInfo.m_request->GetCommand());
+                AZ_Assert(readCommand != nullptr, "Request stored with the io_uring read did not contain a read request.");
+                const size_t requiredSize = readInfo.m_copyBackOffset + readCommand->m_size;
+                if (readInfo.m_bytesTransferred < requiredSize && readInfo.m_bytesTransferred < readInfo.m_readSize)
+                {
+                    // The kernel is allowed to return fewer bytes than requested, for instance when the read got interrupted.
+                    // Queue another read for the remainder. If the end of the file has been reached that read will return 0.
+                    if (QueueRead(readSlot))
+                    {
+                        hasQueuedReads = true;
+                        continue;
+                    }
+                    constexpr bool encounteredError = true;
+                    FinalizeSingleRequest(readSlot, false, encounteredError);
+                }
+                else
+                {
+                    constexpr bool encounteredError = false;
+                    FinalizeSingleRequest(readSlot, false, encounteredError);
+                }
+            }
+            else if (completion.res == 0 || completion.res == -ECANCELED)
+            {
+                // Whether a read that reached the end of the file was successful depends on whether enough data was read.
+                constexpr bool encounteredError = false;
+                FinalizeSingleRequest(readSlot, completion.res == -ECANCELED, encounteredError);
+            }
+            else
+            {
+                AZ_Error("StorageDriveLinux", false, "Async file read operation for '%s' completed with error code %i\n",
+                    m_fileCache_paths[m_readSlots_fileHandleIndex[readSlot]].GetRelativePath(), -completion.res);
+                constexpr bool encounteredError = true;
+                FinalizeSingleRequest(readSlot, false, encounteredError);
+            }
+        }
+        __atomic_store_n(m_ring.m_completionHead, head, __ATOMIC_RELEASE);
+
+        if (hasQueuedReads)
+        {
+            SubmitEntries();
+        }
+        return true;
+    }
+
+    void StorageDriveLinux::FinalizeSingleRequest(size_t readSlot, bool isCanceled, bool encounteredError)
+    {
+        FileReadInformation& fileReadInfo = m_readSlots_readInfo[readSlot];
+        auto now = AZStd::chrono::system_clock::now();
+
+        if (!isCanceled && !encounteredError && fileReadInfo.m_bytesTransferred > 0)
+        {
+            m_readLatencySizeAverage.PushEntry(fileReadInfo.m_bytesTransferred);
+            m_readLatencyAverage.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(now - fileReadInfo.m_startTime));
+        }
+
+        m_activeReads_ByteCount += fileReadInfo.m_bytesTransferred;
+        if (--m_activeReads_Count == 0)
+        {
+            // Update read stats now that the operation is done.
+            m_readSizeAverage.PushEntry(m_activeReads_ByteCount);
+            m_readTimeAverage.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(now - m_activeReads_startTime));
+
+            m_activeReads_ByteCount = 0;
+            m_context->GetStreamerThreadSynchronizer().UnregisterEventHandle(m_ring.m_completionEvent);
+        }
+
+        auto readCommand = AZStd::get_if<FileRequest::ReadData>(&fileReadInfo.m_request->GetCommand());
+        AZ_Assert(readCommand != nullptr, "Request stored with the io_uring read did not contain a read request.");
+
+        // The request could be reading more due to alignment requirements. It should however never read less that the amount of
+        // requested data.
+        bool isSuccess = !encounteredError && (fileReadInfo.m_copyBackOffset + readCommand->m_size <= fileReadInfo.m_bytesTransferred);
+
+        if (isSuccess && fileReadInfo.m_readTarget != readCommand->m_output)
+        {
+            ::memcpy(readCommand->m_output, fileReadInfo.m_readTarget + fileReadInfo.m_copyBackOffset, readCommand->m_size);
+        }
+
+        fileReadInfo.m_request->SetStatus(
+            isCanceled
+                ? IStreamerTypes::RequestStatus::Canceled
+                : isSuccess
+                    ? IStreamerTypes::RequestStatus::Completed
+                    : IStreamerTypes::RequestStatus::Failed
+        );
+        m_context->MarkRequestAsCompleted(fileReadInfo.m_request);
+
+        m_fileCache_activeReads[m_readSlots_fileHandleIndex[readSlot]]--;
+        m_readSlots_fileHandleIndex[readSlot] = InvalidFileCacheIndex;
+        m_readSlots_active[readSlot] = false;
+        fileReadInfo.Clear();
+    }
+
+    size_t StorageDriveLinux::FindInFileHandleCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_fileCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_fileCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidFileCacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableFileHandleCacheIndex() const
+    {
+        AZ_Assert(m_cachesInitialized, "Using file cache before it has been (lazily) initialized\n");
+
+        // This needs to look for files with no active reads, and the oldest file among those.
+        size_t cacheIndex = InvalidFileCacheIndex;
+        AZStd::chrono::system_clock::time_point oldest = AZStd::chrono::system_clock::time_point::max();
+        for (size_t index = 0; index < m_maxFileHandles; ++index)
+        {
+            if (m_fileCache_activeReads[index] == 0 && m_fileCache_lastTimeUsed[index] < oldest)
+            {
+                oldest = m_fileCache_lastTimeUsed[index];
+                cacheIndex = index;
+            }
+        }
+
+        return cacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableReadSlot()
+    {
+        for (size_t i = 0; i < m_readSlots_active.size(); ++i)
+        {
+            if (!m_readSlots_active[i])
+            {
+                return i;
+            }
+        }
+        return InvalidReadSlotIndex;
+    }
+
+    size_t StorageDriveLinux::FindInMetaDataCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_metaDataCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_metaDataCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidMetaDataCacheIndex;
+    }
+
+    size_t StorageDriveLinux::GetNextMetaDataCacheSlot()
+    {
+        m_metaDataCache_front = (m_metaDataCache_front + 1) & (m_metaDataCache_paths.size() - 1);
+        return m_metaDataCache_front;
+    }
+
+    bool StorageDriveLinux::IsServicedByThisDrive(const char* filePath) const
+    {
+        // The file belongs to the mount point with the longest matching path. Mount points are stored without a trailing
+        // slash so a mount point only matches if the path continues with a separator, e.g. "/home" doesn't match "/homework".
+        auto matchLength = [filePath](const AZStd::string& mountPoint) -> size_t
+        {
+            const size_t length = mountPoint.length();
+            if (strncmp(filePath, mountPoint.c_str(), length) == 0 &&
+                (filePath[length] == AZ_CORRECT_FILESYSTEM_SEPARATOR || filePath[length] == 0))
+            {
+                return length + 1;
+            }
+            return 0;
+        };
+
+        size_t bestMatch = 0;
+        bool isServiced = false;
+        for (const AZStd::string& drivePath : m_drivePaths)
+        {
+            if (size_t length = matchLength(drivePath); length > bestMatch)
+            {
+                bestMatch = length;
+                isServiced = true;
+            }
+        }
+        for (const AZStd::string& excludedPath : m_excludedPaths)
+        {
+            if (size_t length = matchLength(excludedPath); length > bestMatch)
+            {
+                bestMatch = length;
+                isServiced = false;
+            }
+        }
+        return isServiced;
+    }
+
+    void StorageDriveLinux::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        if (m_cachesInitialized)
+        {
+            constexpr double bytesToMB = aznumeric_cast<double>(1_mib);
+            using DoubleSeconds = AZStd::chrono::duration<double>;
+
+            double totalBytesReadMB = m_readSizeAverage.GetTotal() / bytesToMB;
+            double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+            statistics.push_back(Statistic::CreateFloat(m_name, "Read Speed (avg. mbps)", totalBytesReadMB / totalReadTimeSec));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Read latency (avg. us)", m_readLatencyAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateFloat(m_name, "Submission batch size (avg.)", m_submissionBatchSizeAverage.CalculateAverage()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "File Open & Close (avg. us)", m_fileOpenCloseTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Get file exists (avg. us)", m_getFileExistsTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Get file meta data (avg. us)", m_getFileMetaDataRetrievalTimeAverage.CalculateAverage().count()));
+
+            statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateNumAvailableSlots()));
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            statistics.push_back(Statistic::CreatePercentage(m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetAverage()));
+            statistics.push_back(Statistic::CreatePercentage(m_name, SeeksName, m_seekPercentageStat.GetAverage()));
+            statistics.push_back(Statistic::CreatePercentage(m_name, DirectReadsName, m_directReadsPercentageStat.GetAverage()));
+#endif
+        }
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    void StorageDriveLinux::Report(const FileRequest::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case FileRequest::ReportData::ReportType::FileLocks:
+            if (m_cachesInitialized)
+            {
+                for (u32 i = 0; i < m_maxFileHandles; ++i)
+                {
+                    if (m_fileCache_handles[i] != -1)
+                    {
+                        AZ_Printf("Streamer", "File lock in %s : '%s'.\n", m_name.c_str(), m_fileCache_paths[i].GetRelativePath());
+                    }
+                }
+            }
+            else
+            {
+                AZ_Printf("Streamer", "File lock in %s : No files have been streamed.\n", m_name.c_str());
+            }
+            break;
+        default:
+            break;
+        }
+    }
+} // namespace AZ::IO
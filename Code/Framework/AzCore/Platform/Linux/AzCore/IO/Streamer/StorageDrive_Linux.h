@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace AZ::IO
+{
+    //! Storage drive that uses io_uring to read from storage. Reads are queued in the submission ring in batches and
+    //! submitted with a single system call, while completions are picked up from the completion ring without needing to
+    //! call into the kernel. If io_uring isn't available on the running kernel all requests are forwarded to the next
+    //! entry in the stack.
+    class StorageDriveLinux
+        : public StreamStackEntry
+    {
+    public:
+        struct ConstructionOptions
+        {
+            ConstructionOptions();
+
+            //! Whether or not the device has a cost for seeking, such as happens on platter disks. This
+            //! will be accounted for when predicting file reads.
+            u8 m_hasSeekPenalty : 1;
+            //! Use unbuffered reads (O_DIRECT) for the fastest possible read speeds by bypassing the Linux page
+            //! cache. This results in a faster read the first time a file is read, but subsequent reads will possibly be
+            //! slower as those could have been serviced from the faster OS cache. During development or for games that reread
+            //! files frequently it's recommended to set this option to false, but generally it's best to be turned on.
+            //! Unbuffered reads have alignment restrictions. Many of the other stream stack entry are (optionally) aware and
+            //! make adjustments. For the most optimal performance align read buffers to the physicalSectorSize.
+            //! File systems that don't support O_DIRECT will automatically fall back to buffered reads.
+            u8 m_enableUnbufferedReads : 1;
+            //! If true, only information that's explicitly requested or issues are reported. If false, status information
+            //! such as when drives are created and destroyed is reported as well.
+            u8 m_minimalReporting : 1;
+        };
+
+        //! Creates an instance of a storage device that's optimized for use on Linux.
+        //! @param drivePaths The mount points that are supported by this device. A single device can have multiple
+        //!     partitions.
+        //! @param excludedPaths Mount points that are nested in one of the drive paths but belong to another device, for
+        //!     instance "/home" on a separate disk while "/" is serviced by this device.
+        //! @param maxFileHandles The maximum number of file handles that are cached. Only a small number are needed when
+        //!     running from archives, but it's recommended that a larger number are kept open when reading from loose files.
+        //! @param maxMetaDataCacheEntires The maximum number of files to keep meta data, such as the file size, to cache. Only
+        //!     a small number are needed when running from archives, but it's recommended that a larger number are kept open
+        //!     when reading from loose files.
+        //! @param physicalSectorSize The minimal sector size as instructed by the device. When unbuffered reads are used the output
+        //!     buffer needs to be aligned to this value.
+        //! @param logicalSectorSize The minimal sector size as instructed by the device. When unbuffered reads are used the
+        //!     file size and read offset need to be aligned to this value.
+        //! @param ioChannelCount The maximum number of requests that the IO controller driving the device supports. This value
+        //!     determines the size of the io_uring queues and will be capped at MaxIoChannels.
+        //! @param overCommit The number of additional slots that will be reported as available. This makes sure that there are
+        //!     always a few requests pending to avoid starvation. An over-commit that is too large can negatively impact the
+        //!     scheduler's ability to re-order requests for optimal read order. A negative value will under-commit and will
+        //!     avoid saturating the IO controller which can be needed if the drive is used by other applications.
+        //! @param registeredBufferSize The size of the sector aligned buffer that's registered with the kernel for every io
+        //!     channel. Unaligned unbuffered reads that fit in this buffer are read into it, avoiding an allocation and the
+        //!     kernel having to map the memory for every read. Set to 0 to disable registered buffers.
+        //! @param options Additional configuration options. See ConstructionOptions for more details.
+        StorageDriveLinux(const AZStd::vector<AZStd::string_view>& drivePaths, const AZStd::vector<AZStd::string_view>& excludedPaths,
+            u32 maxFileHandles, u32 maxMetaDataCacheEntries, size_t physicalSectorSize, size_t logicalSectorSize, u32 ioChannelCount,
+            s32 overCommit, size_t registeredBufferSize, ConstructionOptions options);
+        ~StorageDriveLinux() override;
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+        //! Whether or not the drive was able to create its io_uring instance. If not, all requests will be forwarded.
+        bool IsAvailable() const;
+
+        inline static constexpr u32 MaxIoChannels = 256;
+
+    protected:
+        static const AZStd::chrono::microseconds s_averageSeekTime;
+
+        inline static constexpr size_t InvalidFileCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidReadSlotIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidMetaDataCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr u64 CancelUserData = std::numeric_limits<u64>::max();
+
+        struct IoRing
+        {
+            void* m_submissionRing{ nullptr };
+            size_t m_submissionRingSize{ 0 };
+            void* m_completionRing{ nullptr };
+            size_t m_completionRingSize{ 0 };
+            io_uring_sqe* m_submissionEntries{ nullptr };
+            size_t m_submissionEntriesSize{ 0 };
+            io_uring_cqe* m_completionEntries{ nullptr };
+
+            u32* m_submissionHead{ nullptr };
+            u32* m_submissionTail{ nullptr };
+            u32* m_submissionArray{ nullptr };
+            u32* m_completionHead{ nullptr };
+            u32* m_completionTail{ nullptr };
+            u32 m_submissionMask{ 0 };
+            u32 m_submissionEntryCount{ 0 };
+            u32 m_completionMask{ 0 };
+            u32 m_queuedTail{ 0 }; // Tail including the entries that have been filled in but not published to the kernel yet.
+
+            int m_ringFile{ -1 };
+            int m_completionEvent{ -1 };
+        };
+
+        struct FileReadInformation
+        {
+            AZStd::chrono::system_clock::time_point m_startTime;
+            FileRequest* m_request{ nullptr };
+            void* m_sectorAlignedOutput{ nullptr };    // Internally allocated buffer that is sector aligned.
+            u8* m_readTarget{ nullptr };               // The buffer the kernel writes to. Either the request output or an aligned buffer.
+            size_t m_copyBackOffset{ 0 };
+            u64 m_readOffset{ 0 };
+            size_t m_readSize{ 0 };
+            size_t m_bytesTransferred{ 0 };
+            bool m_usesRegisteredBuffer{ false };
+
+            void AllocateAlignedBuffer(size_t size, size_t sectorSize);
+            void Clear();
+        };
+
+        enum class OpenFileResult
+        {
+            FileOpened,
+            RequestForwarded,
+            CacheFull
+        };
+
+        bool CreateRing();
+        void DestroyRing();
+        io_uring_sqe* GetSubmissionEntry();
+        bool SubmitEntries();
+
+        OpenFileResult OpenFile(int& fileHandle, size_t& cacheSlot, FileRequest* request, const FileRequest::ReadData& data);
+        bool ReadRequest(FileRequest* request);
+        bool ReadRequest(FileRequest* request, size_t readSlot);
+        bool QueueRead(size_t readSlot);
+        bool CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        void FileExistsRequest(FileRequest* request);
+        void FileMetaDataRetrievalRequest(FileRequest* request);
+        size_t FindInFileHandleCache(const RequestPath& filePath) const;
+        size_t FindAvailableFileHandleCacheIndex() const;
+        size_t FindAvailableReadSlot();
+        size_t FindInMetaDataCache(const RequestPath& filePath) const;
+        size_t GetNextMetaDataCacheSlot();
+        bool IsServicedByThisDrive(const char* filePath) const;
+
+        void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::system_clock::time_point& startTime,
+            const RequestPath*& activeFile, u64& activeOffset) const;
+        void EstimateCompletionTimeForRequestChecked(FileRequest* request,
+            AZStd::chrono::system_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const;
+        AZStd::chrono::microseconds EstimateTransferTime(u64 readSize) const;
+        AZStd::chrono::microseconds EstimateReadLatency(u64 readSize) const;
+        s32 CalculateNumAvailableSlots() const;
+
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        bool FinalizeReads();
+        void FinalizeSingleRequest(size_t readSlot, bool isCanceled, bool encounteredError);
+
+        void Report(const FileRequest::ReportData& data) const;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataRetrievalTimeAverage;
+        //! Time and size of periods where the drive was busy. Together these give the throughput of the drive while it's
+        //! running with the queue depth the scheduler typically keeps it at.
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+        //! Time and size for individual reads from submission to completion.
+        TimedAverageWindow<s_statisticsWindowSize> m_readLatencyAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readLatencySizeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_submissionBatchSizeAverage;
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        AZ::Statistics::RunningStatistic m_fileSwitchPercentageStat;
+        AZ::Statistics::RunningStatistic m_seekPercentageStat;
+        AZ::Statistics::RunningStatistic m_directReadsPercentageStat;
+#endif
+        AZStd::chrono::system_clock::time_point m_activeReads_startTime;
+
+        AZStd::deque<FileRequest*> m_pendingReadRequests;
+        AZStd::deque<FileRequest*> m_pendingRequests;
+
+        AZStd::vector<FileReadInformation> m_readSlots_readInfo;
+        AZStd::vector<size_t> m_readSlots_fileHandleIndex;
+        AZStd::vector<bool> m_readSlots_active;
+
+        AZStd::vector<AZStd::chrono::system_clock::time_point> m_fileCache_lastTimeUsed;
+        AZStd::vector<RequestPath> m_fileCache_paths;
+        AZStd::vector<int> m_fileCache_handles;
+        AZStd::vector<u16> m_fileCache_activeReads;
+        AZStd::vector<bool> m_fileCache_isUnbuffered;
+
+        AZStd::vector<RequestPath> m_metaDataCache_paths;
+        AZStd::vector<u64> m_metaDataCache_fileSize;
+
+        AZStd::vector<AZStd::string> m_drivePaths;
+        AZStd::vector<AZStd::string> m_excludedPaths;
+
+        IoRing m_ring;
+        //! Sector aligned memory that's registered with the kernel. Every read slot owns m_registeredBufferSize bytes.
+        u8* m_registeredBuffers{ nullptr };
+        size_t m_registeredBufferSize{ 0 };
+
+        size_t m_activeReads_ByteCount{ 0 };
+
+        size_t m_physicalSectorSize{ 0 };
+        size_t m_logicalSectorSize{ 0 };
+        size_t m_activeCacheSlot{ InvalidFileCacheIndex };
+        size_t m_metaDataCache_front{ 0 };
+        u64 m_activeOffset{ 0 };
+        u32 m_maxFileHandles{ 1 };
+        u32 m_ioChannelCount{ 1 };
+        s32 m_overCommit{ 0 };
+
+        u16 m_activeReads_Count{ 0 };
+
+        ConstructionOptions m_constructionOptions;
+        bool m_cachesInitialized{ false };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <fcntl.h>
+#include <limits.h>
+#include <mntent.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+#include <unistd.h>
+
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/StringFunc/StringFunc.h>
+
+namespace AZ::IO
+{
+    struct MountPoint
+    {
+        AZStd::string m_path;
+        dev_t m_device;
+    };
+
+    static bool ReadSysValue(const AZStd::string& path, u64& value)
+    {
+        int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (file == -1)
+        {
+            return false;
+        }
+        char buffer[32];
+        ssize_t size = ::read(file, buffer, sizeof(buffer) - 1);
+        ::close(file);
+        if (size <= 0)
+        {
+            return false;
+        }
+        buffer[size] = 0;
+        char* end = nullptr;
+        value = strtoull(buffer, &end, 10);
+        return end != buffer;
+    }
+
+    // Finds the sysfs folder for the disk that holds the device. Partitions are stored as sub-folders of the disk,
+    // for instance ".../block/nvme0n1/nvme0n1p2", so for partitions the parent folder is used.
+    static bool FindDiskFolder(dev_t device, AZStd::string& diskFolder)
+    {
+        char devicePath[64];
+        azsnprintf(devicePath, AZ_ARRAY_SIZE(devicePath), "/sys/dev/block/%u:%u", major(device), minor(device));
+        char resolvedPath[PATH_MAX];
+        if (!::realpath(devicePath, resolvedPath))
+        {
+            // Devices without a sysfs entry, such as overlay and network file systems, aren't backed by a block device.
+            return false;
+        }
+
+        struct stat status;
+        diskFolder = resolvedPath;
+        if (::stat((diskFolder + "/partition").c_str(), &status) == 0)
+        {
+            diskFolder.erase(diskFolder.find_last_of('/'));
+        }
+        return ::stat((diskFolder + "/queue").c_str(), &status) == 0;
+    }
+
+    static bool IsNestedPath(AZStd::string_view path, AZStd::string_view mountPoint)
+    {
+        if (mountPoint == "/")
+        {
+            return true;
+        }
+        return AZ::StringFunc::StartsWith(path, mountPoint, true) &&
+            (path.length() == mountPoint.length() || path[mountPoint.length()] == '/');
+    }
+
+    static void CollectDriveInfo(const AZStd::string& diskFolder, DriveInformation& info, bool reportHardware)
+    {
+        u64 value = 0;
+        if (ReadSysValue(diskFolder + "/queue/physical_block_size", value))
+        {
+            info.m_physicalSectorSize = aznumeric_caster(value);
+        }
+        if (ReadSysValue(diskFolder + "/queue/logical_block_size", value))
+        {
+            info.m_logicalSectorSize = aznumeric_caster(value);
+        }
+        if (ReadSysValue(diskFolder + "/queue/max_sectors_kb", value))
+        {
+            info.m_maxTransfer = aznumeric_caster(value * 1_kib);
+        }
+        if (ReadSysValue(diskFolder + "/queue/nr_requests", value))
+        {
+            info.m_ioChannelCount = aznumeric_caster(value);
+        }
+        if (ReadSysValue(diskFolder + "/queue/rotational", value))
+        {
+            info.m_hasSeekPenalty = value != 0;
+        }
+
+        AZStd::string_view diskName(diskFolder);
+        diskName.remove_prefix(diskFolder.find_last_of('/') + 1);
+        info.m_profile = AZ::StringFunc::StartsWith(diskName, "nvme") ? "Nvme" : "Generic";
+        info.m_profile += info.m_hasSeekPenalty ? "_HDD" : "_SSD";
+
+        if (reportHardware)
+        {
+            AZ_Printf(
+                "Streamer",
+                "Drive info for '%.*s':\n"
+                "    Drive type: %s\n"
+                "    Max transfer: %.3f kb\n"
+                "    Max IO count: %u\n"
+                "    Physical sector size: %zu bytes\n"
+                "    Logical sector size: %zu bytes\n",
+                AZ_STRING_ARG(diskName), info.m_hasSeekPenalty ? "HDD" : "SSD",
+                (1.0f / 1024.0f) * info.m_maxTransfer, info.m_ioChannelCount,
+                info.m_physicalSectorSize, info.m_logicalSectorSize);
+        }
+    }
+
+    static void CollectUsedDevices(AZStd::vector<dev_t>& devices)
+    {
+        struct PathVisitor : SettingsRegistryInterface::Visitor
+        {
+            ~PathVisitor() override = default;
+
+            AZStd::vector<dev_t>* m_devices{ nullptr };
+            bool m_firstObject = true;
+
+            SettingsRegistryInterface::VisitResponse Traverse([[maybe_unused]] AZStd::string_view path,
+                [[maybe_unused]] AZStd::string_view valueName, [[maybe_unused]] SettingsRegistryInterface::VisitAction action,
+                SettingsRegistryInterface::Type type) override
+            {
+                if (type == SettingsRegistryInterface::Type::Object)
+                {
+                    if (m_firstObject)
+                    {
+                        m_firstObject = false;
+                        return SettingsRegistryInterface::VisitResponse::Continue;
+                    }
+                    else
+                    {
+                        return SettingsRegistryInterface::VisitResponse::Skip;
+                    }
+                }
+
+                return type == SettingsRegistryInterface::Type::String ?
+                    SettingsRegistryInterface::VisitResponse::Continue : SettingsRegistryInterface::VisitResponse::Skip;
+            }
+
+            void Visit([[maybe_unused]] AZStd::string_view path, [[maybe_unused]] AZStd::string_view valueName,
+                [[maybe_unused]] AZ::SettingsRegistryInterface::Type type, AZStd::string_view value) override
+            {
+                struct stat status;
+                if (::stat(AZStd::string(value).c_str(), &status) == 0 &&
+                    AZStd::find(m_devices->begin(), m_devices->end(), status.st_dev) == m_devices->end())
+                {
+                    m_devices->push_back(status.st_dev);
+                }
+            }
+        };
+
+        if (auto settingsRegistry = SettingsRegistry::Get(); settingsRegistry != nullptr)
+        {
+            PathVisitor visitor;
+            visitor.m_devices = &devices;
+            settingsRegistry->Visit(visitor, SettingsRegistryMergeUtils::FilePathsRootKey);
+        }
+    }
+
+    static bool CollectHardwareInfo(HardwareInformation& hardwareInfo, bool addAllDrives, bool reportHardware)
+    {
+        FILE* mounts = ::setmntent("/proc/self/mounts", "r");
+        if (!mounts)
+        {
+            return false;
+        }
+
+        AZStd::vector<MountPoint> mountPoints;
+        mntent entry;
+        char entryBuffer[4096];
+        while (::getmntent_r(mounts, &entry, entryBuffer, sizeof(entryBuffer)))
+        {
+            struct stat status;
+            if (::stat(entry.mnt_dir, &status) == 0)
+            {
+                mountPoints.push_back(MountPoint{ entry.mnt_dir, status.st_dev });
+            }
+        }
+        ::endmntent(mounts);
+
+        AZStd::vector<dev_t> usedDevices;
+        if (!addAllDrives)
+        {
+            CollectUsedDevices(usedDevices);
+        }
+
+        // Group the mount points by the disk they're on so multiple partitions on the same disk are handled by the same drive.
+        AZStd::unordered_map<AZStd::string, DriveInformation> driveMappings;
+        for (const MountPoint& mountPoint : mountPoints)
+        {
+            if (!addAllDrives && AZStd::find(usedDevices.begin(), usedDevices.end(), mountPoint.m_device) == usedDevices.end())
+            {
+                continue;
+            }
+
+            AZStd::string diskFolder;
+            if (!FindDiskFolder(mountPoint.m_device, diskFolder))
+            {
+                if (reportHardware)
+                {
+                    AZ_Printf("Streamer", "Skipping mount point '%s' because it's not backed by a block device.\n", mountPoint.m_path.c_str());
+                }
+                continue;
+            }
+
+            auto driveInformationEntry = driveMappings.find(diskFolder);
+            if (driveInformationEntry == driveMappings.end())
+            {
+                DriveInformation driveInformation;
+                driveInformation.m_paths.push_back(mountPoint.m_path);
+                CollectDriveInfo(diskFolder, driveInformation, reportHardware);
+
+                hardwareInfo.m_maxPhysicalSectorSize = AZStd::max(hardwareInfo.m_maxPhysicalSectorSize, driveInformation.m_physicalSectorSize);
+                hardwareInfo.m_maxLogicalSectorSize = AZStd::max(hardwareInfo.m_maxLogicalSectorSize, driveInformation.m_logicalSectorSize);
+                hardwareInfo.m_maxTransfer = AZStd::max(hardwareInfo.m_maxTransfer, driveInformation.m_maxTransfer);
+
+                driveMappings.insert({ AZStd::move(diskFolder), AZStd::move(driveInformation) });
+            }
+            else
+            {
+                AZStd::vector<AZStd::string>& paths = driveInformationEntry->second.m_paths;
+                if (AZStd::find(paths.begin(), paths.end(), mountPoint.m_path) == paths.end())
+                {
+                    if (reportHardware)
+                    {
+                        AZ_Printf("Streamer", "Mount point '%s' is on the same storage drive as '%s'.\n",
+                            mountPoint.m_path.c_str(), paths[0].c_str());
+                    }
+                    paths.push_back(mountPoint.m_path);
+                }
+            }
+        }
+
+        DriveList driveList;
+        driveList.reserve(driveMappings.size());
+        for (auto& drive : driveMappings)
+        {
+            // Mount points of other devices or file systems, such as a tmpfs on /tmp, can be nested in the mount points of this
+            // drive. Requests for files in those should not be handled by this drive.
+            DriveInformation& driveInformation = drive.second;
+            for (const MountPoint& mountPoint : mountPoints)
+            {
+                const AZStd::vector<AZStd::string>& paths = driveInformation.m_paths;
+                if (AZStd::find(paths.begin(), paths.end(), mountPoint.m_path) != paths.end())
+                {
+                    continue;
+                }
+                for (const AZStd::string& path : paths)
+                {
+                    if (IsNestedPath(mountPoint.m_path, path))
+                    {
+                        driveInformation.m_excludedPaths.push_back(mountPoint.m_path);
+                        break;
+                    }
+                }
+            }
+            driveList.push_back(AZStd::move(driveInformation));
+        }
+
+        if (driveList.empty())
+        {
+            return false;
+        }
+
+        hardwareInfo.m_maxPageSize = AZStd::max(hardwareInfo.m_maxPageSize, aznumeric_cast<size_t>(::sysconf(_SC_PAGESIZE)));
+        hardwareInfo.m_profile = driveList.size() == 1 ? driveList.front().m_profile : "Generic";
+        hardwareInfo.m_platformData = AZStd::make_any<DriveList>(AZStd::move(driveList));
+        return true;
+    }
+
+    bool CollectIoHardwareInformation(HardwareInformation& info, bool includeAllHardware, bool reportHardware)
+    {
+        if (!CollectHardwareInfo(info, includeAllHardware, reportHardware))
+        {
+            // The numbers below are based on common defaults from a local hardware survey.
+            info.m_maxPageSize = 4096;
+            info.m_maxTransfer = 512_kib;
+            info.m_maxPhysicalSectorSize = 4096;
+            info.m_maxLogicalSectorSize = 512;
+            info.m_profile = "Generic";
+        }
+        return true;
+    }
+
+    void ReflectNative(ReflectContext* context)
+    {
+        LinuxStorageDriveConfig::Reflect(context);
+    }
+} // namespace AZ::IO
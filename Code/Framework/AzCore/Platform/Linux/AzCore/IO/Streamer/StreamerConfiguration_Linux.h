@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::IO
+{
+    struct DriveInformation
+    {
+        AZ_TYPE_INFO(AZ::IO::DriveInformation, "{3A7B7F38-0E2B-4C55-9C85-6A0A0D1B5F21}");
+
+        //! Mount points of the partitions on the device.
+        AZStd::vector<AZStd::string> m_paths;
+        //! Mount points nested in one of m_paths that belong to a different device or file system.
+        AZStd::vector<AZStd::string> m_excludedPaths;
+        AZStd::string m_profile;
+        size_t m_physicalSectorSize{ AZCORE_GLOBAL_NEW_ALIGNMENT };
+        size_t m_logicalSectorSize{ AZCORE_GLOBAL_NEW_ALIGNMENT };
+        size_t m_maxTransfer{ 0 };
+        u32 m_ioChannelCount{ 0 };
+        bool m_hasSeekPenalty{ true };
+    };
+
+    using DriveList = AZStd::vector<DriveInformation>;
+} // namespace AZ::IO
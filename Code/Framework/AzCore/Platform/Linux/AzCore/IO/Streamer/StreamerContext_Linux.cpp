@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <AzCore/IO/Streamer/StreamerContext_Linux.h>
+#include <AzCore/Debug/Profiler.h>
+
+namespace AZ::Platform
+{
+    StreamerContextThreadSync::StreamerContextThreadSync()
+    {
+        m_events[0] = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        AZ_Assert(m_events[0] != -1, "Failed to create a required event for IO Scheduler (Error: %i).", errno);
+        for (size_t i = 1; i < AZ_ARRAY_SIZE(m_events); ++i)
+        {
+            m_events[i] = -1;
+        }
+    }
+
+    StreamerContextThreadSync::~StreamerContextThreadSync()
+    {
+        AZ_Assert(m_eventCount == 1, "There are still %zu IO events registered while shutting down the IO Scheduler.", m_eventCount - 1);
+        if (m_events[0] != -1)
+        {
+            ::close(m_events[0]);
+        }
+    }
+
+    void StreamerContextThreadSync::Suspend()
+    {
+        AZ_Assert(m_events[0] != -1, "There is no synchronization event created for the main streamer thread to use to suspend.");
+
+        pollfd waitList[MaxIoEvents + 1];
+        for (size_t i = 0; i < m_eventCount; ++i)
+        {
+            waitList[i].fd = m_events[i];
+            waitList[i].events = POLLIN;
+            waitList[i].revents = 0;
+        }
+
+        int result;
+        do
+        {
+            result = ::poll(waitList, m_eventCount, -1);
+        } while (result < 0 && errno == EINTR);
+
+        if (result > 0)
+        {
+            // Reset the events that were signaled, similar to how manual reset events would be reset.
+            for (size_t i = 0; i < m_eventCount; ++i)
+            {
+                if (waitList[i].revents & POLLIN)
+                {
+                    eventfd_t value;
+                    ::eventfd_read(waitList[i].fd, &value);
+                }
+            }
+        }
+        else
+        {
+            AZ_Assert(false, "Unexpected wait result: %i (Error: %i).", result, errno);
+        }
+    }
+
+    void StreamerContextThreadSync::Resume()
+    {
+        AZ_Assert(m_events[0] != -1, "There is no synchronization event created for the main streamer thread to use to resume.");
+        ::eventfd_write(m_events[0], 1);
+    }
+
+    void StreamerContextThreadSync::RegisterEventHandle(int event)
+    {
+        AZ_Assert(event != -1, "An invalid IO event was provided.");
+        AZ_Assert(AreEventHandlesAvailable(), "There are no more slots available to register a new IO event in.");
+        m_events[m_eventCount++] = event;
+    }
+
+    void StreamerContextThreadSync::UnregisterEventHandle(int event)
+    {
+        AZ_Assert(m_eventCount > 1, "There are no more IO events that can be unregistered.");
+
+        for (size_t i = 1; i < m_eventCount; ++i)
+        {
+            if (m_events[i] == event)
+            {
+                m_eventCount--;
+                m_events[i] = m_events[m_eventCount];
+                m_events[m_eventCount] = -1;
+                return;
+            }
+        }
+
+        AZ_Assert(false, "IO event couldn't be unregistered as it wasn't found.");
+    }
+
+    size_t StreamerContextThreadSync::GetEventHandleCount() const
+    {
+        return m_eventCount - 1;
+    }
+
+    bool StreamerContextThreadSync::AreEventHandlesAvailable() const
+    {
+        return m_eventCount < AZ_ARRAY_SIZE(m_events);
+    }
+} // namespace AZ::Platform
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ::Platform
+{
+    //! Synchronization for the main Streamer thread on Linux. In addition to the wake up calls from the rest of the engine,
+    //! the thread can be woken up by asynchronous IO through event file descriptors, such as the ones attached to io_uring
+    //! instances, so the thread can go to sleep while reads are in flight.
+    class StreamerContextThreadSync
+    {
+    public:
+        static constexpr size_t MaxIoEvents = 63;
+
+        StreamerContextThreadSync();
+        ~StreamerContextThreadSync();
+
+        void Suspend();
+        void Resume();
+
+        //! Adds an event file descriptor that wakes up the Streamer thread when signaled. The caller keeps ownership
+        //! of the descriptor and needs to unregister it before closing it.
+        void RegisterEventHandle(int event);
+        void UnregisterEventHandle(int event);
+        size_t GetEventHandleCount() const;
+        bool AreEventHandlesAvailable() const;
+
+    private:
+        // Note: The first event is reserved for the synchronization of the scheduler thread
+        // with the rest of the engine. The remaining events can be freely used by Streamer's internals.
+        int m_events[MaxIoEvents + 1];
+        size_t m_eventCount{ 1 }; // The first event is for external wake up calls.
+    };
+
+} // namespace AZ::Platform
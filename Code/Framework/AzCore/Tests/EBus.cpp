@@ -45,7 +45,7 @@ namespace BusImplementation
     };
 
     // Traits for the benchmark bus
-    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false>
+    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false, bool snapshotDispatch = false>
     class Traits
         : public AZ::EBusTraits
     {
@@ -53,6 +53,7 @@ namespace BusImplementation
         static const AZ::EBusAddressPolicy AddressPolicy = addressPolicy;
         static const AZ::EBusHandlerPolicy HandlerPolicy = handlerPolicy;
         static const bool LocklessDispatch = locklessDispatch;
+        static const bool SnapshotDispatch = snapshotDispatch;
 
         // Allow queuing
         static const bool EnableEventQueue = true;
@@ -193,13 +194,17 @@ private:
 };
 
 // Definition of the benchmark bus, depending on supplied policies
-template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false>
-using TestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::Traits<addressPolicy, handlerPolicy, locklessDispatch>>;
+template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false, bool snapshotDispatch = false>
+using TestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::Traits<addressPolicy, handlerPolicy, locklessDispatch, snapshotDispatch>>;
 
 #define EBUS_TEST_ALIAS(BusType, AddressPolicy, HandlerPolicy)                                              \
     using BusType = TestBus<AZ::EBusAddressPolicy::AddressPolicy, AZ::EBusHandlerPolicy::HandlerPolicy>;    \
     namespace testing { namespace internal { template<> std::string GetTypeName<BusType>() { return #BusType; } } }
 
+#define EBUS_SNAPSHOT_TEST_ALIAS(BusType, AddressPolicy, HandlerPolicy)                                                 \
+    using BusType = TestBus<AZ::EBusAddressPolicy::AddressPolicy, AZ::EBusHandlerPolicy::HandlerPolicy, false, true>;   \
+    namespace testing { namespace internal { template<> std::string GetTypeName<BusType>() { return #BusType; } } }
+
 // Predefined benchmark bus instantiations
 // Single
 EBUS_TEST_ALIAS(OneToOne, Single, Single)
@@ -213,6 +218,11 @@ EBUS_TEST_ALIAS(ManyToManyOrdered, ById, MultipleAndOrdered)
 EBUS_TEST_ALIAS(ManyOrderedToOne, ByIdAndOrdered, Single)
 EBUS_TEST_ALIAS(ManyOrderedToMany, ByIdAndOrdered, Multiple)
 EBUS_TEST_ALIAS(ManyOrderedToManyOrdered, ByIdAndOrdered, MultipleAndOrdered)
+// Snapshot dispatch
+EBUS_SNAPSHOT_TEST_ALIAS(OneToManySnapshot, Single, Multiple)
+EBUS_SNAPSHOT_TEST_ALIAS(OneToManyOrderedSnapshot, Single, MultipleAndOrdered)
+EBUS_SNAPSHOT_TEST_ALIAS(ManyToManySnapshot, ById, Multiple)
+EBUS_SNAPSHOT_TEST_ALIAS(ManyOrderedToManyOrderedSnapshot, ByIdAndOrdered, MultipleAndOrdered)
 
 // Handler for multi-address buses
 template <typename Bus, AZ::EBusAddressPolicy addressPolicy = Bus::Traits::AddressPolicy>
@@ -362,11 +372,13 @@ namespace UnitTest
 {
     using BusTypesId = ::testing::Types<
         ManyToOne,        ManyToMany,        ManyToManyOrdered,
-        ManyOrderedToOne, ManyOrderedToMany, ManyOrderedToManyOrdered>;
+        ManyOrderedToOne, ManyOrderedToMany, ManyOrderedToManyOrdered,
+        ManyToManySnapshot, ManyOrderedToManyOrderedSnapshot>;
     using BusTypesAll = ::testing::Types<
         OneToOne,         OneToMany,         OneToManyOrdered,
         ManyToOne,        ManyToMany,        ManyToManyOrdered,
-        ManyOrderedToOne, ManyOrderedToMany, ManyOrderedToManyOrdered>;
+        ManyOrderedToOne, ManyOrderedToMany, ManyOrderedToManyOrdered,
+        OneToManySnapshot, OneToManyOrderedSnapshot, ManyToManySnapshot, ManyOrderedToManyOrderedSnapshot>;
 
     template <typename Bus>
     class EBusTestAll
@@ -564,7 +576,8 @@ namespace UnitTest
 
     using BusTypesIdMultiHandlers = ::testing::Types<
         ManyToMany, ManyToManyOrdered,
-        ManyOrderedToMany, ManyOrderedToManyOrdered>;
+        ManyOrderedToMany, ManyOrderedToManyOrdered,
+        ManyToManySnapshot, ManyOrderedToManyOrderedSnapshot>;
     template <typename Bus>
     class EBusTestIdMultiHandlers
         : public EBusTestAll<Bus>
@@ -2873,6 +2886,297 @@ namespace UnitTest
         }
     }
 
+    namespace SnapshotTest
+    {
+        struct SnapshotEvents
+            : public AZ::EBusTraits
+        {
+            using MutexType = AZStd::recursive_mutex;
+            static const bool SnapshotDispatch = true;
+            static const EBusAddressPolicy AddressPolicy = EBusAddressPolicy::ById;
+            using BusIdType = uint32_t;
+
+            virtual ~SnapshotEvents() = default;
+            virtual void OnEvent() = 0;
+        };
+
+        using SnapshotBus = AZ::EBus<SnapshotEvents>;
+
+        struct SnapshotHandler
+            : public SnapshotBus::Handler
+        {
+            SnapshotHandler(uint32_t id = 0)
+                : m_id(id)
+            {
+            }
+
+            ~SnapshotHandler() override
+            {
+                BusDisconnect();
+            }
+
+            void OnEvent() override
+            {
+                EXPECT_TRUE(m_isConnected.load());
+                m_calls.fetch_add(1);
+                if (m_onEvent)
+                {
+                    m_onEvent(*this);
+                }
+            }
+
+            void Connect()
+            {
+                m_isConnected = true;
+                BusConnect(m_id);
+            }
+
+            void Disconnect()
+            {
+                BusDisconnect();
+                m_isConnected = false;
+            }
+
+            AZStd::function<void(SnapshotHandler&)> m_onEvent;
+            AZStd::atomic<uint32_t> m_calls{ 0 };
+            AZStd::atomic_bool m_isConnected{ false };
+            uint32_t m_id;
+        };
+    }
+
+    TEST_F(EBus, SnapshotDispatch_ConnectDuringDispatch_HandlerReceivesNextEvent)
+    {
+        using namespace SnapshotTest;
+
+        SnapshotHandler connecting;
+        SnapshotHandler handler;
+        handler.m_onEvent = [&connecting](SnapshotHandler&)
+        {
+            if (!connecting.BusIsConnected())
+            {
+                connecting.Connect();
+            }
+        };
+        handler.Connect();
+
+        SnapshotBus::Event(0, &SnapshotBus::Events::OnEvent);
+        EXPECT_EQ(1, handler.m_calls);
+        EXPECT_EQ(0, connecting.m_calls);
+
+        SnapshotBus::Event(0, &SnapshotBus::Events::OnEvent);
+        EXPECT_EQ(2, handler.m_calls);
+        EXPECT_EQ(1, connecting.m_calls);
+    }
+
+    TEST_F(EBus, SnapshotDispatch_DisconnectDuringDispatch_HandlerIsSkipped)
+    {
+        using namespace SnapshotTest;
+
+        SnapshotHandler first;
+        SnapshotHandler second;
+        auto disconnectOther = [&first, &second](SnapshotHandler& self)
+        {
+            SnapshotHandler& other = &self == &first ? second : first;
+            other.Disconnect();
+        };
+        first.m_onEvent = disconnectOther;
+        second.m_onEvent = disconnectOther;
+        first.Connect();
+        second.Connect();
+
+        // Whichever handler is called first disconnects the other one, which then isn't called anymore.
+        SnapshotBus::Broadcast(&SnapshotBus::Events::OnEvent);
+        EXPECT_EQ(1, first.m_calls + second.m_calls);
+        EXPECT_EQ(1, SnapshotBus::GetTotalNumOfEventHandlers());
+    }
+
+    TEST_F(EBus, SnapshotDispatch_DeleteDuringDispatch_HandlerIsRemoved)
+    {
+        using namespace SnapshotTest;
+
+        SnapshotHandler* handler = new SnapshotHandler();
+        handler->m_onEvent = [](SnapshotHandler& self)
+        {
+            delete &self;
+        };
+        handler->Connect();
+
+        SnapshotBus::Broadcast(&SnapshotBus::Events::OnEvent);
+        EXPECT_FALSE(SnapshotBus::HasHandlers());
+    }
+
+    TEST_F(EBus, SnapshotDispatch_DispatchWhileConnectingFromOtherThreads_NoCallsAfterDisconnect)
+    {
+        using namespace SnapshotTest;
+
+        constexpr size_t dispatchThreadCount = 8;
+        constexpr uint32_t addressCount = 4;
+        constexpr int cycleCount = 500;
+
+        AZStd::atomic_bool isRunning{ true };
+        AZStd::thread dispatchThreads[dispatchThreadCount];
+        for (AZStd::thread& thread : dispatchThreads)
+        {
+            thread = AZStd::thread([&isRunning]()
+            {
+                uint32_t id = 0;
+                while (isRunning)
+                {
+                    SnapshotBus::Event(id++ % addressCount, &SnapshotBus::Events::OnEvent);
+                    SnapshotBus::Broadcast(&SnapshotBus::Events::OnEvent);
+                }
+            });
+        }
+
+        // Handlers check on every call that they're still connected, so calls made after a disconnect returned fail the test.
+        for (int i = 0; i < cycleCount; ++i)
+        {
+            SnapshotHandler* handler = new SnapshotHandler(i % addressCount);
+            handler->Connect();
+            AZStd::this_thread::yield();
+            handler->Disconnect();
+            delete handler;
+        }
+
+        isRunning = false;
+        for (AZStd::thread& thread : dispatchThreads)
+        {
+            thread.join();
+        }
+        EXPECT_FALSE(SnapshotBus::HasHandlers());
+    }
+
+    TEST_F(EBus, SnapshotDispatch_DisconnectDuringDispatchOnMultipleThreads_DoesNotDeadlock)
+    {
+        using namespace SnapshotTest;
+
+        constexpr size_t threadCount = 4;
+        constexpr int cycleCount = 200;
+
+        // Every thread dispatches to its own address, while the handlers disconnect handlers on other threads' addresses.
+        AZStd::vector<AZStd::unique_ptr<SnapshotHandler>> handlers;
+        for (uint32_t i = 0; i < threadCount; ++i)
+        {
+            handlers.emplace_back(AZStd::make_unique<SnapshotHandler>(i));
+        }
+        for (uint32_t i = 0; i < threadCount; ++i)
+        {
+            SnapshotHandler& other = *handlers[(i + 1) % threadCount];
+            handlers[i]->m_onEvent = [&other](SnapshotHandler&)
+            {
+                other.Disconnect();
+                other.Connect();
+            };
+            handlers[i]->Connect();
+        }
+
+        AZStd::thread threads[threadCount];
+        for (uint32_t i = 0; i < threadCount; ++i)
+        {
+            threads[i] = AZStd::thread([i]()
+            {
+                for (int cycle = 0; cycle < cycleCount; ++cycle)
+                {
+                    SnapshotBus::Event(i, &SnapshotBus::Events::OnEvent);
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (auto& handler : handlers)
+        {
+            handler->m_onEvent = nullptr;
+            handler->Disconnect();
+        }
+    }
+
+    TEST_F(EBus, SnapshotDispatch_DisconnectWhileHandlerOnOtherThreadIsWaiting_WaitsForHandlerToReturn)
+    {
+        using namespace SnapshotTest;
+
+        AZStd::atomic_bool isOtherEntered{ false };
+        AZStd::atomic_bool isOtherReleased{ false };
+        AZStd::atomic_bool isWaitingEntered{ false };
+        AZStd::atomic_bool isOtherDisconnected{ false };
+        AZStd::atomic_bool isWaitingReleased{ false };
+        AZStd::atomic_bool hasWaitingReturned{ false };
+        AZStd::atomic_bool hasDisconnectReturned{ false };
+
+        // Blocks the dispatch to address 1 so a disconnect of this handler has to wait.
+        SnapshotHandler other(1);
+        other.m_onEvent = [&](SnapshotHandler&)
+        {
+            isOtherEntered = true;
+            while (!isOtherReleased)
+            {
+                AZStd::this_thread::yield();
+            }
+        };
+        other.Connect();
+
+        // Disconnects the blocked handler from inside a dispatch, so the thread calling it is waiting itself.
+        SnapshotHandler waiting(0);
+        waiting.m_onEvent = [&](SnapshotHandler&)
+        {
+            isWaitingEntered = true;
+            other.Disconnect();
+            isOtherDisconnected = true;
+            while (!isWaitingReleased)
+            {
+                AZStd::this_thread::yield();
+            }
+            hasWaitingReturned = true;
+        };
+        waiting.Connect();
+
+        AZStd::thread otherThread([]()
+        {
+            SnapshotBus::Event(1, &SnapshotBus::Events::OnEvent);
+        });
+        while (!isOtherEntered)
+        {
+            AZStd::this_thread::yield();
+        }
+        AZStd::thread waitingThread([]()
+        {
+            SnapshotBus::Event(0, &SnapshotBus::Events::OnEvent);
+        });
+        while (!isWaitingEntered)
+        {
+            AZStd::this_thread::yield();
+        }
+
+        // Disconnecting while the other thread is still waiting for its own disconnect must not skip it, as it's still
+        // inside the handler.
+        bool wasWaitingReturned = false;
+        AZStd::thread disconnectThread([&]()
+        {
+            waiting.Disconnect();
+            wasWaitingReturned = hasWaitingReturned;
+            hasDisconnectReturned = true;
+        });
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(10));
+        EXPECT_FALSE(hasDisconnectReturned);
+
+        isOtherReleased = true;
+        while (!isOtherDisconnected)
+        {
+            AZStd::this_thread::yield();
+        }
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(10));
+        EXPECT_FALSE(hasDisconnectReturned);
+
+        isWaitingReleased = true;
+        disconnectThread.join();
+        waitingThread.join();
+        otherThread.join();
+        EXPECT_TRUE(wasWaitingReturned);
+        EXPECT_FALSE(SnapshotBus::HasHandlers());
+    }
+
     namespace MultithreadConnect
     {
         class MyEventGroup
@@ -4062,6 +4366,17 @@ namespace Benchmark
                 ->ThreadPerCpu();
                 ;
         }
+
+        // Used to compare how dispatching scales with the number of threads that dispatch at the same time.
+        // Expected that this will be called after one of the above, so Common not called
+        void ConcurrentDispatchers(::benchmark::internal::Benchmark* benchmark)
+        {
+            benchmark
+                ->Threads(1)
+                ->Threads(8)
+                ->Threads(32)
+                ;
+        }
     }
 
     // AZ Benchmark environment used to initialize all EBus Handlers and then shared them with each benchmark test
@@ -4501,6 +4816,60 @@ namespace Benchmark
         }
     }
     BENCHMARK(BM_EBus_Multithreaded_Lockless)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
+
+    static void BM_EBus_Multithreaded_Snapshot(::benchmark::State& state)
+    {
+        using Bus = TestBus<AZ::EBusAddressPolicy::Single, AZ::EBusHandlerPolicy::Multiple, false, true>;
+
+        AZStd::unique_ptr<BM_EBusEnvironment<Bus>> ebusBenchmarkEnv;
+        if (state.thread_index == 0)
+        {
+            ebusBenchmarkEnv = AZStd::make_unique<BM_EBusEnvironment<Bus>>();
+            ebusBenchmarkEnv->SetUpBenchmark();
+            ebusBenchmarkEnv->Connect(state);
+        }
+
+        while (state.KeepRunning())
+        {
+            Bus::Broadcast(&Bus::Events::OnWait);
+        };
+
+        if (state.thread_index == 0)
+        {
+            ebusBenchmarkEnv->Disconnect(state);
+            ebusBenchmarkEnv->TearDownBenchmark();
+        }
+    }
+    BENCHMARK(BM_EBus_Multithreaded_Snapshot)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::ConcurrentDispatchers);
+    // The 1 and 8 thread runs of the locking version are already covered by the Multithreaded settings.
+    BENCHMARK(BM_EBus_Multithreaded_Locks)->Apply(&BenchmarkSettings::OneToMany)->Threads(32);
+
+    // Every thread sends events to its own address, as is common for notification buses that are sent to from jobs.
+    template <typename Bus>
+    static void BM_EBus_Multithreaded_Event(::benchmark::State& state)
+    {
+        AZStd::vector<AZStd::unique_ptr<Handler<Bus>>> handlers;
+        if (state.thread_index == 0)
+        {
+            constexpr bool connectOnConstruct{ true };
+            for (int address = 0; address < state.threads; ++address)
+            {
+                handlers.emplace_back(AZStd::make_unique<Handler<Bus>>(address, connectOnConstruct));
+            }
+        }
+
+        while (state.KeepRunning())
+        {
+            Bus::Event(state.thread_index, &Bus::Events::OnWait);
+        };
+
+        if (state.thread_index == 0)
+        {
+            handlers.clear();
+        }
+    }
+    BENCHMARK_TEMPLATE(BM_EBus_Multithreaded_Event, ManyToMany)->Apply(&BenchmarkSettings::Common)->Apply(&BenchmarkSettings::ConcurrentDispatchers);
+    BENCHMARK_TEMPLATE(BM_EBus_Multithreaded_Event, ManyToManySnapshot)->Apply(&BenchmarkSettings::Common)->Apply(&BenchmarkSettings::ConcurrentDispatchers);
 }
 
 #endif // HAVE_BENCHMARK
@@ -1652,6 +1652,122 @@ namespace UnitTest
     {
         RunTest();
     }
+
+    class WorkQueueTestJob : public Job
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(WorkQueueTestJob, ThreadPoolAllocator, 0)
+
+        WorkQueueTestJob(size_t index, AZ::s8 priority, JobContext* context)
+            : Job(false, context, false, priority)
+            , m_index(index)
+        {
+        }
+
+        void Process() override
+        {
+        }
+
+        const size_t m_index;
+    };
+
+    class WorkQueueStressTestFixture : public DefaultJobManagerSetupFixture
+    {
+    public:
+        void RunTest()
+        {
+            constexpr size_t numJobs = 100000;
+            constexpr size_t numThieves = 4;
+            // pushing in bursts larger than the initial capacity of the deque makes it grow while it's being stolen from
+            constexpr size_t burstSize = 1000;
+
+            // a few jobs with a raised priority go through the sorted queue next to the deque
+            AZStd::vector<AZStd::unique_ptr<WorkQueueTestJob>> jobs;
+            jobs.reserve(numJobs);
+            for (size_t i = 0; i < numJobs; ++i)
+            {
+                jobs.emplace_back(aznew WorkQueueTestJob(i, (i % 64 == 0) ? 1 : 0, m_jobContext));
+            }
+
+            AZ::Internal::WorkQueue queue;
+            AZStd::atomic<size_t> numTaken{ 0 };
+            AZStd::vector<size_t> takenByOwner;
+            AZStd::vector<size_t> takenByThief[numThieves];
+
+            AZStd::thread thieves[numThieves];
+            for (size_t thiefIndex = 0; thiefIndex < numThieves; ++thiefIndex)
+            {
+                thieves[thiefIndex] = AZStd::thread([&queue, &numTaken, &taken = takenByThief[thiefIndex]]()
+                {
+                    while (numTaken.load() < numJobs)
+                    {
+                        if (Job* job = queue.TrySteal())
+                        {
+                            taken.push_back(static_cast<WorkQueueTestJob*>(job)->m_index);
+                            ++numTaken;
+                        }
+                    }
+                });
+            }
+
+            // the owner pushes the jobs in bursts and pops half a burst after each, racing the thieves for the last job in the deque
+            for (size_t firstJob = 0; firstJob < numJobs; firstJob += burstSize)
+            {
+                const size_t endJob = AZStd::min(firstJob + burstSize, numJobs);
+                for (size_t i = firstJob; i < endJob; ++i)
+                {
+                    queue.LocalInsert(jobs[i].get());
+                }
+                for (size_t i = 0; i < burstSize / 2; ++i)
+                {
+                    if (Job* job = queue.LocalPop())
+                    {
+                        takenByOwner.push_back(static_cast<WorkQueueTestJob*>(job)->m_index);
+                        ++numTaken;
+                    }
+                }
+            }
+            while (numTaken.load() < numJobs)
+            {
+                if (Job* job = queue.LocalPop())
+                {
+                    takenByOwner.push_back(static_cast<WorkQueueTestJob*>(job)->m_index);
+                    ++numTaken;
+                }
+            }
+
+            for (AZStd::thread& thief : thieves)
+            {
+                thief.join();
+            }
+
+            // every job was taken exactly once
+            AZStd::vector<AZ::u32> takeCounts(numJobs, 0);
+            for (size_t index : takenByOwner)
+            {
+                ++takeCounts[index];
+            }
+            for (const AZStd::vector<size_t>& taken : takenByThief)
+            {
+                for (size_t index : taken)
+                {
+                    ++takeCounts[index];
+                }
+            }
+            EXPECT_EQ(numJobs, numTaken.load());
+            for (size_t i = 0; i < numJobs; ++i)
+            {
+                EXPECT_EQ(1, takeCounts[i]) << "Job " << i << " was taken " << takeCounts[i] << " times";
+            }
+            EXPECT_EQ(nullptr, queue.LocalPop());
+            EXPECT_EQ(nullptr, queue.TrySteal());
+        }
+    };
+
+    TEST_F(WorkQueueStressTestFixture, ConcurrentPushPopAndSteal_EveryJobIsTakenOnce)
+    {
+        RunTest();
+    }
 } // UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -2012,6 +2128,115 @@ namespace Benchmark
             RunMultipleCalculatePiJobsWithRandomDepthAndRandomPriority(LARGE_NUMBER_OF_JOBS);
         }
     }
+
+    //! Recursively splits [begin, end) in halves as child jobs and joins on them, the leaves calculate pi. This is the
+    //! fork/join pattern of the culling and animation jobs and stresses the local queues and stealing rather than the global queue.
+    class TestJobForkJoin : public Job
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TestJobForkJoin, ThreadPoolAllocator, 0)
+
+        TestJobForkJoin(AZ::u32 begin, AZ::u32 end, AZ::u32 depth, JobContext* context)
+            : Job(true, context)
+            , m_begin(begin)
+            , m_end(end)
+            , m_depth(depth)
+        {
+        }
+
+        void Process() override
+        {
+            if (m_end - m_begin <= 1)
+            {
+                benchmark::DoNotOptimize(CalculatePi(m_depth));
+                return;
+            }
+
+            const AZ::u32 middle = m_begin + (m_end - m_begin) / 2;
+            StartAsChild(aznew TestJobForkJoin(m_begin, middle, m_depth, m_context));
+            StartAsChild(aznew TestJobForkJoin(middle, m_end, m_depth, m_context));
+            WaitForChildren();
+        }
+    private:
+        const AZ::u32 m_begin;
+        const AZ::u32 m_end;
+        const AZ::u32 m_depth;
+    };
+
+    //! Runs fork/join job trees with the number of worker threads given by the first benchmark argument
+    class JobForkJoinBenchmarkFixture : public ::benchmark::Fixture
+    {
+    public:
+        static const AZ::u32 NUMBER_OF_LEAF_JOBS = 16384;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+
+            JobManagerDesc desc;
+            JobManagerThreadDesc threadDesc;
+            const AZ::u32 numWorkerThreads = static_cast<AZ::u32>(state.range(0));
+            for (AZ::u32 i = 0; i < numWorkerThreads; ++i)
+            {
+                desc.m_workerThreads.push_back(threadDesc);
+            }
+
+            m_jobManager = aznew JobManager(desc);
+            m_jobContext = aznew JobContext(*m_jobManager);
+        }
+
+        void TearDown([[maybe_unused]] ::benchmark::State& state) override
+        {
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+        }
+
+    protected:
+        void RunForkJoin(::benchmark::State& state, AZ::u32 leafDepth)
+        {
+            for (auto _ : state)
+            {
+                Job* rootJob = aznew TestJobForkJoin(0, NUMBER_OF_LEAF_JOBS, leafDepth, m_jobContext);
+                JobCompletion doneJob(m_jobContext);
+                rootJob->SetDependent(&doneJob);
+                rootJob->Start();
+                doneJob.StartAndWaitForCompletion();
+            }
+            state.SetItemsProcessed(state.iterations() * NUMBER_OF_LEAF_JOBS);
+        }
+
+        JobManager* m_jobManager = nullptr;
+        JobContext* m_jobContext = nullptr;
+    };
+
+    BENCHMARK_DEFINE_F(JobForkJoinBenchmarkFixture, ForkJoinLightWeightJobs)(benchmark::State& state)
+    {
+        RunForkJoin(state, JobBenchmarkFixture::LIGHT_WEIGHT_JOB_CALCULATE_PI_DEPTH);
+    }
+
+    BENCHMARK_DEFINE_F(JobForkJoinBenchmarkFixture, ForkJoinMediumWeightJobs)(benchmark::State& state)
+    {
+        RunForkJoin(state, JobBenchmarkFixture::MEDIUM_WEIGHT_JOB_CALCULATE_PI_DEPTH);
+    }
+
+    // The main thread only waits, so wall clock time is what shows how the job system scales with the number of workers.
+    BENCHMARK_REGISTER_F(JobForkJoinBenchmarkFixture, ForkJoinLightWeightJobs)
+        ->ArgName("Workers")
+        ->RangeMultiplier(2)
+        ->Range(1, 64)
+        ->UseRealTime()
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(JobForkJoinBenchmarkFixture, ForkJoinMediumWeightJobs)
+        ->ArgName("Workers")
+        ->RangeMultiplier(2)
+        ->Range(1, 64)
+        ->UseRealTime()
+        ->Unit(benchmark::kMicrosecond);
 } // Benchmark
 
 #endif // HAVE_BENCHMARK
@@ -9,6 +9,8 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Memory/HphaSchema.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
 
 #if defined(HAVE_BENCHMARK)
 #include <benchmark/benchmark.h>
@@ -111,6 +113,139 @@ namespace UnitTest
     INSTANTIATE_TEST_CASE_P(Mixed,
         HphaSchemaTestFixture,
         ::testing::ValuesIn(s_mixedInstancesParameters));
+
+    class HphaSchemaThreadCacheTestFixture
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            HphaSchema_TestAllocator::Descriptor desc;
+            desc.m_isThreadCacheEnabled = true;
+            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Create(desc);
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Destroy();
+        }
+
+        static AZ::HphaSchema::ThreadCacheStats GetThreadCacheStats()
+        {
+            AZ::HphaSchema::ThreadCacheStats stats;
+            static_cast<AZ::HphaSchema*>(AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().GetSchema())->GetThreadCacheStats(stats);
+            return stats;
+        }
+
+        static void AllocateAndFree(size_t numberOfAllocationsPerSize)
+        {
+            AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>> allocations;
+            for (size_t i = 0; i < numberOfAllocationsPerSize * s_smallAllocationSizes.size(); ++i)
+            {
+                const size_t allocationSize = s_smallAllocationSizes[i % s_smallAllocationSizes.size()];
+                void* allocation = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().Allocate(allocationSize, 0);
+                EXPECT_NE(nullptr, allocation);
+                allocations.emplace_back(allocation);
+            }
+            for (size_t i = 0; i < allocations.size(); ++i)
+            {
+                AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().DeAllocate(allocations[i], s_smallAllocationSizes[i % s_smallAllocationSizes.size()]);
+            }
+        }
+    };
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, AllocateAndFree_CachesFreedMemory_NotReportedAsAllocated)
+    {
+        AllocateAndFree(100);
+
+        AZ::HphaSchema::ThreadCacheStats stats = GetThreadCacheStats();
+        EXPECT_EQ(1u, stats.m_numThreadCaches);
+        EXPECT_LT(0u, stats.m_numRefills);
+        EXPECT_LT(0u, stats.m_cachedBytes);
+        EXPECT_EQ(stats.m_cachedBytes, AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().GetThreadCachedBytes());
+        EXPECT_EQ(0u, AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().NumAllocatedBytes());
+
+        AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().GarbageCollect();
+        EXPECT_EQ(0u, GetThreadCacheStats().m_cachedBytes);
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, ThreadExit_ReturnsCachedMemory)
+    {
+        constexpr size_t numberOfThreads = 4;
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t i = 0; i < numberOfThreads; ++i)
+        {
+            threads.emplace_back([]()
+            {
+                AllocateAndFree(100);
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        AZ::HphaSchema::ThreadCacheStats stats = GetThreadCacheStats();
+        EXPECT_EQ(0u, stats.m_numThreadCaches);
+        EXPECT_EQ(0u, stats.m_cachedBytes);
+        EXPECT_LT(0u, stats.m_numFlushes);
+        EXPECT_EQ(0u, AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().NumAllocatedBytes());
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, FreeOnOtherThread_ReturnsMemory)
+    {
+        AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>> allocations;
+        for (size_t allocationSize : s_smallAllocationSizes)
+        {
+            allocations.emplace_back(AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().Allocate(allocationSize, 0));
+        }
+
+        AZStd::thread thread([&allocations]()
+        {
+            for (void* allocation : allocations)
+            {
+                AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().DeAllocate(allocation);
+            }
+        });
+        thread.join();
+
+        AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().GarbageCollect();
+        EXPECT_EQ(0u, AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().NumAllocatedBytes());
+        EXPECT_EQ(0u, GetThreadCacheStats().m_cachedBytes);
+    }
+
+    struct DeallocateOnThreadExit
+    {
+        ~DeallocateOnThreadExit()
+        {
+            if (m_allocation)
+            {
+                AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().DeAllocate(m_allocation);
+            }
+        }
+
+        void* m_allocation = nullptr;
+    };
+    static thread_local DeallocateOnThreadExit t_deallocateOnThreadExit;
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, FreeFromThreadLocalAfterCacheReleased_ReturnsMemory)
+    {
+        AZStd::thread thread([]()
+        {
+            // constructed before the first allocation of the thread creates its cache, so it's destroyed after the cache
+            // has been released when the thread exits
+            DeallocateOnThreadExit& deallocateOnThreadExit = t_deallocateOnThreadExit;
+            deallocateOnThreadExit.m_allocation = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().Allocate(s_smallAllocationSizes[0], 0);
+            EXPECT_NE(nullptr, deallocateOnThreadExit.m_allocation);
+            AllocateAndFree(10);
+        });
+        thread.join();
+
+        AZ::HphaSchema::ThreadCacheStats stats = GetThreadCacheStats();
+        EXPECT_EQ(0u, stats.m_numThreadCaches);
+        EXPECT_EQ(0u, stats.m_cachedBytes);
+        EXPECT_EQ(0u, AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().NumAllocatedBytes());
+    }
 }
 
 
@@ -178,6 +313,123 @@ namespace Benchmark
         BM_Allocations(state, s_mixedAllocationSizes);
     }
 
+    // Small allocations from multiple threads. The first argument enables the thread cache.
+    // SetUp and TearDown run on every thread, so only the first thread creates and destroys the allocator. The other threads
+    // can't touch the allocator once they stopped running.
+    class HphaSchemaMultithreadedBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        static const size_t s_batchSize = 64;
+
+        void SetUp(const ::benchmark::State& state)
+        {
+            if (state.thread_index == 0)
+            {
+                HphaSchema_TestAllocator::Descriptor desc;
+                desc.m_isThreadCacheEnabled = state.range(0) != 0;
+                AZ::AllocatorInstance<HphaSchema_TestAllocator>::Create(desc);
+            }
+        }
+
+        void TearDown(const ::benchmark::State& state)
+        {
+            if (state.thread_index == 0)
+            {
+                for (void* allocation : s_sharedBatch)
+                {
+                    AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().DeAllocate(allocation);
+                }
+                s_sharedBatch = {};
+                AZ::AllocatorInstance<HphaSchema_TestAllocator>::Destroy();
+            }
+        }
+
+        static void AllocateBatch(AZStd::vector<void*>& batch, size_t firstSizeIndex)
+        {
+            for (size_t i = 0; i < s_batchSize; ++i)
+            {
+                batch.push_back(AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().Allocate(s_smallAllocationSizes[(firstSizeIndex + i) % s_smallAllocationSizes.size()], 0));
+            }
+        }
+
+        static void FreeBatch(AZStd::vector<void*>& batch)
+        {
+            for (void* allocation : batch)
+            {
+                AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().DeAllocate(allocation);
+            }
+            batch.clear();
+        }
+
+        // batch handed between the threads by the producer/consumer benchmark
+        static AZStd::vector<void*> s_sharedBatch;
+        static AZStd::mutex s_sharedBatchMutex;
+    };
+    AZStd::vector<void*> HphaSchemaMultithreadedBenchmarkFixture::s_sharedBatch;
+    AZStd::mutex HphaSchemaMultithreadedBenchmarkFixture::s_sharedBatchMutex;
+
+    // Every thread allocates a batch and frees it again, as jobs building temporary containers do
+    BENCHMARK_DEFINE_F(HphaSchemaMultithreadedBenchmarkFixture, SmallAllocations_AllocateThenFree)(benchmark::State& state)
+    {
+        AZStd::vector<void*> batch;
+        batch.reserve(s_batchSize);
+        size_t sizeIndex = state.thread_index;
+        while (state.KeepRunning())
+        {
+            AllocateBatch(batch, sizeIndex++);
+            FreeBatch(batch);
+        }
+        state.SetItemsProcessed(state.iterations() * s_batchSize);
+    }
+    BENCHMARK_REGISTER_F(HphaSchemaMultithreadedBenchmarkFixture, SmallAllocations_AllocateThenFree)
+        ->Arg(0)->Arg(1)->ThreadRange(1, 8)->ThreadPerCpu();
+
+    // Every thread keeps a window of live allocations and replaces the oldest one, so allocations and frees interleave.
+    // All allocations are freed within the iteration as the allocator can be destroyed as soon as the first thread stops running.
+    BENCHMARK_DEFINE_F(HphaSchemaMultithreadedBenchmarkFixture, SmallAllocations_Interleaved)(benchmark::State& state)
+    {
+        static const size_t s_replacementsPerIteration = 4 * s_batchSize;
+        AZStd::vector<void*> window;
+        window.reserve(s_batchSize);
+        size_t sizeIndex = state.thread_index;
+        while (state.KeepRunning())
+        {
+            AllocateBatch(window, sizeIndex);
+            for (size_t i = 0; i < s_replacementsPerIteration; ++i)
+            {
+                const size_t oldest = i % s_batchSize;
+                AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().DeAllocate(window[oldest]);
+                window[oldest] = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().Allocate(s_smallAllocationSizes[(sizeIndex + i) % s_smallAllocationSizes.size()], 0);
+            }
+            FreeBatch(window);
+            ++sizeIndex;
+        }
+        state.SetItemsProcessed(state.iterations() * (s_batchSize + s_replacementsPerIteration));
+    }
+    BENCHMARK_REGISTER_F(HphaSchemaMultithreadedBenchmarkFixture, SmallAllocations_Interleaved)
+        ->Arg(0)->Arg(1)->ThreadRange(1, 8)->ThreadPerCpu();
+
+    // Every thread allocates a batch and frees the batch allocated by another thread, as in producer/consumer queues
+    BENCHMARK_DEFINE_F(HphaSchemaMultithreadedBenchmarkFixture, SmallAllocations_FreeOnOtherThread)(benchmark::State& state)
+    {
+        AZStd::vector<void*> batch;
+        batch.reserve(s_batchSize);
+        size_t sizeIndex = state.thread_index;
+        while (state.KeepRunning())
+        {
+            AllocateBatch(batch, sizeIndex++);
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(s_sharedBatchMutex);
+                batch.swap(s_sharedBatch);
+            }
+            FreeBatch(batch);
+        }
+        state.SetItemsProcessed(state.iterations() * s_batchSize);
+    }
+    BENCHMARK_REGISTER_F(HphaSchemaMultithreadedBenchmarkFixture, SmallAllocations_FreeOnOtherThread)
+        ->Arg(0)->Arg(1)->ThreadRange(1, 8)->ThreadPerCpu();
+
 
 } // Benchmark
 #endif // HAVE_BENCHMARK
@@ -48,14 +48,39 @@ namespace UnitTest
             AZ::NameDictionary::Destroy();
         }
 
-        static const AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*>& GetDictionary()
+        static size_t GetEntryCount()
         {
-            return AZ::NameDictionary::Instance().m_dictionary;
+            size_t entryCount = 0;
+            for (const auto& shard : AZ::NameDictionary::Instance().m_shards)
+            {
+                entryCount += shard.m_dictionary.size();
+            }
+            return entryCount;
         }
-        
-        static size_t GetEntryCount()
+
+        static bool ContainsEntry(AZStd::string_view name)
         {
-            return GetDictionary().size();
+            for (const auto& shard : AZ::NameDictionary::Instance().m_shards)
+            {
+                for (const auto& entry : shard.m_dictionary)
+                {
+                    if (entry.second->GetName() == name)
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        static uint64_t GetLockedLookupCount()
+        {
+            uint64_t lookupCount = 0;
+            for (const auto& shard : AZ::NameDictionary::Instance().m_shards)
+            {
+                lookupCount += shard.m_lockedLookupCount;
+            }
+            return lookupCount;
         }
 
         //! Directly calculate the hash value for a string without collision resolution
@@ -270,11 +295,7 @@ namespace UnitTest
         // Make sure all entries in the localDictionary got copied into the globalDictionary
         for (const AZStd::string& nameString : localDictionary)
         {
-            auto& globalDictionary = NameDictionaryTester::GetDictionary();
-            auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString](AZStd::pair<AZ::Name::Hash, AZ::Internal::NameData*> entry) {
-                return entry.second->GetName() == nameString;
-            });
-            EXPECT_TRUE(it != globalDictionary.end()) << "Can't find '" << nameString.data() << "' in local dictionary.";
+            EXPECT_TRUE(NameDictionaryTester::ContainsEntry(nameString)) << "Can't find '" << nameString.data() << "' in local dictionary.";
         }
 
         // Make sure all the threads got an accurate Name object
@@ -560,6 +581,41 @@ namespace UnitTest
         delete serializeContext;
     }
     
+    TEST_F(NameTest, ExistingNames_AreMadeWithoutLockingTheDictionary)
+    {
+        AZ::Name a{ "a" };
+        const uint64_t lockedLookupCount = NameDictionaryTester::GetLockedLookupCount();
+
+        for (int i = 0; i < 100; ++i)
+        {
+            AZ::Name anotherA{ "a" };
+            EXPECT_EQ(anotherA, a);
+        }
+
+        EXPECT_EQ(NameDictionaryTester::GetLockedLookupCount(), lockedLookupCount);
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+    }
+
+    TEST_F(NameTest, ReleasedNames_AreNotReturnedFromTheLookupCaches)
+    {
+        // Fill the caches with an entry, then release it so the cached pointers refer to released name data
+        AZStd::unique_ptr<AZ::Name> a = AZStd::make_unique<AZ::Name>("a");
+        const AZ::Name::Hash hash = a->GetHash();
+        a.reset();
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 0);
+
+        // Other names are free to reuse the released name data
+        AZ::Name b{ "b" };
+        EXPECT_EQ(b.GetStringView(), "b");
+
+        AZ::Name newA{ "a" };
+        EXPECT_EQ(newA.GetStringView(), "a");
+        EXPECT_EQ(newA.GetHash(), hash);
+        EXPECT_EQ(b.GetStringView(), "b");
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 2);
+        EXPECT_EQ(AZ::NameDictionary::Instance().FindName(hash), newA);
+    }
+
     TEST_F(NameTest, NameContanerTest)
     {
         AZStd::unordered_set<AZ::Name> nameSet;
@@ -696,6 +752,72 @@ namespace UnitTest
         EXPECT_GT(newNameTime, stringTime);
     }
 
+    TEST_F(NameTest, DISABLED_NamePerf_ConcurrentCreation)
+    {
+        // Simulates asset loading, where many job threads create names at once. Most of the names already
+        // exist in the dictionary, but each thread also creates some names that are new.
+        constexpr int ThreadCount = 8;
+        constexpr int CreateCountPerThread = AZ_TRAIT_UNIT_TEST_NAME_COUNT;
+        constexpr int ExistingNameCount = 1000;
+
+        char buffer[RandomStringBufferSize];
+        AZStd::vector<AZ::Name> existingNames;
+        existingNames.reserve(ExistingNameCount);
+        for (int i = 0; i < ExistingNameCount; ++i)
+        {
+            existingNames.push_back(AZ::Name{ MakeRandomString(buffer) });
+        }
+
+        auto runThreads = [&](auto&& threadFunction)
+        {
+            AZStd::vector<AZStd::thread> threads;
+            const AZStd::sys_time_t startTime = AZStd::GetTimeNowMicroSecond();
+            for (int threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+            {
+                threads.emplace_back([threadIndex, &threadFunction]() { threadFunction(threadIndex); });
+            }
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+            return AZStd::GetTimeNowMicroSecond() - startTime;
+        };
+
+        const AZStd::sys_time_t existingNameTime = runThreads([&](int threadIndex)
+        {
+            char threadBuffer[RandomStringBufferSize];
+            for (int i = 0; i < CreateCountPerThread; ++i)
+            {
+                const AZ::Name& existingName = existingNames[(i * ThreadCount + threadIndex) % ExistingNameCount];
+                azstrcpy(threadBuffer, RandomStringBufferSize, existingName.GetCStr());
+                AZ::Name name{ threadBuffer };
+            }
+        });
+
+        const AZStd::sys_time_t mixedNameTime = runThreads([&](int threadIndex)
+        {
+            char threadBuffer[RandomStringBufferSize];
+            for (int i = 0; i < CreateCountPerThread; ++i)
+            {
+                if (i % 10 == 0)
+                {
+                    azsnprintf(threadBuffer, RandomStringBufferSize, "t%d_%d", threadIndex, i);
+                }
+                else
+                {
+                    azstrcpy(threadBuffer, RandomStringBufferSize, existingNames[(i * ThreadCount + threadIndex) % ExistingNameCount].GetCStr());
+                }
+                AZ::Name name{ threadBuffer };
+            }
+        });
+
+        AZ_TracePrintf("NameTest", "Create %d existing names on %d threads:       %d us\n", CreateCountPerThread, ThreadCount, existingNameTime);
+        AZ_TracePrintf("NameTest", "Create %d mostly existing names on %d threads: %d us\n", CreateCountPerThread, ThreadCount, mixedNameTime);
+
+        existingNames.clear();
+        EXPECT_EQ(0, NameDictionaryTester::GetEntryCount());
+    }
+
     TEST_F(NameTest, DISABLED_NameVsStringPerf_Comparison)
     {
         constexpr int CompareCount = 10000;
@@ -0,0 +1,721 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+
+namespace AZ::IO
+{
+    constexpr AZ::u32 TestMaxFileHandles = 1;
+    constexpr AZ::u32 TestMaxMetaDataEntries = 16;
+    constexpr size_t TestPhysicalSectorSize = 4_kib;
+    constexpr size_t TestLogicalSectorSize = 512;
+    constexpr AZ::u32 TestMaxIOChannels = 8;
+    constexpr AZ::s32 TestOverCommit = 0;
+    constexpr size_t TestRegisteredBufferSize = 64_kib;
+    constexpr bool TestEnableUnbufferReads = true;
+    constexpr bool HasSeekPenalty = false;
+
+    //
+    // StreamStackEntry API Conformity
+    //
+    class StorageDriveLinuxTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<StorageDriveLinux>
+    {
+    public:
+        StorageDriveLinux CreateInstance() override
+        {
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_hasSeekPenalty = HasSeekPenalty;
+            options.m_enableUnbufferedReads = TestEnableUnbufferReads;
+            options.m_minimalReporting = true;
+
+            return StorageDriveLinux({ "/" }, {}, TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize,
+                TestLogicalSectorSize, TestMaxIOChannels, TestOverCommit, TestRegisteredBufferSize, options);
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_StorageDriveLinuxConformityTests, StreamStackEntryConformityTests, StorageDriveLinuxTestDescription);
+
+
+    // Helper class to count the number of asserts / errors / warnings / printfs that have been triggered.
+    class StreamerTraceBusDetector
+        : public AZ::Debug::TraceMessageBus::Handler
+    {
+    public:
+        StreamerTraceBusDetector()
+        {
+            BusConnect();
+        }
+
+        ~StreamerTraceBusDetector() override
+        {
+            BusDisconnect();
+        }
+
+        bool OnAssert([[maybe_unused]] const char* message) override
+        {
+            m_assert++;
+            return false;
+        }
+
+        bool OnError([[maybe_unused]] const char* window, [[maybe_unused]] const char* message) override
+        {
+            m_error++;
+            return false;
+        }
+
+        bool OnWarning([[maybe_unused]] const char* window, [[maybe_unused]] const char* message) override
+        {
+            m_warning++;
+            return false;
+        }
+
+        bool OnPrintf([[maybe_unused]] const char* window, [[maybe_unused]] const char* message) override
+        {
+            m_printf++;
+            return false;
+        }
+
+        int m_assert{ 0 };
+        int m_error{ 0 };
+        int m_warning{ 0 };
+        int m_printf{ 0 };
+    };
+
+    //
+    // StorageDriveLinux Tests
+    //
+
+    // io_uring can be unavailable on older kernels or be blocked by a sandbox such as a container's seccomp profile. In those
+    // cases the drive forwards all requests and the tests that check reading behavior return early.
+#define AZ_STORAGE_DRIVE_LINUX_REQUIRE_RING() \
+    if (!m_isRingAvailable) \
+    { \
+        return; \
+    }
+
+    class Streamer_StorageDriveLinuxTestFixture
+        : public UnitTest::ScopedAllocatorSetupFixture
+        , public UnitTest::SetRestoreFileIOBaseRAII
+    {
+    public:
+        // Data...
+        static constexpr char s_dummyFilename[] = "Dummy.bin";
+        static constexpr char s_fileCharacter = 'F';
+        static constexpr char s_beginCharacter = 'B';
+        static constexpr char s_endCharacter = 'E';
+        static constexpr char s_chunkCharacter = 'C';
+
+        UnitTest::TestFileIOBase m_fileIO{};
+        AZStd::string m_dummyFilepath;
+        AZStd::string m_testFolder;
+        AZ::IO::RequestPath m_dummyRequestPath;
+        AZStd::shared_ptr<StorageDriveLinux> m_storageDriveLinux{};
+        AZ::IO::StreamerContext* m_context = nullptr;
+        AZStd::vector<AZStd::string> m_dummyFiles;
+        AZStd::vector<AZStd::unique_ptr<char[]>> m_dummyBuffers;
+        StreamerTraceBusDetector m_traceDetector;
+        StorageDriveLinux::ConstructionOptions m_configurationOptions;
+        bool m_isRingAvailable{ false };
+
+        // Methods...
+        Streamer_StorageDriveLinuxTestFixture()
+            : UnitTest::SetRestoreFileIOBaseRAII(m_fileIO)
+        {
+            PrepareTestFilepath();
+        }
+
+        void SetupStorageDrive(s32 overCommit, const AZStd::vector<AZStd::string_view>& excludedPaths = {})
+        {
+            if (m_context == nullptr)
+            {
+                m_context = new AZ::IO::StreamerContext();
+            }
+
+            ASSERT_FALSE(m_dummyFilepath.empty());
+
+            m_configurationOptions.m_hasSeekPenalty = HasSeekPenalty;
+            m_configurationOptions.m_enableUnbufferedReads = TestEnableUnbufferReads;
+            m_configurationOptions.m_minimalReporting = true;
+
+            m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(AZStd::vector<AZStd::string_view>{ "/" },
+                excludedPaths, TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize, TestLogicalSectorSize,
+                TestMaxIOChannels, overCommit, TestRegisteredBufferSize, m_configurationOptions);
+            m_storageDriveLinux->SetContext(*m_context);
+            m_isRingAvailable = m_storageDriveLinux->IsAvailable();
+        }
+
+        void SetUp() override
+        {
+            m_dummyRequestPath.InitFromAbsolutePath(m_dummyFilepath);
+
+            SetupStorageDrive(TestOverCommit);
+        }
+
+        void TearDown() override
+        {
+            m_storageDriveLinux.reset();
+            delete m_context;
+            m_context = nullptr;
+
+            RemoveDummyFiles();
+            m_dummyBuffers.clear();
+            m_dummyBuffers.shrink_to_fit();
+        }
+
+        // Create a file filled with a single character.
+        // If chunkOffset is non-zero, it will write in a specific character every chunkOffset bytes till the end of file.
+        // If beginEndMarkers is true, it will write in specific bytes to mark the begin and end of the file.
+        void CreateDummyFile(AZStd::string path, size_t fileSize, size_t chunkOffset = 0, bool beginEndMarkers = false)
+        {
+            using namespace AZ::IO;
+
+            SystemFile file;
+            bool fileCreated = file.Open(path.c_str(),
+                SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_READ_WRITE);
+
+            ASSERT_TRUE(fileCreated);
+
+            m_dummyFiles.push_back(AZStd::move(path));
+
+            AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+            ::memset(buffer.get(), s_fileCharacter, fileSize);
+            if (chunkOffset != 0)
+            {
+                for (size_t offset = 0; offset < fileSize; offset += chunkOffset)
+                {
+                    buffer[offset] = s_chunkCharacter;
+                }
+            }
+
+            if (beginEndMarkers)
+            {
+                buffer[0] = s_beginCharacter;
+                buffer[fileSize - 1] = s_endCharacter;
+            }
+
+            auto bytesWritten = file.Write(buffer.get(), fileSize);
+            file.Close();
+
+            ASSERT_EQ(bytesWritten, fileSize);
+        }
+
+        void CreateDummyFile(size_t fileSize, size_t chunkOffset = 0, bool beginEndMarkers = false)
+        {
+            CreateDummyFile(m_dummyFilepath, fileSize, chunkOffset, beginEndMarkers);
+        }
+
+        void RemoveDummyFiles()
+        {
+            for (auto& dummyFile : m_dummyFiles)
+            {
+                AZ::IO::SystemFile::Delete(dummyFile.c_str());
+            }
+            m_dummyFiles.clear();
+            m_dummyFiles.shrink_to_fit();
+        }
+
+        void WaitTillCompleted()
+        {
+            StreamStackEntry::Status status;
+            auto startTime = AZStd::chrono::system_clock::now();
+            do
+            {
+                m_storageDriveLinux->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+
+                status.m_isIdle = true;
+                m_storageDriveLinux->UpdateStatus(status);
+
+                if (AZStd::chrono::system_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL();
+                }
+            } while (!status.m_isIdle);
+        }
+
+        void DoSingleRead()
+        {
+            constexpr size_t fileSize = 16_kib;
+            AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+
+            CreateDummyFile(fileSize);
+
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffer.get(), fileSize, m_dummyRequestPath, 0, fileSize);
+            m_storageDriveLinux->QueueRequest(request);
+
+            m_dummyBuffers.push_back(AZStd::move(buffer));
+        }
+
+        void DoMetaDataRetrieval()
+        {
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateFileMetaDataRetrieval(m_dummyRequestPath);
+            m_storageDriveLinux->QueueRequest(request);
+        }
+
+    private:
+        void PrepareTestFilepath()
+        {
+            char exePath[AZ_MAX_PATH_LEN] = { 0 };
+            auto result = AZ::Utils::GetExecutablePath(exePath, AZ_MAX_PATH_LEN);
+            if (result.m_pathStored != AZ::Utils::ExecutablePathResult::Success)
+            {
+                return;
+            }
+
+            AZStd::string filePath(exePath);
+
+            if (result.m_pathIncludesFilename)
+            {
+                AZ::StringFunc::Path::StripFullName(filePath);
+            }
+
+            AZ::StringFunc::Path::Join(filePath.c_str(), "TestFiles", filePath);
+
+            // Create the "TestFiles" dir in the bin directory if it doesn't exist...
+            if (!AZ::IO::SystemFile::Exists(filePath.c_str()))
+            {
+                if (!AZ::IO::SystemFile::CreateDir(filePath.c_str()))
+                {
+                    return;
+                }
+            }
+
+            m_testFolder = filePath;
+            AZ::StringFunc::Path::Join(filePath.c_str(), s_dummyFilename, m_dummyFilepath);
+        }
+    };
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, SanityCheck)
+    {
+        // Just make sure the storage drive was set up...
+        EXPECT_NE(m_storageDriveLinux.get(), nullptr);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_MultipleDrivePaths_AllPathsAreIncludedInTheName)
+    {
+        AZStd::vector<AZStd::string_view> drives;
+        drives.push_back("/");
+        drives.push_back("/home");
+        drives.push_back("/mnt/data");
+        m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(drives, AZStd::vector<AZStd::string_view>{},
+            TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize, TestLogicalSectorSize, TestMaxIOChannels,
+            TestOverCommit, TestRegisteredBufferSize, m_configurationOptions);
+
+        const AZStd::string& name = m_storageDriveLinux->GetName();
+        EXPECT_NE(name.find("(/,"), AZStd::string::npos);
+        EXPECT_NE(name.find("/home,"), AZStd::string::npos);
+        EXPECT_NE(name.find("/mnt/data)"), AZStd::string::npos);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidSizes_ErrorsAreReported)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(AZStd::vector<AZStd::string_view>{ "/" },
+            AZStd::vector<AZStd::string_view>{}, TestMaxFileHandles, TestMaxMetaDataEntries, 0, 0, TestMaxIOChannels,
+            TestOverCommit, TestRegisteredBufferSize, m_configurationOptions);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(2);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidIoChannelCount_WarningIsReportedAndSizeAdjusted)
+    {
+        AZ_STORAGE_DRIVE_LINUX_REQUIRE_RING();
+
+        EXPECT_EQ(m_traceDetector.m_warning, 0);
+        m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(AZStd::vector<AZStd::string_view>{ "/" },
+            AZStd::vector<AZStd::string_view>{}, TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize,
+            TestLogicalSectorSize, 0, TestOverCommit, 0, m_configurationOptions);
+        EXPECT_EQ(m_traceDetector.m_warning, 1);
+
+        AZ::IO::StreamStackEntry::Status status{};
+        m_storageDriveLinux->UpdateStatus(status);
+        EXPECT_GT(status.m_numAvailableSlots, 0);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidOvercommit_ErrorIsReportedAndSizeAdjusted)
+    {
+        AZ_STORAGE_DRIVE_LINUX_REQUIRE_RING();
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(AZStd::vector<AZStd::string_view>{ "/" },
+            AZStd::vector<AZStd::string_view>{}, TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize,
+            TestLogicalSectorSize, TestMaxIOChannels, -(aznumeric_cast<s32>(TestMaxIOChannels) + 2), TestRegisteredBufferSize,
+            m_configurationOptions);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        AZ::IO::StreamStackEntry::Status status{};
+        m_storageDriveLinux->UpdateStatus(status);
+        EXPECT_EQ(1, status.m_numAvailableSlots);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_FileExists_ReportsAccurateFileSize)
+    {
+        AZ_STORAGE_DRIVE_LINUX_REQUIRE_RING();
+
+        CreateDummyFile(4_kib);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(m_dummyRequestPath);
+
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileMetaData = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_TRUE(fileMetaData.m_found);
+                EXPECT_EQ(4_kib, fileMetaData.m_fileSize);
+            });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_FileDoesntExist_ReturnsFalse)
+    {
+        AZ_STORAGE_DRIVE_LINUX_REQUIRE_RING();
+
+        AZ::IO::RequestPath path;
+        path.InitFromAbsolutePath(m_dummyFilepath + ".disappear");
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(path);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileMetaData = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_FALSE(fileMetaData.m_found);
+                EXPECT_EQ(0, fileMetaData.m_fileSize);
+            });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_UseStoredFileHandle_ReportsAccurateFileSize)
+    {
+        AZ_STORAGE_DRIVE_LINUX_REQUIRE_RING();
+
+        DoSingleRead();
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(m_dummyRequestPath);
+
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileMetaData = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_TRUE(fileMetaData.m_found);
+                EXPECT_EQ(16_kib, fileMetaData.m_fileSize);
+            });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_FileExists_ReturnsCompletedWithFileFound)
+    {
+        AZ_STORAGE_DRIVE_LINUX_REQUIRE_RING();
+
+        CreateDummyFile(4_kib);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileExistsCheck = AZStd::get<FileRequest::FileExistsCheckData>(request.GetCommand());
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                EXPECT_TRUE(fileExistsCheck.m_found);
+            });
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_FileDoesNotExist_ReturnsCompletedWithFileNotFound)
+    {
+        AZ_STORAGE_DRIVE_LINUX_REQUIRE_RING();
+
+        AZ::IO::RequestPath path;
+        path.InitFromAbsolutePath(m_dummyFilepath + ".disappear");
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(path);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileExistsCheck = AZStd::get<FileRequest::FileExistsCheckData>(request.GetCommand());
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                EXPECT_FALSE(fileExistsCheck.m_found);
+            });
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_QueueAndExecuteRequest_StorageDriveHandledRequest)
+    {
+        AZ_STORAGE_DRIVE_LINUX_REQUIRE_RING();
+
+        constexpr size_t fileSize = 16_kib;
+        AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+
+        // Put begin and end markers in the file...
+        CreateDummyFile(fileSize, 0, true);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer.get(), fileSize, m_dummyRequestPath, 0, fileSize);
+        auto callback = [fileSize, this](const FileRequest& request)
+        {
+            EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+            auto& readRequest = AZStd::get<AZ::IO::FileRequest::ReadData>(request.GetCommand());
+            EXPECT_EQ(readRequest.m_size, fileSize);
+            EXPECT_STREQ(readRequest.m_path.GetAbsolutePath(), m_dummyFilepath.c_str());
+        };
+
+        request->SetCompletionCallback(AZStd::move(callback));
+        m_storageDriveLinux->QueueRequest(request);
+
+        WaitTillCompleted();
+
+        EXPECT_EQ(buffer[0], s_beginCharacter);
+        EXPECT_EQ(buffer[1], s_fileCharacter);
+        EXPECT_EQ(buffer[fileSize - 2], s_fileCharacter);
+        EXPECT_EQ(buffer[fileSize - 1], s_endCharacter);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_UnalignedOffsetRead_ReturnsCorrectData)
+    {
+        AZ_STORAGE_DRIVE_LINUX_REQUIRE_RING();
+
+        constexpr AZ::u64 unalignedOffset = 40;
+        constexpr AZ::u64 numChunksToRead = 7;
+        constexpr AZ::u64 unalignedSize = unalignedOffset * numChunksToRead;
+        constexpr size_t fileSize = 16_kib;
+
+        constexpr char unexpectedChar = 'Z';
+        char* buffer = reinterpret_cast<char*>(azmalloc(unalignedSize + 4, TestPhysicalSectorSize));
+        // Make sure the read doesn't touch any bytes past the requested size.
+        buffer[unalignedSize] = unexpectedChar;
+
+        CreateDummyFile(fileSize, unalignedOffset);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, unalignedSize + 4, m_dummyRequestPath, unalignedOffset, unalignedSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+            });
+        m_storageDriveLinux->QueueRequest(request);
+
+        WaitTillCompleted();
+
+        EXPECT_EQ(buffer[0], s_chunkCharacter);
+        for (size_t offset = 1; offset < numChunksToRead; ++offset)
+        {
+            EXPECT_EQ(buffer[(offset * unalignedOffset) - 1], s_fileCharacter);
+            EXPECT_EQ(buffer[offset * unalignedOffset], s_chunkCharacter);
+        }
+        EXPECT_EQ(buffer[unalignedSize - 1], s_fileCharacter);
+        EXPECT_EQ(buffer[unalignedSize], unexpectedChar);
+
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_UnalignedSizeRead_ReturnsCorrectDataAndDoesNotWriteMore)
+    {
+        AZ_STORAGE_DRIVE_LINUX_REQUIRE_RING();
+
+        constexpr AZ::u64 unalignedSize = 103630;
+        // Don't give it too much extra size otherwise the extra space will be used over-read to the next alignment.
+        constexpr size_t bufferSize = unalignedSize + 8;
+
+        char* buffer = reinterpret_cast<char*>(azmalloc(bufferSize, TestPhysicalSectorSize));
+        ::memset(buffer, 'Z', bufferSize);
+
+        CreateDummyFile(unalignedSize);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, bufferSize, m_dummyRequestPath, 0, unalignedSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+            });
+        m_storageDriveLinux->QueueRequest(request);
+
+        WaitTillCompleted();
+
+        for (size_t i = 0; i < unalignedSize; ++i)
+        {
+            ASSERT_EQ(s_fileCharacter, buffer[i]);
+        }
+        for (size_t i = unalignedSize; i < bufferSize; ++i)
+        {
+            ASSERT_EQ('Z', buffer[i]);
+        }
+
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_UnalignedMemoryAllocation_ReturnsCorrectData)
+    {
+        AZ_STORAGE_DRIVE_LINUX_REQUIRE_RING();
+
+        // Larger than the registered buffer so the fallback to a temporary aligned allocation is used as well.
+        constexpr AZ::u64 readSize = TestRegisteredBufferSize * 2;
+
+        char* memory = reinterpret_cast<char*>(azmalloc(readSize + 16, TestPhysicalSectorSize));
+        char* buffer = memory + 7;
+
+        CreateDummyFile(readSize);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, readSize + 16 - 7, m_dummyRequestPath, 0, readSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+            });
+        m_storageDriveLinux->QueueRequest(request);
+
+        WaitTillCompleted();
+
+        for (size_t i = 0; i < readSize; ++i)
+        {
+            ASSERT_EQ(s_fileCharacter, buffer[i]);
+        }
+
+        azfree(memory);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_InvalidFilePath_RequestIsForwarded)
+    {
+        constexpr AZ::u64 readSize = TestPhysicalSectorSize;
+
+        char buffer[readSize];
+
+        auto mock = AZStd::make_shared<::testing::NiceMock<StreamStackEntryMock>>();
+        m_storageDriveLinux->SetNext(mock);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        AZ::IO::RequestPath path;
+        path.InitFromAbsolutePath(m_dummyFilepath + "/Broken/Path.txt");
+
+        request->CreateRead(nullptr, buffer, readSize, path, 0, readSize);
+        EXPECT_CALL(*mock, QueueRequest(request)).
+            WillOnce([this](AZ::IO::FileRequest* request)
+                {
+                    m_context->MarkRequestAsCompleted(request);
+                });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_FileInExcludedMountPoint_RequestIsForwarded)
+    {
+        constexpr size_t fileSize = 4_kib;
+        AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+        CreateDummyFile(fileSize);
+
+        // Treat the folder with the test files as if a different file system is mounted there.
+        SetupStorageDrive(TestOverCommit, { m_testFolder });
+
+        auto mock = AZStd::make_shared<::testing::NiceMock<StreamStackEntryMock>>();
+        m_storageDriveLinux->SetNext(mock);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer.get(), fileSize, m_dummyRequestPath, 0, fileSize);
+        EXPECT_CALL(*mock, QueueRequest(request)).
+            WillOnce([this](AZ::IO::FileRequest* request)
+                {
+                    m_context->MarkRequestAsCompleted(request);
+                });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_ParallelReads_DataIsCorrect)
+    {
+        AZ_STORAGE_DRIVE_LINUX_REQUIRE_RING();
+
+        constexpr size_t chunkSize = TestPhysicalSectorSize;
+        // More chunks than io channels so the submissions are split over multiple batches.
+        constexpr size_t numChunks = TestMaxIOChannels * 2 + 1;
+        constexpr size_t fileSize = numChunks * chunkSize;
+        AZStd::array<AZStd::unique_ptr<u8[]>, numChunks> buffers;
+
+        CreateDummyFile(fileSize, chunkSize, true);
+
+        size_t completed = 0;
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            buffers[i].reset(new u8[chunkSize]);
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+
+            request->CreateRead(nullptr, buffers[i].get(), chunkSize, m_dummyRequestPath, i * chunkSize, chunkSize);
+            request->SetCompletionCallback([chunkSize, i, &completed](const FileRequest& request)
+                {
+                    EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+                    auto& readRequest = AZStd::get<AZ::IO::FileRequest::ReadData>(request.GetCommand());
+                    EXPECT_EQ(readRequest.m_size, chunkSize);
+                    EXPECT_EQ(readRequest.m_offset, i * chunkSize);
+                    completed++;
+                });
+
+            m_storageDriveLinux->QueueRequest(request);
+        }
+
+        WaitTillCompleted();
+        EXPECT_EQ(numChunks, completed);
+
+        EXPECT_EQ(buffers[0][0], s_beginCharacter);
+        EXPECT_EQ(buffers[0][chunkSize - 1], s_fileCharacter);
+        EXPECT_EQ(buffers[numChunks - 1][0], s_chunkCharacter);
+        EXPECT_EQ(buffers[numChunks - 1][chunkSize - 1], s_endCharacter);
+        for (size_t i = 1; i < numChunks - 1; ++i)
+        {
+            EXPECT_EQ(buffers[i][0], s_chunkCharacter);
+            EXPECT_EQ(buffers[i][chunkSize - 1], s_fileCharacter);
+        }
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FlushEntireCacheRequest_FlushPreviouslyReadFileAndMetaData_NoErrorsReported)
+    {
+        AZ_STORAGE_DRIVE_LINUX_REQUIRE_RING();
+
+        DoSingleRead();
+        DoMetaDataRetrieval();
+        // Wait here because normally the scheduler will only queue a flush when the stack is idle.
+        WaitTillCompleted();
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        AZ::IO::FileRequest* flushRequest = m_context->GetNewInternalRequest();
+        flushRequest->CreateFlushAll();
+        m_storageDriveLinux->QueueRequest(flushRequest);
+
+        WaitTillCompleted();
+        AZ_TEST_STOP_TRACE_SUPPRESSION(0);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, CollectStatistics_ReadDone_MoreThanZeroStatisticsReturned)
+    {
+        AZ_STORAGE_DRIVE_LINUX_REQUIRE_RING();
+
+        DoSingleRead();
+        WaitTillCompleted();
+
+        AZStd::vector<Statistic> statistics;
+        m_storageDriveLinux->CollectStatistics(statistics);
+        EXPECT_FALSE(statistics.empty());
+    }
+
+#undef AZ_STORAGE_DRIVE_LINUX_REQUIRE_RING
+} // namespace AZ::IO
@@ -8152,5 +8152,430 @@ namespace UnitTest
         m_serializeContext->Class<TestClassWithEnumFieldThatSpecializesTypeInfo>();
         m_serializeContext->DisableRemoveReflection();
     }
+
+    struct TypeTableElement
+    {
+        AZ_TYPE_INFO(TypeTableElement, "{6C5B6E0B-3D3E-4B55-9E3C-2F6A37C8B7D1}");
+        float m_weight = 0.0f;
+        int m_index = 0;
+        AZStd::string m_name;
+    };
+
+    struct TypeTableContainer
+    {
+        AZ_TYPE_INFO(TypeTableContainer, "{0E8C1F33-5B3F-4E08-8B8A-64B1D0F4C2A7}");
+        AZStd::vector<TypeTableElement> m_skipped;
+        AZStd::vector<TypeTableElement> m_elements;
+
+        void Fill(int numElements)
+        {
+            m_elements.resize(numElements);
+            for (int i = 0; i < numElements; ++i)
+            {
+                m_elements[i].m_weight = static_cast<float>(i) * 0.5f;
+                m_elements[i].m_index = i;
+                m_elements[i].m_name = AZStd::string::format("Element%d", i);
+            }
+        }
+
+        static void Reflect(AZ::SerializeContext* serializeContext)
+        {
+            serializeContext->Class<TypeTableElement>()
+                ->Field("m_weight", &TypeTableElement::m_weight)
+                ->Field("m_index", &TypeTableElement::m_index)
+                ->Field("m_name", &TypeTableElement::m_name)
+                ;
+            serializeContext->Class<TypeTableContainer>()
+                ->Field("m_skipped", &TypeTableContainer::m_skipped)
+                ->Field("m_elements", &TypeTableContainer::m_elements)
+                ;
+        }
+
+        static void Unreflect(AZ::SerializeContext* serializeContext)
+        {
+            serializeContext->EnableRemoveReflection();
+            serializeContext->Class<TypeTableContainer>();
+            serializeContext->Class<TypeTableElement>();
+            serializeContext->DisableRemoveReflection();
+        }
+    };
+
+    class BinaryObjectStreamTypeTable
+        : public ScopedAllocatorSetupFixture
+    {
+    public:
+        void SetUp() override
+        {
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            TypeTableContainer::Reflect(m_serializeContext.get());
+        }
+
+        void TearDown() override
+        {
+            TypeTableContainer::Unreflect(m_serializeContext.get());
+            m_serializeContext.reset();
+        }
+
+    protected:
+        static size_t CountTypeId(const AZStd::vector<char>& buffer, const AZ::Uuid& typeId)
+        {
+            const size_t typeIdSize = typeId.end() - typeId.begin();
+            size_t count = 0;
+            for (size_t offset = 0; offset + typeIdSize <= buffer.size(); ++offset)
+            {
+                if (memcmp(buffer.data() + offset, typeId.begin(), typeIdSize) == 0)
+                {
+                    ++count;
+                }
+            }
+            return count;
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+    };
+
+    TEST_F(BinaryObjectStreamTypeTable, SaveAndLoad_ManyElementsOfTheSameType_TypeIdIsStoredOnce)
+    {
+        TypeTableContainer saved;
+        saved.Fill(100);
+
+        AZStd::vector<char> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> saveStream(&buffer);
+        ASSERT_TRUE(AZ::Utils::SaveObjectToStream(saveStream, AZ::DataStream::ST_BINARY, &saved, m_serializeContext.get()));
+
+        EXPECT_EQ(1u, CountTypeId(buffer, azrtti_typeid<TypeTableElement>()));
+        EXPECT_EQ(1u, CountTypeId(buffer, azrtti_typeid<int>()));
+
+        AZ::IO::MemoryStream loadStream(buffer.data(), buffer.size());
+        TypeTableContainer loaded;
+        ASSERT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(loadStream, loaded, m_serializeContext.get()));
+        ASSERT_EQ(saved.m_elements.size(), loaded.m_elements.size());
+        for (size_t i = 0; i < saved.m_elements.size(); ++i)
+        {
+            EXPECT_EQ(saved.m_elements[i].m_weight, loaded.m_elements[i].m_weight);
+            EXPECT_EQ(saved.m_elements[i].m_index, loaded.m_elements[i].m_index);
+            EXPECT_EQ(saved.m_elements[i].m_name, loaded.m_elements[i].m_name);
+        }
+    }
+
+    TEST_F(BinaryObjectStreamTypeTable, Load_TypesFirstSeenInSkippedElement_AreResolvedInLaterElements)
+    {
+        // m_skipped is written first, so the element types enter the type table inside data that is discarded on load
+        TypeTableContainer saved;
+        saved.m_skipped.resize(2);
+        saved.Fill(3);
+
+        AZStd::vector<char> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> saveStream(&buffer);
+        ASSERT_TRUE(AZ::Utils::SaveObjectToStream(saveStream, AZ::DataStream::ST_BINARY, &saved, m_serializeContext.get()));
+
+        m_serializeContext->EnableRemoveReflection();
+        m_serializeContext->Class<TypeTableContainer>();
+        m_serializeContext->DisableRemoveReflection();
+        m_serializeContext->Class<TypeTableContainer>()
+            ->Field("m_elements", &TypeTableContainer::m_elements)
+            ;
+
+        AZ::IO::MemoryStream loadStream(buffer.data(), buffer.size());
+        TypeTableContainer loaded;
+        ASSERT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(loadStream, loaded, m_serializeContext.get()));
+        EXPECT_TRUE(loaded.m_skipped.empty());
+        ASSERT_EQ(3u, loaded.m_elements.size());
+        EXPECT_EQ(2, loaded.m_elements[2].m_index);
+        EXPECT_EQ("Element2", loaded.m_elements[2].m_name);
+    }
+
+    struct PackedElementsContainer
+    {
+        AZ_TYPE_INFO(PackedElementsContainer, "{5F2A8D4E-93C1-4B7A-A6E0-1D8C3F5B2E94}");
+        AZStd::vector<float> m_skipped;
+        AZStd::vector<float> m_weights;
+        AZStd::vector<AZ::u32> m_indices;
+        AZStd::vector<AZStd::string> m_names;
+
+        void Fill(int numElements, bool fillNames)
+        {
+            m_weights.resize(numElements);
+            m_indices.resize(numElements);
+            for (int i = 0; i < numElements; ++i)
+            {
+                m_weights[i] = static_cast<float>(i) * 0.5f;
+                m_indices[i] = static_cast<AZ::u32>(numElements - i);
+                if (fillNames)
+                {
+                    // the names don't all have the same length, so they can't be packed
+                    m_names.push_back(AZStd::string::format("Element%d", i));
+                }
+            }
+        }
+
+        // version 2 stores the weights doubled
+        static bool ConvertToVersion2(AZ::SerializeContext& context, AZ::SerializeContext::DataElementNode& classElement)
+        {
+            AZ::SerializeContext::DataElementNode* weightsElement = classElement.FindSubElement(AZ_CRC("m_weights"));
+            AZStd::vector<float> weights;
+            if (!weightsElement || !weightsElement->GetData(weights))
+            {
+                return false;
+            }
+            for (float& weight : weights)
+            {
+                weight *= 2.0f;
+            }
+            return weightsElement->SetData(context, weights);
+        }
+
+        static void Reflect(AZ::SerializeContext* serializeContext, unsigned int version = 1, bool reflectSkipped = true)
+        {
+            auto classBuilder = serializeContext->Class<PackedElementsContainer>()
+                ->Version(version, version > 1 ? &ConvertToVersion2 : nullptr);
+            if (reflectSkipped)
+            {
+                classBuilder->Field("m_skipped", &PackedElementsContainer::m_skipped);
+            }
+            classBuilder
+                ->Field("m_weights", &PackedElementsContainer::m_weights)
+                ->Field("m_indices", &PackedElementsContainer::m_indices)
+                ->Field("m_names", &PackedElementsContainer::m_names)
+                ;
+        }
+
+        static void Unreflect(AZ::SerializeContext* serializeContext)
+        {
+            serializeContext->EnableRemoveReflection();
+            serializeContext->Class<PackedElementsContainer>();
+            serializeContext->DisableRemoveReflection();
+        }
+    };
+
+    class BinaryObjectStreamPackedElements
+        : public ScopedAllocatorSetupFixture
+    {
+    public:
+        void SetUp() override
+        {
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            PackedElementsContainer::Reflect(m_serializeContext.get());
+        }
+
+        void TearDown() override
+        {
+            PackedElementsContainer::Unreflect(m_serializeContext.get());
+            m_serializeContext.reset();
+        }
+
+    protected:
+        void Save(const PackedElementsContainer& saved, AZStd::vector<char>& buffer)
+        {
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> saveStream(&buffer);
+            ASSERT_TRUE(AZ::Utils::SaveObjectToStream(saveStream, AZ::DataStream::ST_BINARY, &saved, m_serializeContext.get()));
+        }
+
+        void Load(const AZStd::vector<char>& buffer, PackedElementsContainer& loaded)
+        {
+            AZ::IO::MemoryStream loadStream(buffer.data(), buffer.size());
+            ASSERT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(loadStream, loaded, m_serializeContext.get()));
+        }
+
+        void Rereflect(unsigned int version, bool reflectSkipped)
+        {
+            PackedElementsContainer::Unreflect(m_serializeContext.get());
+            PackedElementsContainer::Reflect(m_serializeContext.get(), version, reflectSkipped);
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+    };
+
+    TEST_F(BinaryObjectStreamPackedElements, SaveAndLoad_ContainersOfFixedSizeValues_RoundTripAndTakeOnlyTheValueBytes)
+    {
+        constexpr int NumElements = 1000;
+        PackedElementsContainer saved;
+        saved.Fill(NumElements, false);
+
+        AZStd::vector<char> buffer;
+        Save(saved, buffer);
+        // without packing every element would also store its flags, name and type
+        EXPECT_LT(buffer.size(), NumElements * (sizeof(float) + sizeof(AZ::u32)) + 512);
+
+        PackedElementsContainer loaded;
+        Load(buffer, loaded);
+        EXPECT_EQ(saved.m_weights, loaded.m_weights);
+        EXPECT_EQ(saved.m_indices, loaded.m_indices);
+    }
+
+    TEST_F(BinaryObjectStreamPackedElements, SaveAndLoad_ValuesOfDifferentSizes_AreStoredAsElements)
+    {
+        PackedElementsContainer saved;
+        saved.Fill(20, true);
+
+        AZStd::vector<char> buffer;
+        Save(saved, buffer);
+
+        PackedElementsContainer loaded;
+        Load(buffer, loaded);
+        EXPECT_EQ(saved.m_weights, loaded.m_weights);
+        EXPECT_EQ(saved.m_names, loaded.m_names);
+    }
+
+    TEST_F(BinaryObjectStreamPackedElements, Load_OlderVersionOfTheOwningClass_ConverterSeesThePackedElements)
+    {
+        PackedElementsContainer saved;
+        saved.Fill(10, true);
+
+        AZStd::vector<char> buffer;
+        Save(saved, buffer);
+
+        Rereflect(2, true);
+
+        PackedElementsContainer loaded;
+        Load(buffer, loaded);
+        ASSERT_EQ(saved.m_weights.size(), loaded.m_weights.size());
+        for (size_t i = 0; i < saved.m_weights.size(); ++i)
+        {
+            EXPECT_EQ(saved.m_weights[i] * 2.0f, loaded.m_weights[i]);
+        }
+        EXPECT_EQ(saved.m_indices, loaded.m_indices);
+        EXPECT_EQ(saved.m_names, loaded.m_names);
+    }
+
+    TEST_F(BinaryObjectStreamPackedElements, Load_LayoutFirstSeenInSkippedElement_IsResolvedInLaterElements)
+    {
+        // m_skipped is written first, so the layout of the float elements enters the layout table inside data that is discarded
+        PackedElementsContainer saved;
+        saved.m_skipped = { 1.0f, 2.0f, 3.0f };
+        saved.Fill(5, false);
+
+        AZStd::vector<char> buffer;
+        Save(saved, buffer);
+
+        Rereflect(1, false);
+
+        PackedElementsContainer loaded;
+        Load(buffer, loaded);
+        EXPECT_TRUE(loaded.m_skipped.empty());
+        EXPECT_EQ(saved.m_weights, loaded.m_weights);
+        EXPECT_EQ(saved.m_indices, loaded.m_indices);
+    }
 }
 
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class BinaryObjectStreamBenchmarkFixture
+        : public ::UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            ::UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            UnitTest::TypeTableContainer::Reflect(m_serializeContext.get());
+
+            m_object = AZStd::make_unique<UnitTest::TypeTableContainer>();
+            m_object->Fill(static_cast<int>(state.range(0)));
+            m_buffer = AZStd::make_unique<AZStd::vector<char>>();
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> saveStream(m_buffer.get());
+            AZ::Utils::SaveObjectToStream(saveStream, AZ::DataStream::ST_BINARY, m_object.get(), m_serializeContext.get());
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_buffer.reset();
+            m_object.reset();
+            UnitTest::TypeTableContainer::Unreflect(m_serializeContext.get());
+            m_serializeContext.reset();
+
+            ::UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<UnitTest::TypeTableContainer> m_object;
+        AZStd::unique_ptr<AZStd::vector<char>> m_buffer;
+    };
+
+    BENCHMARK_DEFINE_F(BinaryObjectStreamBenchmarkFixture, BM_BinaryObjectStream_Save)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZStd::vector<char> buffer;
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> saveStream(&buffer);
+            AZ::Utils::SaveObjectToStream(saveStream, AZ::DataStream::ST_BINARY, m_object.get(), m_serializeContext.get());
+        }
+        state.SetBytesProcessed(state.iterations() * m_buffer->size());
+    }
+    BENCHMARK_REGISTER_F(BinaryObjectStreamBenchmarkFixture, BM_BinaryObjectStream_Save)->Arg(1000)->Arg(10000);
+
+    BENCHMARK_DEFINE_F(BinaryObjectStreamBenchmarkFixture, BM_BinaryObjectStream_Load)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::IO::MemoryStream loadStream(m_buffer->data(), m_buffer->size());
+            UnitTest::TypeTableContainer loaded;
+            AZ::Utils::LoadObjectFromStreamInPlace(loadStream, loaded, m_serializeContext.get());
+        }
+        state.SetBytesProcessed(state.iterations() * m_buffer->size());
+    }
+    BENCHMARK_REGISTER_F(BinaryObjectStreamBenchmarkFixture, BM_BinaryObjectStream_Load)->Arg(1000)->Arg(10000);
+
+    // Containers of plain values, like the vertex and index data that makes up most of the bytes of mesh and terrain assets
+    class BinaryObjectStreamPackedElementsBenchmarkFixture
+        : public ::UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            ::UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            UnitTest::PackedElementsContainer::Reflect(m_serializeContext.get());
+
+            m_object = AZStd::make_unique<UnitTest::PackedElementsContainer>();
+            m_object->Fill(static_cast<int>(state.range(0)), false);
+            m_buffer = AZStd::make_unique<AZStd::vector<char>>();
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> saveStream(m_buffer.get());
+            AZ::Utils::SaveObjectToStream(saveStream, AZ::DataStream::ST_BINARY, m_object.get(), m_serializeContext.get());
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_buffer.reset();
+            m_object.reset();
+            UnitTest::PackedElementsContainer::Unreflect(m_serializeContext.get());
+            m_serializeContext.reset();
+
+            ::UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<UnitTest::PackedElementsContainer> m_object;
+        AZStd::unique_ptr<AZStd::vector<char>> m_buffer;
+    };
+
+    BENCHMARK_DEFINE_F(BinaryObjectStreamPackedElementsBenchmarkFixture, BM_BinaryObjectStream_SavePackedElements)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZStd::vector<char> buffer;
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> saveStream(&buffer);
+            AZ::Utils::SaveObjectToStream(saveStream, AZ::DataStream::ST_BINARY, m_object.get(), m_serializeContext.get());
+        }
+        state.SetBytesProcessed(state.iterations() * m_buffer->size());
+    }
+    BENCHMARK_REGISTER_F(BinaryObjectStreamPackedElementsBenchmarkFixture, BM_BinaryObjectStream_SavePackedElements)->Arg(10000)->Arg(100000);
+
+    BENCHMARK_DEFINE_F(BinaryObjectStreamPackedElementsBenchmarkFixture, BM_BinaryObjectStream_LoadPackedElements)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::IO::MemoryStream loadStream(m_buffer->data(), m_buffer->size());
+            UnitTest::PackedElementsContainer loaded;
+            AZ::Utils::LoadObjectFromStreamInPlace(loadStream, loaded, m_serializeContext.get());
+        }
+        state.SetBytesProcessed(state.iterations() * m_buffer->size());
+    }
+    BENCHMARK_REGISTER_F(BinaryObjectStreamPackedElementsBenchmarkFixture, BM_BinaryObjectStream_LoadPackedElements)->Arg(10000)->Arg(100000);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
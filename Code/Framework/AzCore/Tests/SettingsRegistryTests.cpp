@@ -13,6 +13,7 @@
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzCore/Serialization/Json/JsonSystemComponent.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
@@ -1756,4 +1757,284 @@ namespace SettingsRegistryTests
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File1"));
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File2"));
     }
+
+    //
+    // SaveSnapshot/MergeSnapshot
+    //
+
+    TEST_F(SettingsRegistryTest, MergeSnapshot_SnapshotOfAllTypes_AllValuesRestored)
+    {
+        ASSERT_TRUE(m_registry->MergeSettings(R"(
+            {
+                "Bool": true,
+                "Signed": -42,
+                "Unsigned": 18446744073709551615,
+                "Double": 4.5,
+                "String": "Hello",
+                "Array": [ 1, "Two", { "Three": 3 } ],
+                "Object": { "Nested": { "Value": false } }
+            })", AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        ASSERT_TRUE(m_registry->MergeSettings(R"([ { "op": "add", "path": "/Null", "value": null } ])",
+            AZ::SettingsRegistryInterface::Format::JsonPatch));
+
+        AZStd::vector<char> snapshot;
+        ASSERT_TRUE(m_registry->SaveSnapshot(snapshot));
+
+        AZ::SettingsRegistryImpl registry;
+        size_t notifications = 0;
+        auto notifier = registry.RegisterNotifier([&notifications](AZStd::string_view, AZ::SettingsRegistryInterface::Type)
+        {
+            ++notifications;
+        });
+        ASSERT_TRUE(registry.MergeSnapshot(AZStd::string_view(snapshot.data(), snapshot.size())));
+        EXPECT_EQ(1, notifications);
+
+        bool boolValue = false;
+        AZ::s64 signedValue = 0;
+        AZ::u64 unsignedValue = 0;
+        double doubleValue = 0.0;
+        AZStd::string stringValue;
+        EXPECT_TRUE(registry.Get(boolValue, "/Bool"));
+        EXPECT_TRUE(boolValue);
+        EXPECT_TRUE(registry.Get(signedValue, "/Signed"));
+        EXPECT_EQ(-42, signedValue);
+        EXPECT_TRUE(registry.Get(unsignedValue, "/Unsigned"));
+        EXPECT_EQ(18446744073709551615ull, unsignedValue);
+        EXPECT_TRUE(registry.Get(doubleValue, "/Double"));
+        EXPECT_DOUBLE_EQ(4.5, doubleValue);
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::FloatingPoint, registry.GetType("/Double"));
+        EXPECT_TRUE(registry.Get(stringValue, "/String"));
+        EXPECT_STREQ("Hello", stringValue.c_str());
+        EXPECT_TRUE(registry.Get(stringValue, "/Array/1"));
+        EXPECT_STREQ("Two", stringValue.c_str());
+        EXPECT_TRUE(registry.Get(signedValue, "/Array/2/Three"));
+        EXPECT_EQ(3, signedValue);
+        EXPECT_TRUE(registry.Get(boolValue, "/Object/Nested/Value"));
+        EXPECT_FALSE(boolValue);
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Null, registry.GetType("/Null"));
+
+        AZStd::vector<char> restoredSnapshot;
+        ASSERT_TRUE(registry.SaveSnapshot(restoredSnapshot));
+        EXPECT_TRUE(snapshot == restoredSnapshot);
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSnapshot_ExistingSettings_ObjectsMergedAndValuesReplaced)
+    {
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Object": { "Value": 1, "Array": [ 1, 2, 3 ] } })",
+            AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        AZStd::vector<char> snapshot;
+        ASSERT_TRUE(m_registry->SaveSnapshot(snapshot));
+
+        AZ::SettingsRegistryImpl registry;
+        ASSERT_TRUE(registry.MergeSettings(R"({ "Object": { "Value": "Text", "Array": [ 4 ], "Other": 2 }, "Root": true })",
+            AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        ASSERT_TRUE(registry.MergeSnapshot(AZStd::string_view(snapshot.data(), snapshot.size())));
+
+        AZ::s64 value = 0;
+        bool boolValue = false;
+        EXPECT_TRUE(registry.Get(value, "/Object/Value"));
+        EXPECT_EQ(1, value);
+        EXPECT_TRUE(registry.Get(value, "/Object/Array/2"));
+        EXPECT_EQ(3, value);
+        EXPECT_TRUE(registry.Get(value, "/Object/Other"));
+        EXPECT_EQ(2, value);
+        EXPECT_TRUE(registry.Get(boolValue, "/Root"));
+        EXPECT_TRUE(boolValue);
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSnapshot_TruncatedSnapshot_ReportsErrorAndLeavesRegistryUnchanged)
+    {
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Object": { "Value": 1, "String": "Text" } })",
+            AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        AZStd::vector<char> snapshot;
+        ASSERT_TRUE(m_registry->SaveSnapshot(snapshot));
+
+        AZ::SettingsRegistryImpl registry;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        bool result = registry.MergeSnapshot(AZStd::string_view(snapshot.data(), snapshot.size() - 2));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_FALSE(result);
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, registry.GetType("/Object"));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSnapshot_NotASnapshot_ReportsErrorAndReturnsFalse)
+    {
+        AZ::SettingsRegistryImpl registry;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        bool result = registry.MergeSnapshot(R"({ "Object": 1 })");
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_FALSE(result);
+    }
+
+    //
+    // Compiled registry
+    //
+
+    class SettingsRegistryCompiledRegistryTest
+        : public SettingsRegistryTest
+    {
+    public:
+        void SetUp() override
+        {
+            SettingsRegistryTest::SetUp();
+
+            m_registryFolder = AZStd::string::format("%s/%s", m_testFolder->c_str(), AZ::SettingsRegistryInterface::RegistryFolder);
+            m_compiledRegistryPath = AZStd::string::format("%s/Compiled/test.setregbin", m_testFolder->c_str());
+        }
+
+        void MergeAndSaveCompiledRegistry()
+        {
+            ASSERT_TRUE(m_registry->MergeSettingsFolder(m_registryFolder, { "editor" }, "Test"));
+            ASSERT_TRUE(AZ::SettingsRegistryMergeUtils::SaveCompiledRegistry(*m_registry, m_compiledRegistryPath, "Test", LaunchKey));
+        }
+
+    protected:
+        static constexpr AZ::HashValue64 LaunchKey{ 42 };
+
+        AZStd::string m_registryFolder;
+        AZStd::string m_compiledRegistryPath;
+    };
+
+    TEST_F(SettingsRegistryCompiledRegistryTest, MergeCompiledRegistry_UnchangedFiles_SettingsRestored)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0, "MemoryRoot": true })");
+        CreateTestFile("Memory.editor.setreg", R"({ "Memory": 1 })");
+        CreateTestFile("Platform/Test/Memory.setreg", R"({ "Platform": "Test" })");
+        MergeAndSaveCompiledRegistry();
+
+        AZ::SettingsRegistryImpl registry;
+        EXPECT_TRUE(AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_CompiledRegistry(
+            registry, m_compiledRegistryPath, "Test", LaunchKey));
+
+        AZ::s64 memory = 0;
+        bool memoryRoot = false;
+        AZStd::string platform;
+        AZStd::string loadedPath;
+        EXPECT_TRUE(registry.Get(memory, "/Memory"));
+        EXPECT_EQ(1, memory);
+        EXPECT_TRUE(registry.Get(memoryRoot, "/MemoryRoot"));
+        EXPECT_TRUE(memoryRoot);
+        EXPECT_TRUE(registry.Get(platform, "/Platform"));
+        EXPECT_STREQ("Test", platform.c_str());
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Object, registry.GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/0"));
+        EXPECT_TRUE(registry.Get(loadedPath, AZ::SettingsRegistryMergeUtils::CompiledRegistryLoadedPathKey));
+        EXPECT_STREQ(m_compiledRegistryPath.c_str(), loadedPath.c_str());
+    }
+
+    TEST_F(SettingsRegistryCompiledRegistryTest, MergeCompiledRegistry_DifferentLaunchKey_ReturnsFalse)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        MergeAndSaveCompiledRegistry();
+
+        AZ::SettingsRegistryImpl registry;
+        EXPECT_FALSE(AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_CompiledRegistry(
+            registry, m_compiledRegistryPath, "Test", AZ::HashValue64{ 43 }));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, registry.GetType("/Memory"));
+    }
+
+    TEST_F(SettingsRegistryCompiledRegistryTest, MergeCompiledRegistry_SettingsFileChanged_ReturnsFalse)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        MergeAndSaveCompiledRegistry();
+        CreateTestFile("Memory.setreg", R"({ "Memory": 2 })");
+
+        AZ::SettingsRegistryImpl registry;
+        EXPECT_FALSE(AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_CompiledRegistry(
+            registry, m_compiledRegistryPath, "Test", LaunchKey));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, registry.GetType("/Memory"));
+    }
+
+    TEST_F(SettingsRegistryCompiledRegistryTest, MergeCompiledRegistry_FileAddedToPlatformFolder_ReturnsFalse)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        MergeAndSaveCompiledRegistry();
+        CreateTestFile("Platform/Test/Memory.setreg", R"({ "Memory": 2 })");
+
+        AZ::SettingsRegistryImpl registry;
+        EXPECT_FALSE(AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_CompiledRegistry(
+            registry, m_compiledRegistryPath, "Test", LaunchKey));
+    }
+
+    TEST_F(SettingsRegistryCompiledRegistryTest, MergeCompiledRegistry_MissingFile_ReturnsFalse)
+    {
+        AZ::SettingsRegistryImpl registry;
+        EXPECT_FALSE(AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_CompiledRegistry(
+            registry, m_compiledRegistryPath, "Test", LaunchKey));
+    }
 } // namespace SettingsRegistryTests
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class SettingsRegistryStartupBenchmarkFixture
+        : public ::UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr int FileCount = 64;
+        static constexpr int SettingsPerFile = 32;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            ::UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_testFolder = AZStd::string::format("%sSettingsRegistryBenchmark_%s", UnitTest::GetTestFolderPath().c_str(),
+                AZ::Uuid::CreateRandom().ToString<AZStd::string>(false, false).c_str());
+            m_registryFolder = AZStd::string::format("%s/%s", m_testFolder.c_str(), AZ::SettingsRegistryInterface::RegistryFolder);
+            m_compiledRegistryPath = AZStd::string::format("%s/Compiled/benchmark.setregbin", m_testFolder.c_str());
+
+            // Roughly the shape of the registry files of an engine with a handful of gems.
+            for (int file = 0; file < FileCount; ++file)
+            {
+                AZStd::string content = AZStd::string::format(R"({ "Amazon": { "Gems": { "Gem%d": {)", file);
+                for (int setting = 0; setting < SettingsPerFile; ++setting)
+                {
+                    content += AZStd::string::format(R"( "Setting%d": { "Value": %d, "Name": "Setting number %d" },)",
+                        setting, setting, setting);
+                }
+                content += R"( "Enabled": true } } } })";
+
+                AZStd::string path = AZStd::string::format("%s/Gem%d.setreg", m_registryFolder.c_str(), file);
+                AZ::IO::SystemFile settingsFile;
+                settingsFile.Open(path.c_str(),
+                    AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY);
+                settingsFile.Write(content.data(), content.size());
+            }
+
+            AZ::SettingsRegistryImpl registry;
+            registry.MergeSettingsFolder(m_registryFolder, {}, {});
+            AZ::SettingsRegistryMergeUtils::SaveCompiledRegistry(registry, m_compiledRegistryPath, {}, LaunchKey);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            SettingsRegistryTests::SettingsRegistryTest::DeleteFolderRecursive(m_testFolder);
+            ::UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        static constexpr AZ::HashValue64 LaunchKey{ 42 };
+
+        AZStd::string m_testFolder;
+        AZStd::string m_registryFolder;
+        AZStd::string m_compiledRegistryPath;
+    };
+
+    BENCHMARK_F(SettingsRegistryStartupBenchmarkFixture, BM_SettingsRegistryStartup_MergeSettingsFolder)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::SettingsRegistryImpl registry;
+            registry.MergeSettingsFolder(m_registryFolder, {}, {});
+        }
+    }
+
+    BENCHMARK_F(SettingsRegistryStartupBenchmarkFixture, BM_SettingsRegistryStartup_MergeCompiledRegistry)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::SettingsRegistryImpl registry;
+            AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_CompiledRegistry(registry, m_compiledRegistryPath, {}, LaunchKey);
+        }
+    }
+} // namespace Benchmark
+#endif
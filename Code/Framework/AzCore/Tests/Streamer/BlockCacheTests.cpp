@@ -75,7 +75,8 @@ namespace AZ::IO
         {
             using ::testing::_;
 
-            m_cache = AZStd::make_shared<BlockCache>(m_cacheSize, m_blockSize, AZCORE_GLOBAL_NEW_ALIGNMENT, onlyEpilogWrites);
+            m_cache = AZStd::make_shared<BlockCache>(m_cacheSize, m_blockSize, AZCORE_GLOBAL_NEW_ALIGNMENT, onlyEpilogWrites,
+                m_replacementPolicy);
             m_mock = AZStd::make_shared<StreamStackEntryMock>();
             m_cache->SetNext(m_mock);
             EXPECT_CALL(*m_mock, SetContext(_)).Times(1);
@@ -243,6 +244,7 @@ namespace AZ::IO
         u64 m_fakeFileLength{ 5 * m_blockSize };
         u64 m_readBufferLength{ 10 * 1024 * 1024 };
         bool m_fakeFileFound{ true };
+        BlockCacheConfig::ReplacementPolicy m_replacementPolicy{ BlockCacheConfig::ReplacementPolicy::Recency };
     };
 
     /////////////////////////////////////////////////////////////
@@ -1175,4 +1177,295 @@ namespace AZ::IO
         EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(1);
         ProcessRead(m_buffer, m_path, 512, m_blockSize - 1024, IStreamerTypes::RequestStatus::Completed);
     }
+
+    /////////////////////////////////////////////////////////////
+    // Replacement policies
+    /////////////////////////////////////////////////////////////
+    class Streamer_BlockCacheReplacementPolicyTest
+        : public BlockCacheTest
+    {
+    public:
+        static constexpr u64 ScanBlockCount = 200;
+
+        void CreateTestEnvironment(BlockCacheConfig::ReplacementPolicy policy)
+        {
+            m_replacementPolicy = policy;
+            m_fakeFileLength = (ScanBlockCount + 1) * m_blockSize;
+            CreateTestEnvironmentImplementation(false);
+        }
+
+        // Reads a small part of the block so the read is serviced through a single cache block.
+        void ReadBlock(u64 blockIndex)
+        {
+            u64 offset = blockIndex * m_blockSize;
+            ProcessRead(m_buffer, m_path, offset + 256, m_blockSize - 512, IStreamerTypes::RequestStatus::Completed);
+            VerifyReadBuffer(offset + 256, m_blockSize - 512);
+        }
+
+        // Reads the hot block a few times, then streams through more blocks than fit in the cache and reads the hot block again.
+        void ReadHotBlockAroundScan(size_t expectedHotBlockReads)
+        {
+            using ::testing::_;
+
+            const u64 hotOffset = ScanBlockCount * m_blockSize;
+            EXPECT_CALL(*this, ReadFile(_, _, hotOffset, _)).Times(aznumeric_cast<int>(expectedHotBlockReads));
+            EXPECT_CALL(*this, ReadFile(_, _, ::testing::Ne(hotOffset), _)).Times(aznumeric_cast<int>(ScanBlockCount));
+
+            for (int i = 0; i < 3; ++i)
+            {
+                ReadBlock(ScanBlockCount);
+            }
+            for (u64 i = 0; i < ScanBlockCount; ++i)
+            {
+                ReadBlock(i);
+            }
+            ReadBlock(ScanBlockCount);
+        }
+    };
+
+    TEST_F(Streamer_BlockCacheReplacementPolicyTest, Recency_HotBlockFollowedByScan_HotBlockIsEvicted)
+    {
+        CreateTestEnvironment(BlockCacheConfig::ReplacementPolicy::Recency);
+        RedirectReadCalls();
+
+        ReadHotBlockAroundScan(2);
+        EXPECT_GT(m_cache->GetEvictionCount(), 0);
+    }
+
+    TEST_F(Streamer_BlockCacheReplacementPolicyTest, FrequencyAware_HotBlockFollowedByScan_HotBlockStaysCached)
+    {
+        CreateTestEnvironment(BlockCacheConfig::ReplacementPolicy::FrequencyAware);
+        RedirectReadCalls();
+
+        ReadHotBlockAroundScan(1);
+        EXPECT_GT(m_cache->GetEvictionCount(), 0);
+        EXPECT_EQ(3, m_cache->GetCacheHitCount());
+        EXPECT_EQ(ScanBlockCount + 1, m_cache->GetCacheMissCount());
+    }
+
+    TEST_F(Streamer_BlockCacheReplacementPolicyTest, FrequencyAware_RepeatedReads_BlocksAreServicedFromCache)
+    {
+        using ::testing::_;
+
+        CreateTestEnvironment(BlockCacheConfig::ReplacementPolicy::FrequencyAware);
+        RedirectReadCalls();
+
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(4);
+        for (int i = 0; i < 3; ++i)
+        {
+            for (u64 block = 0; block < 4; ++block)
+            {
+                ReadBlock(block);
+            }
+        }
+        EXPECT_EQ(8, m_cache->GetCacheHitCount());
+        EXPECT_EQ(0, m_cache->GetEvictionCount());
+    }
+
+    TEST_F(Streamer_BlockCacheReplacementPolicyTest, CollectStatistics_FrequencyAware_HitMissAndEvictionsReported)
+    {
+        CreateTestEnvironment(BlockCacheConfig::ReplacementPolicy::FrequencyAware);
+
+        AZStd::vector<Statistic> statistics;
+        m_cache->CollectStatistics(statistics);
+
+        auto hasStatistic = [&statistics](AZStd::string_view name)
+        {
+            return AZStd::find_if(statistics.begin(), statistics.end(),
+                [name](const Statistic& statistic) { return statistic.GetName() == name; }) != statistics.end();
+        };
+        EXPECT_TRUE(hasStatistic("Hits"));
+        EXPECT_TRUE(hasStatistic("Misses"));
+        EXPECT_TRUE(hasStatistic("Evictions"));
+        EXPECT_TRUE(hasStatistic("Admission rejections"));
+    }
 } // namespace AZ::IO
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Math/Random.h>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Replays request traces against the BlockCache with the different replacement policies. The next entry in the stack
+    //! completes requests immediately so the reported hit rates and downstream read counts only depend on the policy.
+    class BlockCacheReplayFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using ReplacementPolicy = AZ::IO::BlockCacheConfig::ReplacementPolicy;
+
+        static constexpr AZ::u32 BlockSize = 64 * 1024;
+        static constexpr AZ::u64 CacheSize = 4 * 1024 * 1024;
+        static constexpr AZ::u64 FileSize = 256 * 1024 * 1024;
+
+        struct TraceEntry
+        {
+            AZ::u32 m_file;
+            AZ::u64 m_offset;
+            AZ::u64 m_size;
+        };
+
+        class ImmediateStackEntry
+            : public AZ::IO::StreamStackEntry
+        {
+        public:
+            ImmediateStackEntry()
+                : AZ::IO::StreamStackEntry("Immediate")
+            {
+            }
+
+            void QueueRequest(AZ::IO::FileRequest* request) override
+            {
+                using namespace AZ::IO;
+                if (auto metaData = AZStd::get_if<FileRequest::FileMetaDataRetrievalData>(&request->GetCommand()))
+                {
+                    metaData->m_found = true;
+                    metaData->m_fileSize = FileSize;
+                }
+                else if (AZStd::holds_alternative<FileRequest::ReadData>(request->GetCommand()))
+                {
+                    m_numReads++;
+                }
+                request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                m_context->MarkRequestAsCompleted(request);
+            }
+
+            size_t m_numReads{ 0 };
+        };
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            m_previousFileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            AZ::IO::FileIOBase::SetInstance(&m_fileIO);
+
+            m_paths.resize(16);
+            for (size_t i = 0; i < m_paths.size(); ++i)
+            {
+                m_paths[i].InitFromAbsolutePath(AZStd::string::format("TraceFile%zu.pak", i));
+            }
+            m_buffer.reset(new char[MaxReadSize]);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_buffer.reset();
+            m_paths = {};
+            m_trace = {};
+
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            AZ::IO::FileIOBase::SetInstance(m_previousFileIO);
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        // Models loading while streaming: small reads of archive headers and catalog pages are interleaved with large
+        // unaligned sequential reads from streaming data such as audio banks and mip tails.
+        void CreateStreamingTrace()
+        {
+            AZ::SimpleLcgRandom random;
+            AZ::u64 streamOffset = 0;
+            for (AZ::u32 i = 0; i < 20000; ++i)
+            {
+                if (i % 4 == 0)
+                {
+                    AZ::u64 size = 256 * 1024 + (random.GetRandom() % BlockSize);
+                    m_trace.push_back(TraceEntry{ 0, streamOffset + 100, size });
+                    streamOffset = (streamOffset + size) % (FileSize - MaxReadSize);
+                }
+                else
+                {
+                    // Headers and catalogs of the other archives. Some are much more popular than others.
+                    AZ::u32 file = 1 + (random.GetRandom() % 15);
+                    AZ::u64 page = (random.GetRandom() % 8) * (random.GetRandom() % 4 == 0 ? 16 : 1);
+                    m_trace.push_back(TraceEntry{ file, page * BlockSize + 512, 2048 });
+                }
+            }
+        }
+
+        // Small reads with a skewed popularity, approximating a Zipf distribution over 4096 blocks.
+        void CreateSkewedTrace()
+        {
+            AZ::SimpleLcgRandom random;
+            for (AZ::u32 i = 0; i < 20000; ++i)
+            {
+                float uniform = random.GetRandomFloat();
+                AZ::u64 block = aznumeric_cast<AZ::u64>(4096.0f * uniform * uniform * uniform);
+                m_trace.push_back(TraceEntry{ aznumeric_cast<AZ::u32>(block % m_paths.size()), block * BlockSize + 128, 1024 });
+            }
+        }
+
+        void Replay(::benchmark::State& state)
+        {
+            using namespace AZ::IO;
+
+            ReplacementPolicy policy = static_cast<ReplacementPolicy>(state.range(0));
+            for ([[maybe_unused]] auto _ : state)
+            {
+                StreamerContext context;
+                auto next = AZStd::make_shared<ImmediateStackEntry>();
+                auto cache = AZStd::make_shared<BlockCache>(CacheSize, BlockSize, AZCORE_GLOBAL_NEW_ALIGNMENT, false, policy);
+                cache->SetNext(next);
+                cache->SetContext(context);
+
+                for (const TraceEntry& entry : m_trace)
+                {
+                    FileRequest* request = context.GetNewInternalRequest();
+                    request->CreateRead(nullptr, m_buffer.get(), MaxReadSize, m_paths[entry.m_file], entry.m_offset, entry.m_size);
+                    cache->QueueRequest(request);
+                    do
+                    {
+                        while (context.FinalizeCompletedRequests());
+                    } while (cache->ExecuteRequests());
+                }
+
+                AZ::u64 lookups = cache->GetCacheHitCount() + cache->GetCacheMissCount();
+                state.counters["HitRate"] = lookups > 0 ? aznumeric_cast<double>(cache->GetCacheHitCount()) / lookups : 0.0;
+                state.counters["Evictions"] = aznumeric_cast<double>(cache->GetEvictionCount());
+                state.counters["DownstreamReads"] = aznumeric_cast<double>(next->m_numReads);
+            }
+        }
+
+    protected:
+        static constexpr AZ::u64 MaxReadSize = 512 * 1024;
+
+        UnitTest::TestFileIOBase m_fileIO;
+        AZ::IO::FileIOBase* m_previousFileIO{};
+        AZStd::vector<AZ::IO::RequestPath> m_paths;
+        AZStd::vector<TraceEntry> m_trace;
+        AZStd::unique_ptr<char[]> m_buffer;
+    };
+
+    BENCHMARK_DEFINE_F(BlockCacheReplayFixture, StreamingTrace)(benchmark::State& state)
+    {
+        CreateStreamingTrace();
+        Replay(state);
+    }
+
+    BENCHMARK_DEFINE_F(BlockCacheReplayFixture, SkewedTrace)(benchmark::State& state)
+    {
+        CreateSkewedTrace();
+        Replay(state);
+    }
+
+    BENCHMARK_REGISTER_F(BlockCacheReplayFixture, StreamingTrace)
+        ->ArgNames({ "Policy" })
+        ->Arg(static_cast<int64_t>(AZ::IO::BlockCacheConfig::ReplacementPolicy::Recency))
+        ->Arg(static_cast<int64_t>(AZ::IO::BlockCacheConfig::ReplacementPolicy::FrequencyAware))
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(BlockCacheReplayFixture, SkewedTrace)
+        ->ArgNames({ "Policy" })
+        ->Arg(static_cast<int64_t>(AZ::IO::BlockCacheConfig::ReplacementPolicy::Recency))
+        ->Arg(static_cast<int64_t>(AZ::IO::BlockCacheConfig::ReplacementPolicy::FrequencyAware))
+        ->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
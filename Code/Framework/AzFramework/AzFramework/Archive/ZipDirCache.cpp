@@ -10,6 +10,7 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/string/conversions.h>
 
 #include <AzFramework/Archive/ZipFileFormat.h>
@@ -19,6 +20,7 @@
 #include <AzFramework/Archive/ZipDirCache.h>
 #include <AzFramework/Archive/ZipDirCacheFactory.h>
 #include <AzFramework/Archive/ZipDirFind.h>
+#include <AzFramework/Archive/ZipDirIndex.h>
 #include <AzFramework/IO/FileOperations.h>
 
 #include <locale>
@@ -182,7 +184,9 @@ namespace AZ::IO::ZipDir
             }
         }
         m_allocator = nullptr;
+        // the names in the tree may point into the directory index, so the tree is cleared first
         m_treeDir.Clear();
+        m_directoryIndex.Clear();
     }
 
     bool Cache::WriteCompressedData(uint8_t* data, size_t size, bool)
@@ -773,8 +777,24 @@ namespace AZ::IO::ZipDir
         AZ::StringFunc::Path::Normalize(szPath);
         AZStd::to_lower(AZStd::begin(szPath), AZStd::end(szPath));
 
-        ZipDir::FindFile fd(GetRoot());
-        FileEntry* fileEntry = fd.FindExact(szPath);
+        FileEntry* fileEntry{};
+        if (m_directoryIndex.IsLoaded())
+        {
+            // the index stores the paths with '/' separators and without a leading separator
+            AZStd::replace(AZStd::begin(szPath), AZStd::end(szPath), '\\', '/');
+            AZStd::string_view indexPath = szPath;
+            while (!indexPath.empty() && indexPath.front() == '/')
+            {
+                indexPath.remove_prefix(1);
+            }
+            fileEntry = m_directoryIndex.FindFile(indexPath);
+        }
+        else
+        {
+            ZipDir::FindFile fd(GetRoot());
+            fileEntry = fd.FindExact(szPath);
+        }
+
         if (!fileEntry)
         {
             if (az_archive_zip_directory_cache_verbosity)
@@ -789,7 +809,21 @@ namespace AZ::IO::ZipDir
     // returns the size of memory occupied by the instance referred to by this cache
     size_t Cache::GetSize() const
     {
-        return sizeof(*this) + m_strFilePath.capacity() + m_treeDir.GetSize() - sizeof(m_treeDir);
+        return sizeof(*this) + m_strFilePath.capacity() + m_treeDir.GetSize() - sizeof(m_treeDir) + m_directoryIndex.GetSize() - sizeof(m_directoryIndex);
+    }
+
+    FileEntryTree* Cache::GetRoot()
+    {
+        if (!m_isTreeDirBuilt.load(AZStd::memory_order_acquire))
+        {
+            AZStd::scoped_lock lock(m_treeDirMutex);
+            if (!m_isTreeDirBuilt.load(AZStd::memory_order_relaxed))
+            {
+                m_directoryIndex.BuildTree(m_treeDir);
+                m_isTreeDirBuilt.store(true, AZStd::memory_order_release);
+            }
+        }
+        return &m_treeDir;
     }
 
     // refreshes information about the given file entry into this file entry
@@ -968,6 +1002,70 @@ namespace AZ::IO::ZipDir
         return false;
     }
 
+    ErrorEnum Cache::WriteDirectoryIndex()
+    {
+        if (m_nFlags & FLAGS_READ_ONLY)
+        {
+            return ZD_ERROR_INVALID_CALL;
+        }
+
+        // the index stores the file paths and offsets unencrypted
+        if (m_encryptedHeaders != ZipFile::HEADERS_NOT_ENCRYPTED)
+        {
+            return ZD_ERROR_UNSUPPORTED;
+        }
+
+        // a previous index would no longer match the CDR
+        if (FindFile(DirectoryIndex::FileName))
+        {
+            ErrorEnum e = RemoveFile(DirectoryIndex::FileName);
+            if (e != ZD_ERROR_SUCCESS)
+            {
+                return e;
+            }
+        }
+
+        // the index is found by reading backwards from the CDR, so there can't be any gaps after it
+        if (m_nFlags & FLAGS_UNCOMPACTED)
+        {
+            if (!RelinkZip())
+            {
+                return ZD_ERROR_IO_FAILED;
+            }
+            m_nFlags &= ~FLAGS_UNCOMPACTED;
+        }
+
+        // the index stores the data offsets so reads don't have to look them up from the local headers
+        FileRecordList arrFiles(GetRoot());
+        for (FileRecord& file : arrFiles)
+        {
+            ErrorEnum e = Refresh(file.pFileEntryBase);
+            if (e != ZD_ERROR_SUCCESS)
+            {
+                return e;
+            }
+        }
+
+        AZStd::vector<uint8_t> indexData;
+        if (!DirectoryIndex::Build(arrFiles, aznumeric_cast<uint32_t>(arrFiles.size() + 1), indexData))
+        {
+            return ZD_ERROR_UNEXPECTED;
+        }
+
+        ErrorEnum e = UpdateFile(DirectoryIndex::FileName, indexData.data(), indexData.size(), ZipFile::METHOD_STORE);
+        if (e != ZD_ERROR_SUCCESS)
+        {
+            return e;
+        }
+
+        if (!WriteCDR())
+        {
+            return ZD_ERROR_IO_FAILED;
+        }
+        m_nFlags &= ~FLAGS_CDR_DIRTY;
+        return ZD_ERROR_SUCCESS;
+    }
+
     // writes out the file data in the queue into the given file. Empties the queue
     bool Cache::WriteZipFiles(AZStd::vector<FileDataRecordPtr>& queFiles, AZ::IO::HandleType fTmp)
     {
@@ -17,8 +17,11 @@
 
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzFramework/Archive/Codec.h>
+#include <AzFramework/Archive/ZipDirIndex.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
 #include <AzFramework/Archive/ZipDirTree.h>
 
@@ -95,7 +98,7 @@ namespace AZ::IO::ZipDir
         // QUICK check to determine whether the file entry belongs to this object
         bool IsOwnerOf(const FileEntry* pFileEntry) const
         {
-            return m_treeDir.IsOwnerOf(pFileEntry);
+            return m_directoryIndex.IsOwnerOf(pFileEntry) || m_treeDir.IsOwnerOf(pFileEntry);
         }
 
         // returns the string - path to the zip file from which this object was constructed.
@@ -105,16 +108,19 @@ namespace AZ::IO::ZipDir
             return m_strFilePath.c_str();
         }
 
-        FileEntryTree* GetRoot()
-        {
-            return &m_treeDir;
-        }
+        // returns the directory tree of the archive. If the archive was opened through its directory index
+        // the tree is only built on the first call
+        FileEntryTree* GetRoot();
 
         // writes the CDR to the disk
         bool WriteCDR() { return WriteCDR(m_fileHandle); }
         bool WriteCDR(AZ::IO::HandleType fTarget);
 
         bool RelinkZip();
+
+        // compacts the archive and appends a directory index of all the files as the last file before the CDR,
+        // which allows it to be opened read-only without parsing the CDR. Any previous index is replaced
+        ErrorEnum WriteDirectoryIndex();
     protected:
         bool RelinkZip(AZ::IO::HandleType fTmp);
         // writes out the file data in the queue into the given file. Empties the queue
@@ -133,6 +139,10 @@ namespace AZ::IO::ZipDir
         friend class CacheFactory;
         friend class FileEntryTransactionAdd;
         FileEntryTree m_treeDir;
+        // when the archive was opened through its directory index, the tree is built from the index on demand
+        DirectoryIndex m_directoryIndex;
+        AZStd::mutex m_treeDirMutex;
+        AZStd::atomic_bool m_isTreeDirBuilt{ true };
         AZ::IO::HandleType m_fileHandle;
         AZ::IAllocatorAllocate* m_allocator;
         AZStd::string m_strFilePath;
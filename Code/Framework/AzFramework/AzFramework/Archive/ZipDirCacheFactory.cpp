@@ -165,13 +165,22 @@ namespace AZ::IO::ZipDir
             return false;
         }
 
-        // since it's open for R/W, we need to know exactly how much space
-        // we have for each file to use the gaps efficiently
-        FileEntryList Adjuster(&m_treeFileEntries, m_CDREnd.lCDROffset);
-        Adjuster.RefreshEOFOffsets();
+        if (m_directoryIndex.IsLoaded())
+        {
+            // the index already holds the EOF offsets, the tree is only built if the archive is enumerated
+            m_directoryIndex.Swap(rwCache.m_directoryIndex);
+            rwCache.m_isTreeDirBuilt = false;
+        }
+        else
+        {
+            // since it's open for R/W, we need to know exactly how much space
+            // we have for each file to use the gaps efficiently
+            FileEntryList Adjuster(&m_treeFileEntries, m_CDREnd.lCDROffset);
+            Adjuster.RefreshEOFOffsets();
 
-        m_treeFileEntries.Swap(rwCache.m_treeDir);
-        m_CDR_buffer.swap(rwCache.m_CDR_buffer);   // CDR Buffer contain actually the string pool for the tree directory.
+            m_treeFileEntries.Swap(rwCache.m_treeDir);
+            m_CDR_buffer.swap(rwCache.m_CDR_buffer);   // CDR Buffer contain actually the string pool for the tree directory.
+        }
 
         // very important: we need this offset to be able to add to the zip file
         rwCache.m_lCDROffset = m_CDREnd.lCDROffset;
@@ -299,8 +308,62 @@ namespace AZ::IO::ZipDir
             return false;
         }
 
-        BuildFileEntryMap();
+        if (!ReadDirectoryIndex())
+        {
+            BuildFileEntryMap();
+        }
+
+        return true;
+    }
+
+    bool CacheFactory::ReadDirectoryIndex()
+    {
+        // the index is only written for unencrypted archives and skips the validation done while parsing the CDR.
+        // archives opened for writing need the tree to be able to modify it
+        if (!(m_nFlags & FLAGS_READ_ONLY)
+            || (m_nFlags & FLAGS_FILENAMES_AS_CRC32)
+            || m_nInitMethod != ZD_INIT_FAST
+            || m_encryptedHeaders != ZipFile::HEADERS_NOT_ENCRYPTED)
+        {
+            return false;
+        }
+
+        // the index is the last file in the archive, so its footer ends right where the CDR starts
+        ZipFile::DirectoryIndexFooter footer;
+        if (m_CDREnd.lCDROffset < sizeof(ZipFile::DirectoryIndexHeader) + sizeof(footer))
+        {
+            return false;
+        }
+        Seek(m_CDREnd.lCDROffset - sizeof(footer));
+        if (!Read(&footer, sizeof(footer))
+            || footer.lSignature != ZipFile::DirectoryIndexFooter::SIGNATURE
+            || footer.nIndexSize < sizeof(ZipFile::DirectoryIndexHeader) + sizeof(footer)
+            || footer.nIndexSize > m_CDREnd.lCDROffset)
+        {
+            return false;
+        }
+
+        // the whole index is read at once and used as is, without parsing the CDR or allocating per file
+        AZStd::vector<uint8_t> indexData(footer.nIndexSize);
+        Seek(m_CDREnd.lCDROffset - footer.nIndexSize);
+        if (!Read(indexData.data(), footer.nIndexSize))
+        {
+            return false;
+        }
 
+        // the CDR is only checksummed against the index, not parsed
+        AZStd::vector<uint8_t> cdrData(m_CDREnd.lCDRSize);
+        Seek(m_CDREnd.lCDROffset);
+        if (!Read(cdrData.data(), m_CDREnd.lCDRSize))
+        {
+            return false;
+        }
+
+        if (!m_directoryIndex.Load(AZStd::move(indexData), cdrData, m_CDREnd.numEntriesTotal, m_CDREnd.lCDROffset))
+        {
+            AZ_Warning("Archive", false, "The directory index of %s doesn't match its CDR and will be ignored", m_szFilename.c_str());
+            return false;
+        }
         return true;
     }
 
@@ -320,6 +383,7 @@ namespace AZ::IO::ZipDir
         memset(&m_CDREnd, 0, sizeof(m_CDREnd));
         m_mapFileEntries.clear();
         m_treeFileEntries.Clear();
+        m_directoryIndex.Clear();
         m_encryptedHeaders = ZipFile::HEADERS_NOT_ENCRYPTED;
     }
 
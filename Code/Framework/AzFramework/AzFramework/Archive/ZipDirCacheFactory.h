@@ -13,6 +13,7 @@
 #pragma once
 
 #include <AzFramework/Archive/IArchive.h>
+#include <AzFramework/Archive/ZipDirIndex.h>
 
 namespace AZ::IO::ZipDir
 {
@@ -68,6 +69,10 @@ namespace AZ::IO::ZipDir
         // builds up the m_mapFileEntries
         bool BuildFileEntryMap();// throw (ErrorEnum);
 
+        // reads the directory index stored in front of the CDR, if the archive has one that can be used
+        // in place of the file entry tree. Returns false if the CDR needs to be parsed instead
+        bool ReadDirectoryIndex();
+
         // give the CDR File Header entry, reads the local file header to validate and determine where
         // the actual file lies
         // This function can actually modify strFilePath variable, make sure you use a copy of the real path.
@@ -124,6 +129,7 @@ namespace AZ::IO::ZipDir
         FileEntryMap m_mapFileEntries;
 
         FileEntryTree m_treeFileEntries;
+        DirectoryIndex m_directoryIndex;
 
         AZStd::vector<uint8_t> m_CDR_buffer;
 
@@ -0,0 +1,454 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzFramework/Archive/ZipFileFormat.h>
+#include <AzFramework/Archive/ZipDirStructures.h>
+#include <AzFramework/Archive/ZipDirTree.h>
+#include <AzFramework/Archive/ZipDirList.h>
+#include <AzFramework/Archive/ZipDirIndex.h>
+
+namespace AZ::IO::ZipDir
+{
+    // number of seeds tried for a single bucket before giving up on building the perfect hash
+    static constexpr uint32_t MaxSeedAttempts = 1 << 20;
+    // average number of paths that share a bucket, and therefore a seed
+    static constexpr uint32_t PathsPerBucket = 4;
+
+    uint64_t DirectoryIndex::HashPath(AZStd::string_view szPath)
+    {
+        // 64-bit FNV-1a
+        uint64_t nHash = 0xcbf29ce484222325ull;
+        for (char c : szPath)
+        {
+            nHash ^= static_cast<uint8_t>(c);
+            nHash *= 0x100000001b3ull;
+        }
+        return nHash;
+    }
+
+    uint32_t DirectoryIndex::GetSlot(uint64_t nHash, uint32_t nSeed, uint32_t nSlotCount)
+    {
+        // mix the seed into the hash and scramble the bits, so every seed gives an unrelated slot
+        uint64_t nMixed = nHash ^ (uint64_t{ nSeed } * 0x9e3779b97f4a7c15ull);
+        nMixed ^= nMixed >> 33;
+        nMixed *= 0xff51afd7ed558ccdull;
+        nMixed ^= nMixed >> 33;
+        nMixed *= 0xc4ceb9fe1a85ec53ull;
+        nMixed ^= nMixed >> 33;
+        return aznumeric_cast<uint32_t>(nMixed % nSlotCount);
+    }
+
+    bool DirectoryIndex::ChecksumCDR(const uint8_t* pCDR, size_t nCDRSize, uint32_t& lCRC32)
+    {
+        AZ::Crc32 crc;
+        const uint8_t* pEnd = pCDR + nCDRSize;
+        while (pCDR != pEnd)
+        {
+            ZipFile::CDRFileHeader header;
+            if (aznumeric_cast<size_t>(pEnd - pCDR) < sizeof(header))
+            {
+                return false;
+            }
+            memcpy(&header, pCDR, sizeof(header));
+
+            const size_t nEntrySize = sizeof(header) + header.nFileNameLength + header.nExtraFieldLength + header.nFileCommentLength;
+            if (nEntrySize > aznumeric_cast<size_t>(pEnd - pCDR))
+            {
+                return false;
+            }
+
+            // the entry of the index holds the CRC32 of the index data, which in turn holds this checksum
+            const AZStd::string_view szName(reinterpret_cast<const char*>(pCDR + sizeof(header)), header.nFileNameLength);
+            if (szName != FileName)
+            {
+                crc.Add(pCDR, nEntrySize);
+            }
+            pCDR += nEntrySize;
+        }
+
+        lCRC32 = crc;
+        return true;
+    }
+
+    bool DirectoryIndex::Build(const FileRecordList& files, uint32_t nCDREntryCount, AZStd::vector<uint8_t>& indexData)
+    {
+        struct IndexedFile
+        {
+            AZStd::string strPath;
+            uint64_t nHash;
+            const FileEntryBase* pFileEntry;
+        };
+
+        AZStd::vector<IndexedFile> indexedFiles;
+        indexedFiles.reserve(files.size());
+        size_t nNamePoolSize = 0;
+        for (const FileRecord& file : files)
+        {
+            AZStd::string strPath = file.strPath;
+            AZStd::to_lower(strPath.begin(), strPath.end());
+            AZStd::replace(strPath.begin(), strPath.end(), '\\', '/');
+            if (strPath.size() > AZStd::numeric_limits<uint16_t>::max())
+            {
+                return false;
+            }
+            nNamePoolSize += strPath.size();
+            const uint64_t nHash = HashPath(strPath);
+            indexedFiles.push_back(IndexedFile{ AZStd::move(strPath), nHash, file.pFileEntryBase });
+        }
+
+        const uint32_t nFileCount = aznumeric_cast<uint32_t>(indexedFiles.size());
+        const uint32_t nBucketCount = AZStd::max(1u, (nFileCount + PathsPerBucket - 1) / PathsPerBucket);
+        // leave a few slots empty so the last buckets quickly find a seed
+        const uint32_t nSlotCount = nFileCount + nFileCount / 8 + 1;
+
+        AZStd::vector<AZStd::vector<uint32_t>> buckets(nBucketCount);
+        for (uint32_t nFile = 0; nFile < nFileCount; ++nFile)
+        {
+            buckets[indexedFiles[nFile].nHash % nBucketCount].push_back(nFile);
+        }
+
+        // place the largest buckets first, while most slots are still free
+        AZStd::vector<uint32_t> bucketOrder(nBucketCount);
+        for (uint32_t nBucket = 0; nBucket < nBucketCount; ++nBucket)
+        {
+            bucketOrder[nBucket] = nBucket;
+        }
+        AZStd::sort(bucketOrder.begin(), bucketOrder.end(),
+            [&buckets](uint32_t left, uint32_t right)
+            {
+                return buckets[left].size() != buckets[right].size() ? buckets[left].size() > buckets[right].size() : left < right;
+            });
+
+        AZStd::vector<uint32_t> seeds(nBucketCount, 0);
+        AZStd::vector<uint32_t> slots(nSlotCount, InvalidEntry);
+        AZStd::vector<uint32_t> bucketSlots;
+        for (uint32_t nBucket : bucketOrder)
+        {
+            const AZStd::vector<uint32_t>& bucket = buckets[nBucket];
+            if (bucket.empty())
+            {
+                break;
+            }
+
+            bool bPlaced = false;
+            for (uint32_t nSeed = 0; nSeed < MaxSeedAttempts && !bPlaced; ++nSeed)
+            {
+                bPlaced = true;
+                bucketSlots.clear();
+                for (uint32_t nFile : bucket)
+                {
+                    const uint32_t nSlot = GetSlot(indexedFiles[nFile].nHash, nSeed, nSlotCount);
+                    if (slots[nSlot] != InvalidEntry || AZStd::find(bucketSlots.begin(), bucketSlots.end(), nSlot) != bucketSlots.end())
+                    {
+                        bPlaced = false;
+                        break;
+                    }
+                    bucketSlots.push_back(nSlot);
+                }
+
+                if (bPlaced)
+                {
+                    seeds[nBucket] = nSeed;
+                    for (size_t nFile = 0; nFile < bucket.size(); ++nFile)
+                    {
+                        slots[bucketSlots[nFile]] = bucket[nFile];
+                    }
+                }
+            }
+
+            if (!bPlaced)
+            {
+                return false;
+            }
+        }
+
+        // the CDR the index is written for holds the entries of the files, plus the entry of the index itself
+        AZStd::vector<uint8_t> cdrData(files.GetStats().nSizeCDR);
+        const size_t nFilesCDRSize = files.MakeZipCDR(0, cdrData.data()) - sizeof(ZipFile::CDREnd);
+        uint32_t lCDRCRC32 = 0;
+        if (!ChecksumCDR(cdrData.data(), nFilesCDRSize, lCDRCRC32))
+        {
+            return false;
+        }
+        const size_t nCDRSize = nFilesCDRSize + sizeof(ZipFile::CDRFileHeader) + FileName.size();
+        if (nCDRSize > AZStd::numeric_limits<uint32_t>::max())
+        {
+            return false;
+        }
+
+        const size_t nIndexSize = sizeof(ZipFile::DirectoryIndexHeader) + sizeof(uint32_t) * (nBucketCount + nSlotCount) +
+            sizeof(ZipFile::DirectoryIndexEntry) * nFileCount + nNamePoolSize + sizeof(ZipFile::DirectoryIndexFooter);
+        if (nIndexSize > AZStd::numeric_limits<uint32_t>::max())
+        {
+            return false;
+        }
+
+        indexData.clear();
+        indexData.resize(nIndexSize);
+        uint8_t* pData = indexData.data();
+
+        ZipFile::DirectoryIndexHeader header;
+        header.lSignature = ZipFile::DirectoryIndexHeader::SIGNATURE;
+        header.nVersion = ZipFile::DirectoryIndexHeader::VERSION;
+        header.nFileCount = nFileCount;
+        header.nBucketCount = nBucketCount;
+        header.nSlotCount = nSlotCount;
+        header.nNamePoolSize = aznumeric_cast<uint32_t>(nNamePoolSize);
+        header.nCDREntryCount = nCDREntryCount;
+        header.lCDRSize = aznumeric_cast<uint32_t>(nCDRSize);
+        header.lCDRCRC32 = lCDRCRC32;
+        memcpy(pData, &header, sizeof(header));
+        pData += sizeof(header);
+
+        memcpy(pData, seeds.data(), sizeof(uint32_t) * nBucketCount);
+        pData += sizeof(uint32_t) * nBucketCount;
+        memcpy(pData, slots.data(), sizeof(uint32_t) * nSlotCount);
+        pData += sizeof(uint32_t) * nSlotCount;
+
+        char* pNamePool = reinterpret_cast<char*>(pData + sizeof(ZipFile::DirectoryIndexEntry) * nFileCount);
+        uint32_t nNameOffset = 0;
+        for (const IndexedFile& file : indexedFiles)
+        {
+            const FileEntryBase& fileEntry = *file.pFileEntry;
+            ZipFile::DirectoryIndexEntry entry;
+            entry.nNameHash = file.nHash;
+            entry.nNameOffset = nNameOffset;
+            entry.nNameLength = aznumeric_cast<uint16_t>(file.strPath.size());
+            entry.nMethod = fileEntry.nMethod;
+            entry.desc = fileEntry.desc;
+            entry.nFileHeaderOffset = fileEntry.nFileHeaderOffset;
+            entry.nFileDataOffset = fileEntry.nFileDataOffset;
+            entry.nEOFOffset = fileEntry.nEOFOffset;
+            entry.nLastModTime = fileEntry.nLastModTime;
+            entry.nLastModDate = fileEntry.nLastModDate;
+            entry.nNTFS_LastModifyTime = fileEntry.nNTFS_LastModifyTime;
+            memcpy(pData, &entry, sizeof(entry));
+            pData += sizeof(entry);
+
+            memcpy(pNamePool + nNameOffset, file.strPath.data(), file.strPath.size());
+            nNameOffset += entry.nNameLength;
+        }
+        pData += nNamePoolSize;
+
+        ZipFile::DirectoryIndexFooter footer;
+        footer.nIndexSize = aznumeric_cast<uint32_t>(nIndexSize);
+        footer.lSignature = ZipFile::DirectoryIndexFooter::SIGNATURE;
+        memcpy(pData, &footer, sizeof(footer));
+
+        return true;
+    }
+
+    bool DirectoryIndex::Load(AZStd::vector<uint8_t>&& indexData, const AZStd::vector<uint8_t>& cdrData, uint32_t nCDREntryCount, uint32_t lCDROffset)
+    {
+        Clear();
+
+        if (indexData.size() < sizeof(ZipFile::DirectoryIndexHeader) + sizeof(ZipFile::DirectoryIndexFooter))
+        {
+            return false;
+        }
+
+        const uint8_t* pData = indexData.data();
+        const auto* header = reinterpret_cast<const ZipFile::DirectoryIndexHeader*>(pData);
+        const auto* footer = reinterpret_cast<const ZipFile::DirectoryIndexFooter*>(pData + indexData.size() - sizeof(ZipFile::DirectoryIndexFooter));
+        if (header->lSignature != ZipFile::DirectoryIndexHeader::SIGNATURE
+            || header->nVersion != ZipFile::DirectoryIndexHeader::VERSION
+            || footer->lSignature != ZipFile::DirectoryIndexFooter::SIGNATURE
+            || footer->nIndexSize != indexData.size())
+        {
+            return false;
+        }
+
+        // an index that was written for another CDR is out of date, e.g. because the archive was modified with another tool
+        if (header->nCDREntryCount != nCDREntryCount
+            || header->nFileCount >= nCDREntryCount
+            || header->nBucketCount == 0
+            || header->nSlotCount <= header->nFileCount)
+        {
+            return false;
+        }
+
+        const uint64_t nExpectedSize = sizeof(ZipFile::DirectoryIndexHeader) + sizeof(uint32_t) * (uint64_t{ header->nBucketCount } + header->nSlotCount) +
+            sizeof(ZipFile::DirectoryIndexEntry) * uint64_t{ header->nFileCount } + header->nNamePoolSize + sizeof(ZipFile::DirectoryIndexFooter);
+        if (nExpectedSize != indexData.size())
+        {
+            return false;
+        }
+
+        // the entry count alone doesn't catch files that were replaced or moved without adding or removing any
+        uint32_t lCDRCRC32 = 0;
+        if (header->lCDRSize != cdrData.size()
+            || !ChecksumCDR(cdrData.data(), cdrData.size(), lCDRCRC32)
+            || header->lCDRCRC32 != lCDRCRC32)
+        {
+            return false;
+        }
+
+        const auto* seeds = reinterpret_cast<const uint32_t*>(pData + sizeof(ZipFile::DirectoryIndexHeader));
+        const uint32_t* slots = seeds + header->nBucketCount;
+        const auto* entries = reinterpret_cast<const ZipFile::DirectoryIndexEntry*>(slots + header->nSlotCount);
+        const char* namePool = reinterpret_cast<const char*>(entries + header->nFileCount);
+
+        for (uint32_t nSlot = 0; nSlot < header->nSlotCount; ++nSlot)
+        {
+            if (slots[nSlot] != InvalidEntry && slots[nSlot] >= header->nFileCount)
+            {
+                return false;
+            }
+        }
+
+        for (uint32_t nEntry = 0; nEntry < header->nFileCount; ++nEntry)
+        {
+            const ZipFile::DirectoryIndexEntry& entry = entries[nEntry];
+            if (uint64_t{ entry.nNameOffset } + entry.nNameLength > header->nNamePoolSize
+                || entry.nFileHeaderOffset >= lCDROffset
+                || entry.nFileDataOffset < entry.nFileHeaderOffset
+                || uint64_t{ entry.nFileDataOffset } + entry.desc.lSizeCompressed > lCDROffset
+                || entry.nEOFOffset > lCDROffset)
+            {
+                return false;
+            }
+        }
+
+        m_data = AZStd::move(indexData);
+        m_header = header;
+        m_seeds = seeds;
+        m_slots = slots;
+        m_entries = entries;
+        m_namePool = namePool;
+        // value initialization sets all the entries to null
+        m_fileEntries.reset(new AZStd::atomic<FileEntry*>[header->nFileCount]());
+        return true;
+    }
+
+    void DirectoryIndex::Clear()
+    {
+        if (m_fileEntries)
+        {
+            for (uint32_t nEntry = 0; nEntry < m_header->nFileCount; ++nEntry)
+            {
+                delete m_fileEntries[nEntry].load(AZStd::memory_order_relaxed);
+            }
+            m_fileEntries.reset();
+        }
+
+        m_header = nullptr;
+        m_seeds = nullptr;
+        m_slots = nullptr;
+        m_entries = nullptr;
+        m_namePool = nullptr;
+        m_data.clear();
+    }
+
+    void DirectoryIndex::Swap(DirectoryIndex& rThat)
+    {
+        m_data.swap(rThat.m_data);
+        AZStd::swap(m_header, rThat.m_header);
+        AZStd::swap(m_seeds, rThat.m_seeds);
+        AZStd::swap(m_slots, rThat.m_slots);
+        AZStd::swap(m_entries, rThat.m_entries);
+        AZStd::swap(m_namePool, rThat.m_namePool);
+        m_fileEntries.swap(rThat.m_fileEntries);
+    }
+
+    FileEntry* DirectoryIndex::FindFile(AZStd::string_view szPath)
+    {
+        if (!IsLoaded())
+        {
+            return nullptr;
+        }
+
+        const uint64_t nHash = HashPath(szPath);
+        const uint32_t nSeed = m_seeds[nHash % m_header->nBucketCount];
+        const uint32_t nEntry = m_slots[GetSlot(nHash, nSeed, m_header->nSlotCount)];
+        if (nEntry == InvalidEntry)
+        {
+            return nullptr;
+        }
+
+        // every path maps to a slot, so paths that aren't in the archive are rejected by comparing the name
+        const ZipFile::DirectoryIndexEntry& entry = m_entries[nEntry];
+        if (entry.nNameHash != nHash || GetName(entry) != szPath)
+        {
+            return nullptr;
+        }
+
+        AZStd::atomic<FileEntry*>& fileEntrySlot = m_fileEntries[nEntry];
+        FileEntry* pFileEntry = fileEntrySlot.load(AZStd::memory_order_acquire);
+        if (!pFileEntry)
+        {
+            auto newFileEntry = AZStd::make_unique<FileEntry>();
+            CopyEntry(entry, *newFileEntry);
+            // if another thread created the entry first, use that one instead
+            if (fileEntrySlot.compare_exchange_strong(pFileEntry, newFileEntry.get(), AZStd::memory_order_acq_rel, AZStd::memory_order_acquire))
+            {
+                pFileEntry = newFileEntry.release();
+            }
+        }
+        return pFileEntry;
+    }
+
+    void DirectoryIndex::BuildTree(FileEntryTree& tree) const
+    {
+        if (!IsLoaded())
+        {
+            return;
+        }
+
+        FileEntryBase fileEntry;
+        for (uint32_t nEntry = 0; nEntry < m_header->nFileCount; ++nEntry)
+        {
+            CopyEntry(m_entries[nEntry], fileEntry);
+            tree.Add(GetName(m_entries[nEntry]), fileEntry);
+        }
+    }
+
+    bool DirectoryIndex::IsOwnerOf(const FileEntry* pFileEntry) const
+    {
+        for (uint32_t nEntry = 0; nEntry < NumFiles(); ++nEntry)
+        {
+            if (m_fileEntries[nEntry].load(AZStd::memory_order_acquire) == pFileEntry)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t DirectoryIndex::GetSize() const
+    {
+        size_t nSize = sizeof(*this) + m_data.capacity() + sizeof(AZStd::atomic<FileEntry*>) * NumFiles();
+        for (uint32_t nEntry = 0; nEntry < NumFiles(); ++nEntry)
+        {
+            if (m_fileEntries[nEntry].load(AZStd::memory_order_relaxed))
+            {
+                nSize += sizeof(FileEntry);
+            }
+        }
+        return nSize;
+    }
+
+    void DirectoryIndex::CopyEntry(const ZipFile::DirectoryIndexEntry& entry, FileEntryBase& fileEntry)
+    {
+        fileEntry.desc = entry.desc;
+        fileEntry.nFileDataOffset = entry.nFileDataOffset;
+        fileEntry.nFileHeaderOffset = entry.nFileHeaderOffset;
+        fileEntry.nNameOffset = entry.nNameOffset;
+        fileEntry.nMethod = entry.nMethod;
+        fileEntry.nLastModTime = entry.nLastModTime;
+        fileEntry.nLastModDate = entry.nLastModDate;
+        fileEntry.nNTFS_LastModifyTime = entry.nNTFS_LastModifyTime;
+        fileEntry.nEOFOffset = entry.nEOFOffset;
+    }
+}
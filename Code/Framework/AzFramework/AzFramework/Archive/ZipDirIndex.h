@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+
+// Precomputed directory of a read-only archive. Instead of parsing the CDR and building the
+// FileEntryTree when the archive is opened, the index written into the archive is read with a single
+// read and looked up in place through a perfect hash of the file paths.
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string_view.h>
+#include <AzFramework/Archive/ZipDirStructures.h>
+#include <AzFramework/Archive/ZipFileFormat.h>
+
+namespace AZ::IO::ZipDir
+{
+    class FileEntryTree;
+    class FileRecordList;
+
+    class DirectoryIndex
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(DirectoryIndex, AZ::SystemAllocator, 0);
+
+        // path of the index inside the archive
+        inline static constexpr AZStd::string_view FileName = "$zipdir.index";
+
+        DirectoryIndex() = default;
+        DirectoryIndex(const DirectoryIndex&) = delete;
+        DirectoryIndex& operator=(const DirectoryIndex&) = delete;
+        ~DirectoryIndex()
+        {
+            Clear();
+        }
+
+        // builds the index of the given files, which need to have their data offsets refreshed.
+        // nCDREntryCount is the number of files the CDR will have after the index has been added to the archive.
+        // returns false if no perfect hash could be found for the paths
+        static bool Build(const FileRecordList& files, uint32_t nCDREntryCount, AZStd::vector<uint8_t>& indexData);
+
+        // takes over the index data read from the archive, validating it against the CDR of the archive.
+        // cdrData holds the CDR entries, without the CDREnd.
+        // returns false, leaving the index empty, if the data isn't a valid index for this CDR
+        bool Load(AZStd::vector<uint8_t>&& indexData, const AZStd::vector<uint8_t>& cdrData, uint32_t nCDREntryCount, uint32_t lCDROffset);
+
+        bool IsLoaded() const
+        {
+            return m_header != nullptr;
+        }
+
+        void Clear();
+
+        void Swap(DirectoryIndex& rThat);
+
+        // finds the file by its lower case path with '/' as the separator and no leading separator.
+        // the file entries are created the first time they are found, this is safe to call from multiple threads
+        FileEntry* FindFile(AZStd::string_view szPath);
+
+        // adds all the files in the index to the tree. The names in the tree point into the index, so the
+        // tree must be cleared before the index is
+        void BuildTree(FileEntryTree& tree) const;
+
+        bool IsOwnerOf(const FileEntry* pFileEntry) const;
+
+        // returns the size of memory occupied by the index
+        size_t GetSize() const;
+
+        uint32_t NumFiles() const
+        {
+            return m_header ? m_header->nFileCount : 0;
+        }
+
+    private:
+        inline static constexpr uint32_t InvalidEntry = 0xFFFFFFFF;
+
+        static uint64_t HashPath(AZStd::string_view szPath);
+        static uint32_t GetSlot(uint64_t nHash, uint32_t nSeed, uint32_t nSlotCount);
+        // computes the CRC32 of the CDR entries, skipping the entry of the index itself.
+        // returns false if the entries don't fill the CDR exactly
+        static bool ChecksumCDR(const uint8_t* pCDR, size_t nCDRSize, uint32_t& lCRC32);
+
+        AZStd::string_view GetName(const ZipFile::DirectoryIndexEntry& entry) const
+        {
+            return AZStd::string_view(m_namePool + entry.nNameOffset, entry.nNameLength);
+        }
+        static void CopyEntry(const ZipFile::DirectoryIndexEntry& entry, FileEntryBase& fileEntry);
+
+        AZStd::vector<uint8_t> m_data;
+        const ZipFile::DirectoryIndexHeader* m_header{};
+        const uint32_t* m_seeds{};
+        const uint32_t* m_slots{};
+        const ZipFile::DirectoryIndexEntry* m_entries{};
+        const char* m_namePool{};
+
+        // file entries created on demand, parallel to m_entries
+        AZStd::unique_ptr<AZStd::atomic<FileEntry*>[]> m_fileEntries;
+    };
+}
@@ -209,6 +209,59 @@ namespace AZ::IO::ZipFile
     };
 #pragma pack(pop)
 
+    // Precomputed perfect hash lookup table of the files in the archive. It's stored uncompressed as the last file
+    // before the CDR, so the DirectoryIndexFooter ends exactly at the start of the CDR. Laid out as:
+    //    DirectoryIndexHeader
+    //    bucket seeds (uint32_t * nBucketCount)
+    //    slots with the index of the entry that hashes to it (uint32_t * nSlotCount)
+    //    DirectoryIndexEntry * nFileCount
+    //    name pool with the lower case file paths (nNamePoolSize bytes)
+    //    DirectoryIndexFooter
+#pragma pack(push, 1)
+    struct DirectoryIndexHeader
+    {
+        inline static constexpr uint32_t SIGNATURE = 0x58444e49; // "INDX"
+        inline static constexpr uint32_t VERSION = 2;
+
+        uint32_t lSignature{};
+        uint32_t nVersion{};
+        uint32_t nFileCount{};      // number of files in the index, which doesn't include the index itself
+        uint32_t nBucketCount{};
+        uint32_t nSlotCount{};
+        uint32_t nNamePoolSize{};
+        uint32_t nCDREntryCount{};  // number of entries in the CDR the index was written for, including the index itself
+        uint32_t lCDRSize{};        // size of that CDR, without the CDREnd
+        uint32_t lCDRCRC32{};       // CRC32 of the entries in that CDR, except the one of the index itself
+    };
+#pragma pack(pop)
+
+#pragma pack(push, 1)
+    struct DirectoryIndexEntry
+    {
+        uint64_t nNameHash{};
+        uint32_t nNameOffset{};     // offset of the file path in the name pool
+        uint16_t nNameLength{};
+        uint16_t nMethod{};
+        DataDescriptor desc{};
+        uint32_t nFileHeaderOffset{};
+        uint32_t nFileDataOffset{};
+        uint32_t nEOFOffset{};
+        uint16_t nLastModTime{};
+        uint16_t nLastModDate{};
+        uint64_t nNTFS_LastModifyTime{};
+    };
+#pragma pack(pop)
+
+#pragma pack(push, 1)
+    struct DirectoryIndexFooter
+    {
+        inline static constexpr uint32_t SIGNATURE = 0x46444e49; // "INDF"
+
+        uint32_t nIndexSize{};      // size of the whole index, including the header and this footer
+        uint32_t lSignature{};
+    };
+#pragma pack(pop)
+
     // compression methods
     enum EExtraHeaderID : uint32_t
     {
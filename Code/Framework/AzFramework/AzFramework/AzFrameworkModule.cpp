@@ -12,6 +12,7 @@
 #include <AzFramework/Asset/CustomAssetTypeComponent.h>
 #include <AzFramework/Asset/AssetSystemComponent.h>
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformHierarchySystemComponent.h>
 #include <AzFramework/Components/NonUniformScaleComponent.h>
 #include <AzFramework/Components/AzFrameworkConfigurationSystemComponent.h>
 #include <AzFramework/Driller/RemoteDrillerInterface.h>
@@ -37,6 +38,7 @@ namespace AzFramework
             AzFramework::CustomAssetTypeComponent::CreateDescriptor(),
             AzFramework::FileTag::ExcludeFileComponent::CreateDescriptor(),
             AzFramework::TransformComponent::CreateDescriptor(),
+            AzFramework::TransformHierarchySystemComponent::CreateDescriptor(),
             AzFramework::NonUniformScaleComponent::CreateDescriptor(),
             AzFramework::GameEntityContextComponent::CreateDescriptor(),
             AzFramework::RenderGeometry::GameIntersectorComponent::CreateDescriptor(),
@@ -152,6 +152,12 @@ namespace AzFramework
         AZ::TransformBus::Handler::BusConnect(m_entity->GetId());
         AZ::TransformNotificationBus::Bind(m_notificationBus, m_entity->GetId());
 
+        m_hierarchy = TransformHierarchyInterface::Get();
+        if (m_hierarchy)
+        {
+            m_hierarchyHandle = m_hierarchy->RegisterTransform(this);
+        }
+
         const bool keepWorldTm = (m_parentActivationTransformMode == ParentActivationTransformMode::MaintainCurrentWorldTransform || !m_parentId.IsValid());
         SetParentImpl(m_parentId, keepWorldTm);
     }
@@ -173,6 +179,13 @@ namespace AzFramework
             AZ::EntityBus::Handler::BusDisconnect();
         }
         AZ::TransformBus::Handler::BusDisconnect();
+
+        if (m_hierarchy)
+        {
+            m_hierarchy->UnregisterTransform(m_hierarchyHandle);
+            m_hierarchy = nullptr;
+            m_hierarchyHandle = TransformHierarchyDefinition::InvalidHandle;
+        }
     }
 
     void TransformComponent::BindTransformChangedEventHandler(AZ::TransformChangedEvent::Handler& handler)
@@ -501,6 +514,10 @@ namespace AzFramework
         if (parentEntity)
         {
             m_parentTM = parentEntity->GetTransform();
+            if (m_hierarchy)
+            {
+                m_hierarchy->OnParentChanged(m_hierarchyHandle);
+            }
 
             AZ_Warning("TransformComponent", !m_isStatic || m_parentTM->IsStaticTransform(),
                 "Entity '%s' %s has static transform, but parent has non-static transform. This may lead to unexpected movement.",
@@ -522,6 +539,10 @@ namespace AzFramework
         AZ_Assert(parentEntityId == m_parentId, "We expect to receive notifications only from the current parent!");
         m_parentTM = nullptr;
         m_parentActive = false;
+        if (m_hierarchy)
+        {
+            m_hierarchy->OnParentChanged(m_hierarchyHandle);
+        }
         ComputeLocalTM();
     }
 
@@ -543,6 +564,11 @@ namespace AzFramework
         }
 
         m_parentId = parentId;
+        if (m_hierarchy)
+        {
+            m_hierarchy->OnParentChanged(m_hierarchyHandle);
+        }
+
         if (m_parentId.IsValid())
         {
             AZ::ComponentApplicationRequests* componentApplication = AZ::Interface<AZ::ComponentApplicationRequests>::Get();
@@ -614,7 +640,19 @@ namespace AzFramework
         // Ignore the event until we've already derived our local transform.
         if (m_parentTM)
         {
+            if (m_hierarchy && IsParentManagedByHierarchy())
+            {
+                // The transform hierarchy already propagated the parent's change to this transform.
+                return;
+            }
+
             m_worldTM = parentWorldTM * m_localTM;
+            if (m_hierarchy)
+            {
+                m_hierarchy->MarkDirty(m_hierarchyHandle);
+                return;
+            }
+
             EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
             m_transformChangedEvent.Signal(m_localTM, m_worldTM);
         }
@@ -631,6 +669,13 @@ namespace AzFramework
             m_localTM = m_worldTM;
         }
 
+        if (m_hierarchy)
+        {
+            // Notifications are sent after the transform hierarchy propagated the change to the children.
+            m_hierarchy->MarkDirty(m_hierarchyHandle);
+            return;
+        }
+
         EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
 
@@ -652,10 +697,36 @@ namespace AzFramework
             m_worldTM = m_localTM;
         }
 
+        if (m_hierarchy)
+        {
+            // Notifications are sent after the transform hierarchy propagated the change to the children.
+            m_hierarchy->MarkDirty(m_hierarchyHandle);
+            return;
+        }
+
         EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
     }
 
+    void TransformComponent::NotifyTransformChanged()
+    {
+        EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
+        m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+
+        // Children moved by the hierarchy change their bounds as well, so every changed entity is reported.
+        AzFramework::IEntityBoundsUnion* boundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
+        if (boundsUnion != nullptr)
+        {
+            boundsUnion->OnTransformUpdated(GetEntity());
+        }
+    }
+
+    bool TransformComponent::IsParentManagedByHierarchy() const
+    {
+        const TransformComponent* parent = azrtti_cast<TransformComponent*>(m_parentTM);
+        return parent && parent->m_hierarchy == m_hierarchy;
+    }
+
     bool TransformComponent::AreMoveRequestsAllowed() const
     {
         // Don't allow static transform to be moved while entity is activated.
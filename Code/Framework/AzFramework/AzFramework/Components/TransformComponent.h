@@ -13,6 +13,7 @@
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/EBus/Event.h>
+#include <AzFramework/Components/TransformHierarchyInterface.h>
 
 namespace AzToolsFramework
 {
@@ -41,6 +42,7 @@ namespace AzFramework
         AZ_COMPONENT(TransformComponent, AZ::TransformComponentTypeId, AZ::TransformInterface);
 
         friend class AzToolsFramework::Components::TransformComponent;
+        friend class TransformHierarchySystemComponent;
 
         using ParentActivationTransformMode = AZ::TransformConfig::ParentActivationTransformMode;
 
@@ -159,6 +161,11 @@ namespace AzFramework
         void ComputeWorldTM();
         //////////////////////////////////////////////////////////////////////////
 
+        //! Sends the deferred transform changed notifications once the transform hierarchy has propagated the world transform.
+        void NotifyTransformChanged();
+        //! Returns true if the world transform of this entity is propagated from its parent by the transform hierarchy.
+        bool IsParentManagedByHierarchy() const;
+
         //! Returns whether external calls are currently allowed to move the transform.
         bool AreMoveRequestsAllowed() const;
 
@@ -185,5 +192,8 @@ namespace AzFramework
         bool m_parentActive = false; ///< Keeps track of the state of the parent entity.
         bool m_onNewParentKeepWorldTM = true; ///< If set, recompute localTM instead of worldTM when parent becomes active.
         bool m_isStatic = false; ///< If true, the transform is static and doesn't move while entity is active.
+
+        TransformHierarchyDefinition* m_hierarchy = nullptr; ///< Transform hierarchy managing this transform while active, if available.
+        TransformHierarchyDefinition::Handle m_hierarchyHandle = TransformHierarchyDefinition::InvalidHandle; ///< Handle of this transform in m_hierarchy.
     };
 }   // namespace AZ
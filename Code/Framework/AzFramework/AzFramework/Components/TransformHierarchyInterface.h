@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/limits.h>
+
+namespace AzFramework
+{
+    class TransformComponent;
+
+    //! Interface to the optional system that batches the propagation of world transforms through the transform hierarchy.
+    //! While it's registered, TransformComponents update their own transforms immediately but leave the world transforms of
+    //! their descendants and all change notifications to the system, which recomputes every changed subtree once per tick
+    //! and then notifies each changed entity once. All calls to this interface need to be made from the main thread.
+    class TransformHierarchyDefinition
+    {
+    public:
+        AZ_RTTI(AzFramework::TransformHierarchyDefinition, "{5C0A4E42-6B7F-4D3B-9A0E-2F8B1D3C7E61}");
+
+        using Handle = uint32_t;
+        static constexpr Handle InvalidHandle = AZStd::numeric_limits<Handle>::max();
+
+        virtual ~TransformHierarchyDefinition() = default;
+
+        //! Adds an activating transform to the hierarchy. The returned handle may be reassigned by the system when the hierarchy
+        //! is rebuilt, which is why the system writes it back to the transform component.
+        virtual Handle RegisterTransform(TransformComponent* transform) = 0;
+        //! Removes a deactivating transform from the hierarchy. Pending notifications for the transform are dropped.
+        virtual void UnregisterTransform(Handle handle) = 0;
+        //! Informs the system that the parent of the transform has changed, which requires the hierarchy to be rebuilt.
+        virtual void OnParentChanged(Handle handle) = 0;
+        //! Marks the local or world transform of the transform as changed so it and its descendants are updated and notified
+        //! during the next propagation.
+        virtual void MarkDirty(Handle handle) = 0;
+        //! Recomputes the world transforms of all changed subtrees and sends out the change notifications. This is called
+        //! every tick, but can also be called explicitly (e.g. for testing purposes).
+        virtual void PropagateTransforms() = 0;
+    };
+
+    using TransformHierarchyInterface = AZ::Interface<TransformHierarchyDefinition>;
+} // namespace AzFramework
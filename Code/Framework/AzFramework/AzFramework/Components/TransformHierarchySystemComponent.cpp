@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformHierarchySystemComponent.h>
+
+namespace AzFramework
+{
+    AZ_CVAR(uint32_t, bg_transformHierarchyTransformsPerJob, 512, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Minimum number of transforms in a level of the transform hierarchy to update per job before the level is split across the job system");
+
+    void TransformHierarchySystemComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<TransformHierarchySystemComponent, AZ::Component>()
+                ->Version(1);
+        }
+    }
+
+    void TransformHierarchySystemComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("TransformHierarchyService"));
+    }
+
+    void TransformHierarchySystemComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("TransformHierarchyService"));
+    }
+
+    void TransformHierarchySystemComponent::Activate()
+    {
+        TransformHierarchyInterface::Register(this);
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void TransformHierarchySystemComponent::Deactivate()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+
+        // Flush the pending changes and hand the transforms back to their components, which then update their children directly.
+        PropagateTransforms();
+        for (TransformComponent* transform : m_transforms)
+        {
+            if (transform)
+            {
+                transform->m_hierarchy = nullptr;
+                transform->m_hierarchyHandle = InvalidHandle;
+            }
+        }
+
+        m_transforms.clear();
+        m_slotToSorted.clear();
+        m_slotDirty.clear();
+        m_dirtySlots.clear();
+        m_sortedSlots.clear();
+        m_sortedParents.clear();
+        m_localTMs.clear();
+        m_worldTMs.clear();
+        m_dirty.clear();
+        m_depthOffsets.clear();
+        m_hierarchyChanged = false;
+
+        TransformHierarchyInterface::Unregister(this);
+    }
+
+    void TransformHierarchySystemComponent::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
+    {
+        PropagateTransforms();
+    }
+
+    int TransformHierarchySystemComponent::GetTickOrder()
+    {
+        return AZ::ComponentTickBus::TICK_PRE_RENDER;
+    }
+
+    TransformHierarchySystemComponent::Handle TransformHierarchySystemComponent::RegisterTransform(TransformComponent* transform)
+    {
+        const Handle handle = aznumeric_cast<Handle>(m_transforms.size());
+        m_transforms.push_back(transform);
+        m_slotDirty.push_back(0);
+        m_hierarchyChanged = true;
+        return handle;
+    }
+
+    void TransformHierarchySystemComponent::UnregisterTransform(Handle handle)
+    {
+        AZ_Assert(handle < m_transforms.size() && m_transforms[handle], "Unregistering an unknown transform from the transform hierarchy.");
+
+        // The slot is only released when the hierarchy is rebuilt, so slots are stable while notifications are being sent.
+        m_transforms[handle] = nullptr;
+        m_hierarchyChanged = true;
+    }
+
+    void TransformHierarchySystemComponent::OnParentChanged([[maybe_unused]] Handle handle)
+    {
+        AZ_Assert(handle < m_transforms.size() && m_transforms[handle], "Reparenting an unknown transform in the transform hierarchy.");
+        m_hierarchyChanged = true;
+    }
+
+    void TransformHierarchySystemComponent::MarkDirty(Handle handle)
+    {
+        AZ_Assert(handle < m_transforms.size() && m_transforms[handle], "Marking an unknown transform in the transform hierarchy as dirty.");
+        if (!m_slotDirty[handle])
+        {
+            m_slotDirty[handle] = 1;
+            m_dirtySlots.push_back(handle);
+        }
+    }
+
+    void TransformHierarchySystemComponent::PropagateTransforms()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzFramework);
+
+        if (m_isPropagating)
+        {
+            // Transforms that change while notifications are being sent are picked up by the next propagation.
+            return;
+        }
+
+        if (m_hierarchyChanged)
+        {
+            RebuildHierarchy();
+        }
+
+        if (m_dirtySlots.empty())
+        {
+            return;
+        }
+
+        // The components already updated their own transforms, only their descendants still need to be updated.
+        for (Handle slot : m_dirtySlots)
+        {
+            const TransformComponent* transform = m_transforms[slot];
+            const uint32_t sorted = m_slotToSorted[slot];
+            m_localTMs[sorted] = transform->m_localTM;
+            m_worldTMs[sorted] = transform->m_worldTM;
+            m_dirty[sorted] = 1;
+            m_slotDirty[slot] = 0;
+        }
+        m_dirtySlots.clear();
+
+        // JobContext::GetParentContext() dereferences the global job context without checking it, and applications without a
+        // job manager don't have one, so look it up through the environment first.
+        AZ::EnvironmentVariable<AZ::JobContext*> globalJobContext = AZ::Environment::FindVariable<AZ::JobContext*>("GlobalJobContext");
+        AZ::JobContext* jobContext = (globalJobContext && *globalJobContext) ? AZ::JobContext::GetParentContext() : nullptr;
+        const uint32_t jobCount = jobContext ? AZ::GetMax(jobContext->GetJobManager().GetNumWorkerThreads(), 1u) : 1;
+        const uint32_t transformsPerJob = AZ::GetMax(static_cast<uint32_t>(bg_transformHierarchyTransformsPerJob), 1u);
+
+        // Roots keep the world transform computed by their component. Every following depth only reads from the depth above it,
+        // so the transforms within a depth can be split across jobs.
+        for (size_t depth = 1; depth + 1 < m_depthOffsets.size(); ++depth)
+        {
+            const uint32_t first = m_depthOffsets[depth];
+            const uint32_t count = m_depthOffsets[depth + 1] - first;
+            const uint32_t activeJobCount = AZ::GetMin(jobCount, count / transformsPerJob);
+            if (activeJobCount > 1)
+            {
+                AZ::parallel_for(0, aznumeric_cast<int32_t>(activeJobCount),
+                    [this, first, count, activeJobCount](int32_t jobIndex)
+                    {
+                        const uint64_t rangeBegin = (uint64_t{ count } * jobIndex) / activeJobCount;
+                        const uint64_t rangeEnd = (uint64_t{ count } * (jobIndex + 1)) / activeJobCount;
+                        PropagateRange(first + aznumeric_cast<uint32_t>(rangeBegin), first + aznumeric_cast<uint32_t>(rangeEnd));
+                    });
+            }
+            else
+            {
+                PropagateRange(first, first + count);
+            }
+        }
+
+        // Write back all world transforms before notifying anyone so listeners querying other entities see the updated hierarchy.
+        m_notifySlots.clear();
+        const uint32_t sortedCount = aznumeric_cast<uint32_t>(m_sortedSlots.size());
+        for (uint32_t sorted = 0; sorted < sortedCount; ++sorted)
+        {
+            if (m_dirty[sorted])
+            {
+                m_dirty[sorted] = 0;
+                const Handle slot = m_sortedSlots[sorted];
+                m_transforms[slot]->m_worldTM = m_worldTMs[sorted];
+                m_notifySlots.push_back(slot);
+            }
+        }
+
+        // Notify in sorted order so parents are always notified before their children.
+        m_isPropagating = true;
+        for (Handle slot : m_notifySlots)
+        {
+            // Listeners may deactivate entities, which clears their slot.
+            if (TransformComponent* transform = m_transforms[slot])
+            {
+                transform->NotifyTransformChanged();
+            }
+        }
+        m_isPropagating = false;
+    }
+
+    void TransformHierarchySystemComponent::PropagateRange(uint32_t first, uint32_t last)
+    {
+        for (uint32_t sorted = first; sorted < last; ++sorted)
+        {
+            const uint32_t parent = m_sortedParents[sorted];
+            if (m_dirty[parent])
+            {
+                m_worldTMs[sorted] = m_worldTMs[parent] * m_localTMs[sorted];
+                m_dirty[sorted] = 1;
+            }
+        }
+    }
+
+    void TransformHierarchySystemComponent::RebuildHierarchy()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzFramework);
+
+        m_hierarchyChanged = false;
+
+        // Compact the slots, reassigning the handles of the transforms that moved.
+        Handle slotCount = 0;
+        for (size_t slot = 0; slot < m_transforms.size(); ++slot)
+        {
+            if (TransformComponent* transform = m_transforms[slot])
+            {
+                transform->m_hierarchyHandle = slotCount;
+                m_transforms[slotCount] = transform;
+                m_slotDirty[slotCount] = m_slotDirty[slot];
+                ++slotCount;
+            }
+        }
+        m_transforms.resize(slotCount);
+        m_slotDirty.resize(slotCount);
+
+        m_dirtySlots.clear();
+        AZStd::vector<uint32_t> parentSlots(slotCount, InvalidIndex);
+        for (Handle slot = 0; slot < slotCount; ++slot)
+        {
+            if (m_slotDirty[slot])
+            {
+                m_dirtySlots.push_back(slot);
+            }
+
+            // Parents that aren't managed by the hierarchy push their changes through the notification bus, so their children are
+            // treated as roots.
+            const TransformComponent* parent = azrtti_cast<TransformComponent*>(m_transforms[slot]->m_parentTM);
+            if (parent && parent->m_hierarchyHandle < slotCount && m_transforms[parent->m_hierarchyHandle] == parent)
+            {
+                parentSlots[slot] = parent->m_hierarchyHandle;
+            }
+        }
+
+        // Find the depth of every transform, walking up until a transform with a known depth is found.
+        AZStd::vector<uint32_t> depths(slotCount, InvalidIndex);
+        AZStd::vector<Handle> chain;
+        uint32_t maxDepth = 0;
+        for (Handle slot = 0; slot < slotCount; ++slot)
+        {
+            Handle current = slot;
+            while (depths[current] == InvalidIndex && parentSlots[current] != InvalidIndex && chain.size() < slotCount)
+            {
+                chain.push_back(current);
+                current = parentSlots[current];
+            }
+
+            if (depths[current] == InvalidIndex)
+            {
+                AZ_Assert(parentSlots[current] == InvalidIndex, "Circular dependency found in the transform hierarchy.");
+                parentSlots[current] = InvalidIndex;
+                depths[current] = 0;
+            }
+
+            uint32_t depth = depths[current];
+            while (!chain.empty())
+            {
+                depths[chain.back()] = ++depth;
+                chain.pop_back();
+            }
+            maxDepth = AZ::GetMax(maxDepth, depths[slot]);
+        }
+
+        // Counting sort by depth, which keeps the transforms within a depth in registration order.
+        m_depthOffsets.assign(maxDepth + 2, 0);
+        for (Handle slot = 0; slot < slotCount; ++slot)
+        {
+            ++m_depthOffsets[depths[slot] + 1];
+        }
+        for (size_t depth = 1; depth < m_depthOffsets.size(); ++depth)
+        {
+            m_depthOffsets[depth] += m_depthOffsets[depth - 1];
+        }
+
+        AZStd::vector<uint32_t> cursors(m_depthOffsets.begin(), m_depthOffsets.end() - 1);
+        m_sortedSlots.resize_no_construct(slotCount);
+        m_slotToSorted.resize_no_construct(slotCount);
+        for (Handle slot = 0; slot < slotCount; ++slot)
+        {
+            const uint32_t sorted = cursors[depths[slot]]++;
+            m_sortedSlots[sorted] = slot;
+            m_slotToSorted[slot] = sorted;
+        }
+
+        m_sortedParents.resize_no_construct(slotCount);
+        m_localTMs.resize_no_construct(slotCount);
+        m_worldTMs.resize_no_construct(slotCount);
+        m_dirty.assign(slotCount, 0);
+        for (uint32_t sorted = 0; sorted < slotCount; ++sorted)
+        {
+            const Handle slot = m_sortedSlots[sorted];
+            const TransformComponent* transform = m_transforms[slot];
+            m_sortedParents[sorted] = parentSlots[slot] != InvalidIndex ? m_slotToSorted[parentSlots[slot]] : InvalidIndex;
+            m_localTMs[sorted] = transform->m_localTM;
+            m_worldTMs[sorted] = transform->m_worldTM;
+        }
+    }
+} // namespace AzFramework
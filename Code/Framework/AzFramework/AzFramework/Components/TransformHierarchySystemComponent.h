@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Components/TransformHierarchyInterface.h>
+
+namespace AzFramework
+{
+    //! Optional system component that propagates world transforms through the transform hierarchy in batches.
+    //! Local and world transforms are kept in contiguous arrays sorted by hierarchy depth, so every level of the hierarchy can be
+    //! updated in parallel after the level above it has been completed. Transforms that changed are only marked dirty when they
+    //! change and their subtrees are recomputed once per tick, after which every changed entity is notified once in
+    //! parent-to-child order.
+    //! @note Until the hierarchy has been propagated the world transforms of the descendants of a moved entity still hold the
+    //!       values from the last propagation.
+    class TransformHierarchySystemComponent
+        : public AZ::Component
+        , public TransformHierarchyDefinition
+        , public AZ::TickBus::Handler
+    {
+    public:
+        AZ_COMPONENT(TransformHierarchySystemComponent, "{0E1B6C2D-8E7A-4A57-B3F4-94D26A1C5B08}", TransformHierarchyDefinition);
+
+        TransformHierarchySystemComponent() = default;
+        TransformHierarchySystemComponent(const TransformHierarchySystemComponent&) = delete;
+        TransformHierarchySystemComponent& operator=(const TransformHierarchySystemComponent&) = delete;
+        ~TransformHierarchySystemComponent() override = default;
+
+        static void Reflect(AZ::ReflectContext* context);
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        // TransformHierarchyDefinition overrides ...
+        Handle RegisterTransform(TransformComponent* transform) override;
+        void UnregisterTransform(Handle handle) override;
+        void OnParentChanged(Handle handle) override;
+        void MarkDirty(Handle handle) override;
+        void PropagateTransforms() override;
+
+    protected:
+        // Component overrides ...
+        void Activate() override;
+        void Deactivate() override;
+
+        // TickBus overrides ...
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+
+    private:
+        static constexpr uint32_t InvalidIndex = AZStd::numeric_limits<uint32_t>::max();
+
+        //! Removes the unregistered slots, sorts the transforms by depth and reloads all transforms into the sorted arrays.
+        void RebuildHierarchy();
+        //! Recomputes the world transforms in the range [first, last) of the sorted arrays whose parent has changed.
+        void PropagateRange(uint32_t first, uint32_t last);
+
+        // Per slot data, indexed by the handles given out to the transform components.
+        AZStd::vector<TransformComponent*> m_transforms; //!< Registered transforms, or null if the slot was unregistered.
+        AZStd::vector<uint32_t> m_slotToSorted; //!< Position of the slot in the sorted arrays.
+        AZStd::vector<uint8_t> m_slotDirty; //!< Whether the slot is already in the dirty list.
+        AZStd::vector<Handle> m_dirtySlots; //!< Slots that changed since the last propagation.
+
+        // Data sorted by hierarchy depth so every parent is stored before its children.
+        AZStd::vector<Handle> m_sortedSlots; //!< Slot of each sorted transform.
+        AZStd::vector<uint32_t> m_sortedParents; //!< Sorted index of the parent or InvalidIndex if the transform is a root.
+        AZStd::vector<AZ::Transform> m_localTMs;
+        AZStd::vector<AZ::Transform> m_worldTMs;
+        AZStd::vector<uint8_t> m_dirty; //!< Whether the world transform has changed in the current propagation.
+        AZStd::vector<uint32_t> m_depthOffsets; //!< Start of every depth in the sorted arrays, followed by the total count.
+
+        AZStd::vector<Handle> m_notifySlots; //!< Scratch list of the slots to notify after a propagation.
+
+        bool m_hierarchyChanged = false;
+        bool m_isPropagating = false;
+    };
+} // namespace AzFramework
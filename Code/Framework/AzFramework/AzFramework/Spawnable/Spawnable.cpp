@@ -8,6 +8,8 @@
 
 #include <AzCore/RTTI/ReflectContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 
 namespace AzFramework
@@ -32,6 +34,30 @@ namespace AzFramework
         return m_entities.empty();
     }
 
+    auto Spawnable::GetClonePrograms(AZ::SerializeContext& serializeContext) const -> AZStd::shared_ptr<const CloneProgramList>
+    {
+        AZStd::scoped_lock lock(m_cloneProgramsMutex);
+        // The size check catches entities that were added or removed without invalidating the programs, so that spawning
+        // can always index the programs by entity.
+        if (!m_clonePrograms || m_clonePrograms->size() != m_entities.size())
+        {
+            AZStd::shared_ptr<CloneProgramList> clonePrograms = AZStd::make_shared<CloneProgramList>();
+            clonePrograms->reserve(m_entities.size());
+            for (const AZStd::unique_ptr<AZ::Entity>& entity : m_entities)
+            {
+                clonePrograms->push_back(EntityCloneProgram::Compile(*entity, serializeContext));
+            }
+            m_clonePrograms = AZStd::move(clonePrograms);
+        }
+        return m_clonePrograms;
+    }
+
+    void Spawnable::InvalidateClonePrograms()
+    {
+        AZStd::scoped_lock lock(m_cloneProgramsMutex);
+        m_clonePrograms.reset();
+    }
+
     SpawnableMetaData& Spawnable::GetMetaData()
     {
         return m_metaData;
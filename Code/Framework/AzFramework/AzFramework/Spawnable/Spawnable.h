@@ -12,12 +12,16 @@
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzFramework/Spawnable/SpawnableEntityCloneProgram.h>
 #include <AzFramework/Spawnable/SpawnableMetaData.h>
 
 namespace AZ
 {
     class ReflectContext;
+    class SerializeContext;
 }
 
 namespace AzFramework
@@ -30,6 +34,7 @@ namespace AzFramework
         AZ_RTTI(AzFramework::Spawnable, "{855E3021-D305-4845-B284-20C3F7FDF16B}", AZ::Data::AssetData);
 
         using EntityList = AZStd::vector<AZStd::unique_ptr<AZ::Entity>>;
+        using CloneProgramList = AZStd::vector<EntityCloneProgram>;
 
         inline static constexpr const char* FileExtension = "spawnable";
         inline static constexpr const char* DotFileExtension = ".spawnable";
@@ -44,9 +49,19 @@ namespace AzFramework
         Spawnable& operator=(Spawnable&& other) = delete;
 
         const EntityList& GetEntities() const;
+        //! Returns the entities for modification. Call InvalidateClonePrograms after modifying the entities of a spawnable
+        //! that may already have been spawned from.
         EntityList& GetEntities();
         bool IsEmpty() const;
 
+        //! Returns the clone programs for the entities in this spawnable, in the same order as the entities.
+        //! The programs are compiled on first use and reused for every spawn after that. The returned list is never
+        //! modified, so it stays valid for the caller even if the programs are invalidated in the meantime.
+        AZStd::shared_ptr<const CloneProgramList> GetClonePrograms(AZ::SerializeContext& serializeContext) const;
+
+        //! Discards the clone programs so they'll be rebuilt for the updated entities on the next spawn.
+        void InvalidateClonePrograms();
+
         SpawnableMetaData& GetMetaData();
         const SpawnableMetaData& GetMetaData() const;
 
@@ -58,6 +73,10 @@ namespace AzFramework
         // Container for keeping all entities of the prefab the Spawnable was created from.
         // Includes both direct and nested entities of the prefab.
         EntityList m_entities;
+
+        // Lazily compiled instructions for cloning the entities without walking their full reflection tree.
+        mutable AZStd::shared_ptr<const CloneProgramList> m_clonePrograms;
+        mutable AZStd::mutex m_cloneProgramsMutex;
     };
 
     using SpawnableList = AZStd::vector<Spawnable>;
@@ -243,9 +243,14 @@ namespace AzFramework
         }
     }
 
-    AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(const AZ::Entity& entityTemplate,
+    AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(const AZ::Entity& entityTemplate, const EntityCloneProgram& cloneProgram,
         EntityIdMap& templateToCloneMap, AZ::SerializeContext& serializeContext)
     {
+        if (cloneProgram.IsCompiled())
+        {
+            return cloneProgram.Run(entityTemplate, templateToCloneMap, serializeContext);
+        }
+
         // If the same ID gets remapped more than once, preserve the original remapping instead of overwriting it.
         constexpr bool allowDuplicateIds = false;
 
@@ -299,7 +304,11 @@ namespace AzFramework
             size_t spawnedEntitiesInitialCount = spawnedEntities.size();
 
             // These are 'template' entities we'll be cloning from
-            const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
+            const Spawnable& spawnable = *ticket.m_spawnable;
+            const Spawnable::EntityList& entitiesToSpawn = spawnable.GetEntities();
+            // Hold on to the programs for the duration of the spawn, in case they get invalidated on another thread.
+            const AZStd::shared_ptr<const Spawnable::CloneProgramList> clonePrograms =
+                spawnable.GetClonePrograms(*request.m_serializeContext);
             size_t entitiesToSpawnSize = entitiesToSpawn.size();
 
             // Reserve buffers
@@ -319,7 +328,8 @@ namespace AzFramework
                 // If this entity has previously been spawned, give it a new id in the reference map
                 RefreshEntityIdMapping(entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                AZ::Entity* clone = CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                AZ::Entity* clone = CloneSingleEntity(
+                    *entitiesToSpawn[i], (*clonePrograms)[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                 AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
 
                 spawnedEntities.emplace_back(clone);
@@ -373,7 +383,10 @@ namespace AzFramework
             size_t spawnedEntitiesInitialCount = spawnedEntities.size();
 
             // These are 'template' entities we'll be cloning from
-            const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
+            const Spawnable& spawnable = *ticket.m_spawnable;
+            const Spawnable::EntityList& entitiesToSpawn = spawnable.GetEntities();
+            const AZStd::shared_ptr<const Spawnable::CloneProgramList> clonePrograms =
+                spawnable.GetClonePrograms(*request.m_serializeContext);
             size_t entitiesToSpawnSize = request.m_entityIndices.size();
 
             if (ticket.m_entityIdReferenceMap.empty() || !request.m_referencePreviouslySpawnedEntities)
@@ -400,8 +413,8 @@ namespace AzFramework
                     RefreshEntityIdMapping(
                         entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                    AZ::Entity* clone =
-                        CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                    AZ::Entity* clone = CloneSingleEntity(
+                        *entitiesToSpawn[index], (*clonePrograms)[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                     AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
 
                     spawnedEntities.push_back(clone);
@@ -489,7 +502,10 @@ namespace AzFramework
 
             // Rebuild the list of entities.
             ticket.m_spawnedEntities.clear();
-            const Spawnable::EntityList& entities = request.m_spawnable->GetEntities();
+            const Spawnable& spawnable = *request.m_spawnable;
+            const Spawnable::EntityList& entities = spawnable.GetEntities();
+            const AZStd::shared_ptr<const Spawnable::CloneProgramList> clonePrograms =
+                spawnable.GetClonePrograms(*request.m_serializeContext);
 
             // Pre-generate the full set of entity id to new entity id mappings, so that during the clone operation below,
             // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
@@ -509,7 +525,8 @@ namespace AzFramework
                     // If this entity has previously been spawned, give it a new id in the reference map
                     RefreshEntityIdMapping(entities[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                    AZ::Entity* clone = CloneSingleEntity(*entities[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                    AZ::Entity* clone =
+                        CloneSingleEntity(*entities[i], (*clonePrograms)[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                     AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
 
                     ticket.m_spawnedEntities.push_back(clone);
@@ -530,7 +547,8 @@ namespace AzFramework
                         // If this entity has previously been spawned, give it a new id in the reference map
                         RefreshEntityIdMapping(entities[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                        AZ::Entity* clone = CloneSingleEntity(*entities[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                        AZ::Entity* clone = CloneSingleEntity(
+                            *entities[index], (*clonePrograms)[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                         AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
                         ticket.m_spawnedEntities.push_back(clone);
                     }
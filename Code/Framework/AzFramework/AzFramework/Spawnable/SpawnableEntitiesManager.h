@@ -194,7 +194,8 @@ namespace AzFramework
         CommandQueueStatus ProcessQueue(Queue& queue);
 
         AZ::Entity* CloneSingleEntity(
-            const AZ::Entity& entityTemplate, EntityIdMap& templateToCloneMap, AZ::SerializeContext& serializeContext);
+            const AZ::Entity& entityTemplate, const EntityCloneProgram& cloneProgram, EntityIdMap& templateToCloneMap,
+            AZ::SerializeContext& serializeContext);
         
         bool ProcessRequest(SpawnAllEntitiesCommand& request);
         bool ProcessRequest(SpawnEntitiesCommand& request);
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzFramework/Spawnable/SpawnableEntityCloneProgram.h>
+
+namespace AzFramework
+{
+    EntityCloneProgram EntityCloneProgram::Compile(const AZ::Entity& entityTemplate, AZ::SerializeContext& serializeContext)
+    {
+        struct Frame
+        {
+            const char* m_rootAddress;
+            size_t m_rootIndex;
+            bool m_isInline; //!< True if the element is stored directly in the entity or component, so at the same offset in every clone.
+        };
+
+        const AZ::Entity::ComponentArrayType& components = entityTemplate.GetComponents();
+        const AZ::Uuid& entityIdType = AZ::SerializeTypeInfo<AZ::EntityId>::GetUuid();
+
+        EntityCloneProgram program;
+        bool isCompilable = true;
+        AZStd::vector<Frame> stack;
+        stack.reserve(30);
+
+        auto beginCB = [&](void* ptr, const AZ::SerializeContext::ClassData* classData,
+                           const AZ::SerializeContext::ClassElement* elementData) -> bool
+        {
+            // The remapper enumerates for write, which calls the event handlers. Skipping them could change behavior.
+            if (classData->m_eventHandler)
+            {
+                isCompilable = false;
+            }
+
+            Frame frame = stack.empty() ? Frame{ reinterpret_cast<const char*>(&entityTemplate), EntityRoot, true } : stack.back();
+            if (elementData && (elementData->m_flags & AZ::SerializeContext::ClassElement::FLG_POINTER))
+            {
+                const void* object = *reinterpret_cast<void* const*>(ptr);
+                auto componentIt = AZStd::find(components.begin(), components.end(), object);
+                if (componentIt != components.end())
+                {
+                    // Components are separate allocations, so offsets restart from the component.
+                    frame = Frame{ reinterpret_cast<const char*>(object),
+                        static_cast<size_t>(AZStd::distance(components.begin(), componentIt)), true };
+                }
+                else
+                {
+                    frame.m_isInline = false;
+                }
+            }
+
+            if (classData->m_typeId == entityIdType)
+            {
+                if (frame.m_isInline)
+                {
+                    IdPatch patch{ reinterpret_cast<const char*>(ptr) - frame.m_rootAddress, frame.m_rootIndex };
+
+                    AZ::AttributeFunction<AZ::EntityId()>* generator = nullptr;
+                    if (elementData)
+                    {
+                        AZ::Attribute* attribute = AZ::FindAttribute(AZ::Edit::Attributes::IdGeneratorFunction, elementData->m_attributes);
+                        generator = azrtti_cast<AZ::AttributeFunction<AZ::EntityId()>*>(attribute);
+                    }
+
+                    if (generator)
+                    {
+                        program.m_generatedIds.push_back(GeneratedIdPatch{ patch, generator });
+                    }
+                    else
+                    {
+                        program.m_referencedIds.push_back(patch);
+                    }
+                }
+                else
+                {
+                    isCompilable = false;
+                }
+            }
+
+            if (classData->m_container)
+            {
+                // Container elements are stored separately and may be ordered by their value.
+                frame.m_isInline = false;
+            }
+
+            stack.push_back(frame);
+            return true;
+        };
+
+        auto endCB = [&]() -> bool
+        {
+            stack.pop_back();
+            return true;
+        };
+
+        serializeContext.EnumerateInstanceConst(
+            &entityTemplate, AZ::SerializeTypeInfo<AZ::Entity>::GetUuid(&entityTemplate), beginCB, endCB,
+            AZ::SerializeContext::ENUM_ACCESS_FOR_READ, nullptr, nullptr);
+
+        if (!isCompilable)
+        {
+            return EntityCloneProgram();
+        }
+
+        program.m_isCompiled = true;
+        return program;
+    }
+
+    bool EntityCloneProgram::IsCompiled() const
+    {
+        return m_isCompiled;
+    }
+
+    AZ::Entity* EntityCloneProgram::Run(
+        const AZ::Entity& entityTemplate, EntityIdMap& templateToCloneMap, AZ::SerializeContext& serializeContext) const
+    {
+        AZ_Assert(m_isCompiled, "Running a clone program that wasn't successfully compiled.");
+
+        AZ::Entity* clone = serializeContext.CloneObject(&entityTemplate);
+        if (!clone)
+        {
+            return nullptr;
+        }
+        AZ_Assert(clone->GetComponents().size() == entityTemplate.GetComponents().size(),
+            "Clone of entity '%s' has a different number of components than its template.", entityTemplate.GetName().c_str());
+
+        // Same order and policy as the remapper: first generate the new ids, keeping any mapping that already exists,
+        // then fix up the references.
+        for (const GeneratedIdPatch& generatedId : m_generatedIds)
+        {
+            AZ::EntityId* id = ResolvePatch(generatedId.m_patch, *clone);
+            *id = templateToCloneMap.emplace(*id, generatedId.m_generator->Invoke(nullptr)).first->second;
+        }
+
+        for (const IdPatch& referencedId : m_referencedIds)
+        {
+            AZ::EntityId* id = ResolvePatch(referencedId, *clone);
+            auto it = templateToCloneMap.find(*id);
+            if (it != templateToCloneMap.end())
+            {
+                *id = it->second;
+            }
+        }
+
+        return clone;
+    }
+
+    AZ::EntityId* EntityCloneProgram::ResolvePatch(const IdPatch& patch, AZ::Entity& clone)
+    {
+        char* root = patch.m_rootIndex == EntityRoot
+            ? reinterpret_cast<char*>(&clone)
+            : reinterpret_cast<char*>(clone.GetComponents()[patch.m_rootIndex]);
+        return reinterpret_cast<AZ::EntityId*>(root + patch.m_offset);
+    }
+} // namespace AzFramework
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/RTTI/ReflectContext.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+
+namespace AZ
+{
+    class Entity;
+    class SerializeContext;
+}
+
+namespace AzFramework
+{
+    //! Precompiled instructions for cloning a single template entity of a Spawnable and fixing up its entity ids.
+    //! Cloning an entity with AZ::IdUtils::Remapper walks the reflection tree three times: once to copy the entity and
+    //! twice more to find the entity ids to replace and the entity ids references to fix. The clone program records where
+    //! those entity ids live the first time the template is seen, so later clones only need the copy walk after which the
+    //! ids are patched directly through their recorded offsets.
+    //! Only ids stored inline in the entity or in one of its components can be patched this way, because those are at the
+    //! same offset in every clone. Templates with ids in containers, behind pointers or in classes that listen to
+    //! serialization events aren't compiled and are cloned through the remapper instead.
+    class EntityCloneProgram final
+    {
+    public:
+        using EntityIdMap = AZStd::unordered_map<AZ::EntityId, AZ::EntityId>;
+
+        //! Builds the clone program for the provided template entity.
+        static EntityCloneProgram Compile(const AZ::Entity& entityTemplate, AZ::SerializeContext& serializeContext);
+
+        //! Returns true if the template can be cloned with this program, otherwise the remapper has to be used.
+        bool IsCompiled() const;
+
+        //! Clones the template entity this program was compiled for, generates new ids for the entity ids it owns and fixes up
+        //! the references to other entities using the provided map, with the same results as
+        //! Remapper::CloneObjectAndGenerateNewIdsAndFixRefs.
+        AZ::Entity* Run(const AZ::Entity& entityTemplate, EntityIdMap& templateToCloneMap, AZ::SerializeContext& serializeContext) const;
+
+    private:
+        static constexpr size_t EntityRoot = AZStd::numeric_limits<size_t>::max();
+
+        //! Location of an entity id relative to the entity or one of its components.
+        struct IdPatch
+        {
+            ptrdiff_t m_offset;
+            size_t m_rootIndex; //!< Index of the component holding the id or EntityRoot if the id is a member of the entity.
+        };
+        //! Location of an entity id that gets a newly generated id, typically the id of the entity itself.
+        struct GeneratedIdPatch
+        {
+            IdPatch m_patch;
+            AZ::AttributeFunction<AZ::EntityId()>* m_generator;
+        };
+
+        static AZ::EntityId* ResolvePatch(const IdPatch& patch, AZ::Entity& clone);
+
+        AZStd::vector<GeneratedIdPatch> m_generatedIds;
+        AZStd::vector<IdPatch> m_referencedIds;
+        bool m_isCompiled{ false };
+    };
+} // namespace AzFramework
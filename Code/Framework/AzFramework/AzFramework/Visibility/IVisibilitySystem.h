@@ -60,6 +60,15 @@ namespace AzFramework
         };
         using EnumerateCallback = AZStd::function<void(const NodeData&)>;
 
+        //! A copyable version of NodeData, used to store enumeration results in contiguous buckets.
+        struct EnumeratedNodeData
+        {
+            AZ::Aabb m_bounds;
+            const AZStd::vector<VisibilityEntry*>* m_entries = nullptr;
+        };
+        using NodeDataBucket = AZStd::vector<EnumeratedNodeData>;
+        using NodeDataBuckets = AZStd::vector<NodeDataBucket>;
+
         //! Get the unique scene name, used to look up the scene in the IVisibilitySystem. Duplicate names will assert on creation.
         virtual const AZ::Name& GetName() const = 0;
 
@@ -94,6 +103,13 @@ namespace AzFramework
         //! @return the intersection result of the frustum against the visibility system
         virtual void Enumerate(const AZ::Frustum& frustum, const EnumerateCallback& callback) const = 0;
 
+        //! Intersects a frustum against the visibility system, splitting the traversal across the job system.
+        //! Rather than invoking a callback, each job appends the visible nodes it finds to its own contiguous bucket.
+        //! The returned NodeData reference the scene's internal storage and are only valid until the scene is next modified.
+        //! @param frustum the frustum to test against
+        //! @param buckets receives one bucket of visible nodes per job, existing buckets are cleared and reused to avoid reallocating
+        virtual void EnumerateParallel(const AZ::Frustum& frustum, NodeDataBuckets& buckets) const = 0;
+
         //! Enumerate *all* OctreeNodes that have any entries in them (without any culling).
         //! @param callback the callback to invoke when a node is visible
         virtual void EnumerateNoCull(const EnumerateCallback& callback) const = 0;
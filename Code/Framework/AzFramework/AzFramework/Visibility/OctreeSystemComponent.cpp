@@ -7,7 +7,13 @@
  */
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Module/Environment.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
 namespace AzFramework
@@ -16,18 +22,23 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,       64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,       32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(float,    bg_octreeLooseness,          1.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Scale applied to the bounds of each octree node when fitting entries, values greater than 1 create a loose octree");
+    AZ_CVAR(uint32_t, bg_octreeSubtreesPerJob,        4, nullptr, AZ::ConsoleFunctorFlags::Null, "Number of visible subtrees to gather per job before splitting a parallel enumeration across the job system");
 
 
+    static constexpr uint32_t MaxChildNodeCount = 8;
+
     static uint32_t GetChildNodeCount()
     {
         constexpr uint32_t QuadtreeNodeChildCount = 4;
-        constexpr uint32_t OctreeNodeChildCount   = 8;
+        constexpr uint32_t OctreeNodeChildCount   = MaxChildNodeCount;
         return (bg_octreeUseQuadtree) ? QuadtreeNodeChildCount : OctreeNodeChildCount;
     }
 
 
     OctreeNode::OctreeNode(const AZ::Aabb& bounds)
         : m_bounds(bounds)
+        , m_looseBounds(bounds)
     {
         ;
     }
@@ -35,6 +46,7 @@ namespace AzFramework
 
     OctreeNode::OctreeNode(OctreeNode&& rhs)
         : m_bounds(rhs.m_bounds)
+        , m_looseBounds(rhs.m_looseBounds)
         , m_parent(rhs.m_parent)
         , m_children(rhs.m_children)
         , m_entries(AZStd::move(rhs.m_entries))
@@ -50,6 +62,7 @@ namespace AzFramework
     OctreeNode& OctreeNode::operator=(OctreeNode&& rhs)
     {
         m_bounds = rhs.m_bounds;
+        m_looseBounds = rhs.m_looseBounds;
         m_parent = rhs.m_parent;
         m_children = rhs.m_children;
         m_entries = AZStd::move(rhs.m_entries);
@@ -68,17 +81,26 @@ namespace AzFramework
     {
         AZ_Assert(entry->m_internalNode == nullptr, "Double-insertion: Insert invoked for an entry already bound to the OctreeScene");
 
-        // If this is not a leaf node, try to insert into the child nodes
+        // If this is not a leaf node, try to insert into the child node containing the center of the entry
+        // The child nodes only overlap when the octree is loose, so the center is enough to select the only candidate
         if (m_children != nullptr)
         {
             const AZ::Aabb boundingVolume = entry->m_boundingVolume;
-            const uint32_t childCount = GetChildNodeCount();
-            for (uint32_t child = 0; child < childCount; ++child)
+            const AZ::Vector3 entryCenter = boundingVolume.GetCenter();
+            const AZ::Vector3 nodeCenter = m_bounds.GetCenter();
+
+            // This matches the child ordering used by Split
+            uint32_t child = 0;
+            child |= (entryCenter.GetX() >= nodeCenter.GetX()) ? 0x01 : 0;
+            child |= (entryCenter.GetY() >= nodeCenter.GetY()) ? 0x02 : 0;
+            if (GetChildNodeCount() > 4)
             {
-                if (AZ::ShapeIntersection::Contains(m_children[child].m_bounds, boundingVolume))
-                {
-                    return m_children[child].Insert(octreeScene, entry);
-                }
+                child |= (entryCenter.GetZ() >= nodeCenter.GetZ()) ? 0x04 : 0;
+            }
+
+            if (AZ::ShapeIntersection::Contains(m_children[child].m_looseBounds, boundingVolume))
+            {
+                return m_children[child].Insert(octreeScene, entry);
             }
         }
 
@@ -104,7 +126,7 @@ namespace AzFramework
         AZ_Assert(entry->m_internalNode == this, "Update invoked for an entry bound to a different OctreeNode");
 
         const AZ::Aabb boundingVolume = entry->m_boundingVolume;
-        if (IsLeaf() && AZ::ShapeIntersection::Contains(m_bounds, boundingVolume))
+        if (IsLeaf() && AZ::ShapeIntersection::Contains(m_looseBounds, boundingVolume))
         {
             // Entry moved, but is still fully contained within the current node
             // We can only do this for leaf nodes, otherwise entries can get 'stuck' in non-leaf nodes
@@ -120,7 +142,7 @@ namespace AzFramework
         OctreeNode* insertCheck = this;
         while (insertCheck != nullptr)
         {
-            if (AZ::ShapeIntersection::Contains(insertCheck->m_bounds, boundingVolume) || !insertCheck->m_parent)
+            if (AZ::ShapeIntersection::Contains(insertCheck->m_looseBounds, boundingVolume) || !insertCheck->m_parent)
             {
                 // Insert here if the entry is fully contained or if we've reached the root node
                 return insertCheck->Insert(octreeScene, entry);
@@ -155,19 +177,28 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        EnumerateHelper(aabb, callback);
+        if (AZ::ShapeIntersection::Overlaps(aabb, m_looseBounds))
+        {
+            EnumerateHelper(aabb, callback);
+        }
     }
 
 
     void OctreeNode::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        EnumerateHelper(sphere, callback);
+        if (AZ::ShapeIntersection::Overlaps(sphere, m_looseBounds))
+        {
+            EnumerateHelper(sphere, callback);
+        }
     }
 
 
     void OctreeNode::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        EnumerateHelper(frustum, callback);
+        if (AZ::ShapeIntersection::Overlaps(frustum, m_looseBounds))
+        {
+            EnumerateHelper(frustum, callback);
+        }
     }
 
 
@@ -176,7 +207,7 @@ namespace AzFramework
         // Invoke the callback for the current node
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback({m_looseBounds, m_entries});
         }
 
         if (m_children != nullptr)
@@ -237,24 +268,24 @@ namespace AzFramework
     }
 
 
-    template <typename T>
-    void OctreeNode::EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const
+    template <typename T, typename Callback>
+    void OctreeNode::EnumerateHelper(const T& boundingVolume, const Callback& callback) const
     {
-        AZ_Assert(AZ::ShapeIntersection::Overlaps(boundingVolume, m_bounds), "EnumerateHelper invoked on an octreeSystemComponent node that is not within the bounding volume");
-
         // Invoke the callback for the current node
+        // The loose bounds are reported since entries may extend past the split bounds of the node
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback({m_looseBounds, m_entries});
         }
 
         if (m_children != nullptr)
         {
-            // If this is not a leaf node, recurse into the children
+            // If this is not a leaf node, recurse into the children that overlap the bounding volume
+            const uint32_t overlappingChildren = GetOverlappingChildren(boundingVolume);
             const uint32_t childCount = GetChildNodeCount();
             for (uint32_t child = 0; child < childCount; ++child)
             {
-                if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_bounds))
+                if (overlappingChildren & (1 << child))
                 {
                     m_children[child].EnumerateHelper(boundingVolume, callback);
                 }
@@ -263,6 +294,92 @@ namespace AzFramework
     }
 
 
+    template <typename T>
+    uint32_t OctreeNode::GetOverlappingChildren(const T& boundingVolume) const
+    {
+        uint32_t overlappingChildren = 0;
+        const uint32_t childCount = GetChildNodeCount();
+        for (uint32_t child = 0; child < childCount; ++child)
+        {
+            if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_looseBounds))
+            {
+                overlappingChildren |= (1 << child);
+            }
+        }
+        return overlappingChildren;
+    }
+
+
+    uint32_t OctreeNode::GetOverlappingChildren(const AZ::Frustum& frustum) const
+    {
+        using namespace AZ::Simd;
+
+        // Transpose the child bounds into center and extent arrays so that four children can be tested against a plane at once
+        // In quadtree mode the unused lanes repeat the first child, they are discarded when building the result mask
+        alignas(16) float centers[3][MaxChildNodeCount];
+        alignas(16) float extents[3][MaxChildNodeCount];
+        const uint32_t childCount = GetChildNodeCount();
+        for (uint32_t child = 0; child < MaxChildNodeCount; ++child)
+        {
+            const AZ::Aabb& childBounds = m_children[(child < childCount) ? child : 0].m_looseBounds;
+
+            // See ShapeIntersection::Overlaps(Frustum, Aabb), the extents are scaled before subtracting to avoid overflowing with FLT_MAX bounds
+            const AZ::Vector3 childCenter = childBounds.GetCenter();
+            const AZ::Vector3 childExtents = (0.5f * childBounds.GetMax()) - (0.5f * childBounds.GetMin());
+            centers[0][child] = childCenter.GetX();
+            centers[1][child] = childCenter.GetY();
+            centers[2][child] = childCenter.GetZ();
+            extents[0][child] = childExtents.GetX();
+            extents[1][child] = childExtents.GetY();
+            extents[2][child] = childExtents.GetZ();
+        }
+
+        constexpr uint32_t LaneGroupCount = MaxChildNodeCount / 4;
+        Vec4::FloatType outside[LaneGroupCount] = { Vec4::ZeroFloat(), Vec4::ZeroFloat() };
+        for (AZ::Frustum::PlaneId planeId = AZ::Frustum::PlaneId::Near; planeId < AZ::Frustum::PlaneId::MAX; ++planeId)
+        {
+            // The same test as ShapeIntersection::Overlaps(Frustum, Aabb), a child is outside if the plane distance of its center
+            // plus the projection of its extents onto the plane normal is not positive
+            const AZ::Vector4 plane = frustum.GetPlane(planeId).GetPlaneEquationCoefficients();
+            const Vec4::FloatType normalX = Vec4::Splat(plane.GetX());
+            const Vec4::FloatType normalY = Vec4::Splat(plane.GetY());
+            const Vec4::FloatType normalZ = Vec4::Splat(plane.GetZ());
+            const Vec4::FloatType distance = Vec4::Splat(plane.GetW());
+            const Vec4::FloatType absNormalX = Vec4::Abs(normalX);
+            const Vec4::FloatType absNormalY = Vec4::Abs(normalY);
+            const Vec4::FloatType absNormalZ = Vec4::Abs(normalZ);
+
+            for (uint32_t group = 0; group < LaneGroupCount; ++group)
+            {
+                const uint32_t offset = group * 4;
+                Vec4::FloatType result = Vec4::Madd(normalX, Vec4::LoadAligned(&centers[0][offset]), distance);
+                result = Vec4::Madd(normalY, Vec4::LoadAligned(&centers[1][offset]), result);
+                result = Vec4::Madd(normalZ, Vec4::LoadAligned(&centers[2][offset]), result);
+                result = Vec4::Madd(absNormalX, Vec4::LoadAligned(&extents[0][offset]), result);
+                result = Vec4::Madd(absNormalY, Vec4::LoadAligned(&extents[1][offset]), result);
+                result = Vec4::Madd(absNormalZ, Vec4::LoadAligned(&extents[2][offset]), result);
+                outside[group] = Vec4::Or(outside[group], Vec4::CmpLtEq(result, Vec4::ZeroFloat()));
+            }
+        }
+
+        alignas(16) int32_t outsideMask[MaxChildNodeCount];
+        for (uint32_t group = 0; group < LaneGroupCount; ++group)
+        {
+            Vec4::StoreAligned(&outsideMask[group * 4], Vec4::CastToInt(outside[group]));
+        }
+
+        uint32_t overlappingChildren = 0;
+        for (uint32_t child = 0; child < childCount; ++child)
+        {
+            if (outsideMask[child] == 0)
+            {
+                overlappingChildren |= (1 << child);
+            }
+        }
+        return overlappingChildren;
+    }
+
+
     void OctreeNode::Split(OctreeScene& octreeScene)
     {
         AZ_Assert(m_children == nullptr, "Split invoked on an octreeScene node that has already been split");
@@ -298,6 +415,8 @@ namespace AzFramework
                 }
 
                 m_children[child].m_bounds = childBound.GetTranslated(childOffset);
+                m_children[child].m_looseBounds = m_children[child].m_bounds;
+                m_children[child].m_looseBounds.Expand(childExtent * (octreeScene.GetLooseness() - 1.0f) * 0.5f);
                 m_children[child].m_parent = this;
             }
         }
@@ -338,6 +457,7 @@ namespace AzFramework
     OctreeScene::OctreeScene(const AZ::Name& sceneName)
         : m_sceneName(sceneName)
         , m_root(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-bg_octreeMaxWorldExtents), AZ::Vector3(bg_octreeMaxWorldExtents)))
+        , m_looseness(AZ::GetMax(static_cast<float>(bg_octreeLooseness), 1.0f))
     {
         AZ_Assert(!sceneName.IsEmpty(), "sceneName must be a valid string");
     }
@@ -404,6 +524,87 @@ namespace AzFramework
     }
 
 
+    void OctreeScene::EnumerateParallel(const AZ::Frustum& frustum, IVisibilityScene::NodeDataBuckets& buckets) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzFramework);
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+
+        // JobContext::GetParentContext() dereferences the global job context without checking it, so look it up through the environment
+        // first; applications (and tests) without a job manager don't have one
+        AZ::EnvironmentVariable<AZ::JobContext*> globalJobContext = AZ::Environment::FindVariable<AZ::JobContext*>("GlobalJobContext");
+        AZ::JobContext* jobContext = (globalJobContext && *globalJobContext) ? AZ::JobContext::GetParentContext() : nullptr;
+        const uint32_t jobCount = jobContext ? AZ::GetMax(jobContext->GetJobManager().GetNumWorkerThreads(), 1u) : 1;
+
+        buckets.resize(jobCount);
+        for (IVisibilityScene::NodeDataBucket& bucket : buckets)
+        {
+            bucket.clear();
+        }
+
+        if (!AZ::ShapeIntersection::Overlaps(frustum, m_root.m_looseBounds))
+        {
+            return;
+        }
+
+        // Walk the top of the tree breadth first on the calling thread until there are enough visible subtrees to give each job several
+        // Nodes visited here go into the first bucket, the first job appends to that bucket once the walk is complete
+        const size_t targetSubtreeCount = jobCount * AZ::GetMax(static_cast<uint32_t>(bg_octreeSubtreesPerJob), 1u);
+        AZStd::vector<const OctreeNode*> subtrees;
+        subtrees.push_back(&m_root);
+        size_t nextSubtree = 0;
+        while ((jobCount > 1) && (nextSubtree < subtrees.size()) && (subtrees.size() - nextSubtree < targetSubtreeCount))
+        {
+            const OctreeNode* node = subtrees[nextSubtree++];
+            if (!node->m_entries.empty())
+            {
+                buckets[0].push_back({ node->m_looseBounds, &node->m_entries });
+            }
+
+            if (node->m_children != nullptr)
+            {
+                const uint32_t overlappingChildren = node->GetOverlappingChildren(frustum);
+                const uint32_t childCount = GetChildNodeCount();
+                for (uint32_t child = 0; child < childCount; ++child)
+                {
+                    if (overlappingChildren & (1 << child))
+                    {
+                        subtrees.push_back(&node->m_children[child]);
+                    }
+                }
+            }
+        }
+
+        // Split the remaining subtrees into contiguous ranges, one per job, so each bucket is only ever written by a single job
+        const size_t remainingSubtreeCount = subtrees.size() - nextSubtree;
+        const uint32_t activeJobCount = aznumeric_cast<uint32_t>(AZ::GetMin<size_t>(jobCount, remainingSubtreeCount));
+        auto enumerateSubtrees = [&](int32_t jobIndex)
+        {
+            IVisibilityScene::NodeDataBucket& bucket = buckets[jobIndex];
+            auto appendToBucket = [&bucket](const IVisibilityScene::NodeData& nodeData)
+            {
+                bucket.push_back({ nodeData.m_bounds, &nodeData.m_entries });
+            };
+
+            const size_t first = nextSubtree + (remainingSubtreeCount * jobIndex) / activeJobCount;
+            const size_t last = nextSubtree + (remainingSubtreeCount * (jobIndex + 1)) / activeJobCount;
+            for (size_t subtree = first; subtree < last; ++subtree)
+            {
+                subtrees[subtree]->EnumerateHelper(frustum, appendToBucket);
+            }
+        };
+
+        if (activeJobCount > 1)
+        {
+            AZ::parallel_for(0, aznumeric_cast<int32_t>(activeJobCount), enumerateSubtrees);
+        }
+        else if (activeJobCount == 1)
+        {
+            enumerateSubtrees(0);
+        }
+    }
+
+
     void OctreeScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
@@ -441,6 +642,12 @@ namespace AzFramework
     }
 
 
+    float OctreeScene::GetLooseness() const
+    {
+        return m_looseness;
+    }
+
+
     void OctreeScene::DumpStats()
     {
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::EntryCount = %u", GetName().GetCStr(), GetEntryCount());
@@ -448,6 +655,7 @@ namespace AzFramework
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::FreeNodeCount = %u", GetName().GetCStr(), GetFreeNodeCount());
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::PageCount = %u", GetName().GetCStr(), GetPageCount());
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::ChildNodeCount = %u", GetName().GetCStr(), GetChildNodeCount());
+        AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::Looseness = %f", GetName().GetCStr(), GetLooseness());
     }
 
 
@@ -22,7 +22,8 @@ namespace AzFramework
     class OctreeScene;
 
     //! An internal node within the tree.
-    //! It contains all objects that are *fully contained* by the node, if an object spans multiple child nodes that object will be stored in the parent.
+    //! It contains all objects that are *fully contained* by the node's loose bounds, if an object spans multiple child nodes that object will be stored in the parent.
+    //! When the octree looseness is greater than one, each node's loose bounds extend past its split bounds so that entries moving near a split plane don't keep migrating between nodes.
     class OctreeNode
         : public VisibilityNode
     {
@@ -70,8 +71,16 @@ namespace AzFramework
 
         void TryMerge(OctreeScene& octreeScene);
 
+        template <typename T, typename Callback>
+        void EnumerateHelper(const T& boundingVolume, const Callback& callback) const;
+
+        //! Returns a bitmask with one bit set for each child node whose loose bounds overlap the bounding volume.
+        //! The frustum overload tests all of the children against each frustum plane at once using SIMD.
+        //! @{
         template <typename T>
-        void EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const;
+        uint32_t GetOverlappingChildren(const T& boundingVolume) const;
+        uint32_t GetOverlappingChildren(const AZ::Frustum& frustum) const;
+        //! @}
 
         void Split(OctreeScene& octreeScene);
         void Merge(OctreeScene& octreeScene);
@@ -80,10 +89,13 @@ namespace AzFramework
         // This gives us a maximum of 65,536 pages and 65,536 nodes per page, for a total of 2^32 - 1 total pages (-1 reserved for the invalid index)
         static constexpr uint32_t InvalidChildNodeIndex = 0xFFFFFFFF;
         uint32_t m_childNodeIndex = InvalidChildNodeIndex;
-        AZ::Aabb m_bounds;
+        AZ::Aabb m_bounds; //< The bounds used to split this node into child nodes
+        AZ::Aabb m_looseBounds; //< The bounds used to determine which entries fit in this node, m_bounds expanded by the scene looseness
         OctreeNode* m_parent = nullptr; //< This is a pointer to an array of GetChildNodeCount() nodes, or nullptr if this is a leaf node
         OctreeNode* m_children = nullptr;
         AZStd::vector<VisibilityEntry*> m_entries;
+
+        friend class OctreeScene; // For access to the node bounds and children during parallel enumeration
     };
 
     //! Implementation of the visibility system interface.
@@ -107,6 +119,7 @@ namespace AzFramework
         void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateParallel(const AZ::Frustum& frustum, IVisibilityScene::NodeDataBuckets& buckets) const override;
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
         uint32_t GetEntryCount() const override;
         //! @}
@@ -117,6 +130,7 @@ namespace AzFramework
         uint32_t GetFreeNodeCount() const;
         uint32_t GetPageCount() const;
         uint32_t GetChildNodeCount() const;
+        float GetLooseness() const;
         void DumpStats();
         //! @}
 
@@ -132,6 +146,7 @@ namespace AzFramework
 
         uint32_t m_entryCount = 0; //< Metric tracking the number of entries inserted into the octreeSystemComponent.
         uint32_t m_nodeCount = 1; //< Metric tracking the number of nodes allocated by the octreeSystemComponent, at least one for the root node.
+        float m_looseness = 1.0f; //< Scale applied to the extents of each child node to produce its loose bounds, 1 for a regular octree.
 
         static constexpr uint32_t BlockSize = 8192; //< This represents the number of nodes that can be stored in each page
         static_assert(BlockSize < 0xFFFF, "BlockSize must be less than 2^16");
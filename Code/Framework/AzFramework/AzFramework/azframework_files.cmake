@@ -31,12 +31,14 @@ set(FILES
     Archive/ZipDirCache.cpp
     Archive/ZipDirCacheFactory.cpp
     Archive/ZipDirFind.cpp
+    Archive/ZipDirIndex.cpp
     Archive/ZipDirList.cpp
     Archive/ZipDirStructures.cpp
     Archive/ZipDirTree.cpp
     Archive/ZipDirCache.h
     Archive/ZipDirCacheFactory.h
     Archive/ZipDirFind.h
+    Archive/ZipDirIndex.h
     Archive/ZipDirList.h
     Archive/ZipDirStructures.h
     Archive/ZipDirTree.h
@@ -134,6 +136,9 @@ set(FILES
     Components/EditorEntityEvents.h
     Components/TransformComponent.cpp
     Components/TransformComponent.h
+    Components/TransformHierarchyInterface.h
+    Components/TransformHierarchySystemComponent.cpp
+    Components/TransformHierarchySystemComponent.h
     Components/CameraBus.h
     Components/ConsoleBus.h
     Components/ConsoleBus.cpp
@@ -293,6 +298,8 @@ set(FILES
     Spawnable/SpawnableEntitiesInterface.cpp
     Spawnable/SpawnableEntitiesManager.h
     Spawnable/SpawnableEntitiesManager.cpp
+    Spawnable/SpawnableEntityCloneProgram.h
+    Spawnable/SpawnableEntityCloneProgram.cpp
     Spawnable/SpawnableMetaData.cpp
     Spawnable/SpawnableMetaData.h
     Spawnable/SpawnableMonitor.h
@@ -23,6 +23,9 @@
 #include <AzFramework/Archive/Archive.h>
 #include <AzFramework/Archive/ArchiveVars.h>
 #include <AzFramework/Archive/INestedArchive.h>
+#include <AzFramework/Archive/ZipDirCache.h>
+#include <AzFramework/Archive/ZipDirCacheFactory.h>
+#include <AzFramework/Archive/ZipFileFormat.h>
 
 namespace UnitTest
 {
@@ -586,6 +589,146 @@ namespace UnitTest
         fileIo->Remove(testArchivePath_withMountPoint);
     }
 
+    TEST_F(ArchiveTestFixture, FilesInArchiveWithDirectoryIndex_AreReadableAndSearchable)
+    {
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        constexpr AZStd::string_view dataString = "HELLO WORLD";
+        constexpr AZStd::string_view otherDataString = "GOODBYE WORLD";
+        constexpr const char* testArchivePath = "@usercache@/levels/test/indexedarchive.pak";
+
+        AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive = archive->OpenArchive(testArchivePath, nullptr, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+        ASSERT_NE(nullptr, pArchive);
+        EXPECT_EQ(0, pArchive->UpdateFile("levelinfo.xml", dataString.data(), dataString.size(), AZ::IO::INestedArchive::METHOD_COMPRESS, AZ::IO::INestedArchive::LEVEL_FASTEST));
+        EXPECT_EQ(0, pArchive->UpdateFile("mylevel\\MyLevel.xml", otherDataString.data(), otherDataString.size(), AZ::IO::INestedArchive::METHOD_STORE, AZ::IO::INestedArchive::LEVEL_FASTEST));
+        pArchive.reset();
+
+        char resolvedArchivePath[AZ_MAX_PATH_LEN];
+        ASSERT_TRUE(fileIo->ResolvePath(testArchivePath, resolvedArchivePath, AZ_ARRAY_SIZE(resolvedArchivePath)));
+        {
+            AZ::IO::ZipDir::CacheFactory factory(AZ::IO::ZipDir::ZD_INIT_FAST, 0);
+            AZ::IO::ZipDir::CachePtr cache = factory.New(resolvedArchivePath);
+            ASSERT_NE(nullptr, cache);
+            EXPECT_EQ(AZ::IO::ZipDir::ZD_ERROR_SUCCESS, cache->WriteDirectoryIndex());
+            // writing the index again replaces the previous one
+            EXPECT_EQ(AZ::IO::ZipDir::ZD_ERROR_SUCCESS, cache->WriteDirectoryIndex());
+        }
+
+        {
+            AZ::IO::ZipDir::CacheFactory factory(AZ::IO::ZipDir::ZD_INIT_FAST, AZ::IO::ZipDir::CacheFactory::FLAGS_READ_ONLY);
+            AZ::IO::ZipDir::CachePtr cache = factory.New(resolvedArchivePath);
+            ASSERT_NE(nullptr, cache);
+            AZ::IO::ZipDir::FileEntry* fileEntry = cache->FindFile("MyLevel/mylevel.xml");
+            ASSERT_NE(nullptr, fileEntry);
+            EXPECT_EQ(otherDataString.size(), fileEntry->desc.lSizeUncompressed);
+            EXPECT_EQ(fileEntry, cache->FindFile("/mylevel\\mylevel.xml"));
+            EXPECT_TRUE(cache->IsOwnerOf(fileEntry));
+            EXPECT_EQ(nullptr, cache->FindFile("mylevel"));
+            EXPECT_EQ(nullptr, cache->FindFile("mylevel/levelinfo.xml"));
+
+            // the index itself isn't part of the directory tree
+            EXPECT_EQ(2u, cache->GetRoot()->NumFilesTotal());
+        }
+
+        EXPECT_TRUE(archive->OpenPack("@assets@\\indexed", testArchivePath));
+        EXPECT_TRUE(archive->IsFileExist("indexed\\levelinfo.xml"));
+        EXPECT_TRUE(archive->IsFileExist("indexed//mylevel//mylevel.xml"));
+        EXPECT_FALSE(archive->IsFileExist("indexed\\mylevel.xml"));
+
+        AZ::IO::HandleType fileHandle = archive->FOpen("indexed\\levelinfo.xml", "rb", 0);
+        ASSERT_NE(AZ::IO::InvalidHandle, fileHandle);
+        size_t fileSize = 0;
+        const char* fileData = reinterpret_cast<const char*>(archive->FGetCachedFileData(fileHandle, fileSize));
+        ASSERT_NE(nullptr, fileData);
+        EXPECT_EQ(dataString, AZStd::string_view(fileData, fileSize));
+        archive->FClose(fileHandle);
+
+        bool foundLevelFolder = false;
+        AZ::IO::ArchiveFileIterator handle = archive->FindFirst("indexed\\*");
+        EXPECT_TRUE(static_cast<bool>(handle));
+        if (handle)
+        {
+            do
+            {
+                if ((handle.m_fileDesc.nAttrib & AZ::IO::FileDesc::Attribute::Subdirectory) == AZ::IO::FileDesc::Attribute::Subdirectory)
+                {
+                    foundLevelFolder = foundLevelFolder || azstricmp(handle.m_filename.data(), "mylevel") == 0;
+                }
+            } while (handle = archive->FindNext(handle));
+
+            archive->FindClose(handle);
+        }
+        EXPECT_TRUE(foundLevelFolder);
+
+        archive->ClosePack(testArchivePath);
+        fileIo->Remove(testArchivePath);
+    }
+
+    TEST_F(ArchiveTestFixture, ArchiveWithDirectoryIndex_CDRModifiedAfterIndex_IndexIsIgnored)
+    {
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        constexpr AZStd::string_view dataString = "HELLO WORLD";
+        constexpr AZStd::string_view fileName = "levelinfo.xml";
+        constexpr const char* testArchivePath = "@usercache@/levels/test/modifiedindexedarchive.pak";
+
+        AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive = archive->OpenArchive(testArchivePath, nullptr, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+        ASSERT_NE(nullptr, pArchive);
+        EXPECT_EQ(0, pArchive->UpdateFile(fileName, dataString.data(), dataString.size(), AZ::IO::INestedArchive::METHOD_STORE, AZ::IO::INestedArchive::LEVEL_FASTEST));
+        pArchive.reset();
+
+        char resolvedArchivePath[AZ_MAX_PATH_LEN];
+        ASSERT_TRUE(fileIo->ResolvePath(testArchivePath, resolvedArchivePath, AZ_ARRAY_SIZE(resolvedArchivePath)));
+        {
+            AZ::IO::ZipDir::CacheFactory factory(AZ::IO::ZipDir::ZD_INIT_FAST, 0);
+            AZ::IO::ZipDir::CachePtr cache = factory.New(resolvedArchivePath);
+            ASSERT_NE(nullptr, cache);
+            EXPECT_EQ(AZ::IO::ZipDir::ZD_ERROR_SUCCESS, cache->WriteDirectoryIndex());
+        }
+
+        // change the modification time of the file in the CDR, which keeps the number of entries the same.
+        // the CDR is at the end of the archive, so the last occurrence of the name is the one in the CDR
+        AZStd::vector<char> archiveData(AZ::IO::SystemFile::Length(resolvedArchivePath));
+        ASSERT_EQ(archiveData.size(), AZ::IO::SystemFile::Read(resolvedArchivePath, archiveData.data()));
+        const size_t namePos = AZStd::string_view(archiveData.data(), archiveData.size()).rfind(fileName);
+        ASSERT_NE(AZStd::string_view::npos, namePos);
+        ASSERT_GE(namePos, sizeof(AZ::IO::ZipFile::CDRFileHeader));
+        const size_t headerPos = namePos - sizeof(AZ::IO::ZipFile::CDRFileHeader);
+
+        AZ::IO::ZipFile::CDRFileHeader cdrHeader;
+        memcpy(&cdrHeader, archiveData.data() + headerPos, sizeof(cdrHeader));
+        ASSERT_EQ(AZ::IO::ZipFile::CDRFileHeader::SIGNATURE, cdrHeader.lSignature);
+        const uint16_t modifiedTime = cdrHeader.nLastModTime ^ 1;
+        cdrHeader.nLastModTime = modifiedTime;
+        {
+            AZ::IO::SystemFile file;
+            ASSERT_TRUE(file.Open(resolvedArchivePath, AZ::IO::SystemFile::SF_OPEN_READ_WRITE));
+            file.Seek(headerPos, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+            EXPECT_EQ(sizeof(cdrHeader), file.Write(&cdrHeader, sizeof(cdrHeader)));
+        }
+
+        // the entries come from the CDR instead of the out of date index
+        {
+            AZ::IO::ZipDir::CacheFactory factory(AZ::IO::ZipDir::ZD_INIT_FAST, AZ::IO::ZipDir::CacheFactory::FLAGS_READ_ONLY);
+            AZ::IO::ZipDir::CachePtr cache = factory.New(resolvedArchivePath);
+            ASSERT_NE(nullptr, cache);
+            AZ::IO::ZipDir::FileEntry* fileEntry = cache->FindFile(fileName);
+            ASSERT_NE(nullptr, fileEntry);
+            EXPECT_EQ(modifiedTime, fileEntry->nLastModTime);
+            EXPECT_EQ(dataString.size(), fileEntry->desc.lSizeUncompressed);
+        }
+
+        fileIo->Remove(testArchivePath);
+    }
+
     // test that ArchiveFileIO class works as expected
     TEST_F(ArchiveTestFixture, TestArchiveViaFileIO)
     {
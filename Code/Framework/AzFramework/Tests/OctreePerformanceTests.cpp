@@ -328,6 +328,36 @@ namespace Benchmark
         }
         RemoveEntries(EntryCount);
     }
+
+    BENCHMARK_F(BM_Octree, EnumerateParallelFrustum100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        AzFramework::IVisibilityScene::NodeDataBuckets buckets;
+        for (auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->EnumerateParallel(queryData.frustum, buckets);
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateParallelFrustum1000000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000000;
+        InsertEntries(EntryCount);
+        AzFramework::IVisibilityScene::NodeDataBuckets buckets;
+        for (auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->EnumerateParallel(queryData.frustum, buckets);
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
 }
 
 #endif
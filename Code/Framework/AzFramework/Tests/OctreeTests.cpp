@@ -11,6 +11,12 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 #include <random>
 
@@ -38,6 +44,7 @@ namespace UnitTest
             m_console->GetCvarValue("bg_octreeNodeMaxEntries", m_savedMaxEntries);
             m_console->GetCvarValue("bg_octreeNodeMinEntries", m_savedMinEntries);
             m_console->GetCvarValue("bg_octreeMaxWorldExtents", m_savedBounds);
+            m_console->GetCvarValue("bg_octreeLooseness", m_savedLooseness);
 
             // To ease unit testing, configure the octreeSystemComponent to only allow one entry per node
             m_console->PerformCommand("bg_octreeNodeMaxEntries 1");
@@ -63,6 +70,8 @@ namespace UnitTest
             m_console->PerformCommand(commandString.c_str());
             commandString.format("bg_octreeMaxWorldExtents %f", m_savedBounds);
             m_console->PerformCommand(commandString.c_str());
+            commandString.format("bg_octreeLooseness %f", m_savedLooseness);
+            m_console->PerformCommand(commandString.c_str());
 
             m_octreeSystemComponent->DestroyVisibilityScene(m_octreeScene);
             delete m_octreeSystemComponent;
@@ -88,6 +97,7 @@ namespace UnitTest
         uint32_t m_savedMaxEntries = 0;
         uint32_t m_savedMinEntries = 0;
         float m_savedBounds = 0.0f;
+        float m_savedLooseness = 0.0f;
         AZ::Console* m_console;
     };
 
@@ -420,4 +430,191 @@ namespace UnitTest
         // Expect all the entries to be in the scene
         ValidateEntryCountEqualsExpectedCount(m_octreeScene, visEntries.size());
     }
+
+    TEST_F(OctreeTests, LooseOctree_EntriesStraddlingSplitPlanes_AreStoredInChildNodes)
+    {
+        m_console->PerformCommand("bg_octreeLooseness 2");
+        IVisibilityScene* looseScene = m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("LooseOctreeUnitTestScene"));
+        EXPECT_FLOAT_EQ(azdynamic_cast<OctreeScene*>(looseScene)->GetLooseness(), 2.0f);
+
+        AzFramework::VisibilityEntry visEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.05f), AZ::Vector3(0.3f));
+
+        // The second entry crosses the root split planes, so a tight octree would have to keep it in the root node
+        looseScene->InsertOrUpdateEntry(visEntry[0]);
+        looseScene->InsertOrUpdateEntry(visEntry[1]);
+        ValidateEntryCountEqualsExpectedCount(looseScene, 2);
+        ASSERT_TRUE(visEntry[1].m_internalNode != nullptr);
+        EXPECT_TRUE(static_cast<OctreeNode*>(visEntry[1].m_internalNode)->IsLeaf());
+
+        // Small movements across the split planes stay within the loose bounds and don't move the entry
+        VisibilityNode* originalNode = visEntry[1].m_internalNode;
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.1f), AZ::Vector3(0.25f));
+        looseScene->InsertOrUpdateEntry(visEntry[1]);
+        EXPECT_EQ(visEntry[1].m_internalNode, originalNode);
+        ValidateEntryCountEqualsExpectedCount(looseScene, 2);
+
+        // Enumeration reports the loose bounds, so the entry is still found by volumes that only touch the part outside its split bounds
+        AZStd::vector<VisibilityEntry*> gatheredEntries;
+        looseScene->Enumerate(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.2f), AZ::Vector3(-0.15f)),
+            [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(gatheredEntries, nodeData); });
+        EXPECT_TRUE(AZStd::find(gatheredEntries.begin(), gatheredEntries.end(), &visEntry[1]) != gatheredEntries.end());
+
+        looseScene->RemoveEntry(visEntry[0]);
+        looseScene->RemoveEntry(visEntry[1]);
+        ValidateEntryCountEqualsExpectedCount(looseScene, 0);
+        m_octreeSystemComponent->DestroyVisibilityScene(looseScene);
+    }
+
+    void ValidateEnumerateParallelMatchesEnumerate(IVisibilityScene* visScene, const AZ::Frustum& frustum)
+    {
+        AZStd::unordered_set<VisibilityEntry*> expectedEntries;
+        visScene->Enumerate(frustum, [&expectedEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+        {
+            expectedEntries.insert(nodeData.m_entries.begin(), nodeData.m_entries.end());
+        });
+
+        IVisibilityScene::NodeDataBuckets buckets;
+        visScene->EnumerateParallel(frustum, buckets);
+
+        AZStd::unordered_set<VisibilityEntry*> gatheredEntries;
+        size_t gatheredEntryCount = 0;
+        for (const IVisibilityScene::NodeDataBucket& bucket : buckets)
+        {
+            for (const IVisibilityScene::EnumeratedNodeData& nodeData : bucket)
+            {
+                gatheredEntries.insert(nodeData.m_entries->begin(), nodeData.m_entries->end());
+                gatheredEntryCount += nodeData.m_entries->size();
+            }
+        }
+
+        // Every node should be reported exactly once
+        EXPECT_EQ(gatheredEntryCount, gatheredEntries.size());
+        EXPECT_EQ(gatheredEntries, expectedEntries);
+    }
+
+    class OctreeEnumerateParallelTests
+        : public OctreeTests
+    {
+    public:
+        void SetUp() override
+        {
+            OctreeTests::SetUp();
+
+            m_console->PerformCommand("bg_octreeNodeMaxEntries 4");
+
+            const unsigned int seed = 1;
+            std::mt19937_64 rng(seed);
+            std::uniform_real_distribution<float> unif(-0.95f, 0.9f);
+
+            m_visEntries.resize(512);
+            for (AzFramework::VisibilityEntry& entry : m_visEntries)
+            {
+                const AZ::Vector3 aabbMin(unif(rng), unif(rng), unif(rng));
+                entry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(aabbMin, aabbMin + AZ::Vector3(0.05f));
+                m_octreeScene->InsertOrUpdateEntry(entry);
+            }
+        }
+
+        void TearDown() override
+        {
+            for (AzFramework::VisibilityEntry& entry : m_visEntries)
+            {
+                m_octreeScene->RemoveEntry(entry);
+            }
+            ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+            m_visEntries.set_capacity(0);
+
+            OctreeTests::TearDown();
+        }
+
+        void ValidateFrustums()
+        {
+            AZ::Vector3 frustumOrigin = AZ::Vector3(0.0f, -2.0f, 0.0f);
+            AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateIdentity(), frustumOrigin);
+            const AZ::Frustum frustums[] =
+            {
+                AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.5f), 1.0f, 3.0f)),
+                AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.25f), 1.5f, 2.5f)),
+                AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.5f), 10.0f, 20.0f)) // Outside the world bounds
+            };
+
+            for (const AZ::Frustum& frustum : frustums)
+            {
+                ValidateEnumerateParallelMatchesEnumerate(m_octreeScene, frustum);
+            }
+        }
+
+        AZStd::vector<AzFramework::VisibilityEntry> m_visEntries;
+    };
+
+    TEST_F(OctreeEnumerateParallelTests, EnumerateParallel_WithoutJobManager_MatchesEnumerate)
+    {
+        // Hide any global job context left behind by other tests, so the traversal runs entirely on the calling thread
+        AZ::EnvironmentVariable<AZ::JobContext*> globalJobContext = AZ::Environment::FindVariable<AZ::JobContext*>("GlobalJobContext");
+        AZ::JobContext* savedJobContext = globalJobContext ? *globalJobContext : nullptr;
+        if (savedJobContext)
+        {
+            AZ::JobContext::SetGlobalContext(nullptr);
+        }
+
+        ValidateFrustums();
+
+        if (savedJobContext)
+        {
+            AZ::JobContext::SetGlobalContext(savedJobContext);
+        }
+    }
+
+    TEST_F(OctreeEnumerateParallelTests, EnumerateParallel_WithJobManager_MatchesEnumerate)
+    {
+        const bool ownsPoolAllocator = !AZ::AllocatorInstance<AZ::PoolAllocator>::IsReady();
+        const bool ownsThreadPoolAllocator = !AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::IsReady();
+        if (ownsPoolAllocator)
+        {
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+        }
+        if (ownsThreadPoolAllocator)
+        {
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+        }
+
+        {
+            AZ::JobManagerDesc desc;
+            AZ::JobManagerThreadDesc threadDesc;
+            for (unsigned int i = 0; i < 4; ++i)
+            {
+                desc.m_workerThreads.push_back(threadDesc);
+            }
+            AZ::JobManager jobManager(desc);
+            AZ::JobContext jobContext(jobManager);
+
+            // Use this test's own job manager, regardless of any global job context left behind by other tests
+            AZ::EnvironmentVariable<AZ::JobContext*> globalJobContext = AZ::Environment::FindVariable<AZ::JobContext*>("GlobalJobContext");
+            AZ::JobContext* savedJobContext = globalJobContext ? *globalJobContext : nullptr;
+            if (savedJobContext)
+            {
+                AZ::JobContext::SetGlobalContext(nullptr);
+            }
+            AZ::JobContext::SetGlobalContext(&jobContext);
+
+            ValidateFrustums();
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+            if (savedJobContext)
+            {
+                AZ::JobContext::SetGlobalContext(savedJobContext);
+            }
+        }
+
+        if (ownsThreadPoolAllocator)
+        {
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+        }
+        if (ownsPoolAllocator)
+        {
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        }
+    }
 }
@@ -55,6 +55,33 @@ namespace UnitTest
         AZ::EntityId m_entityReference;
     };
 
+    // Test component that stores its entity references in a container, which can't be patched by a precompiled clone program.
+    class ComponentWithEntityReferenceList : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ComponentWithEntityReferenceList, "{2B6B4B3C-6F0E-4C84-9C39-4C3C6C0A54E1}");
+
+        void Activate() override
+        {
+        }
+
+        void Deactivate() override
+        {
+        }
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection))
+            {
+                serializeContext->Class<ComponentWithEntityReferenceList, AZ::Component>()
+                    ->Field("EntityReferences", &ComponentWithEntityReferenceList::m_entityReferences)
+                    ;
+            }
+        }
+
+        AZStd::vector<AZ::EntityId> m_entityReferences;
+    };
+
     class SpawnableEntitiesManagerTest : public AllocatorsFixture
     {
     public:
@@ -66,6 +93,7 @@ namespace UnitTest
             AZ::ComponentApplication::Descriptor descriptor;
             m_application->Start(descriptor);
             m_application->RegisterComponentDescriptor(ComponentWithEntityReference::CreateDescriptor());
+            m_application->RegisterComponentDescriptor(ComponentWithEntityReferenceList::CreateDescriptor());
 
             // Without this, the user settings component would attempt to save on finalize/shutdown. Since the file is
             // shared across the whole engine, if multiple tests are run in parallel, the saving could cause a crash
@@ -111,6 +139,7 @@ namespace UnitTest
             {
                 entities.push_back(AZStd::make_unique<AZ::Entity>());
             }
+            m_spawnable->InvalidateClonePrograms();
         }
 
         void CreateRecursiveHierarchy()
@@ -128,6 +157,7 @@ namespace UnitTest
                 }
                 parent = entity->GetId();     
             }
+            m_spawnable->InvalidateClonePrograms();
         }
 
         void CreateSingleParent()
@@ -147,6 +177,7 @@ namespace UnitTest
                     }
                 }
             }
+            m_spawnable->InvalidateClonePrograms();
         }
 
         enum class EntityReferenceScheme
@@ -185,6 +216,7 @@ namespace UnitTest
                     break;
                 }
             }
+            m_spawnable->InvalidateClonePrograms();
         }
 
         // Verify that the entity references are pointing to the correct other entities within the same spawn batch.
@@ -325,6 +357,93 @@ namespace UnitTest
         }
     }
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_ReferencesInContainer_EntityIdsAreMappedCorrectly)
+    {
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        AzFramework::Spawnable::EntityList& entities = m_spawnable->GetEntities();
+        for (AZStd::unique_ptr<AZ::Entity>& entity : entities)
+        {
+            auto component = entity->CreateComponent<ComponentWithEntityReferenceList>();
+            component->m_entityReferences.push_back(entities[0]->GetId());
+            component->m_entityReferences.push_back(entity->GetId());
+        }
+        m_spawnable->InvalidateClonePrograms();
+
+        size_t spawnedEntitiesCount = 0;
+        auto callback =
+            [&spawnedEntitiesCount](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView spawnedEntities)
+        {
+            const AZ::EntityId firstId = (*spawnedEntities.begin())->GetId();
+            for (const AZ::Entity* entity : spawnedEntities)
+            {
+                auto component = entity->FindComponent<ComponentWithEntityReferenceList>();
+                ASSERT_NE(nullptr, component);
+                ASSERT_EQ(2, component->m_entityReferences.size());
+                EXPECT_EQ(firstId, component->m_entityReferences[0]);
+                EXPECT_EQ(entity->GetId(), component->m_entityReferences[1]);
+            }
+            spawnedEntitiesCount += spawnedEntities.size();
+        };
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+
+        EXPECT_EQ(NumEntities, spawnedEntitiesCount);
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, GetClonePrograms_InlineAndContainerReferences_OnlyInlineReferencesAreCompiled)
+    {
+        FillSpawnable(2);
+        AzFramework::Spawnable::EntityList& entities = m_spawnable->GetEntities();
+        entities[0]->CreateComponent<AzFramework::TransformComponent>();
+        entities[0]->CreateComponent<ComponentWithEntityReference>()->m_entityReference = entities[1]->GetId();
+        entities[1]->CreateComponent<ComponentWithEntityReferenceList>()->m_entityReferences.push_back(entities[0]->GetId());
+        m_spawnable->InvalidateClonePrograms();
+
+        AZ::SerializeContext* serializeContext = m_application->GetSerializeContext();
+        ASSERT_NE(nullptr, serializeContext);
+        const AzFramework::Spawnable& spawnable = *m_spawnable;
+        AZStd::shared_ptr<const AzFramework::Spawnable::CloneProgramList> clonePrograms = spawnable.GetClonePrograms(*serializeContext);
+        ASSERT_NE(nullptr, clonePrograms);
+        ASSERT_EQ(2, clonePrograms->size());
+        EXPECT_TRUE((*clonePrograms)[0].IsCompiled());
+        EXPECT_FALSE((*clonePrograms)[1].IsCompiled());
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, GetClonePrograms_InvalidatedWhileHeld_HeldProgramsStayValidAndNewProgramsAreCompiled)
+    {
+        FillSpawnable(1);
+        AzFramework::Spawnable::EntityList& entities = m_spawnable->GetEntities();
+        entities[0]->CreateComponent<ComponentWithEntityReferenceList>()->m_entityReferences.push_back(entities[0]->GetId());
+        m_spawnable->InvalidateClonePrograms();
+
+        AZ::SerializeContext* serializeContext = m_application->GetSerializeContext();
+        ASSERT_NE(nullptr, serializeContext);
+        const AzFramework::Spawnable& spawnable = *m_spawnable;
+        AZStd::shared_ptr<const AzFramework::Spawnable::CloneProgramList> heldPrograms = spawnable.GetClonePrograms(*serializeContext);
+        ASSERT_EQ(1, heldPrograms->size());
+        EXPECT_FALSE((*heldPrograms)[0].IsCompiled());
+
+        // Accessing the entities for modification alone doesn't discard the programs.
+        m_spawnable->GetEntities();
+        EXPECT_EQ(heldPrograms, spawnable.GetClonePrograms(*serializeContext));
+
+        // Replace the entity with one that can be compiled. The held programs must not be touched by this.
+        entities[0] = AZStd::make_unique<AZ::Entity>();
+        entities[0]->CreateComponent<ComponentWithEntityReference>()->m_entityReference = entities[0]->GetId();
+        m_spawnable->InvalidateClonePrograms();
+
+        ASSERT_EQ(1, heldPrograms->size());
+        EXPECT_FALSE((*heldPrograms)[0].IsCompiled());
+
+        AZStd::shared_ptr<const AzFramework::Spawnable::CloneProgramList> newPrograms = spawnable.GetClonePrograms(*serializeContext);
+        ASSERT_NE(heldPrograms, newPrograms);
+        ASSERT_EQ(1, newPrograms->size());
+        EXPECT_TRUE((*newPrograms)[0].IsCompiled());
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_AllEntitiesReferenceOtherEntities_EntityIdsOnlyReferWithinASingleCall)
     {
         // This tests that entity id references get mapped correctly with multiple SpawnAllEntities calls.  Each call should only map
@@ -956,3 +1075,128 @@ namespace UnitTest
         EXPECT_LT(defaultPriorityCallId, highPriorityCallId);
     }
 } // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class SpawnableEntitiesManagerBenchmarkFixture : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        static constexpr size_t NumEntitiesInPrefab = 10;
+        static constexpr size_t NumSpawnedEntities = 10000;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_application = new UnitTest::TestApplication();
+            AZ::ComponentApplication::Descriptor descriptor;
+            m_application->Start(descriptor);
+            m_application->RegisterComponentDescriptor(UnitTest::ComponentWithEntityReference::CreateDescriptor());
+            m_application->RegisterComponentDescriptor(UnitTest::ComponentWithEntityReferenceList::CreateDescriptor());
+            AZ::UserSettingsComponentRequestBus::Broadcast(&AZ::UserSettingsComponentRequests::DisableSaveOnFinalize);
+
+            m_spawnable = aznew AzFramework::Spawnable(
+                AZ::Data::AssetId::CreateString("{A4C5A0C2-6B67-4B9B-8F2C-3C5F1A4B7E21}:0"), AZ::Data::AssetData::AssetStatus::Ready);
+            m_spawnableAsset = new AZ::Data::Asset<AzFramework::Spawnable>(m_spawnable, AZ::Data::AssetLoadBehavior::Default);
+            m_manager = azrtti_cast<AzFramework::SpawnableEntitiesManager*>(AzFramework::SpawnableEntitiesInterface::Get());
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            ProcessAllCommands();
+            delete m_spawnableAsset;
+            m_spawnableAsset = nullptr;
+            delete m_application;
+            m_application = nullptr;
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        //! Builds a small prefab where every entity has a transform parented to the first entity and a reference to the next entity.
+        //! References are either stored in a plain member or in a container. The latter can't use a clone program.
+        void FillPrefab(bool useContainerReferences)
+        {
+            AzFramework::Spawnable::EntityList& entities = m_spawnable->GetEntities();
+            entities.clear();
+            for (size_t i = 0; i < NumEntitiesInPrefab; ++i)
+            {
+                entities.push_back(AZStd::make_unique<AZ::Entity>());
+            }
+            for (size_t i = 0; i < NumEntitiesInPrefab; ++i)
+            {
+                AZ::Entity& entity = *entities[i];
+                auto transform = entity.CreateComponent<AzFramework::TransformComponent>();
+                if (i > 0)
+                {
+                    transform->SetParent(entities[0]->GetId());
+                }
+
+                const AZ::EntityId nextId = entities[(i + 1) % NumEntitiesInPrefab]->GetId();
+                if (useContainerReferences)
+                {
+                    entity.CreateComponent<UnitTest::ComponentWithEntityReferenceList>()->m_entityReferences.push_back(nextId);
+                }
+                else
+                {
+                    entity.CreateComponent<UnitTest::ComponentWithEntityReference>()->m_entityReference = nextId;
+                }
+            }
+            m_spawnable->InvalidateClonePrograms();
+        }
+
+        void ProcessAllCommands()
+        {
+            while (m_manager->ProcessQueue(
+                       AzFramework::SpawnableEntitiesManager::CommandQueuePriority::High |
+                       AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular) !=
+                   AzFramework::SpawnableEntitiesManager::CommandQueueStatus::NoCommandsLeft)
+            {
+            }
+        }
+
+        void SpawnPrefabs(::benchmark::State& state)
+        {
+            AzFramework::EntitySpawnTicket ticket(*m_spawnableAsset);
+            for (auto _ : state)
+            {
+                for (size_t i = 0; i < NumSpawnedEntities / NumEntitiesInPrefab; ++i)
+                {
+                    m_manager->SpawnAllEntities(ticket);
+                }
+                ProcessAllCommands();
+
+                state.PauseTiming();
+                m_manager->DespawnAllEntities(ticket);
+                ProcessAllCommands();
+                state.ResumeTiming();
+            }
+            state.SetItemsProcessed(state.iterations() * NumSpawnedEntities);
+        }
+
+        AZ::Data::Asset<AzFramework::Spawnable>* m_spawnableAsset{ nullptr };
+        AzFramework::SpawnableEntitiesManager* m_manager{ nullptr };
+        AzFramework::Spawnable* m_spawnable{ nullptr };
+        UnitTest::TestApplication* m_application{ nullptr };
+    };
+
+    BENCHMARK_DEFINE_F(SpawnableEntitiesManagerBenchmarkFixture, SpawnEntitiesWithClonePrograms)(benchmark::State& state)
+    {
+        FillPrefab(false);
+        SpawnPrefabs(state);
+    }
+
+    BENCHMARK_DEFINE_F(SpawnableEntitiesManagerBenchmarkFixture, SpawnEntitiesWithRemapper)(benchmark::State& state)
+    {
+        FillPrefab(true);
+        SpawnPrefabs(state);
+    }
+
+    BENCHMARK_REGISTER_F(SpawnableEntitiesManagerBenchmarkFixture, SpawnEntitiesWithClonePrograms)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(SpawnableEntitiesManagerBenchmarkFixture, SpawnEntitiesWithRemapper)->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
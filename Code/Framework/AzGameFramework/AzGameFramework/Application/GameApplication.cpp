@@ -51,6 +51,24 @@ namespace AzGameFramework
         Application::SetSettingsRegistrySpecializations(specializations);
         specializations.Append("game");
 
+        bool useCompiledRegistry = false;
+        registry.Get(useCompiledRegistry, AZ::SettingsRegistryMergeUtils::CompiledRegistryEnabledKey);
+        AZ::IO::FixedMaxPath compiledRegistryPath;
+        AZ::HashValue64 compiledRegistryLaunchKey{};
+        if (useCompiledRegistry)
+        {
+            compiledRegistryPath = AZ::SettingsRegistryMergeUtils::GetCompiledRegistryPath(registry, specializations, AZ_TRAIT_OS_PLATFORM_CODENAME);
+            compiledRegistryLaunchKey = AZ::SettingsRegistryMergeUtils::GetCompiledRegistryLaunchKey(registry, specializations, AZ_TRAIT_OS_PLATFORM_CODENAME);
+            if (!compiledRegistryPath.empty() && AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_CompiledRegistry(
+                registry, compiledRegistryPath.Native(), AZ_TRAIT_OS_PLATFORM_CODENAME, compiledRegistryLaunchKey))
+            {
+#if defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
+                AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_CommandLine(registry, m_commandLine, true);
+#endif
+                return;
+            }
+        }
+
         AZStd::vector<char> scratchBuffer;
 
 #if defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
@@ -82,6 +100,12 @@ namespace AzGameFramework
 #endif
         // Update the Runtime file paths in case the "{BootstrapSettingsRootKey}/assets" key was overriden by a setting registry
         AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_AddRuntimeFilePaths(registry);
+
+        if (!compiledRegistryPath.empty())
+        {
+            AZ::SettingsRegistryMergeUtils::SaveCompiledRegistry(registry, compiledRegistryPath.Native(), AZ_TRAIT_OS_PLATFORM_CODENAME,
+                compiledRegistryLaunchKey);
+        }
     }
 
     AZ::ComponentTypeList GameApplication::GetRequiredSystemComponents() const
@@ -14,6 +14,8 @@
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/Utils/Utils.h>
+#include <AzFramework/Archive/ZipDirCache.h>
+#include <AzFramework/Archive/ZipDirCacheFactory.h>
 #include <AzFramework/Asset/AssetBundleManifest.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 #include <AzFramework/API/ApplicationAPI.h>
@@ -59,6 +61,23 @@ namespace AzToolsFramework
         return true;
     }
 
+    //! Appends the directory index to the bundle, which lets the runtime open it without parsing its central directory.
+    //! Bundles without the index still work, so failing to write it is not treated as an error.
+    void WriteBundleDirectoryIndex(const AZStd::string& bundleFilePath)
+    {
+        AZ::IO::ZipDir::CacheFactory factory(AZ::IO::ZipDir::ZD_INIT_FAST, AZ::IO::ZipDir::CacheFactory::FLAGS_DONT_COMPACT);
+        AZ::IO::ZipDir::CachePtr cache = factory.New(bundleFilePath.c_str());
+        if (!cache)
+        {
+            AZ_Warning(logWindowName, false, "Failed to open bundle (%s) to write its directory index.\n", bundleFilePath.c_str());
+            return;
+        }
+
+        [[maybe_unused]] AZ::IO::ZipDir::ErrorEnum result = cache->WriteDirectoryIndex();
+        AZ_Warning(logWindowName, result == AZ::IO::ZipDir::ZD_ERROR_SUCCESS, "Failed to write the directory index of bundle (%s), error %d.\n",
+            bundleFilePath.c_str(), static_cast<int>(result));
+    }
+
     //! This helper class can be used to create a temp folder from a filename.
     //! It strips the extension and than adds _temp token to the name and tries to create that directory on disk.
     struct TemporaryDir
@@ -410,6 +429,12 @@ namespace AzToolsFramework
             return false;
         }
 
+        // The bundles are complete, add the directory index as the last file of each of them
+        for (const auto& [bundleFilePath, deltaCatalogName] : bundlePathDeltaCatalogPair)
+        {
+            WriteBundleDirectoryIndex(bundleFilePath);
+        }
+
         // Surface any errors during the renames
         ScopedIOEventBusHandler renameHandler;
 
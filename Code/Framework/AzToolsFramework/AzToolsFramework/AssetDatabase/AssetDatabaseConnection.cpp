@@ -1589,13 +1589,14 @@ namespace AzToolsFramework
                 && m_fileName == other.m_fileName
                 && m_isFolder == other.m_isFolder
                 && m_modTime == other.m_modTime
-                && m_hash == other.m_hash;
+                && m_hash == other.m_hash
+                && m_fileSize == other.m_fileSize;
         }
 
         AZStd::string FileDatabaseEntry::ToString() const
         {
-            return AZStd::string::format("FileDatabaseEntry id: %" PRId64 " scanfolderpk: %" PRId64 " filename: %s isfolder: %i modtime: %" PRIu64 " hash: %" PRIu64,
-                static_cast<int64_t>(m_fileID), static_cast<int64_t>(m_scanFolderPK), m_fileName.c_str(), m_isFolder, static_cast<uint64_t>(m_modTime), static_cast<uint64_t>(m_hash));
+            return AZStd::string::format("FileDatabaseEntry id: %" PRId64 " scanfolderpk: %" PRId64 " filename: %s isfolder: %i modtime: %" PRIu64 " hash: %" PRIu64 " filesize: %" PRId64,
+                static_cast<int64_t>(m_fileID), static_cast<int64_t>(m_scanFolderPK), m_fileName.c_str(), m_isFolder, static_cast<uint64_t>(m_modTime), static_cast<uint64_t>(m_hash), static_cast<int64_t>(m_fileSize));
         }
 
         auto FileDatabaseEntry::GetColumns()
@@ -1606,7 +1607,8 @@ namespace AzToolsFramework
                 MakeColumn("FileName", m_fileName),
                 MakeColumn("IsFolder", m_isFolder),
                 MakeColumn("ModTime", m_modTime),
-                MakeColumn("Hash", m_hash)
+                MakeColumn("Hash", m_hash),
+                MakeColumn("FileSize", m_fileSize)
             );
         }
 
@@ -30,6 +30,7 @@ namespace AzToolsFramework
     namespace AssetDatabase
     {
         constexpr AZ::s64 InvalidEntryId = -1;
+        constexpr AZ::s64 UnknownFileSize = -1;
 
         //! List all database version changes here with descriptive naming to explain what was changed in
         //! the database
@@ -65,6 +66,7 @@ namespace AzToolsFramework
             AddedScanTimeSecondsSinceEpochField = 29,
             ChangedSortFunctionFromQSortToStdStableSort = 30,
             RemoveOutputPrefixFromScanFolders,
+            AddedFileSizeField,
             //Add all new versions before this
             DatabaseVersionCount,
             LatestVersion = DatabaseVersionCount - 1
@@ -390,6 +392,7 @@ namespace AzToolsFramework
             int m_isFolder = 0;
             AZ::u64 m_modTime{};
             AZ::u64 m_hash{};
+            AZ::s64 m_fileSize = UnknownFileSize; //!< Size of the file when the mod time and hash were recorded
         };
 
         typedef AZStd::vector<FileDatabaseEntry> FileDatabaseEntryContainer;
@@ -6,8 +6,12 @@
  *
  */
 
+#include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/parallel/scoped_lock.h>
 #include <AzToolsFramework/Prefab/Spawnable/PrefabConversionPipeline.h>
 
 namespace AzToolsFramework::Prefab::PrefabConversionUtils
@@ -49,11 +53,60 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
 
     void PrefabConversionPipeline::ProcessPrefab(PrefabProcessorContext& context)
     {
+        // The time and memory each stage takes are recorded and reported so slow or memory hungry stages can be found from the
+        // builder log. The system allocator is shared by the whole process, so the memory figures include allocations made by
+        // other threads. The peak can only be measured if the allocator keeps records, in which case the allocator's own peak
+        // is reset at the start of every stage.
+        auto& allocator = AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+        AZ::Debug::AllocationRecords* records = allocator.GetRecords();
+        const AZStd::chrono::steady_clock::time_point startTime = AZStd::chrono::steady_clock::now();
+
+        m_lastStageStatistics.clear();
+        m_lastStageStatistics.reserve(m_processors.size());
         for (auto& processor : m_processors)
         {
+            StageStatistics& stage = m_lastStageStatistics.emplace_back();
+            stage.m_processorName = processor->RTTI_GetTypeName();
+            stage.m_startAllocatedBytes = allocator.NumAllocatedBytes();
+            if (records)
+            {
+                AZStd::scoped_lock lock(*records);
+                records->ResetPeakBytes();
+            }
+            const AZStd::chrono::steady_clock::time_point stageStartTime = AZStd::chrono::steady_clock::now();
+
             processor->Process(context);
+
+            stage.m_duration = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                AZStd::chrono::steady_clock::now() - stageStartTime);
+            if (records)
+            {
+                AZStd::scoped_lock lock(*records);
+                stage.m_peakAllocatedBytes = records->RequestedBytesPeak();
+                stage.m_isPeakTracked = true;
+            }
+            else
+            {
+                stage.m_peakAllocatedBytes = allocator.NumAllocatedBytes();
+            }
+
+            AZ_TracePrintf("PrefabConversionPipeline", "Stage '%s' took %lld ms, %s system allocator usage %zu KB (%+lld KB).\n",
+                stage.m_processorName, static_cast<long long>(stage.m_duration.count() / 1000),
+                stage.m_isPeakTracked ? "peak" : "final", stage.m_peakAllocatedBytes / 1024,
+                (static_cast<long long>(stage.m_peakAllocatedBytes) - static_cast<long long>(stage.m_startAllocatedBytes)) / 1024);
         }
+
+        [[maybe_unused]] const AZStd::chrono::milliseconds duration =
+            AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(AZStd::chrono::steady_clock::now() - startTime);
+        AZ_TracePrintf("PrefabConversionPipeline", "Processing %zu stages took %lld ms.\n",
+            m_processors.size(), static_cast<long long>(duration.count()));
     }
+
+    auto PrefabConversionPipeline::GetLastStageStatistics() const -> const StageStatisticsList&
+    {
+        return m_lastStageStatistics;
+    }
+
     size_t PrefabConversionPipeline::CalculateProcessorFingerprint(AZ::SerializeContext* context)
     {
         size_t fingerprint = 0;
@@ -10,6 +10,7 @@
 
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/std/chrono/types.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string_view.h>
@@ -26,10 +27,25 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         using PrefabProcessorListEntry = AZStd::unique_ptr<PrefabProcessor>;
         using PrefabProcessorList = AZStd::vector<PrefabProcessorListEntry>;
 
+        //! The time and memory a single processor stage took during the last call to ProcessPrefab.
+        struct StageStatistics
+        {
+            const char* m_processorName{ nullptr };
+            AZStd::chrono::microseconds m_duration{ 0 };
+            //! Bytes the system allocator had in use when the stage started.
+            size_t m_startAllocatedBytes{ 0 };
+            //! Highest number of bytes the system allocator had in use while the stage ran. This is only tracked when the
+            //! system allocator keeps allocation records, otherwise it's the number of bytes in use after the stage.
+            size_t m_peakAllocatedBytes{ 0 };
+            bool m_isPeakTracked{ false };
+        };
+        using StageStatisticsList = AZStd::vector<StageStatistics>;
+
         bool LoadStackProfile(AZStd::string_view stackProfile);
         bool IsLoaded() const;
 
         void ProcessPrefab(PrefabProcessorContext& context);
+        const StageStatisticsList& GetLastStageStatistics() const;
 
         size_t GetFingerprint() const;
 
@@ -39,6 +55,7 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         size_t CalculateProcessorFingerprint(AZ::SerializeContext* context);
 
         PrefabProcessorList m_processors;
+        StageStatisticsList m_lastStageStatistics;
         size_t m_fingerprint{};
     };
 } // namespace AzToolsFramework::Prefab::PrefabConversionUtils
@@ -39,6 +39,7 @@ namespace AzToolsFramework::Prefab::SpawnableUtils
                 {
                     entities.emplace_back(AZStd::move(entity));
                 });
+            spawnable.InvalidateClonePrograms();
             return true;
         }
         else
@@ -159,6 +160,7 @@ namespace AzToolsFramework::Prefab::SpawnableUtils
     void SortEntitiesByTransformHierarchy(AzFramework::Spawnable& spawnable)
     {
         SortEntitiesByTransformHierarchy(spawnable.GetEntities());
+        spawnable.InvalidateClonePrograms();
     }
 
     template<typename EntityPtr>
@@ -97,6 +97,10 @@ namespace AzToolsFramework
             // you still don't lose data if the application crashes, only if you literally lose power while the disk is writing.
             // and because you're in WAL mode, you only lose the current transaction anyway.
             sqlite3_exec(m_db, "PRAGMA synchronous = 0;", NULL, NULL, NULL);
+
+            // other connections (the asset catalog, tools reading the database) may briefly hold a lock, for example
+            // while the WAL is being checkpointed, so wait for it rather than failing the statement
+            sqlite3_busy_timeout(m_db, 5000);
             return      (res == SQLITE_OK);
         }
 
@@ -107,6 +111,7 @@ namespace AzToolsFramework
                 FinalizeAll();
                 sqlite3_close(m_db);
                 m_db = NULL;
+                m_transactionDepth = 0;
             }
         }
 
@@ -217,7 +222,16 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+
+            if (m_transactionDepth++ == 0)
+            {
+                sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+            }
+            else
+            {
+                AZStd::string savepoint = AZStd::string::format("SAVEPOINT Nested%i;", m_transactionDepth);
+                sqlite3_exec(m_db, savepoint.c_str(), NULL, NULL, NULL);
+            }
         }
 
         void Connection::CommitTransaction()
@@ -227,7 +241,21 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
+
+            AZ_Assert(m_transactionDepth > 0, "CommitTransaction:  No transaction to commit!");
+            if (m_transactionDepth == 1)
+            {
+                sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
+            }
+            else if (m_transactionDepth > 1)
+            {
+                AZStd::string release = AZStd::string::format("RELEASE SAVEPOINT Nested%i;", m_transactionDepth);
+                sqlite3_exec(m_db, release.c_str(), NULL, NULL, NULL);
+            }
+            if (m_transactionDepth > 0)
+            {
+                --m_transactionDepth;
+            }
         }
 
         void Connection::RollbackTransaction()
@@ -237,7 +265,22 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+
+            AZ_Assert(m_transactionDepth > 0, "RollbackTransaction:  No transaction to roll back!");
+            if (m_transactionDepth == 1)
+            {
+                sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+            }
+            else if (m_transactionDepth > 1)
+            {
+                // only undo the writes of the nested transaction, the outer one carries on
+                AZStd::string rollback = AZStd::string::format("ROLLBACK TO SAVEPOINT Nested%i; RELEASE SAVEPOINT Nested%i;", m_transactionDepth, m_transactionDepth);
+                sqlite3_exec(m_db, rollback.c_str(), NULL, NULL, NULL);
+            }
+            if (m_transactionDepth > 0)
+            {
+                --m_transactionDepth;
+            }
         }
 
         void Connection::Vacuum()
@@ -760,7 +803,10 @@ namespace AzToolsFramework
         ScopedTransaction::ScopedTransaction(Connection* connect)
         {
             m_connection = connect;
-            m_connection->BeginTransaction();
+            if (m_connection)
+            {
+                m_connection->BeginTransaction();
+            }
         }
 
         ScopedTransaction::~ScopedTransaction()
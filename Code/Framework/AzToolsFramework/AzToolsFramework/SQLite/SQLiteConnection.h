@@ -46,6 +46,8 @@ namespace AzToolsFramework
             bool IsOpen() const;
 
             // ----- Transaction support -----
+            //! Transactions can be nested, nested transactions are savepoints within the outermost transaction
+            //! so only the outermost one commits to the database
             void BeginTransaction();
             void CommitTransaction();
             void RollbackTransaction();
@@ -87,6 +89,7 @@ namespace AzToolsFramework
 
         private:
             sqlite3* m_db;
+            int m_transactionDepth = 0;
             typedef AZStd::unordered_map< AZStd::string, StatementPrototype* > StatementContainer;
             StatementContainer m_statementPrototypes;
         };
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzToolsFramework/Prefab/Spawnable/PrefabConversionPipeline.h>
+#include <AzToolsFramework/UnitTest/AzToolsFrameworkTestHelpers.h>
+
+namespace UnitTest
+{
+    using namespace AzToolsFramework::Prefab::PrefabConversionUtils;
+
+    // A stage that does nothing, so only what the pipeline itself records about the stage is checked.
+    class PrefabConversionPipelineTestProcessor
+        : public PrefabProcessor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(PrefabConversionPipelineTestProcessor, AZ::SystemAllocator, 0);
+        AZ_RTTI(PrefabConversionPipelineTestProcessor, "{6C1B6A77-3F0E-4C55-9E0D-2B8A7E5C41D2}", PrefabProcessor);
+
+        static void Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+            {
+                serializeContext->Class<PrefabConversionPipelineTestProcessor, PrefabProcessor>()->Version(1);
+            }
+        }
+
+        void Process(PrefabProcessorContext&) override
+        {
+        }
+    };
+
+    // A stage that temporarily allocates a large buffer, which should show up in the peak memory recorded for the stage.
+    class PrefabConversionPipelineAllocatingTestProcessor
+        : public PrefabProcessor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(PrefabConversionPipelineAllocatingTestProcessor, AZ::SystemAllocator, 0);
+        AZ_RTTI(PrefabConversionPipelineAllocatingTestProcessor, "{0E3F8C59-7B0A-4A8F-A2E4-5D9C1B6F2E83}", PrefabProcessor);
+
+        static constexpr size_t AllocationSize = 4 * 1024 * 1024;
+
+        static void Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+            {
+                serializeContext->Class<PrefabConversionPipelineAllocatingTestProcessor, PrefabProcessor>()->Version(1);
+            }
+        }
+
+        void Process(PrefabProcessorContext&) override
+        {
+            AZStd::vector<char> buffer(AllocationSize, 0);
+        }
+    };
+
+    class PrefabConversionPipelineTests
+        : public ToolsApplicationFixture
+    {
+    protected:
+        static constexpr const char* StackProfile = "PrefabConversionPipelineTests";
+        static constexpr const char* StackProfileKey = "/Amazon/Tools/Prefab/Processing/Stack/PrefabConversionPipelineTests";
+
+        void SetUpEditorFixtureImpl() override
+        {
+            AZ::SerializeContext* serializeContext = GetSerializeContext();
+            ASSERT_NE(serializeContext, nullptr);
+            PrefabConversionPipelineTestProcessor::Reflect(serializeContext);
+            PrefabConversionPipelineAllocatingTestProcessor::Reflect(serializeContext);
+
+            auto registry = AZ::SettingsRegistry::Get();
+            ASSERT_NE(registry, nullptr);
+            ASSERT_TRUE(registry->MergeSettings(
+                R"({ "Amazon": { "Tools": { "Prefab": { "Processing": { "Stack": { "PrefabConversionPipelineTests": [
+                    { "$type": "{6C1B6A77-3F0E-4C55-9E0D-2B8A7E5C41D2}" },
+                    { "$type": "{0E3F8C59-7B0A-4A8F-A2E4-5D9C1B6F2E83}" }
+                ] } } } } } })",
+                AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        }
+
+        void TearDownEditorFixtureImpl() override
+        {
+            if (auto registry = AZ::SettingsRegistry::Get(); registry != nullptr)
+            {
+                registry->Remove(StackProfileKey);
+            }
+
+            if (AZ::SerializeContext* serializeContext = GetSerializeContext(); serializeContext != nullptr)
+            {
+                serializeContext->EnableRemoveReflection();
+                PrefabConversionPipelineTestProcessor::Reflect(serializeContext);
+                PrefabConversionPipelineAllocatingTestProcessor::Reflect(serializeContext);
+                serializeContext->DisableRemoveReflection();
+            }
+        }
+
+        static AZ::SerializeContext* GetSerializeContext()
+        {
+            AZ::SerializeContext* serializeContext = nullptr;
+            AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
+            return serializeContext;
+        }
+    };
+
+    TEST_F(PrefabConversionPipelineTests, ProcessPrefab_TwoStages_RecordsStatisticsForEachStageInOrder)
+    {
+        PrefabConversionPipeline pipeline;
+        ASSERT_TRUE(pipeline.LoadStackProfile(StackProfile));
+        EXPECT_TRUE(pipeline.GetLastStageStatistics().empty());
+
+        PrefabProcessorContext context(AZ::Uuid::CreateRandom());
+        pipeline.ProcessPrefab(context);
+
+        const PrefabConversionPipeline::StageStatisticsList& statistics = pipeline.GetLastStageStatistics();
+        ASSERT_EQ(statistics.size(), 2);
+        EXPECT_STREQ(statistics[0].m_processorName, "PrefabConversionPipelineTestProcessor");
+        EXPECT_STREQ(statistics[1].m_processorName, "PrefabConversionPipelineAllocatingTestProcessor");
+        for (const PrefabConversionPipeline::StageStatistics& stage : statistics)
+        {
+            EXPECT_GE(stage.m_duration.count(), 0);
+        }
+    }
+
+    TEST_F(PrefabConversionPipelineTests, ProcessPrefab_ProcessedTwice_StatisticsOnlyCoverTheLastRun)
+    {
+        PrefabConversionPipeline pipeline;
+        ASSERT_TRUE(pipeline.LoadStackProfile(StackProfile));
+
+        PrefabProcessorContext context(AZ::Uuid::CreateRandom());
+        pipeline.ProcessPrefab(context);
+        pipeline.ProcessPrefab(context);
+
+        EXPECT_EQ(pipeline.GetLastStageStatistics().size(), 2);
+    }
+
+    TEST_F(PrefabConversionPipelineTests, ProcessPrefab_StageAllocatesTemporarily_PeakIncludesReleasedAllocation)
+    {
+        PrefabConversionPipeline pipeline;
+        ASSERT_TRUE(pipeline.LoadStackProfile(StackProfile));
+
+        PrefabProcessorContext context(AZ::Uuid::CreateRandom());
+        pipeline.ProcessPrefab(context);
+
+        const PrefabConversionPipeline::StageStatisticsList& statistics = pipeline.GetLastStageStatistics();
+        ASSERT_EQ(statistics.size(), 2);
+        const PrefabConversionPipeline::StageStatistics& stage = statistics[1];
+        // The peak can only be measured if the system allocator keeps allocation records.
+        if (stage.m_isPeakTracked)
+        {
+            // The buffer is released before the stage ends, so it's only visible in the peak.
+            EXPECT_GE(
+                stage.m_peakAllocatedBytes,
+                stage.m_startAllocatedBytes + PrefabConversionPipelineAllocatingTestProcessor::AllocationSize);
+        }
+    }
+} // namespace UnitTest
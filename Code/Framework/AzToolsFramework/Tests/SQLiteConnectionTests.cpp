@@ -126,4 +126,43 @@ namespace UnitTest
         }
     }
 
+    TEST_F(SQLiteTest, NestedTransaction_InnerRolledBack_OuterWritesCommitted)
+    {
+        ASSERT_TRUE(m_database->IsOpen());
+
+        m_database->AddStatement("CreateTable", "CREATE TABLE IF NOT EXISTS testtable( rowID INTEGER PRIMARY KEY, value INTEGER NOT NULL);");
+        m_database->AddStatement("InsertOuter", "INSERT INTO testtable (value) VALUES (1);");
+        m_database->AddStatement("InsertInner", "INSERT INTO testtable (value) VALUES (2);");
+        EXPECT_TRUE(m_database->ExecuteOneOffStatement("CreateTable"));
+
+        {
+            SQLite::ScopedTransaction outer(m_database.get());
+            EXPECT_TRUE(m_database->ExecuteOneOffStatement("InsertOuter"));
+            {
+                // not committed, so only the writes of this transaction are undone
+                SQLite::ScopedTransaction inner(m_database.get());
+                EXPECT_TRUE(m_database->ExecuteOneOffStatement("InsertInner"));
+            }
+            {
+                SQLite::ScopedTransaction inner(m_database.get());
+                EXPECT_TRUE(m_database->ExecuteOneOffStatement("InsertOuter"));
+                inner.Commit();
+            }
+            outer.Commit();
+        }
+
+        int outerRows = 0;
+        int innerRows = 0;
+        EXPECT_TRUE(m_database->ExecuteRawSqlQuery("SELECT value FROM testtable;",
+            [&outerRows, &innerRows](sqlite3_stmt* statement)
+            {
+                const int value = SQLite::GetColumnInt(statement, 0);
+                outerRows += (value == 1) ? 1 : 0;
+                innerRows += (value == 2) ? 1 : 0;
+                return true;
+            }, nullptr));
+
+        EXPECT_EQ(outerRows, 2);
+        EXPECT_EQ(innerRows, 0);
+    }
 }
@@ -7,15 +7,18 @@
  */
 
 #include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/Matrix3x3.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/Module/Environment.h>
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UserSettings/UserSettingsComponent.h>
 
 #include <AzFramework/Application/Application.h>
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformHierarchySystemComponent.h>
 
 #include <AzToolsFramework/Application/ToolsApplication.h>
 #include <AzToolsFramework/ToolsComponents/TransformComponent.h>
@@ -723,6 +726,177 @@ namespace UnitTest
         EXPECT_TRUE(actualChildWorldPos == expectedChildLocalPos);
     }
 
+    // Fixture with a chain of three entities whose world transforms are propagated by the transform hierarchy system.
+    class TransformHierarchySystem
+        : public TransformComponentApplication
+    {
+    protected:
+        static constexpr size_t EntityCount = 3;
+
+        void SetUp() override
+        {
+            TransformComponentApplication::SetUp();
+
+            m_systemEntity = aznew Entity("TransformHierarchySystem");
+            m_hierarchy = m_systemEntity->CreateComponent<TransformHierarchySystemComponent>();
+            m_systemEntity->Init();
+            m_systemEntity->Activate();
+
+            for (size_t i = 0; i < EntityCount; ++i)
+            {
+                m_entities[i] = aznew Entity(AZStd::string::format("Entity%zu", i));
+                m_entities[i]->CreateComponent<TransformComponent>();
+                m_entities[i]->Init();
+                m_entities[i]->Activate();
+                if (i > 0)
+                {
+                    TransformBus::Event(m_entities[i]->GetId(), &TransformBus::Events::SetParent, m_entities[i - 1]->GetId());
+                }
+            }
+            m_hierarchy->PropagateTransforms();
+        }
+
+        void TearDown() override
+        {
+            for (size_t i = EntityCount; i > 0; --i)
+            {
+                m_entities[i - 1]->Deactivate();
+                delete m_entities[i - 1];
+            }
+            m_systemEntity->Deactivate();
+            delete m_systemEntity;
+
+            TransformComponentApplication::TearDown();
+        }
+
+        EntityId GetId(size_t index) const
+        {
+            return m_entities[index]->GetId();
+        }
+
+        Transform GetWorldTM(size_t index) const
+        {
+            Transform worldTM = Transform::CreateIdentity();
+            TransformBus::EventResult(worldTM, GetId(index), &TransformBus::Events::GetWorldTM);
+            return worldTM;
+        }
+
+        Entity* m_systemEntity = nullptr;
+        TransformHierarchySystemComponent* m_hierarchy = nullptr;
+        Entity* m_entities[EntityCount] = {};
+    };
+
+    TEST_F(TransformHierarchySystem, MoveRoot_PropagateTransforms_DescendantsFollow)
+    {
+        const Transform localTM = Transform::CreateTranslation(Vector3(0.0f, 0.0f, 1.0f));
+        TransformBus::Event(GetId(1), &TransformBus::Events::SetLocalTM, localTM);
+        TransformBus::Event(GetId(2), &TransformBus::Events::SetLocalTM, localTM);
+        m_hierarchy->PropagateTransforms();
+
+        const Transform previousWorldTM = GetWorldTM(2);
+        const Transform rootTM = Transform::CreateTranslation(Vector3(1.0f, 2.0f, 3.0f));
+        TransformBus::Event(GetId(0), &TransformBus::Events::SetWorldTM, rootTM);
+
+        // The moved entity is updated immediately, its descendants when the hierarchy is propagated.
+        EXPECT_THAT(GetWorldTM(0), IsClose(rootTM));
+        EXPECT_THAT(GetWorldTM(2), IsClose(previousWorldTM));
+
+        m_hierarchy->PropagateTransforms();
+        EXPECT_THAT(GetWorldTM(1), IsClose(rootTM * localTM));
+        EXPECT_THAT(GetWorldTM(2), IsClose(rootTM * localTM * localTM));
+    }
+
+    TEST_F(TransformHierarchySystem, MoveRootSeveralTimes_PropagateTransforms_NotifiesOncePerEntity)
+    {
+        int rootNotificationCount = 0;
+        int leafNotificationCount = 0;
+        AZ::TransformChangedEvent::Handler rootHandler(
+            [&rootNotificationCount](const Transform&, const Transform&) { ++rootNotificationCount; });
+        AZ::TransformChangedEvent::Handler leafHandler(
+            [&leafNotificationCount](const Transform&, const Transform&) { ++leafNotificationCount; });
+        TransformBus::Event(GetId(0), &TransformBus::Events::BindTransformChangedEventHandler, rootHandler);
+        TransformBus::Event(GetId(2), &TransformBus::Events::BindTransformChangedEventHandler, leafHandler);
+
+        for (int i = 1; i <= 3; ++i)
+        {
+            TransformBus::Event(GetId(0), &TransformBus::Events::SetWorldTranslation, Vector3(static_cast<float>(i), 0.0f, 0.0f));
+        }
+        EXPECT_EQ(rootNotificationCount, 0);
+        EXPECT_EQ(leafNotificationCount, 0);
+
+        m_hierarchy->PropagateTransforms();
+        EXPECT_EQ(rootNotificationCount, 1);
+        EXPECT_EQ(leafNotificationCount, 1);
+        EXPECT_THAT(GetWorldTM(2).GetTranslation(), IsClose(Vector3(3.0f, 0.0f, 0.0f)));
+
+        // Nothing changed since the last propagation, so nothing is sent.
+        m_hierarchy->PropagateTransforms();
+        EXPECT_EQ(rootNotificationCount, 1);
+        EXPECT_EQ(leafNotificationCount, 1);
+    }
+
+    TEST_F(TransformHierarchySystem, Reparent_PropagateTransforms_FollowsNewParent)
+    {
+        const Transform localTM = Transform::CreateTranslation(Vector3(0.0f, 1.0f, 0.0f));
+        TransformBus::Event(GetId(2), &TransformBus::Events::SetParentRelative, GetId(0));
+        TransformBus::Event(GetId(2), &TransformBus::Events::SetLocalTM, localTM);
+
+        const Transform middleTM = Transform::CreateTranslation(Vector3(0.0f, 0.0f, 5.0f));
+        TransformBus::Event(GetId(1), &TransformBus::Events::SetLocalTM, middleTM);
+        const Transform rootTM = Transform::CreateTranslation(Vector3(2.0f, 0.0f, 0.0f));
+        TransformBus::Event(GetId(0), &TransformBus::Events::SetWorldTM, rootTM);
+
+        m_hierarchy->PropagateTransforms();
+        EXPECT_THAT(GetWorldTM(1), IsClose(rootTM * middleTM));
+        EXPECT_THAT(GetWorldTM(2), IsClose(rootTM * localTM));
+    }
+
+    TEST_F(TransformHierarchySystem, DeactivateChild_PropagateTransforms_RemainingEntitiesUpdated)
+    {
+        m_entities[1]->Deactivate();
+
+        const Transform rootTM = Transform::CreateTranslation(Vector3(4.0f, 0.0f, 0.0f));
+        TransformBus::Event(GetId(0), &TransformBus::Events::SetWorldTM, rootTM);
+        m_hierarchy->PropagateTransforms();
+        EXPECT_THAT(GetWorldTM(0), IsClose(rootTM));
+
+        // The reactivated entity keeps its relative transform, so it follows the root again.
+        m_entities[1]->Activate();
+        m_hierarchy->PropagateTransforms();
+        EXPECT_THAT(GetWorldTM(1), IsClose(rootTM));
+
+        const Transform movedRootTM = Transform::CreateTranslation(Vector3(0.0f, 4.0f, 0.0f));
+        TransformBus::Event(GetId(0), &TransformBus::Events::SetWorldTM, movedRootTM);
+        m_hierarchy->PropagateTransforms();
+        EXPECT_THAT(GetWorldTM(1), IsClose(movedRootTM));
+    }
+
+    TEST_F(TransformHierarchySystem, NoJobManager_PropagateTransforms_DescendantsFollow)
+    {
+        // Hide the application's job context, the propagation has to run on the calling thread without one.
+        EnvironmentVariable<JobContext*> globalJobContext = Environment::FindVariable<JobContext*>("GlobalJobContext");
+        JobContext* savedJobContext = globalJobContext ? *globalJobContext : nullptr;
+        if (savedJobContext)
+        {
+            JobContext::SetGlobalContext(nullptr);
+        }
+
+        const Transform localTM = Transform::CreateTranslation(Vector3(0.0f, 0.0f, 1.0f));
+        TransformBus::Event(GetId(1), &TransformBus::Events::SetLocalTM, localTM);
+        TransformBus::Event(GetId(2), &TransformBus::Events::SetLocalTM, localTM);
+        const Transform rootTM = Transform::CreateTranslation(Vector3(1.0f, 2.0f, 3.0f));
+        TransformBus::Event(GetId(0), &TransformBus::Events::SetWorldTM, rootTM);
+
+        m_hierarchy->PropagateTransforms();
+        EXPECT_THAT(GetWorldTM(1), IsClose(rootTM * localTM));
+        EXPECT_THAT(GetWorldTM(2), IsClose(rootTM * localTM * localTM));
+
+        if (savedJobContext)
+        {
+            JobContext::SetGlobalContext(savedJobContext);
+        }
+    }
+
     // Fixture provides TransformComponent that is static (or not static) on an entity that has been activated.
     template<bool IsStatic>
     class StaticOrMovableTransformComponent
@@ -76,6 +76,7 @@ set(FILES
     Prefab/PrefabUpdateInstancesTests.cpp
     Prefab/PrefabUpdateTemplateTests.cpp
     Prefab/PrefabUpdateWithPatchesTests.cpp
+    Prefab/Spawnable/PrefabConversionPipelineTests.cpp
     Prefab/Spawnable/SpawnableMetaDataTests.cpp
     Prefab/SpawnableCreateTests.cpp
     Prefab/SpawnableRemoveEditorInfoTestFixture.cpp
@@ -11,6 +11,10 @@
 #include <QHash>
 #include <QMutex>
 
+#include <chrono>
+
+#include <errno.h>
+#include <poll.h>
 #include <unistd.h>
 #include <sys/inotify.h>
 
@@ -19,20 +23,37 @@ static constexpr int s_handleToFolderMapLockTimeout = 1000;      // 1 sec timeou
 static constexpr size_t s_iNotifyMaxEntries = 1024 * 16;         // Control the maximum number of entries (from inotify) that can be read at one time
 static constexpr size_t s_iNotifyEventSize = sizeof(struct inotify_event);
 static constexpr size_t s_iNotifyReadBufferSize = s_iNotifyMaxEntries * s_iNotifyEventSize;
+static constexpr int s_iNotifyPollTimeoutMS = 50;                // How long to wait for events before checking for shutdown and pending changes
+
+// Changes are held back and merged per file until no events arrived for the quiet period, or the oldest one waited
+// for the max latency, so that a burst of events (a file being written, a folder being copied) is delivered as one batch
+static constexpr std::chrono::milliseconds s_coalesceQuietPeriod(100);
+static constexpr std::chrono::milliseconds s_coalesceMaxLatency(500);
+
+// IN_CLOSE_WRITE is used instead of IN_MODIFY so that a modification is reported once the file has been written,
+// rather than for every write while it is still in progress
+static constexpr uint32_t s_iNotifyWatchMask = IN_CREATE | IN_CLOSE_WRITE | IN_DELETE | IN_DELETE_SELF | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR;
 
 struct FolderRootWatch::PlatformImplementation
 {
+    using Clock = std::chrono::steady_clock;
+
     PlatformImplementation() = default;
 
     int                         m_iNotifyHandle = -1;
     QMutex                      m_handleToFolderMapLock;
     QHash<int, QString>         m_handleToFolderMap;
 
+    // Changes not delivered yet, only accessed from the watch thread
+    FileChangeCoalescer         m_pendingChanges;
+    Clock::time_point           m_firstPendingTime;
+    Clock::time_point           m_lastEventTime;
+
     bool Initialize()
     {
         if (m_iNotifyHandle < 0)
         {
-            m_iNotifyHandle = inotify_init();
+            m_iNotifyHandle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
         }
         return (m_iNotifyHandle >= 0);
     }
@@ -60,55 +81,83 @@ struct FolderRootWatch::PlatformImplementation
             ::close(m_iNotifyHandle);
             m_iNotifyHandle = -1;
         }
+
+        m_pendingChanges.Clear();
+    }
+
+    QString GetWatchFolder(int watchHandle)
+    {
+        if (!m_handleToFolderMapLock.tryLock(s_handleToFolderMapLockTimeout))
+        {
+            AZ_Error("FileWatcher", false, "Unable to obtain inotify handle lock on thread");
+            return QString();
+        }
+        QString folder = m_handleToFolderMap.value(watchHandle);
+        m_handleToFolderMapLock.unlock();
+        return folder;
     }
 
-    void AddWatchFolder(QString folder)
+    bool AddWatch(const QString& folder)
+    {
+        int watchHandle = inotify_add_watch(m_iNotifyHandle, folder.toUtf8().constData(), s_iNotifyWatchMask);
+        if (watchHandle < 0)
+        {
+            AZ_Warning("FileWatcher", errno == ENOENT, "Unable to watch folder %s for changes (error %d)", folder.toUtf8().constData(), errno);
+            return false;
+        }
+
+        if (!m_handleToFolderMapLock.tryLock(s_handleToFolderMapLockTimeout))
+        {
+            AZ_Error("FileWatcher", false, "Unable to obtain inotify handle lock on thread");
+            return false;
+        }
+        m_handleToFolderMap[watchHandle] = folder;
+        m_handleToFolderMapLock.unlock();
+        return true;
+    }
+
+    //! Watches the folder and all of its subfolders. When reportContents is set, the folder and everything already
+    //! inside it is reported as added, since it may have been filled before the watches were in place
+    void AddWatchFolder(QString folder, bool reportContents = false)
     {
         if (m_iNotifyHandle >= 0)
         {
             // Clean up the path before accepting it as a watch folder
             QString cleanPath = QDir::cleanPath(folder);
 
-            // Add the folder to watch and track it
-            int watchHandle = inotify_add_watch(m_iNotifyHandle, 
-                                                cleanPath.toUtf8().constData(),
-                                                IN_CREATE | IN_CLOSE_WRITE | IN_DELETE | IN_DELETE_SELF | IN_MODIFY);
-            
-            if (!m_handleToFolderMapLock.tryLock(s_handleToFolderMapLockTimeout))
+            if (!AddWatch(cleanPath))
             {
-                AZ_Error("FileWatcher", false, "Unable to obtain inotify handle lock on thread");
                 return;
             }
-            m_handleToFolderMap[watchHandle] = cleanPath;
-            m_handleToFolderMapLock.unlock();
+
+            if (reportContents)
+            {
+                QueueChange(cleanPath, FileAction::FileAction_Added);
+            }
 
             // Add all the subfolders to watch and track them
-            QDirIterator dirIter(folder, QDirIterator::Subdirectories | QDirIterator::FollowSymlinks);
+            QDir::Filters filters = reportContents ? (QDir::Dirs | QDir::Files | QDir::NoDotAndDotDot) : (QDir::Dirs | QDir::NoDotAndDotDot);
+            QDirIterator dirIter(cleanPath, filters, QDirIterator::Subdirectories | QDirIterator::FollowSymlinks);
 
             while (dirIter.hasNext())
             {
-                QString dirName = dirIter.next();
-                if (dirName.endsWith("/.") || dirName.endsWith("/.."))
+                QString entryName = dirIter.next();
+                if (dirIter.fileInfo().isDir())
                 {
-                    continue;
+                    AddWatch(entryName);
                 }
-                
-                int watchHandle = inotify_add_watch(m_iNotifyHandle, 
-                                                    dirName.toUtf8().constData(),
-                                                    IN_CREATE | IN_CLOSE_WRITE | IN_DELETE | IN_DELETE_SELF | IN_MODIFY);
 
-                if (!m_handleToFolderMapLock.tryLock(s_handleToFolderMapLockTimeout))
+                if (reportContents)
                 {
-                    AZ_Error("FileWatcher", false, "Unable to obtain inotify handle lock on thread");
-                    return;
+                    QueueChange(entryName, FileAction::FileAction_Added);
                 }
-                m_handleToFolderMap[watchHandle] = dirName;
-                m_handleToFolderMapLock.unlock();
             }
         }
     }
 
-    void RemoveWatchFolder(int watchHandle)
+    //! Stops watching the folder and all of its subfolders, used when a folder is moved away since inotify keeps
+    //! watching a moved folder under its new name
+    void RemoveWatchFolder(const QString& folder)
     {
         if (m_iNotifyHandle >= 0)
         {
@@ -118,16 +167,63 @@ struct FolderRootWatch::PlatformImplementation
                 return;
             }
 
-            QHash<int, QString>::iterator handleToRemove = m_handleToFolderMap.find(watchHandle);
-            if (handleToRemove != m_handleToFolderMap.end())
+            const QString folderPrefix = folder + '/';
+            for (auto handleIter = m_handleToFolderMap.begin(); handleIter != m_handleToFolderMap.end();)
             {
-                inotify_rm_watch(m_iNotifyHandle, watchHandle);
-                m_handleToFolderMap.erase(handleToRemove);
+                if (handleIter.value() == folder || handleIter.value().startsWith(folderPrefix))
+                {
+                    inotify_rm_watch(m_iNotifyHandle, handleIter.key());
+                    handleIter = m_handleToFolderMap.erase(handleIter);
+                }
+                else
+                {
+                    ++handleIter;
+                }
             }
 
             m_handleToFolderMapLock.unlock();
         }
     }
+
+    //! Forgets a watch that inotify already removed, which happens when the watched folder is deleted
+    void ForgetWatch(int watchHandle)
+    {
+        if (!m_handleToFolderMapLock.tryLock(s_handleToFolderMapLockTimeout))
+        {
+            AZ_Error("FileWatcher", false, "Unable to obtain inotify handle lock on thread");
+            return;
+        }
+        m_handleToFolderMap.remove(watchHandle);
+        m_handleToFolderMapLock.unlock();
+    }
+
+    void QueueChange(const QString& path, FileAction action)
+    {
+        const Clock::time_point now = Clock::now();
+        if (m_pendingChanges.IsEmpty())
+        {
+            m_firstPendingTime = now;
+        }
+        m_lastEventTime = now;
+
+        m_pendingChanges.QueueChange(path, action);
+    }
+
+    bool HasChangesReady() const
+    {
+        if (m_pendingChanges.IsEmpty())
+        {
+            return false;
+        }
+
+        const Clock::time_point now = Clock::now();
+        return (now - m_lastEventTime >= s_coalesceQuietPeriod) || (now - m_firstPendingTime >= s_coalesceMaxLatency);
+    }
+
+    QVector<FileChangeInfo> TakeChanges()
+    {
+        return m_pendingChanges.TakeChanges();
+    }
 };
 
 //////////////////////////////////////////////////////////////////////////////
@@ -166,70 +262,110 @@ void FolderRootWatch::Stop()
 {
     m_shutdownThreadSignal = true;
 
-    m_platformImpl->Finalize();
-
+    // The watch loop polls the notify handle with a timeout, so it has to be done with it before it is closed
     if (m_thread.joinable())
     {
         m_thread.join(); // wait for the thread to finish
         m_thread = std::thread(); //destroy
     }
+
+    m_platformImpl->Finalize();
 }
 
 
 void FolderRootWatch::WatchFolderLoop()
 {
     char eventBuffer[s_iNotifyReadBufferSize];
+    pollfd pollDescriptor = { m_platformImpl->m_iNotifyHandle, POLLIN, 0 };
+
     while (!m_shutdownThreadSignal)
     {
-        ssize_t bytesRead = ::read(m_platformImpl->m_iNotifyHandle, eventBuffer, s_iNotifyReadBufferSize);
-        if (bytesRead < 0)
+        int pollResult = ::poll(&pollDescriptor, 1, s_iNotifyPollTimeoutMS);
+        if (pollResult < 0 && errno != EINTR)
         {
-            // Break out of the loop when the notify handle was closed (outside of this thread)
+            AZ_Error("FileWatcher", false, "Unable to wait for file changes in %s (error %d)", m_root.toUtf8().constData(), errno);
             break;
         }
-        else if (bytesRead > 0)
+
+        // Drain everything inotify has queued before looking at the pending changes
+        while (pollResult > 0 && !m_shutdownThreadSignal)
         {
-            for (size_t index=0; index<bytesRead;)
+            ssize_t bytesRead = ::read(m_platformImpl->m_iNotifyHandle, eventBuffer, s_iNotifyReadBufferSize);
+            if (bytesRead <= 0)
+            {
+                break;
+            }
+
+            for (size_t index = 0; index < static_cast<size_t>(bytesRead);)
             {
-                struct inotify_event *event = ( struct inotify_event * ) &eventBuffer[ index ];
-                const char* eventName = event->name;
+                const struct inotify_event* event = reinterpret_cast<const struct inotify_event*>(&eventBuffer[index]);
+                index += s_iNotifyEventSize + event->len;
+
+                if (event->mask & IN_Q_OVERFLOW)
+                {
+                    AZ_Warning("FileWatcher", false, "Too many file changes at once in %s, some of them were missed.", m_root.toUtf8().constData());
+                    continue;
+                }
+
+                if (event->mask & IN_IGNORED)
+                {
+                    // The watched folder is gone, inotify already removed its watch
+                    m_platformImpl->ForgetWatch(event->wd);
+                    continue;
+                }
 
-                if (event->mask & (IN_CREATE | IN_DELETE | IN_MODIFY | IN_MOVE ))
+                if (event->len == 0)
                 {
-                    QString pathStr = QString("%1%2%3").arg(m_platformImpl->m_handleToFolderMap[event->wd], QDir::separator(), event->name);
+                    // Events about a watched folder itself are also reported, by name, to its parent
+                    continue;
+                }
 
-                    if (event->mask & (IN_CREATE | IN_MOVED_TO)) 
+                QString folder = m_platformImpl->GetWatchFolder(event->wd);
+                if (folder.isEmpty())
+                {
+                    // Events still queued for a folder that was moved away
+                    continue;
+                }
+
+                QString pathStr = QString("%1/%2").arg(folder, QString::fromUtf8(event->name));
+
+                if (event->mask & (IN_CREATE | IN_MOVED_TO))
+                {
+                    if (event->mask & IN_ISDIR)
                     {
-                        if ( event->mask & IN_ISDIR ) 
-                        {
-                            // New Directory, add it to the watch
-                            m_platformImpl->AddWatchFolder(pathStr);
-                        }
-                        else 
-                        {
-                            ProcessNewFileEvent(pathStr);
-                        }
+                        // New Directory, add it to the watch, along with anything that was put in it before the watch was added
+                        m_platformImpl->AddWatchFolder(pathStr, true);
                     }
-                    else if (event->mask & (IN_DELETE | IN_MOVED_FROM)) 
+                    else
                     {
-                        if (event->mask & IN_ISDIR) 
-                        {
-                            // Directory Deleted, remove it from the watch
-                            m_platformImpl->RemoveWatchFolder(event->wd);
-                        }
-                        else 
-                        {
-                            ProcessDeleteFileEvent(pathStr);
-                        }
+                        m_platformImpl->QueueChange(pathStr, FileAction::FileAction_Added);
                     }
-                    else if ((event->mask & IN_MODIFY) && ((event->mask & IN_ISDIR) != IN_ISDIR))
+                }
+                else if (event->mask & (IN_DELETE | IN_MOVED_FROM))
+                {
+                    if ((event->mask & (IN_ISDIR | IN_MOVED_FROM)) == (IN_ISDIR | IN_MOVED_FROM))
                     {
-                        ProcessModifyFileEvent(pathStr);
+                        // Directory moved away, inotify would keep reporting its changes under the old name
+                        m_platformImpl->RemoveWatchFolder(pathStr);
                     }
+
+                    // Directories are reported too, the files inside a directory that was moved away are not reported individually
+                    m_platformImpl->QueueChange(pathStr, FileAction::FileAction_Removed);
+                }
+                else if ((event->mask & IN_CLOSE_WRITE) && !(event->mask & IN_ISDIR))
+                {
+                    m_platformImpl->QueueChange(pathStr, FileAction::FileAction_Modified);
                 }
-                index += s_iNotifyEventSize + event->len;
+            }
+        }
+
+        if (m_platformImpl->HasChangesReady())
+        {
+            QVector<FileChangeInfo> changes = m_platformImpl->TakeChanges();
+            if (!changes.isEmpty())
+            {
+                ProcessFileChanges(changes);
             }
         }
     }
 }
-
@@ -44,6 +44,7 @@ set(FILES
     native/tests/FileProcessor/FileProcessorTests.cpp
     native/tests/FileStateCache/FileStateCacheTests.h
     native/tests/FileStateCache/FileStateCacheTests.cpp
+    native/tests/FileWatcher/FileChangeCoalescerTests.cpp
     native/tests/InternalBuilders/SettingsRegistryBuilderTests.cpp
     native/tests/MissingDependencyScannerTests.cpp
     native/tests/SourceFileRelocatorTests.cpp
@@ -160,6 +160,7 @@ namespace AssetProcessor
             "    IsFolder       INTEGER NOT NULL, "
             "    ModTime        INTEGER NOT NULL, "
             "    Hash           INTEGER NOT NULL, "
+            "    FileSize       INTEGER NOT NULL DEFAULT -1, "
             "    FOREIGN KEY (ScanFolderPK) REFERENCES "
             "       ScanFolders(ScanFolderID) ON DELETE CASCADE);";
 
@@ -418,6 +419,15 @@ namespace AssetProcessor
             SqlParam<AZ::Uuid>(":assettype"),
             SqlParam<AZ::Uuid>(":legacyguid"));
 
+        // New products and product dependencies are inserted with statements of up to this many rows each, which keeps the
+        // number of parameters of a statement well below the limit of SQLite
+        static const size_t s_maxRowsPerInsert = 16;
+
+        static const char* INSERT_PRODUCTS = "AssetProcessor::InsertProducts";
+        static const char* INSERT_PRODUCTS_STATEMENT =
+            "INSERT INTO Products (JobPK, SubID, ProductName, AssetType, LegacyGuid) VALUES ";
+        static const size_t s_insertProductsColumnCount = 5;
+
         static const char* UPDATE_PRODUCT = "AssetProcessor::UpdateProduct";
         static const char* UPDATE_PRODUCT_STATEMENT =
             "UPDATE Products SET "
@@ -548,6 +558,11 @@ namespace AssetProcessor
             SqlParam<AZ::u32>(":typeofdependency"),
             SqlParam<AZ::u32>(":fromAssetId"));
 
+        static const char* INSERT_PRODUCT_DEPENDENCIES = "AssetProcessor::InsertProductDependencies";
+        static const char* INSERT_PRODUCT_DEPENDENCIES_STATEMENT =
+            "INSERT INTO ProductDependencies (ProductPK, DependencySourceGuid, DependencySubID, DependencyFlags, Platform, UnresolvedPath, UnresolvedDependencyType, FromAssetId) VALUES ";
+        static const size_t s_insertProductDependenciesColumnCount = 8;
+
         static const char* UPDATE_PRODUCT_DEPENDENCY = "AssetProcessor::UpdateProductDependency";
         static const char* UPDATE_PRODUCT_DEPENDENCY_STATEMENT =
             "UPDATE ProductDependencies SET "
@@ -676,6 +691,11 @@ namespace AssetProcessor
             "ALTER TABLE Files "
             "ADD Hash INTEGER NOT NULL DEFAULT 0;";
 
+        static const char* INSERT_COLUMN_FILE_SIZE = "AssetProcessor::AddFiles_FileSize";
+        static const char* INSERT_COLUMN_FILE_SIZE_STATEMENT =
+            "ALTER TABLE Files "
+            "ADD FileSize INTEGER NOT NULL DEFAULT -1;";
+
         static const char* INSERT_COLUMN_PRODUCTDEPENDENCY_UNRESOLVEDPATH = "AssetProcessor::AddProductDependency_UnresolvedPath";
         static const char* INSERT_COLUMN_PRODUCTDEPENDENCY_UNRESOLVEDPATH_STATEMENT =
             "ALTER TABLE ProductDependencies "
@@ -727,14 +747,15 @@ namespace AssetProcessor
 
         static const char* INSERT_FILE = "AssetProcessor::InsertFile";
         static const char* INSERT_FILE_STATEMENT =
-            "INSERT INTO Files (ScanFolderPK, FileName, IsFolder, ModTime, Hash) "
-            "VALUES (:scanfolderpk, :filename, :isfolder, :modtime, :hash);";
+            "INSERT INTO Files (ScanFolderPK, FileName, IsFolder, ModTime, Hash, FileSize) "
+            "VALUES (:scanfolderpk, :filename, :isfolder, :modtime, :hash, :filesize);";
         static const auto s_InsertFileQuery = MakeSqlQuery(INSERT_FILE, INSERT_FILE_STATEMENT, LOG_NAME,
             SqlParam<AZ::s64>(":scanfolderpk"),
             SqlParam<const char*>(":filename"),
             SqlParam<AZ::s64>(":isfolder"),
             SqlParam<AZ::u64>(":modtime"),
-            SqlParam<AZ::u64>(":hash"));
+            SqlParam<AZ::u64>(":hash"),
+            SqlParam<AZ::s64>(":filesize"));
         
         static const char* UPDATE_FILE = "AssetProcessor::UpdateFile";
         static const char* UPDATE_FILE_STATEMENT =
@@ -743,7 +764,8 @@ namespace AssetProcessor
             "FileName = :filename, "
             "IsFolder = :isfolder, "
             "ModTime = :modtime, "
-            "Hash = :hash "
+            "Hash = :hash, "
+            "FileSize = :filesize "
             "WHERE FileID = :fileid;";
         static const auto s_UpdateFileQuery = MakeSqlQuery(UPDATE_FILE, UPDATE_FILE_STATEMENT, LOG_NAME,
             SqlParam<AZ::s64>(":scanfolderpk"),
@@ -751,18 +773,21 @@ namespace AssetProcessor
             SqlParam<AZ::s64>(":isfolder"),
             SqlParam<AZ::u64>(":modtime"),
             SqlParam<AZ::u64>(":hash"),
+            SqlParam<AZ::s64>(":filesize"),
             SqlParam<AZ::s64>(":fileid"));
 
         static const char* UPDATE_FILE_MODTIME_AND_HASH_BY_FILENAME_SCANFOLDER_ID = "AssetProcessor::UpdateFileModtimeAndHashByFileNameScanFolderId";
         static const char* UPDATE_FILE_MODTIME_AND_HASH_BY_FILENAME_SCANFOLDER_ID_STATEMENT =
             "UPDATE Files SET "
             "ModTime = :modtime, "
-            "Hash = :hash "
+            "Hash = :hash, "
+            "FileSize = :filesize "
             "WHERE FileName = :filename "
             "AND ScanFolderPK = :scanfolderpk;";
         static const auto s_UpdateFileModtimeByFileNameScanFolderIdQuery = MakeSqlQuery(UPDATE_FILE_MODTIME_AND_HASH_BY_FILENAME_SCANFOLDER_ID, UPDATE_FILE_MODTIME_AND_HASH_BY_FILENAME_SCANFOLDER_ID_STATEMENT, LOG_NAME,
             SqlParam<AZ::u64>(":modtime"),
             SqlParam<AZ::u64>(":hash"),
+            SqlParam<AZ::s64>(":filesize"),
             SqlParam<const char*>(":filename"),
             SqlParam<AZ::s64>(":scanfolderpk"));
 
@@ -772,6 +797,75 @@ namespace AssetProcessor
             "FileID = :fileid;";
         static const auto s_DeleteFileQuery = MakeSqlQuery(DELETE_FILE, DELETE_FILE_STATEMENT, LOG_NAME,
             SqlParam<AZ::s64>(":fileid"));
+
+        //////////////////////////////////////////////////////////////////////////
+        // multi-row inserts, there is one statement for each number of rows up to s_maxRowsPerInsert
+
+        AZStd::string GetMultiRowInsertName(const char* statementName, size_t rowCount)
+        {
+            return AZStd::string::format("%s%zu", statementName, rowCount);
+        }
+
+        AZStd::string GetMultiRowInsertStatement(const char* statement, size_t columnCount, size_t rowCount)
+        {
+            AZStd::string rowValues = "(?";
+            for (size_t column = 1; column < columnCount; ++column)
+            {
+                rowValues += ", ?";
+            }
+            rowValues += ")";
+
+            AZStd::string multiRowStatement = statement;
+            for (size_t row = 0; row < rowCount; ++row)
+            {
+                multiRowStatement += row ? ", " : "";
+                multiRowStatement += rowValues;
+            }
+            multiRowStatement += ";";
+            return multiRowStatement;
+        }
+
+        void AddMultiRowInsertStatements(Connection* connection, const char* statementName, const char* statement, size_t columnCount)
+        {
+            for (size_t rowCount = 1; rowCount <= s_maxRowsPerInsert; ++rowCount)
+            {
+                connection->AddStatement(GetMultiRowInsertName(statementName, rowCount), GetMultiRowInsertStatement(statement, columnCount, rowCount));
+            }
+        }
+
+        //! Inserts rowCount rows with as few statements as possible. bindRow binds the values of a row, starting at the parameter index
+        //! it is given, and advances the index past them.
+        bool InsertRows(Connection& connection, const char* statementName, size_t rowCount, const AZStd::function<bool(Statement*, int&, size_t)>& bindRow)
+        {
+            for (size_t firstRow = 0; firstRow < rowCount; firstRow += s_maxRowsPerInsert)
+            {
+                const size_t statementRowCount = AZStd::GetMin(rowCount - firstRow, s_maxRowsPerInsert);
+
+                StatementAutoFinalizer autoFinalizer(connection, GetMultiRowInsertName(statementName, statementRowCount).c_str());
+                Statement* statement = autoFinalizer.Get();
+                if (!statement)
+                {
+                    return false;
+                }
+
+                int parameterIndex = 1;
+                for (size_t row = firstRow; row < firstRow + statementRowCount; ++row)
+                {
+                    if (!bindRow(statement, parameterIndex, row))
+                    {
+                        AZ_Error(LOG_NAME, false, "Failed to bind the values of the %s statement", statementName);
+                        return false;
+                    }
+                }
+
+                if (statement->Step() == Statement::SqlError)
+                {
+                    AZ_Error(LOG_NAME, false, "Failed to execute the %s statement", statementName);
+                    return false;
+                }
+            }
+            return true;
+        }
     }
 
     AssetDatabaseConnection::AssetDatabaseConnection()
@@ -1047,6 +1141,16 @@ namespace AssetProcessor
         // sqlite doesn't not support altering a table to remove a column
         // This is fine as the extra OutputPrefix column will not be queried
 
+        if (foundVersion == AssetDatabase::DatabaseVersion::RemoveOutputPrefixFromScanFolders)
+        {
+            // Existing files get an unknown size, which is filled in the next time their mod time is recorded
+            if (m_databaseConnection->ExecuteOneOffStatement(INSERT_COLUMN_FILE_SIZE))
+            {
+                foundVersion = DatabaseVersion::AddedFileSizeField;
+                AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Upgraded Asset Database to version %i (AddedFileSizeField)\n", foundVersion)
+            }
+        }
+
         if (foundVersion == CurrentDatabaseVersion())
         {
             dropAllTables = false;
@@ -1192,6 +1296,7 @@ namespace AssetProcessor
         m_createStatements.push_back(CREATE_PRODUCT_TABLE);
 
         AddStatement(m_databaseConnection, s_InsertProductQuery);
+        AddMultiRowInsertStatements(m_databaseConnection, INSERT_PRODUCTS, INSERT_PRODUCTS_STATEMENT, s_insertProductsColumnCount);
         AddStatement(m_databaseConnection, s_UpdateProductQuery);
         AddStatement(m_databaseConnection, s_DeleteProductQuery);
         AddStatement(m_databaseConnection, s_DeleteProductsByJobidQuery);
@@ -1237,6 +1342,7 @@ namespace AssetProcessor
         m_createStatements.push_back(CREATE_PRODUCT_DEPENDENCY_TABLE);
 
         AddStatement(m_databaseConnection, s_InsertProductDependencyQuery);
+        AddMultiRowInsertStatements(m_databaseConnection, INSERT_PRODUCT_DEPENDENCIES, INSERT_PRODUCT_DEPENDENCIES_STATEMENT, s_insertProductDependenciesColumnCount);
         AddStatement(m_databaseConnection, s_UpdateProductDependencyQuery);
         AddStatement(m_databaseConnection, s_DeleteProductDependencyByProductIdQuery);
         
@@ -1263,6 +1369,7 @@ namespace AssetProcessor
         m_databaseConnection->AddStatement(DELETE_FILE, DELETE_FILE_STATEMENT);
         m_databaseConnection->AddStatement(INSERT_COLUMN_FILE_MODTIME, INSERT_COLUMN_FILE_MODTIME_STATEMENT);
         m_databaseConnection->AddStatement(INSERT_COLUMN_FILE_HASH, INSERT_COLUMN_FILE_HASH_STATEMENT);
+        m_databaseConnection->AddStatement(INSERT_COLUMN_FILE_SIZE, INSERT_COLUMN_FILE_SIZE_STATEMENT);
         m_databaseConnection->AddStatement(INSERT_COLUMN_LAST_SCAN, INSERT_COLUMN_LAST_SCAN_STATEMENT);
         m_databaseConnection->AddStatement(INSERT_COLUMN_SCAN_TIME_SECONDS_SINCE_EPOCH, INSERT_COLUMN_SCAN_TIME_SECONDS_SINCE_EPOCH_STATEMENT);
         // ---------------------------------------------------------------------------------------------
@@ -1332,6 +1439,11 @@ namespace AssetProcessor
         }
     }
 
+    ScopedTransaction AssetDatabaseConnection::CreateScopedTransaction()
+    {
+        return ScopedTransaction(m_databaseConnection);
+    }
+
     bool AssetDatabaseConnection::GetScanFolderByScanFolderID(AZ::s64 scanfolderID, ScanFolderDatabaseEntry& entry)
     {
         bool found = false;
@@ -2303,12 +2415,91 @@ namespace AssetProcessor
         {
             return false;
         }
-        
+
+        ScopedTransaction transaction(m_databaseConnection);
+
+        // Products that are already in the database are updated one by one, the new ones are inserted with multi-row statements.
+        // A product that is listed again after it was found to be new is set after the insert, so it updates the inserted row.
         bool succeeded = true;
+        AZStd::vector<ProductDatabaseEntry*> newProducts;
+        AZStd::vector<ProductDatabaseEntry*> repeatedProducts;
         for (auto& entry : container)
         {
-            succeeded &= SetProduct(entry);
+            ProductDatabaseEntry existingProduct;
+            if (entry.m_productID != InvalidEntryId || GetProductByJobIDSubId(entry.m_jobPK, entry.m_subID, existingProduct))
+            {
+                succeeded &= SetProduct(entry);
+            }
+            else if (AZStd::find_if(newProducts.begin(), newProducts.end(), [&entry](const ProductDatabaseEntry* newProduct)
+                {
+                    return newProduct->m_jobPK == entry.m_jobPK && newProduct->m_subID == entry.m_subID;
+                }) != newProducts.end())
+            {
+                repeatedProducts.push_back(&entry);
+            }
+            else
+            {
+                newProducts.push_back(&entry);
+            }
+        }
+
+        if (!InsertRows(*m_databaseConnection, INSERT_PRODUCTS, newProducts.size(),
+            [&newProducts](Statement* statement, int& parameterIndex, size_t row)
+            {
+                const ProductDatabaseEntry& entry = *newProducts[row];
+                return Internal::Bind(statement, parameterIndex++, entry.m_jobPK)
+                    && Internal::Bind(statement, parameterIndex++, entry.m_subID)
+                    && Internal::Bind(statement, parameterIndex++, entry.m_productName.c_str())
+                    && Internal::Bind(statement, parameterIndex++, entry.m_assetType)
+                    && Internal::Bind(statement, parameterIndex++, entry.m_legacyGuid);
+            }))
+        {
+            return false; // auto rollback will occur
+        }
+
+        // a multi-row insert only reports the last row ID, so the IDs of the new products are read back once per job
+        AZStd::unordered_set<AZ::s64> newProductJobIds;
+        for (const ProductDatabaseEntry* newProduct : newProducts)
+        {
+            newProductJobIds.insert(newProduct->m_jobPK);
         }
+
+        for (AZ::s64 jobId : newProductJobIds)
+        {
+            ProductDatabaseEntryContainer jobProducts;
+            GetProductsByJobID(jobId, jobProducts);
+            for (ProductDatabaseEntry* newProduct : newProducts)
+            {
+                if (newProduct->m_jobPK != jobId)
+                {
+                    continue;
+                }
+
+                auto jobProductIt = AZStd::find_if(jobProducts.begin(), jobProducts.end(), [newProduct](const ProductDatabaseEntry& jobProduct)
+                    {
+                        return jobProduct.m_subID == newProduct->m_subID;
+                    });
+                if (jobProductIt == jobProducts.end())
+                {
+                    AZ_Error(LOG_NAME, false, "Failed to read back the product %s after inserting it.", newProduct->ToString().c_str());
+                    return false;
+                }
+                newProduct->m_productID = jobProductIt->m_productID;
+            }
+        }
+
+        for (const ProductDatabaseEntry* newProduct : newProducts)
+        {
+            AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Broadcast(
+                &AzToolsFramework::AssetDatabase::AssetDatabaseNotificationBus::Events::OnProductFileChanged, *newProduct);
+        }
+
+        for (ProductDatabaseEntry* repeatedProduct : repeatedProducts)
+        {
+            succeeded &= SetProduct(*repeatedProduct);
+        }
+
+        transaction.Commit();
         return succeeded;
     }
 
@@ -2987,14 +3178,21 @@ namespace AssetProcessor
         }
 
         // now insert the new ones since we know there's no collisions:
-                
-        for (auto& entry : container)
-        {
-
-            if (!s_InsertProductDependencyQuery.BindAndStep(*m_databaseConnection, entry.m_productPK, entry.m_dependencySourceGuid, entry.m_dependencySubID, entry.m_dependencyFlags.to_ullong(), entry.m_platform.c_str(), entry.m_unresolvedPath.c_str(), entry.m_dependencyType, entry.m_fromAssetId))
+        if (!InsertRows(*m_databaseConnection, INSERT_PRODUCT_DEPENDENCIES, container.size(),
+            [&container](Statement* statement, int& parameterIndex, size_t row)
             {
-                return false;
-            }
+                const ProductDependencyDatabaseEntry& entry = container[row];
+                return Internal::Bind(statement, parameterIndex++, entry.m_productPK)
+                    && Internal::Bind(statement, parameterIndex++, entry.m_dependencySourceGuid)
+                    && Internal::Bind(statement, parameterIndex++, entry.m_dependencySubID)
+                    && Internal::Bind(statement, parameterIndex++, static_cast<AZ::s64>(entry.m_dependencyFlags.to_ullong()))
+                    && Internal::Bind(statement, parameterIndex++, entry.m_platform.c_str())
+                    && Internal::Bind(statement, parameterIndex++, entry.m_unresolvedPath.c_str())
+                    && Internal::Bind(statement, parameterIndex++, static_cast<AZ::u32>(entry.m_dependencyType))
+                    && Internal::Bind(statement, parameterIndex++, entry.m_fromAssetId);
+            }))
+        {
+            return false; // auto rollback will occur
         }
 
         transaction.Commit();
@@ -3062,7 +3260,7 @@ namespace AssetProcessor
         {
             StatementAutoFinalizer autoFinal;
 
-            if (!s_InsertFileQuery.Bind(*m_databaseConnection, autoFinal, entry.m_scanFolderPK, entry.m_fileName.c_str(), static_cast<AZ::s64>(entry.m_isFolder), entry.m_modTime, entry.m_hash))
+            if (!s_InsertFileQuery.Bind(*m_databaseConnection, autoFinal, entry.m_scanFolderPK, entry.m_fileName.c_str(), static_cast<AZ::s64>(entry.m_isFolder), entry.m_modTime, entry.m_hash, entry.m_fileSize))
             {
                 return false;
             }
@@ -3101,7 +3299,7 @@ namespace AssetProcessor
             }
             StatementAutoFinalizer autoFinal;
 
-            if (!s_InsertFileQuery.Bind(*m_databaseConnection, autoFinal, entry.m_scanFolderPK, entry.m_fileName.c_str(), static_cast<AZ::s64>(entry.m_isFolder), entry.m_modTime, entry.m_hash))
+            if (!s_InsertFileQuery.Bind(*m_databaseConnection, autoFinal, entry.m_scanFolderPK, entry.m_fileName.c_str(), static_cast<AZ::s64>(entry.m_isFolder), entry.m_modTime, entry.m_hash, entry.m_fileSize))
             {
                 return false;
             }
@@ -3142,7 +3340,8 @@ namespace AssetProcessor
         if ((existingEntry.m_scanFolderPK == entry.m_scanFolderPK) &&
             (existingEntry.m_fileName == entry.m_fileName) &&
             (existingEntry.m_isFolder == entry.m_isFolder) &&
-            (existingEntry.m_modTime == entry.m_modTime))
+            (existingEntry.m_modTime == entry.m_modTime) &&
+            (existingEntry.m_fileSize == entry.m_fileSize))
         {
             entryAlreadyExists = true;
 
@@ -3150,7 +3349,7 @@ namespace AssetProcessor
         }
 
         StatementAutoFinalizer autoFinal;
-        if (!s_UpdateFileQuery.BindAndStep(*m_databaseConnection, entry.m_scanFolderPK, entry.m_fileName.c_str(), entry.m_isFolder, entry.m_modTime, entry.m_hash, entry.m_fileID))
+        if (!s_UpdateFileQuery.BindAndStep(*m_databaseConnection, entry.m_scanFolderPK, entry.m_fileName.c_str(), entry.m_isFolder, entry.m_modTime, entry.m_hash, entry.m_fileSize, entry.m_fileID))
         {
             return false;
         }
@@ -3158,9 +3357,9 @@ namespace AssetProcessor
         return true;
     }
 
-    bool AssetDatabaseConnection::UpdateFileModTimeAndHashByFileNameAndScanFolderId(QString fileName, AZ::s64 scanFolderId, AZ::u64 modTime, AZ::u64 hash)
+    bool AssetDatabaseConnection::UpdateFileModTimeAndHashByFileNameAndScanFolderId(QString fileName, AZ::s64 scanFolderId, AZ::u64 modTime, AZ::u64 hash, AZ::s64 fileSize)
     {
-        if(!s_UpdateFileModtimeByFileNameScanFolderIdQuery.BindAndStep(*m_databaseConnection, modTime, hash, fileName.toUtf8().constData(), scanFolderId))
+        if(!s_UpdateFileModtimeByFileNameScanFolderIdQuery.BindAndStep(*m_databaseConnection, modTime, hash, fileSize, fileName.toUtf8().constData(), scanFolderId))
         {
             return false;
         }
@@ -13,6 +13,7 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzToolsFramework/AssetDatabase/AssetDatabaseConnection.h>
+#include <AzToolsFramework/SQLite/SQLiteConnection.h>
 
 #include <QtCore/QSet>
 #include <QtCore/QString>
@@ -44,6 +45,11 @@ namespace AssetProcessor
         } 
         void VacuumAndAnalyze();
 
+        //! Groups all the writes made until the transaction is committed into a single transaction, which is much cheaper
+        //! than committing every write on its own. The writes are rolled back if it goes out of scope without being
+        //! committed. Transactions nest, only the outermost one commits to the database.
+        AzToolsFramework::SQLite::ScopedTransaction CreateScopedTransaction();
+
     protected:
         void CreateStatements() override;
         bool PostOpenDatabase() override;
@@ -217,8 +223,8 @@ namespace AssetProcessor
         bool InsertFile(AzToolsFramework::AssetDatabase::FileDatabaseEntry& entry, bool& entryAlreadyExists);
         bool UpdateFile(AzToolsFramework::AssetDatabase::FileDatabaseEntry& entry, bool& entryAlreadyExists);
         
-        // updates the modtime and hash for a file if it exists.  Only returns true if the row existed and was successfully updated
-        bool UpdateFileModTimeAndHashByFileNameAndScanFolderId(QString fileName, AZ::s64 scanFolderId, AZ::u64 modTime, AZ::u64 hash);
+        // updates the modtime, hash and size for a file if it exists.  Only returns true if the row existed and was successfully updated
+        bool UpdateFileModTimeAndHashByFileNameAndScanFolderId(QString fileName, AZ::s64 scanFolderId, AZ::u64 modTime, AZ::u64 hash, AZ::s64 fileSize);
         bool RemoveFile(AZ::s64 sourceID);
     protected:
         void SetDatabaseVersion(AzToolsFramework::AssetDatabase::DatabaseVersion ver);
@@ -132,6 +132,7 @@ namespace AssetProcessor
             m_sourceFilesInDatabase.clear();
             m_fileModTimes.clear();
             m_fileHashes.clear();
+            m_fileSizes.clear();
 
             auto sourcesFunction = [this](AzToolsFramework::AssetDatabase::SourceAndScanFolderDatabaseEntry& entry)
             {
@@ -171,6 +172,10 @@ namespace AssetProcessor
                 QString finalAbsolute = (QString("%1/%2").arg(scanFolderPath).arg(relativeToScanFolderPath));
                 m_fileModTimes.emplace(finalAbsolute.toUtf8().data(), entry.m_modTime);
                 m_fileHashes.emplace(finalAbsolute.toUtf8().constData(), entry.m_hash);
+                if (entry.m_fileSize != AzToolsFramework::AssetDatabase::UnknownFileSize)
+                {
+                    m_fileSizes.emplace(finalAbsolute.toUtf8().constData(), entry.m_fileSize);
+                }
 
                 return true;
             });
@@ -1233,63 +1238,86 @@ namespace AssetProcessor
             }
 
             //set the new products
-            for (size_t productIdx = 0; productIdx < newProducts.size(); ++productIdx)
+            // all the rows of the new products are written in a single transaction, the new products and their dependencies with
+            // multi-row inserts. it is committed before anyone is notified about the products, so they can find them in the database
+            AZStd::vector<AZStd::unordered_set<AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry>> newDependencySets(newProducts.size());
             {
-                AZStd::unordered_set<AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry> dependencySet;
-
-                auto& pair = newProducts[productIdx];
-                auto pathDependencies = AZStd::move(pair.second->m_pathDependencies);
-
-                AZStd::vector<AssetBuilderSDK::ProductDependency> resolvedDependencies;
-                m_pathDependencyManager->ResolveDependencies(pathDependencies, resolvedDependencies, job.m_platform, pair.first.m_productName);
+                auto transaction = m_stateData->CreateScopedTransaction();
 
-                AzToolsFramework::AssetDatabase::ProductDatabaseEntry productEntry;
-                if (pair.first.m_productID == AzToolsFramework::AssetDatabase::InvalidEntryId)
+                AzToolsFramework::AssetDatabase::ProductDatabaseEntryContainer productEntries;
+                productEntries.reserve(newProducts.size());
+                for (const auto& pair : newProducts)
                 {
-                    m_stateData->GetProductByJobIDSubId(pair.first.m_jobPK, pair.second->m_productSubID, productEntry);
+                    productEntries.push_back(pair.first);
                 }
-
-                WriteProductTableInfo(pair, newLegacySubIDs[productIdx], dependencySet, job.m_platform);
-
-                // Add the resolved path dependencies to the dependency set
-                for (const auto& resolvedPathDep : resolvedDependencies)
+                if (!productEntries.empty() && !m_stateData->SetProducts(productEntries))
                 {
-                    dependencySet.emplace(pair.first.m_productID, resolvedPathDep.m_dependencyId.m_guid, resolvedPathDep.m_dependencyId.m_subId, resolvedPathDep.m_flags, job.m_platform, false);
+                    AZ_Error(AssetProcessor::ConsoleChannel, false, "Failed to set the new products of %s in the database!!!",
+                        processedAsset.m_entry.m_pathRelativeToWatchFolder.toUtf8().constData());
                 }
 
-                // Ensure this product does not list itself as a product dependency
-                auto conflictItr = find_if(dependencySet.begin(), dependencySet.end(),
-                    [&](AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry& dependencyEntry)
+                AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntryContainer dependencyContainer;
+                AZStd::vector<AssetBuilderSDK::ProductPathDependencySet> unresolvedPathDependencies(newProducts.size());
+                for (size_t productIdx = 0; productIdx < newProducts.size(); ++productIdx)
+                {
+                    AZStd::unordered_set<AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry>& dependencySet = newDependencySets[productIdx];
+
+                    auto& pair = newProducts[productIdx];
+                    pair.first.m_productID = productEntries[productIdx].m_productID;
+                    auto& pathDependencies = unresolvedPathDependencies[productIdx];
+                    pathDependencies = AZStd::move(pair.second->m_pathDependencies);
+
+                    AZStd::vector<AssetBuilderSDK::ProductDependency> resolvedDependencies;
+                    m_pathDependencyManager->ResolveDependencies(pathDependencies, resolvedDependencies, job.m_platform, pair.first.m_productName);
+
+                    WriteProductTableInfo(pair, newLegacySubIDs[productIdx], dependencySet, job.m_platform);
+
+                    // Add the resolved path dependencies to the dependency set
+                    for (const auto& resolvedPathDep : resolvedDependencies)
                     {
-                        return dependencyEntry.m_dependencySubID == pair.first.m_subID
-                            && dependencyEntry.m_dependencySourceGuid == source.m_sourceGuid; 
-                    });
+                        dependencySet.emplace(pair.first.m_productID, resolvedPathDep.m_dependencyId.m_guid, resolvedPathDep.m_dependencyId.m_subId, resolvedPathDep.m_flags, job.m_platform, false);
+                    }
 
-                if (conflictItr != dependencySet.end())
-                {
-                    dependencySet.erase(conflictItr);
-                    AZ_Warning(AssetProcessor::ConsoleChannel, false,
-                        "Invalid dependency: Product Asset ( %s ) has listed itself as one of its own Product Dependencies.",
-                        pair.first.m_productName.c_str());
-                }
+                    // Ensure this product does not list itself as a product dependency
+                    auto conflictItr = find_if(dependencySet.begin(), dependencySet.end(),
+                        [&](AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry& dependencyEntry)
+                        {
+                            return dependencyEntry.m_dependencySubID == pair.first.m_subID
+                                && dependencyEntry.m_dependencySourceGuid == source.m_sourceGuid; 
+                        });
 
-                // Add all dependencies to the dependency container
-                AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntryContainer dependencyContainer;
-                dependencyContainer.reserve(dependencySet.size());
+                    if (conflictItr != dependencySet.end())
+                    {
+                        dependencySet.erase(conflictItr);
+                        AZ_Warning(AssetProcessor::ConsoleChannel, false,
+                            "Invalid dependency: Product Asset ( %s ) has listed itself as one of its own Product Dependencies.",
+                            pair.first.m_productName.c_str());
+                    }
 
-                for(const auto& entry : dependencySet)
-                {
-                    dependencyContainer.push_back(entry);
+                    // Add all dependencies to the dependency container
+                    dependencyContainer.insert(dependencyContainer.end(), dependencySet.begin(), dependencySet.end());
                 }
 
-                // Set the new dependencies
+                // Set the new dependencies of all the products
                 if (!m_stateData->SetProductDependencies(dependencyContainer))
                 {
                     AZ_Error(AssetProcessor::ConsoleChannel, false, "Failed to set product dependencies");
                 }
 
-                // Save any unresolved dependencies
-                m_pathDependencyManager->SaveUnresolvedDependenciesToDatabase(pathDependencies, pair.first, job.m_platform);
+                // Save any unresolved dependencies. This has to come after the new dependencies are set, setting them replaces all the
+                // dependencies of a product
+                for (size_t productIdx = 0; productIdx < newProducts.size(); ++productIdx)
+                {
+                    m_pathDependencyManager->SaveUnresolvedDependenciesToDatabase(unresolvedPathDependencies[productIdx], newProducts[productIdx].first, job.m_platform);
+                }
+
+                transaction.Commit();
+            }
+
+            for (size_t productIdx = 0; productIdx < newProducts.size(); ++productIdx)
+            {
+                auto& pair = newProducts[productIdx];
+                const AZStd::unordered_set<AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry>& dependencySet = newDependencySets[productIdx];
 
                 // now we need notify everyone about the new products
                 AzToolsFramework::AssetDatabase::ProductDatabaseEntry& newProduct = pair.first;
@@ -1376,7 +1404,8 @@ namespace AssetProcessor
     {
         AzToolsFramework::AssetDatabase::ProductDatabaseEntry& newProduct = pair.first;
         const AssetBuilderSDK::JobProduct* jobProduct = pair.second;
-        if (!m_stateData->SetProduct(newProduct))
+        // the product itself is written together with the other products of its job, it has no ID if that failed
+        if (newProduct.m_productID == AzToolsFramework::AssetDatabase::InvalidEntryId)
         {
             //somethings wrong...
             AZ_Error(AssetProcessor::ConsoleChannel, false, "Failed to set new product in the the database!!! %s", newProduct.ToString().c_str());
@@ -1496,7 +1525,8 @@ namespace AssetProcessor
 
                     m_stateData->UpdateFileModTimeAndHashByFileNameAndScanFolderId(databaseName, scanFolder->ScanFolderID(),
                         AssetUtilities::AdjustTimestamp(metadataFileInfo.lastModified()),
-                        AssetUtilities::GetFileHash(metadataFileInfo.absoluteFilePath().toUtf8().constData()));
+                        AssetUtilities::GetFileHash(metadataFileInfo.absoluteFilePath().toUtf8().constData()),
+                        metadataFileInfo.size());
                 }
                 else
                 {
@@ -2046,7 +2076,8 @@ namespace AssetProcessor
 
             m_stateData->UpdateFileModTimeAndHashByFileNameAndScanFolderId(databaseSourceFile, scanFolder->ScanFolderID(),
                 AssetUtilities::AdjustTimestamp(lastModifiedTime),
-                AssetUtilities::GetFileHash(fileInfo.absoluteFilePath().toUtf8().constData()));
+                AssetUtilities::GetFileHash(fileInfo.absoluteFilePath().toUtf8().constData()),
+                fileInfo.size());
         }
     }
 
@@ -2825,6 +2856,9 @@ namespace AssetProcessor
     {
         int processedFileCount = 0;
 
+        // the mod times of all the unchanged files are updated in a single transaction
+        auto transaction = m_stateData->CreateScopedTransaction();
+
         for (const AssetFileInfo& fileInfo : filePaths)
         {
             if (m_allowModtimeSkippingFeature)
@@ -2840,7 +2874,7 @@ namespace AssetProcessor
                         m_platformConfig->ConvertToRelativePath(fileInfo.m_filePath, fileInfo.m_scanFolder, databaseName);
 
                         // Update the modtime in the db since its possible that the hash is the same, but the modtime is out of date.  Recording the current modtime will allow us to skip hashing the file in the future if no changes are made
-                        bool updated = m_stateData->UpdateFileModTimeAndHashByFileNameAndScanFolderId(databaseName, fileInfo.m_scanFolder->ScanFolderID(), AssetUtilities::AdjustTimestamp(fileInfo.m_modTime), fileHash);
+                        bool updated = m_stateData->UpdateFileModTimeAndHashByFileNameAndScanFolderId(databaseName, fileInfo.m_scanFolder->ScanFolderID(), AssetUtilities::AdjustTimestamp(fileInfo.m_modTime), fileHash, aznumeric_cast<AZ::s64>(fileInfo.m_fileSize));
 
                         if(!updated)
                         {
@@ -2856,6 +2890,8 @@ namespace AssetProcessor
             AssessFileInternal(fileInfo.m_filePath, false, true);
         }
 
+        transaction.Commit();
+
         if (m_allowModtimeSkippingFeature)
         {
             AZ_TracePrintf(AssetProcessor::DebugChannel, "%d files reported from scanner.  %d unchanged files skipped, %d files processed\n", filePaths.size(), filePaths.size() - processedFileCount, processedFileCount);
@@ -2892,6 +2928,19 @@ namespace AssetProcessor
             return false;
         }
 
+        auto sizeItr = m_fileSizes.find(fileInfo.m_filePath.toUtf8().constData());
+        if (sizeItr != m_fileSizes.end())
+        {
+            AZ::s64 databaseFileSize = sizeItr->second;
+            m_fileSizes.erase(sizeItr);
+
+            if (databaseFileSize != aznumeric_cast<AZ::s64>(fileInfo.m_fileSize))
+            {
+                // The size changed, so the contents did too.  No need to compare timestamps or hash the file
+                return false;
+            }
+        }
+
         auto thisModTime = aznumeric_cast<decltype(databaseModTime)>(AssetUtilities::AdjustTimestamp(fileInfo.m_modTime));
 
         if (databaseModTime != thisModTime)
@@ -4348,7 +4397,8 @@ namespace AssetProcessor
 
         m_stateData->UpdateFileModTimeAndHashByFileNameAndScanFolderId(databaseSourceName.toUtf8().constData(), scanFolderPk,
             AssetUtilities::AdjustTimestamp(lastModifiedTime),
-            AssetUtilities::GetFileHash(fileInfo.absoluteFilePath().toUtf8().constData()));
+            AssetUtilities::GetFileHash(fileInfo.absoluteFilePath().toUtf8().constData()),
+            fileInfo.size());
 
         m_remainingJobsForEachSourceFile.erase(foundTrackingInfo);
     }
@@ -424,6 +424,9 @@ namespace AssetProcessor
         // this map contains hashes of all files AP processed last time it ran
         AZStd::unordered_map<AZStd::string, AZ::u64> m_fileHashes;
 
+        // this map contains the sizes of all files AP processed last time it ran, if they were recorded
+        AZStd::unordered_map<AZStd::string, AZ::s64> m_fileSizes;
+
         QSet<QString> m_knownFolders; // a cache of all known folder names, normalized to have forward slashes.
         typedef AZStd::unordered_map<AZ::u64, AzToolsFramework::AssetSystem::JobInfo> JobRunKeyToJobInfoMap;  // for when network requests come in about the jobInfo
 
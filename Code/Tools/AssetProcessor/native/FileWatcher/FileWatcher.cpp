@@ -8,6 +8,60 @@
 #include "FileWatcher.h"
 #include <native/assetprocessor.h>
 
+//////////////////////////////////////////////////////////////////////////////
+/// FileChangeCoalescer
+void FileChangeCoalescer::QueueChange(const QString& path, FileAction action)
+{
+    auto pendingIter = m_pendingChangeIndices.find(path);
+    if (pendingIter == m_pendingChangeIndices.end() || m_pendingChanges[pendingIter.value()].m_action == FileAction::FileAction_None)
+    {
+        FileChangeInfo info;
+        info.m_action = action;
+        info.m_filePath = path;
+        m_pendingChangeIndices[path] = m_pendingChanges.size();
+        m_pendingChanges.push_back(info);
+        return;
+    }
+
+    // Merge with the change that is already pending for this file
+    FileAction& pendingAction = m_pendingChanges[pendingIter.value()].m_action;
+    if (action == FileAction::FileAction_Removed)
+    {
+        pendingAction = (pendingAction == FileAction::FileAction_Added) ? FileAction::FileAction_None : FileAction::FileAction_Removed;
+    }
+    else if (pendingAction != FileAction::FileAction_Added)
+    {
+        pendingAction = FileAction::FileAction_Modified;
+    }
+}
+
+bool FileChangeCoalescer::IsEmpty() const
+{
+    return m_pendingChanges.isEmpty();
+}
+
+QVector<FileChangeInfo> FileChangeCoalescer::TakeChanges()
+{
+    QVector<FileChangeInfo> changes;
+    changes.reserve(m_pendingChanges.size());
+    for (const FileChangeInfo& change : m_pendingChanges)
+    {
+        if (change.m_action != FileAction::FileAction_None)
+        {
+            changes.push_back(change);
+        }
+    }
+
+    Clear();
+    return changes;
+}
+
+void FileChangeCoalescer::Clear()
+{
+    m_pendingChanges.clear();
+    m_pendingChangeIndices.clear();
+}
+
 //////////////////////////////////////////////////////////////////////////////
 /// FolderWatchRoot
 void FolderRootWatch::ProcessNewFileEvent(const QString& file)
@@ -37,12 +91,19 @@ void FolderRootWatch::ProcessModifyFileEvent(const QString& file)
     Q_ASSERT(invoked);
 }
 
+void FolderRootWatch::ProcessFileChanges(const QVector<FileChangeInfo>& changes)
+{
+    const bool invoked = QMetaObject::invokeMethod(m_fileWatcher, "OnFileChanges", Qt::QueuedConnection, Q_ARG(QVector<FileChangeInfo>, changes));
+    Q_ASSERT(invoked);
+}
+
 //////////////////////////////////////////////////////////////////////////
 /// FileWatcher
 FileWatcher::FileWatcher()
     : m_nextHandle(0)
 {
     qRegisterMetaType<FileChangeInfo>("FileChangeInfo");
+    qRegisterMetaType<QVector<FileChangeInfo>>("QVector<FileChangeInfo>");
 }
 
 FileWatcher::~FileWatcher()
@@ -156,6 +217,14 @@ void FileWatcher::RemoveFolderWatch(int handle)
     }
 }
 
+void FileWatcher::OnFileChanges(QVector<FileChangeInfo> changes)
+{
+    for (const FileChangeInfo& info : changes)
+    {
+        Q_EMIT AnyFileChange(info);
+    }
+}
+
 void FileWatcher::StartWatching()
 {
     if (m_startedWatching)
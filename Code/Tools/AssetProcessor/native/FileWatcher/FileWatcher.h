@@ -13,6 +13,7 @@
 #include "FileWatcherAPI.h"
 
 #include <AzCore/std/containers/vector.h>
+#include <QHash>
 #include <QMap>
 #include <QVector>
 #include <QString>
@@ -22,6 +23,33 @@
 
 class FileWatcher;
 
+//////////////////////////////////////////////////////////////////////////
+//! FileChangeCoalescer
+/*! Merges the changes reported for each file until they are taken, so a burst of
+ *! events for one file is delivered as a single change.
+ * */
+class FileChangeCoalescer
+{
+public:
+    //! Records a change, merging it with the change already pending for the same path:
+    //!  - added then removed cancels out, the file never needs to be seen
+    //!  - removed then added becomes modified, which is how many tools save a file
+    //!  - added then modified stays added
+    void QueueChange(const QString& path, FileAction action);
+
+    bool IsEmpty() const;
+
+    //! Returns the pending changes, in the order their paths first changed, and clears them
+    QVector<FileChangeInfo> TakeChanges();
+
+    void Clear();
+
+private:
+    // Changes that cancel out are left in the list with FileAction_None so the indices stay valid
+    QVector<FileChangeInfo> m_pendingChanges;
+    QHash<QString, int> m_pendingChangeIndices;
+};
+
 //////////////////////////////////////////////////////////////////////////
 //! FolderRootWatch
 /*! Class used for holding a point in the files system from which file changes are tracked.
@@ -40,6 +68,8 @@ public:
     void ProcessDeleteFileEvent(const QString& file);
     void ProcessModifyFileEvent(const QString& file);
     void ProcessRenameFileEvent(const QString& fileOld, const QString& fileNew);
+    //! Delivers a batch of changes to the file watcher with a single queued call
+    void ProcessFileChanges(const QVector<FileChangeInfo>& changes);
 
 public Q_SLOTS:
     bool Start();
@@ -86,6 +116,9 @@ public:
 Q_SIGNALS:
     void AnyFileChange(FileChangeInfo info);
 
+private Q_SLOTS:
+    void OnFileChanges(QVector<FileChangeInfo> changes);
+
 private:
     int m_nextHandle;
     AZStd::vector<FolderRootWatch*> m_folderWatchRoots;
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <native/FileWatcher/FileWatcher.h>
+
+namespace UnitTests
+{
+    TEST(FileChangeCoalescerTests, QueueChange_AddedThenRemoved_Dropped)
+    {
+        FileChangeCoalescer coalescer;
+        coalescer.QueueChange("/watched/file.txt", FileAction::FileAction_Added);
+        coalescer.QueueChange("/watched/file.txt", FileAction::FileAction_Modified);
+        coalescer.QueueChange("/watched/file.txt", FileAction::FileAction_Removed);
+
+        EXPECT_TRUE(coalescer.TakeChanges().isEmpty());
+        EXPECT_TRUE(coalescer.IsEmpty());
+    }
+
+    TEST(FileChangeCoalescerTests, QueueChange_RemovedThenAdded_Modified)
+    {
+        FileChangeCoalescer coalescer;
+        coalescer.QueueChange("/watched/file.txt", FileAction::FileAction_Removed);
+        coalescer.QueueChange("/watched/file.txt", FileAction::FileAction_Added);
+
+        QVector<FileChangeInfo> changes = coalescer.TakeChanges();
+        ASSERT_EQ(changes.size(), 1);
+        EXPECT_EQ(changes[0].m_action, FileAction::FileAction_Modified);
+        EXPECT_EQ(changes[0].m_filePath, QString("/watched/file.txt"));
+    }
+
+    TEST(FileChangeCoalescerTests, QueueChange_AddedThenModified_Added)
+    {
+        FileChangeCoalescer coalescer;
+        coalescer.QueueChange("/watched/file.txt", FileAction::FileAction_Added);
+        coalescer.QueueChange("/watched/file.txt", FileAction::FileAction_Modified);
+
+        QVector<FileChangeInfo> changes = coalescer.TakeChanges();
+        ASSERT_EQ(changes.size(), 1);
+        EXPECT_EQ(changes[0].m_action, FileAction::FileAction_Added);
+    }
+
+    TEST(FileChangeCoalescerTests, QueueChange_ModifiedThenRemoved_Removed)
+    {
+        FileChangeCoalescer coalescer;
+        coalescer.QueueChange("/watched/file.txt", FileAction::FileAction_Modified);
+        coalescer.QueueChange("/watched/file.txt", FileAction::FileAction_Removed);
+
+        QVector<FileChangeInfo> changes = coalescer.TakeChanges();
+        ASSERT_EQ(changes.size(), 1);
+        EXPECT_EQ(changes[0].m_action, FileAction::FileAction_Removed);
+    }
+
+    TEST(FileChangeCoalescerTests, QueueChange_AddedAgainAfterDropped_Added)
+    {
+        FileChangeCoalescer coalescer;
+        coalescer.QueueChange("/watched/file.txt", FileAction::FileAction_Added);
+        coalescer.QueueChange("/watched/file.txt", FileAction::FileAction_Removed);
+        coalescer.QueueChange("/watched/file.txt", FileAction::FileAction_Added);
+
+        QVector<FileChangeInfo> changes = coalescer.TakeChanges();
+        ASSERT_EQ(changes.size(), 1);
+        EXPECT_EQ(changes[0].m_action, FileAction::FileAction_Added);
+    }
+
+    TEST(FileChangeCoalescerTests, TakeChanges_SeveralFiles_KeepsFirstChangeOrder)
+    {
+        FileChangeCoalescer coalescer;
+        coalescer.QueueChange("/watched/b.txt", FileAction::FileAction_Added);
+        coalescer.QueueChange("/watched/a.txt", FileAction::FileAction_Modified);
+        coalescer.QueueChange("/watched/b.txt", FileAction::FileAction_Modified);
+        coalescer.QueueChange("/watched/c.txt", FileAction::FileAction_Removed);
+
+        QVector<FileChangeInfo> changes = coalescer.TakeChanges();
+        ASSERT_EQ(changes.size(), 3);
+        EXPECT_EQ(changes[0].m_filePath, QString("/watched/b.txt"));
+        EXPECT_EQ(changes[0].m_action, FileAction::FileAction_Added);
+        EXPECT_EQ(changes[1].m_filePath, QString("/watched/a.txt"));
+        EXPECT_EQ(changes[1].m_action, FileAction::FileAction_Modified);
+        EXPECT_EQ(changes[2].m_filePath, QString("/watched/c.txt"));
+        EXPECT_EQ(changes[2].m_action, FileAction::FileAction_Removed);
+
+        EXPECT_TRUE(coalescer.IsEmpty());
+        EXPECT_TRUE(coalescer.TakeChanges().isEmpty());
+    }
+}
@@ -1166,6 +1166,86 @@ namespace UnitTests
         EXPECT_EQ(m_errorAbsorber->m_numAssertsAbsorbed, 0); // not allowed to assert on this
     }
 
+    TEST_F(AssetDatabaseTest, SetProducts_MoreProductsThanOneInsertHolds_AllProductsWrittenWithTheirIDs)
+    {
+        CreateCoverageTestData();
+
+        ProductDatabaseEntryContainer resultProducts;
+        EXPECT_TRUE(m_data->m_connection.GetProducts(resultProducts));
+        size_t priorProductCount = resultProducts.size();
+
+        // enough new products for several multi-row inserts and one that is only partially filled, on two jobs
+        ProductDatabaseEntryContainer requestProducts;
+        const AZ::u32 newProductCount = 37;
+        for (AZ::u32 subId = 100; subId < 100 + newProductCount; ++subId)
+        {
+            const AZ::s64 jobId = (subId % 2) ? m_data->m_job1.m_jobID : m_data->m_job2.m_jobID;
+            requestProducts.push_back({ jobId, subId, AZStd::string::format("someproduct%u.dds", subId).c_str(), AZ::Data::AssetType::CreateRandom() });
+        }
+        // a product that is already in the database is updated rather than inserted
+        ProductDatabaseEntry existingProduct = m_data->m_product1;
+        existingProduct.m_productID = AzToolsFramework::AssetDatabase::InvalidEntryId;
+        existingProduct.m_productName = "someproduct1_renamed.dds";
+        requestProducts.push_back(existingProduct);
+        // a new product listed twice is inserted once, with the values of the last listing
+        requestProducts.push_back({ m_data->m_job1.m_jobID, 500, "repeated.dds", AZ::Data::AssetType::CreateRandom() });
+        requestProducts.push_back({ m_data->m_job1.m_jobID, 500, "repeated_last.dds", AZ::Data::AssetType::CreateRandom() });
+
+        EXPECT_TRUE(m_data->m_connection.SetProducts(requestProducts));
+
+        resultProducts.clear();
+        EXPECT_TRUE(m_data->m_connection.GetProducts(resultProducts));
+        EXPECT_EQ(resultProducts.size(), priorProductCount + newProductCount + 1);
+
+        for (const ProductDatabaseEntry& requestProduct : requestProducts)
+        {
+            ProductDatabaseEntry databaseProduct;
+            EXPECT_TRUE(m_data->m_connection.GetProductByJobIDSubId(requestProduct.m_jobPK, requestProduct.m_subID, databaseProduct));
+            EXPECT_EQ(requestProduct.m_productID, databaseProduct.m_productID);
+        }
+
+        ProductDatabaseEntry databaseProduct;
+        EXPECT_TRUE(m_data->m_connection.GetProductByProductID(m_data->m_product1.m_productID, databaseProduct));
+        EXPECT_EQ(databaseProduct.m_productName, "someproduct1_renamed.dds");
+        EXPECT_TRUE(m_data->m_connection.GetProductByJobIDSubId(m_data->m_job1.m_jobID, 500, databaseProduct));
+        EXPECT_EQ(databaseProduct.m_productName, "repeated_last.dds");
+
+        EXPECT_EQ(m_errorAbsorber->m_numAssertsAbsorbed, 0); // not allowed to assert on this
+    }
+
+    TEST_F(AssetDatabaseTest, CreateScopedTransaction_NotCommitted_WritesAreRolledBack)
+    {
+        CreateCoverageTestData();
+
+        ProductDatabaseEntryContainer resultProducts;
+        EXPECT_TRUE(m_data->m_connection.GetProducts(resultProducts));
+        size_t priorProductCount = resultProducts.size();
+
+        ProductDatabaseEntryContainer requestProducts;
+        requestProducts.push_back({ m_data->m_job1.m_jobID, 5, "someproduct5.dds", AZ::Data::AssetType::CreateRandom() });
+        requestProducts.push_back({ m_data->m_job1.m_jobID, 6, "someproduct6.dds", AZ::Data::AssetType::CreateRandom() });
+        {
+            auto transaction = m_data->m_connection.CreateScopedTransaction();
+            EXPECT_TRUE(m_data->m_connection.SetProducts(requestProducts));
+        }
+
+        resultProducts.clear();
+        EXPECT_TRUE(m_data->m_connection.GetProducts(resultProducts));
+        EXPECT_EQ(resultProducts.size(), priorProductCount);
+
+        {
+            auto transaction = m_data->m_connection.CreateScopedTransaction();
+            EXPECT_TRUE(m_data->m_connection.SetProducts(requestProducts));
+            transaction.Commit();
+        }
+
+        resultProducts.clear();
+        EXPECT_TRUE(m_data->m_connection.GetProducts(resultProducts));
+        EXPECT_EQ(resultProducts.size(), priorProductCount + 2);
+
+        EXPECT_EQ(m_errorAbsorber->m_numAssertsAbsorbed, 0); // not allowed to assert on this
+    }
+
     // --------------------------------------------------------------------------------------------------------------------
     // ---------------------------------------------- RemoveProduct(s)  ---------------------------------------------------
     // --------------------------------------------------------------------------------------------------------------------
@@ -2169,7 +2249,7 @@ namespace UnitTests
     {
         CreateCoverageTestData();
 
-        ASSERT_FALSE(m_data->m_connection.UpdateFileModTimeAndHashByFileNameAndScanFolderId("testfile.txt", m_data->m_scanFolder.m_scanFolderID, 1234, 1111));
+        ASSERT_FALSE(m_data->m_connection.UpdateFileModTimeAndHashByFileNameAndScanFolderId("testfile.txt", m_data->m_scanFolder.m_scanFolderID, 1234, 1111, 42));
 
         EXPECT_EQ(m_errorAbsorber->m_numAssertsAbsorbed, 0); // not allowed to assert on this
     }
@@ -2185,7 +2265,13 @@ namespace UnitTests
         bool entryAlreadyExists;
         ASSERT_TRUE(m_data->m_connection.InsertFile(entry, entryAlreadyExists));
         ASSERT_FALSE(entryAlreadyExists);
-        ASSERT_TRUE(m_data->m_connection.UpdateFileModTimeAndHashByFileNameAndScanFolderId("testfile.txt", m_data->m_scanFolder.m_scanFolderID, 1234, 1111));
+        ASSERT_TRUE(m_data->m_connection.UpdateFileModTimeAndHashByFileNameAndScanFolderId("testfile.txt", m_data->m_scanFolder.m_scanFolderID, 1234, 1111, 42));
+
+        FileDatabaseEntry updatedEntry;
+        ASSERT_TRUE(m_data->m_connection.GetFileByFileNameAndScanFolderId("testfile.txt", m_data->m_scanFolder.m_scanFolderID, updatedEntry));
+        EXPECT_EQ(updatedEntry.m_modTime, 1234u);
+        EXPECT_EQ(updatedEntry.m_hash, 1111u);
+        EXPECT_EQ(updatedEntry.m_fileSize, 42);
 
         EXPECT_EQ(m_errorAbsorber->m_numAssertsAbsorbed, 0); // not allowed to assert on this
     }
@@ -73,6 +73,7 @@ public:
     friend class GTEST_TEST_CLASS_NAME_(ModtimeScanningTest, ModtimeSkipping_ModifyFilesSameHash_BothProcess);
     friend class GTEST_TEST_CLASS_NAME_(ModtimeScanningTest, ModtimeSkipping_ModifyTimestamp);
     friend class GTEST_TEST_CLASS_NAME_(ModtimeScanningTest, ModtimeSkipping_ModifyTimestampNoHashing_ProcessesFile);
+    friend class GTEST_TEST_CLASS_NAME_(ModtimeScanningTest, ModtimeSkipping_ModifySizeOnly_ProcessesFile);
     friend class GTEST_TEST_CLASS_NAME_(ModtimeScanningTest, ModtimeSkipping_ModifyMetadataFile);
     friend class GTEST_TEST_CLASS_NAME_(ModtimeScanningTest, ModtimeSkipping_DeleteFile);
     friend class GTEST_TEST_CLASS_NAME_(DeleteTest, DeleteFolderSharedAcrossTwoScanFolders_CorrectFileAndFolderAreDeletedFromCache);
@@ -4071,6 +4072,33 @@ TEST_F(ModtimeScanningTest, ModtimeSkipping_ModifyTimestampNoHashing_ProcessesFi
     ExpectWork(2, 2);
 }
 
+TEST_F(ModtimeScanningTest, ModtimeSkipping_ModifySizeOnly_ProcessesFile)
+{
+    // Change the contents and size of a file but report it with the timestamp it had before, as if it had been
+    // edited by a tool that preserves timestamps.  The timestamp matches the database, so only the recorded size
+    // can tell that the file changed, and the file should process without being hashed
+    using namespace AzToolsFramework::AssetSystem;
+
+    const QDateTime originalModTime = QFileInfo(m_data->m_absolutePath[1]).lastModified();
+    SetFileContents(m_data->m_absolutePath[1].toUtf8().constData(), "hello world");
+
+    // Enable the features we're testing, without hashing
+    m_assetProcessorManager->m_allowModtimeSkippingFeature = true;
+    AssetUtilities::SetUseFileHashOverride(true, false);
+
+    QSet<AssetFileInfo> filePaths;
+    for (const auto& path : m_data->m_absolutePath)
+    {
+        QFileInfo fileInfo(path);
+        QDateTime modtime = (path == m_data->m_absolutePath[1]) ? originalModTime : fileInfo.lastModified();
+        filePaths.insert(AssetFileInfo(path, modtime, fileInfo.size(), m_config->GetScanFolderForFile(path), false));
+    }
+    SimulateAssetScanner(filePaths);
+
+    // Even though we're only updating one file, we're expecting 2 createJob calls because our test file is a dependency that triggers the other test file to process as well
+    ExpectWork(2, 2);
+}
+
 TEST_F(ModtimeScanningTest, ModtimeSkipping_ModifyFile)
 {
     using namespace AzToolsFramework::AssetSystem;
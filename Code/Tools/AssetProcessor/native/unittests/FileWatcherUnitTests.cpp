@@ -279,7 +279,8 @@ void FileWatcherUnitTestRunner::StartTest()
 
 #if !defined(AZ_PLATFORM_LINUX)
         // final test... make sure that renaming a DIRECTORY works too.
-        // Note that linux does not get any callbacks if just the directory is renamed (from inotify)
+        // Note that on linux the contents of the renamed directory are reported as added after it, which the
+        // moved in folder test below covers
         QDir renamer;
         fileAddCalled = false;
         fileRemoveCalled = false;
@@ -309,13 +310,63 @@ void FileWatcherUnitTestRunner::StartTest()
         QObject::disconnect(connectionModified);
     }
 
+#if defined(AZ_PLATFORM_LINUX)
+    AZ_TracePrintf(AssetProcessor::DebugChannel, "moved in folder test ...\n");
+
+    { // a folder moved in from outside the watched tree is watched recursively
+      // inotify has to add watches for the folder and its subfolders, so what is already inside them is reported too
+        QSet<QString> addedFiles;
+        auto connectionAdd = QObject::connect(&folderWatch, &FolderWatchCallbackEx::fileAdded, this, [&](QString filename)
+        {
+            addedFiles.insert(QDir::toNativeSeparators(filename));
+        });
+
+        // give the file watcher thread a moment to get started
+        QThread::sleep(1);
+
+        // the folder is built next to the watched one, so moving it in is a rename and not a copy
+        QTemporaryDir outsideTempDir;
+        QDir outsideDir(QDir(outsideTempDir.path()).canonicalPath());
+        UNIT_TEST_EXPECT_TRUE(outsideDir.mkpath("moved/nested"));
+        UNIT_TEST_EXPECT_TRUE(UnitTestUtils::CreateDummyFile(outsideDir.absoluteFilePath("moved/top.tif")));
+        UNIT_TEST_EXPECT_TRUE(UnitTestUtils::CreateDummyFile(outsideDir.absoluteFilePath("moved/nested/inner.tif")));
+
+        QDir tempDirPath(tempPath);
+        UNIT_TEST_EXPECT_TRUE(QDir().rename(outsideDir.absoluteFilePath("moved"), tempDirPath.absoluteFilePath("moved")));
+
+        const QString topFile = QDir::toNativeSeparators(tempDirPath.absoluteFilePath("moved/top.tif"));
+        const QString innerFile = QDir::toNativeSeparators(tempDirPath.absoluteFilePath("moved/nested/inner.tif"));
+
+        int tries = 0;
+        while (!(addedFiles.contains(topFile) && addedFiles.contains(innerFile)) && tries++ < 100)
+        {
+            QThread::msleep(10);
+            QCoreApplication::processEvents(QEventLoop::AllEvents, 100);
+        }
+
+        UNIT_TEST_EXPECT_TRUE(addedFiles.contains(topFile));
+        UNIT_TEST_EXPECT_TRUE(addedFiles.contains(innerFile));
+
+        // a file created in the moved in subfolder afterwards is only seen if the subfolder is watched
+        const QString lateFile = QDir::toNativeSeparators(tempDirPath.absoluteFilePath("moved/nested/late.tif"));
+        UNIT_TEST_EXPECT_TRUE(UnitTestUtils::CreateDummyFile(lateFile));
+
+        tries = 0;
+        while (!addedFiles.contains(lateFile) && tries++ < 100)
+        {
+            QThread::msleep(10);
+            QCoreApplication::processEvents(QEventLoop::AllEvents, 100);
+        }
+
+        UNIT_TEST_EXPECT_TRUE(addedFiles.contains(lateFile));
+
+        QObject::disconnect(connectionAdd);
+    }
+#endif // AZ_PLATFORM_LINUX
 
     Q_EMIT UnitTestPassed();
 }
 
-// File operations on Linux behave differently on Linux than Windows.
-// The system under test doesn't yet handle Linux's file operations, which surfaced as this test arbitrarily passing and failing.
-// This test is disabled on Linux until the system under test can handle Linux file system behavior correctly.
-#if !AZ_TRAIT_DISABLE_FAILED_ASSET_PROCESSOR_TESTS && !defined(AZ_PLATFORM_LINUX)
+#if !AZ_TRAIT_DISABLE_FAILED_ASSET_PROCESSOR_TESTS
 REGISTER_UNIT_TEST(FileWatcherUnitTestRunner)
 #endif // !AZ_TRAIT_DISABLE_FAILED_ASSET_PROCESSOR_TESTS
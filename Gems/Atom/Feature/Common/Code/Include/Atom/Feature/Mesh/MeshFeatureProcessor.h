@@ -70,6 +70,7 @@ namespace AZ
             void UpdateCullBounds(const TransformServiceFeatureProcessor* transformService);
             void UpdateObjectSrg();
             bool MaterialRequiresForwardPassIblSpecular(Data::Instance<RPI::Material> material) const;
+            void AddStreamingImages(const Data::Instance<RPI::Material>& material, AZStd::vector<Data::Instance<RPI::StreamingImage>>& streamingImages) const;
             void SetVisible(bool isVisible);
 
             using DrawPacketList = AZStd::vector<RPI::MeshDrawPacket>;
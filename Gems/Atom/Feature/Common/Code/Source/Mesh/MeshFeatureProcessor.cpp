@@ -1033,6 +1033,7 @@ namespace AZ
             AZ_Assert(lodAssets.size() == modelLodCount, "Number of asset lods must match number of model lods");
 
             lodData.m_lods.resize(modelLodCount);
+            lodData.m_streamingImages.clear();
             cullData.m_drawListMask.reset();
 
             const size_t lodCount = lodAssets.size();
@@ -1065,7 +1066,7 @@ namespace AZ
                 }
 
                 lod.m_drawPackets.clear();
-                for (const RPI::MeshDrawPacket& meshDrawPacket : m_drawPacketListsByLod[lodIndex])
+                for (RPI::MeshDrawPacket& meshDrawPacket : m_drawPacketListsByLod[lodIndex])
                 {
                     const RHI::DrawPacket* rhiDrawPacket = meshDrawPacket.GetRHIDrawPacket();
 
@@ -1075,6 +1076,9 @@ namespace AZ
                         cullData.m_drawListMask |= rhiDrawPacket->GetDrawListMask();
 
                         lod.m_drawPackets.push_back(rhiDrawPacket);
+
+                        //the culling requests the mips of the images the materials sample, based on the mesh's size on screen
+                        AddStreamingImages(meshDrawPacket.GetMaterial(), lodData.m_streamingImages);
                     }
                 }
             }
@@ -1188,6 +1192,28 @@ namespace AZ
             m_objectSrgNeedsUpdate = false;
         }
 
+        void MeshDataInstance::AddStreamingImages(const Data::Instance<RPI::Material>& material, AZStd::vector<Data::Instance<RPI::StreamingImage>>& streamingImages) const
+        {
+            if (!material)
+            {
+                return;
+            }
+
+            for (const RPI::MaterialPropertyValue& propertyValue : material->GetPropertyValues())
+            {
+                if (!propertyValue.Is<Data::Instance<RPI::Image>>())
+                {
+                    continue;
+                }
+
+                Data::Instance<RPI::StreamingImage> streamingImage = azrtti_cast<RPI::StreamingImage*>(propertyValue.GetValue<Data::Instance<RPI::Image>>().get());
+                if (streamingImage && AZStd::find(streamingImages.begin(), streamingImages.end(), streamingImage) == streamingImages.end())
+                {
+                    streamingImages.push_back(streamingImage);
+                }
+            }
+        }
+
         bool MeshDataInstance::MaterialRequiresForwardPassIblSpecular(Data::Instance<RPI::Material> material) const
         {
             // look for a shader that has the o_materialUseForwardPassIBLSpecular option set
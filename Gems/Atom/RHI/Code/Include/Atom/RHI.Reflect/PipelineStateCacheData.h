@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI.Reflect/Base.h>
+#include <Atom/RHI.Reflect/InputStreamLayout.h>
+#include <Atom/RHI.Reflect/PipelineLayoutDescriptor.h>
+#include <Atom/RHI.Reflect/RenderAttachmentLayout.h>
+#include <Atom/RHI.Reflect/RenderStates.h>
+#include <Atom/RHI.Reflect/ShaderStageFunction.h>
+#include <AtomCore/std/containers/array_view.h>
+#include <AzCore/std/smart_ptr/intrusive_base.h>
+
+namespace AZ
+{
+    class ReflectContext;
+
+    namespace RHI
+    {
+        /**
+         * This class records the pipeline states acquired from a pipeline library in a platform-independent,
+         * serializable form, so that they can be compiled ahead of their first use in a later session
+         * (see PipelineStateCache::WarmupLibrary).
+         *
+         * Pipeline state descriptors don't serialize, since the shader functions and pipeline layouts they
+         * reference are shared by many pipeline states. Instead, each function and layout is stored once and
+         * the records reference them by their content hash. Records are keyed by the hash of the descriptor
+         * they were captured from, and every table is sorted by hash, so the same set of pipeline states
+         * always produces the same data regardless of the order they were acquired in.
+         *
+         * Ray tracing pipeline states are not recorded.
+         */
+        class PipelineStateCacheData final
+            : public AZStd::intrusive_base
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(PipelineStateCacheData, SystemAllocator, 0);
+            AZ_TYPE_INFO(PipelineStateCacheData, "{49B14EFD-A6DE-4B89-AB67-92CC57FD3CE9}");
+
+            static void Reflect(ReflectContext* context);
+
+            static Ptr<PipelineStateCacheData> Create();
+
+            /// The state needed to rebuild a PipelineStateDescriptorForDraw.
+            struct DrawRecord
+            {
+                AZ_TYPE_INFO(DrawRecord, "{A7B8A600-4A6D-49D4-AFD4-A378AD884087}");
+
+                static void Reflect(ReflectContext* context);
+
+                /// The hash of the pipeline state descriptor the record was captured from.
+                HashValue64 m_hash = HashValue64{ 0 };
+
+                HashValue64 m_pipelineLayoutHash = HashValue64{ 0 };
+
+                /// Function hashes are zero for functions not used by the pipeline state.
+                HashValue64 m_vertexFunctionHash = HashValue64{ 0 };
+                HashValue64 m_tessellationFunctionHash = HashValue64{ 0 };
+                HashValue64 m_fragmentFunctionHash = HashValue64{ 0 };
+
+                InputStreamLayout m_inputStreamLayout;
+                RenderAttachmentConfiguration m_renderAttachmentConfiguration;
+                RenderStates m_renderStates;
+            };
+
+            /// The state needed to rebuild a PipelineStateDescriptorForDispatch.
+            struct DispatchRecord
+            {
+                AZ_TYPE_INFO(DispatchRecord, "{EB74A6BF-7AB7-4DE8-9D15-4564C51DF61B}");
+
+                static void Reflect(ReflectContext* context);
+
+                /// The hash of the pipeline state descriptor the record was captured from.
+                HashValue64 m_hash = HashValue64{ 0 };
+
+                HashValue64 m_pipelineLayoutHash = HashValue64{ 0 };
+                HashValue64 m_computeFunctionHash = HashValue64{ 0 };
+            };
+
+            /// Adds a record. A record with the same hash as an existing one is discarded by Finalize.
+            void AddDrawRecord(const DrawRecord& record);
+            void AddDispatchRecord(const DispatchRecord& record);
+
+            /// Adds a shader function or pipeline layout referenced by the records. Each is stored once per hash.
+            void AddShaderStageFunction(ConstPtr<ShaderStageFunction> shaderStageFunction);
+            void AddPipelineLayout(ConstPtr<PipelineLayoutDescriptor> pipelineLayout);
+
+            /// Sorts every table by hash and removes duplicates. Must be called after adding data and before any lookups.
+            void Finalize();
+
+            AZStd::array_view<DrawRecord> GetDrawRecords() const;
+            AZStd::array_view<DispatchRecord> GetDispatchRecords() const;
+
+            /// Returns the number of draw and dispatch records.
+            size_t GetRecordCount() const;
+
+            /// Returns the shader function or pipeline layout with the given hash, or null if none is stored.
+            const ShaderStageFunction* FindShaderStageFunction(HashValue64 hash) const;
+            const PipelineLayoutDescriptor* FindPipelineLayout(HashValue64 hash) const;
+
+        private:
+            PipelineStateCacheData() = default;
+
+            AZ_SERIALIZE_FRIEND();
+
+            AZStd::vector<DrawRecord> m_drawRecords;
+            AZStd::vector<DispatchRecord> m_dispatchRecords;
+
+            /// NOTE: Serialization does not allow for ConstPtr. The functions and layouts are treated as immutable.
+            AZStd::vector<Ptr<ShaderStageFunction>> m_shaderStageFunctions;
+            AZStd::vector<Ptr<PipelineLayoutDescriptor>> m_pipelineLayouts;
+        };
+    }
+}
@@ -8,10 +8,20 @@
 #pragma once
 
 #include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
+#include <Atom/RHI.Reflect/ScopeId.h>
+#include <Atom/RHI.Reflect/TransientAttachmentStatistics.h>
 #include <Atom/RHI/Object.h>
 #include <Atom/RHI/ObjectCache.h>
 #include <Atom/RHI/ImageView.h>
 #include <Atom/RHI/BufferView.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/time.h>
+#include <AzCore/Utils/TypeHash.h>
+
+namespace UnitTest
+{
+    class FrameGraphTests;
+}
 
 namespace AZ
 {
@@ -45,6 +55,27 @@ namespace AZ
             FrameSchedulerStatisticsFlags m_statisticsFlags = FrameSchedulerStatisticsFlags::None;
         };
 
+        /**
+         * @brief Counters for FrameGraphCompiler::Compile, including the use of the compile cache.
+         */
+        struct FrameGraphCompilerStatistics
+        {
+            /// The number of successful compiles.
+            uint64_t m_compileCount = 0;
+
+            /// The number of compiles which re-used the platform-independent results of the previous compile.
+            uint64_t m_cacheHitCount = 0;
+
+            /// Time spent in the most recent compile, in ticks, including platform-specific compilation.
+            AZStd::sys_time_t m_lastCompileTime = 0;
+
+            /// Time spent in all compiles, in ticks.
+            AZStd::sys_time_t m_compileTime = 0;
+
+            /// Whether the most recent compile re-used the results of the previous compile.
+            bool m_lastCompileCacheHit = false;
+        };
+
         /**
          * FrameGraphCompiler controls compilation of FrameGraph each frame. FrameScheduler owns
          * and drives an instance of this class, so end-users should never need to interact with it directly.
@@ -99,6 +130,18 @@ namespace AZ
          * kept inside the compiler. The cache is big enough to avoid having to re-create views every frame, but
          * bounded in order to release entries old views.
          *
+         *      == Compile Cache ==
+         *
+         * In practice the frame graph is almost always identical from one frame to the next. Before compiling,
+         * the compiler hashes the topology of the graph: the sorted scopes with their queue classes and consumers,
+         * the transient attachments used by each scope, and the descriptors and lifetimes of every transient
+         * attachment. When the hash matches the previous compile, the queue-centric links, the extended attachment
+         * lifetimes, the sorted allocation commands and the pool memory hint are all replayed from the cache instead
+         * of being recomputed. The transient attachment pool is still driven through the full allocation sequence,
+         * since the attachments must be re-bound to the resources it returns each frame. The cache also stores the
+         * scope ids and transient attachment counts it was recorded with, and a graph that differs in any of them is
+         * compiled from scratch even if its hash matches.
+         *
          *      == Platform-Specific Compilation ==
          *
          * Finally, the compiler calls into the platform-specific compile method, which hands control over to the
@@ -125,6 +168,11 @@ namespace AZ
              */
             MessageOutcome Compile(const FrameGraphCompileRequest& request);
 
+            /// Returns the compile counters accumulated since initialization or the last call to ResetStatistics.
+            const FrameGraphCompilerStatistics& GetStatistics() const;
+
+            void ResetStatistics();
+
         protected:
             FrameGraphCompiler() = default;
 
@@ -146,10 +194,16 @@ namespace AZ
 
             MessageOutcome ValidateCompileRequest(const FrameGraphCompileRequest& request) const;
 
+            /// Hashes every input of the platform-independent phases which can change their results.
+            HashValue64 ComputeCompileHash(const FrameGraphCompileRequest& request) const;
+
             void CompileQueueCentricScopeGraph(
                 FrameGraph& frameGraph,
                 FrameSchedulerCompileFlags compileFlags);
 
+            /// Links the scopes by queue and records the link in the compile cache.
+            void LinkScopesByQueues(Scope* producer, Scope* consumer);
+
             void ExtendTransientAttachmentAsyncQueueLifetimes(
                 FrameGraph& frameGraph,
                 FrameSchedulerCompileFlags compileFlags);
@@ -171,6 +225,63 @@ namespace AZ
             ObjectCache<ImageView> m_imageViewCache;
             ObjectCache<BufferView> m_bufferViewCache;
 
+            /// The platform-independent results of the previous compile, keyed by the hash of its inputs.
+            struct CompileCache
+            {
+                struct ScopeLink
+                {
+                    uint32_t m_producerScopeIndex = 0;
+                    uint32_t m_consumerScopeIndex = 0;
+                };
+
+                struct Lifetime
+                {
+                    uint32_t m_firstScopeIndex = 0;
+                    uint32_t m_lastScopeIndex = 0;
+                };
+
+                void Clear();
+
+                /// Starts recording a compile of the frame graph with the given hash.
+                void Begin(HashValue64 hash, const FrameGraph& frameGraph);
+
+                /// Whether the recorded compile can be replayed for the frame graph. The hash alone is not trusted:
+                /// the entries below index into the scopes and transient attachments, so those must match as well.
+                bool Matches(HashValue64 hash, const FrameGraph& frameGraph) const;
+
+                HashValue64 m_hash = HashValue64{ 0 };
+
+                /// Whether the entries below describe a complete compile with the above hash.
+                bool m_isValid = false;
+
+                /// The scopes and the transient attachment counts of the recorded compile.
+                AZStd::vector<ScopeId> m_scopeIds;
+                uint32_t m_transientBufferCount = 0;
+                uint32_t m_transientImageCount = 0;
+
+                /// Every queue-centric producer / consumer link, in the order they were made.
+                AZStd::vector<ScopeLink> m_scopeLinks;
+
+                /// The lifetimes of the transient attachments after extension for async queues.
+                AZStd::vector<Lifetime> m_transientBufferLifetimes;
+                AZStd::vector<Lifetime> m_transientImageLifetimes;
+
+                /// The sorted transient attachment allocation commands.
+                AZStd::vector<uint32_t> m_transientAttachmentCommands;
+
+                /// The memory usage reported by the sizing pass of the MemoryHint heap strategy.
+                AZStd::optional<TransientAttachmentStatistics::MemoryUsage> m_memoryHint;
+            };
+
+            CompileCache m_compileCache;
+
+            /// Set for the duration of a compile that re-uses m_compileCache.
+            bool m_isCompileCacheHit = false;
+
+            FrameGraphCompilerStatistics m_statistics;
+
+            // Friends
+            friend class UnitTest::FrameGraphTests;
         };
     }
 }
@@ -14,6 +14,7 @@ namespace AZ
     namespace RHI
     {
         class FrameGraph;
+        struct FrameGraphCompilerStatistics;
 
         class FrameGraphLogger
         {
@@ -21,6 +22,9 @@ namespace AZ
             /// Logs the graph to the output console, with the specified verbosity.
             static void Log(const FrameGraph& frameGraph, FrameSchedulerLogVerbosity logVerbosity);
 
+            /// Logs the compile time and compile cache hit rate to the output console, with the specified verbosity.
+            static void Log(const FrameGraphCompilerStatistics& compilerStatistics, FrameSchedulerLogVerbosity logVerbosity);
+
             /// Dumps a graph-vis file of the current frame graph to the logs folder.
             static void DumpGraphVis(const FrameGraph& frameGraph);
         };
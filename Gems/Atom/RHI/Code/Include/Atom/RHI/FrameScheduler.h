@@ -54,7 +54,8 @@ namespace AZ
             /// Controls whether the phase is allowed to use jobs.
             JobPolicy m_jobPolicy = JobPolicy::Parallel;
 
-            /// Controls the number of ShaderResourceGroups compiled per job.
+            /// Controls the minimum number of ShaderResourceGroups compiled per job. The compiles of each pool
+            /// are otherwise split evenly across the job worker threads.
             uint32_t m_shaderResourceGroupCompilesPerJob = 256;
         };
 
@@ -10,7 +10,12 @@
 #include <Atom/RHI/PipelineState.h>
 #include <Atom/RHI/PipelineLibrary.h>
 #include <Atom/RHI/ThreadLocalContext.h>
+#include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
+#include <Atom/RHI.Reflect/Interval.h>
+#include <Atom/RHI.Reflect/PipelineStateCacheData.h>
 #include <AzCore/std/containers/bitset.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/time.h>
 #include <AzCore/Utils/TypeHash.h>
 
 namespace UnitTest
@@ -85,17 +90,32 @@ namespace AZ
          *      This is the fast-path case where multiple threads are now able to resolve pipeline states with very
          *      little performance overhead.
          *
+         * The cache also records the pipeline states of each library in a platform-independent form
+         * (see PipelineStateCacheData), which can be saved alongside the platform pipeline library data. Passing
+         * the recorded data of a previous session to WarmupLibrary compiles those pipeline states on background jobs,
+         * typically during loading, so that they are already compiled when first requested. Warmed up pipeline states
+         * are kept apart from the other caches and matched to the first request by descriptor hash.
+         *
+         * Statistics (cache hits, compiles, compile time) are counted per thread and only summed when queried,
+         * which keeps the fast path free of shared writes.
+         *
          * Example Usage:
          * @code{.cpp}
          *      // Create library instance.
          *      RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary(serializedData); // Initial data loaded from disk.
          *
+         *      // Optionally, compile the pipeline states recorded in a previous session on background jobs.
+         *      pipelineStateCache->WarmupLibrary(libraryHandle, cacheData); // Recorded data loaded from disk.
+         *
          *      // In jobs. Lots and lots of requests.
          *      const RHI::PipelineState* pipelineState = pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor);
          *
          *      // Reset contents of library. Releases all pipeline state references. Library remains valid.
          *      pipelineStateCache->ResetLibrary(libraryHandle);
          *
+         *      // Record the pipeline states of the library, to warm it up in the next session.
+         *      RHI::ConstPtr<RHI::PipelineStateCacheData> cacheData = pipelineStateCache->GetLibraryCacheData(libraryHandle);
+         *
          *      // Release library and all held references.
          *      pipelineStateCache->ReleaseLibrary(libraryHandle);
          * @endcode
@@ -113,8 +133,39 @@ namespace AZ
              */
             static const size_t LibraryCountMax = 256;
 
+            /// Counters for the requests made to the cache.
+            struct Statistics
+            {
+                /// Requests served by the global read-only cache.
+                uint64_t m_readOnlyCacheHitCount = 0;
+
+                /// Requests served by a thread-local cache.
+                uint64_t m_threadLocalCacheHitCount = 0;
+
+                /// Requests served by the pending cache, i.e. pipeline states created on another thread this cycle.
+                uint64_t m_pendingCacheHitCount = 0;
+
+                /// Requests served by a pipeline state compiled by warmup.
+                uint64_t m_warmupCacheHitCount = 0;
+
+                /// Requests that missed every cache and compiled a new pipeline state, including warmup compiles.
+                uint64_t m_compileCount = 0;
+
+                /// Compiles that failed, leaving the pipeline state uninitialized.
+                uint64_t m_compileFailureCount = 0;
+
+                /// Time spent compiling pipeline states, in ticks, summed across threads.
+                AZStd::sys_time_t m_compileTime = 0;
+
+                /// Pipeline states requested by warmup.
+                uint64_t m_warmupCount = 0;
+            };
+
             static Ptr<PipelineStateCache> Create(Device& device);
 
+            /// Cancels any warmup in flight and waits for it to exit.
+            ~PipelineStateCache();
+
             /// Resets the caches of all pipeline libraries back to empty. All internal references to pipeline states are released.
             void Reset();
 
@@ -130,6 +181,38 @@ namespace AZ
             /// Returns the serialized data for the library, which can be used to re-initialize it.
             ConstPtr<PipelineLibraryData> GetLibrarySerializedData(PipelineLibraryHandle handle) const;
 
+            /**
+             * Returns the draw and dispatch pipeline states held by the library, in a form that can be passed to
+             * WarmupLibrary in a later session. Pipeline states that failed to compile are left out. Records of the
+             * library's warmup data that haven't been compiled yet are carried over. Like GetLibrarySerializedData,
+             * this is intended to be called at shutdown, not every frame.
+             */
+            ConstPtr<PipelineStateCacheData> GetLibraryCacheData(PipelineLibraryHandle handle) const;
+
+            /**
+             * Compiles the pipeline states recorded in the cache data ahead of their first use. With JobPolicy::Parallel,
+             * the pipeline states are compiled on background jobs spread across the worker threads and the call returns
+             * immediately; otherwise (or without a job context) they're compiled on the calling thread. Acquiring a
+             * pipeline state that's being warmed up behaves like acquiring one compiled by another thread. Resetting or
+             * releasing the library cancels the remaining warmup.
+             *
+             * The recorded descriptors reference their own copies of the shader functions and pipeline layouts, so they
+             * never compare equal to the application's descriptors, which compare those by pointer. Instead, an acquire
+             * that misses every other cache takes over the warmed pipeline state with the same descriptor hash. This is
+             * the only place where a matching hash alone is trusted.
+             */
+            void WarmupLibrary(PipelineLibraryHandle handle, ConstPtr<PipelineStateCacheData> cacheData, JobPolicy jobPolicy = JobPolicy::Parallel);
+
+            /// Blocks until the background warmup of the library has completed.
+            void WaitForWarmup(PipelineLibraryHandle handle) const;
+
+            /// Returns the counters summed across all threads and libraries. Counters being updated by other threads may be
+            /// missed, and the counters of threads that have exited are dropped with their thread storage.
+            Statistics GetStatistics() const;
+
+            /// Resets all counters to zero.
+            void ResetStatistics();
+
             /**
              * Acquires a pipeline state (either draw or dispatch variants) from the cache. Pipeline states are associated
              * to a specific library handle. Successive calls with the same pipeline state descriptor hash will return the same
@@ -200,10 +283,35 @@ namespace AZ
 
                 // Used to prime the thread libraries.
                 ConstPtr<PipelineLibraryData> m_serializedData;
+
+                // The data passed to the last warmup, carried over by GetLibraryCacheData.
+                ConstPtr<PipelineStateCacheData> m_warmupData;
+
+                // Pipeline states compiled by warmup that haven't been acquired yet, with the descriptors rebuilt from the
+                // warmup data. Guarded by m_pendingCacheMutex. An entry moves to the pending cache, under the acquiring
+                // descriptor, on first use.
+                PipelineStateSet m_warmupCache;
+
+                // Tracks the number of warmup jobs in flight, and tells them to stop early.
+                AZStd::atomic_uint32_t m_warmupJobCount = {0};
+                AZStd::atomic_bool m_warmupCancelled = {false};
             };
 
             using GlobalLibrarySet = AZStd::fixed_vector<GlobalLibraryEntry, LibraryCountMax>;
 
+            /// Statistics counters. Only the owning thread increments them, so that no cache line is shared on the fast path.
+            struct ThreadStatistics
+            {
+                AZStd::atomic<uint64_t> m_readOnlyCacheHitCount = {0};
+                AZStd::atomic<uint64_t> m_threadLocalCacheHitCount = {0};
+                AZStd::atomic<uint64_t> m_pendingCacheHitCount = {0};
+                AZStd::atomic<uint64_t> m_warmupCacheHitCount = {0};
+                AZStd::atomic<uint64_t> m_compileCount = {0};
+                AZStd::atomic<uint64_t> m_compileFailureCount = {0};
+                AZStd::atomic<AZStd::sys_time_t> m_compileTime = {0};
+                AZStd::atomic<uint64_t> m_warmupCount = {0};
+            };
+
             struct ThreadLibraryEntry
             {
                 // A thread-local cache used to reduce contention on the global pending cache.
@@ -216,6 +324,8 @@ namespace AZ
                  * and uses the initial serialized data passed in at creation time.
                  */
                 Ptr<PipelineLibrary> m_library;
+
+                ThreadStatistics m_statistics;
             };
 
             /**
@@ -238,9 +348,26 @@ namespace AZ
                 const PipelineStateDescriptor& pipelineStateDescriptor,
                 PipelineStateHash pipelineStateHash);
 
+            /// Initializes the pipeline state using the thread-local pipeline library, creating the library on first use.
+            void InitPipelineState(
+                GlobalLibraryEntry& globalLibraryEntry,
+                ThreadLibraryEntry& threadLibraryEntry,
+                const PipelineStateDescriptor& pipelineStateDescriptor,
+                PipelineState& pipelineState);
+
+            /// Compiles a recorded pipeline state into the warmup cache of the library, unless it's there already.
+            void WarmupPipelineState(PipelineLibraryHandle handle, const PipelineStateDescriptor& descriptor);
+
             /// Resets the library without validating the handle or taking a lock.
             void ResetLibraryImpl(PipelineLibraryHandle handle);
 
+            /// Cancels the warmup of the library and waits for its jobs to exit. Must be called without holding m_mutex.
+            void CancelWarmup(PipelineLibraryHandle handle);
+
+            /// Rebuilds the descriptors of the records in the interval, which indexes draw records followed by
+            /// dispatch records, and acquires their pipeline states.
+            void WarmupRecords(PipelineLibraryHandle handle, const PipelineStateCacheData& cacheData, Interval interval);
+
             Ptr<Device> m_device;
 
             /// Each thread owns a set of ThreadLibraryEntry elements. RHI::PipelineLibraryHandle is an
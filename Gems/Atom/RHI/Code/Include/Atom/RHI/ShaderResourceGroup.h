@@ -10,6 +10,9 @@
 #include <Atom/RHI/Resource.h>
 #include <Atom/RHI/ShaderResourceGroupData.h>
 
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/parallel/atomic.h>
+
 namespace AZ
 {
     namespace RHI
@@ -53,19 +56,51 @@ namespace AZ
             //! Returns whether the group is currently queued for compilation.
             bool IsQueuedForCompile() const;
 
+            //! Returns whether any of the given resource types has to be written by the compile in progress.
+            //! A resource type stays enabled for Limits::Device::FrameCountMax compiles after it was modified,
+            //! so that platforms which buffer the compiled data per frame refresh every copy.
+            //! Only valid from within ShaderResourceGroupPool::CompileGroupInternal.
+            bool IsResourceTypeEnabledForCompilation(ShaderResourceGroupData::ResourceTypeMask resourceTypeMask) const;
+
+            //! Returns the byte [min, max) interval of the constant data that has to be written by the compile
+            //! in progress. Only valid from within ShaderResourceGroupPool::CompileGroupInternal.
+            Interval GetConstantsCompileInterval() const;
+
         protected:
             ShaderResourceGroup() = default;
 
         private:
             void SetData(const ShaderResourceGroupData& data);
 
+            // Flags resource types for the next compile. Safe to call from multiple threads.
+            void EnableResourceTypeCompilation(ShaderResourceGroupData::ResourceTypeMask resourceTypeMask);
+
+            // Moves the pending modifications into the compile mask. Called by the pool before compiling the group.
+            void BeginCompile();
+
+            // Retires resource types that were written to all buffered copies. Called by the pool after compiling the group.
+            void EndCompile();
+
             ShaderResourceGroupData m_data;
 
             // The binding slot cached from the layout.
             uint32_t m_bindingSlot = (uint32_t)-1;
 
             // Gates the Compile() function so that the SRG is only queued once.
-            bool m_isQueuedForCompile = false;
+            AZStd::atomic_bool m_isQueuedForCompile{ false };
+
+            // Index of the group in the pool compile queue, valid while m_isQueuedForCompile is set.
+            uint32_t m_compileQueueIndex = 0;
+
+            // Resource types and constant bytes modified since the last compile.
+            AZStd::atomic<uint32_t> m_pendingUpdateMask{ 0 };
+            Interval m_pendingConstantsInterval;
+
+            // Resource types and constant bytes written by each compile, along with the number of compiles
+            // each resource type has been written for since it was last modified.
+            uint32_t m_compileUpdateMask = 0;
+            Interval m_compileConstantsInterval;
+            AZStd::array<uint32_t, ShaderResourceGroupData::ResourceTypeCount> m_resourceTypeIteration = {};
         };
     }
 }
@@ -35,9 +35,42 @@ namespace AZ
         //! prefer to share the data between them (i.e. within a single job).
         //! 
         //! NOTE [SRG Constants]: The ConstantsData class is used for efficiently setting/getting the constants values of the SRG.
+        //! 
+        //! NOTE [Update Tracking]: The data records which resource types, and which byte range of the constants, were modified
+        //! since it was created or since the last call to ResetUpdateMask. Platforms use this to skip re-uploading the parts of
+        //! the group that did not change. Users that keep a data instance around and modify it incrementally should call
+        //! ResetUpdateMask after pushing it to the SRG; otherwise the modifications keep accumulating and the group is compiled
+        //! in full, as before.
         class ShaderResourceGroupData
         {
         public:
+            //! The kinds of data held by the group, tracked independently for compilation.
+            enum class ResourceType : uint32_t
+            {
+                ConstantData = 0,
+                BufferView,
+                ImageView,
+                Sampler,
+                BufferViewUnboundedArray,
+                ImageViewUnboundedArray,
+                Count
+            };
+
+            static const uint32_t ResourceTypeCount = static_cast<uint32_t>(ResourceType::Count);
+
+            //! Bit mask of ResourceType values. Bit N corresponds to ResourceType N.
+            enum class ResourceTypeMask : uint32_t
+            {
+                None = 0,
+                ConstantDataMask = AZ_BIT(static_cast<uint32_t>(ResourceType::ConstantData)),
+                BufferViewMask = AZ_BIT(static_cast<uint32_t>(ResourceType::BufferView)),
+                ImageViewMask = AZ_BIT(static_cast<uint32_t>(ResourceType::ImageView)),
+                SamplerMask = AZ_BIT(static_cast<uint32_t>(ResourceType::Sampler)),
+                BufferViewUnboundedArrayMask = AZ_BIT(static_cast<uint32_t>(ResourceType::BufferViewUnboundedArray)),
+                ImageViewUnboundedArrayMask = AZ_BIT(static_cast<uint32_t>(ResourceType::ImageViewUnboundedArray)),
+                All = AZ_BIT_MASK(ResourceTypeCount)
+            };
+
             //! By default creates an empty data structure. Must be initialized before use.
             ShaderResourceGroupData();
             ~ShaderResourceGroupData();
@@ -176,7 +209,21 @@ namespace AZ
             //! Returns the shader resource layout for this group.
             const ShaderResourceGroupLayout* GetLayout() const;
 
+            //! Returns the resource types modified since the data was created or since the last call to ResetUpdateMask.
+            ResourceTypeMask GetUpdateMask() const;
+
+            //! Returns the byte [min, max) interval of the constant data modified since the data was created or since
+            //! the last call to ResetUpdateMask. The interval is empty if no constant was modified.
+            Interval GetConstantsUpdateInterval() const;
+
+            //! Clears the update tracking. Call after the data was pushed to the SRG if the instance is reused.
+            void ResetUpdateMask();
+
         private:
+            void MarkModified(ResourceTypeMask resourceTypeMask);
+            void MarkConstantsModified(uint32_t byteOffset, uint32_t byteCount);
+            void MarkConstantModified(ShaderInputConstantIndex inputIndex);
+
             static const ConstPtr<ImageView> s_nullImageView;
             static const ConstPtr<BufferView> s_nullBufferView;
             static const SamplerState s_nullSamplerState;
@@ -200,24 +247,45 @@ namespace AZ
 
             //! The backing data store of constants for the shader resource group.
             ConstantsData m_constantsData;
+
+            //! Resource types and constant bytes modified since the last call to ResetUpdateMask.
+            ResourceTypeMask m_updateMask = ResourceTypeMask::None;
+            Interval m_constantsUpdateInterval;
         };
 
+        AZ_DEFINE_ENUM_BITWISE_OPERATORS(AZ::RHI::ShaderResourceGroupData::ResourceTypeMask)
+
         template <typename T>
         bool ShaderResourceGroupData::SetConstant(ShaderInputConstantIndex inputIndex, const T& value)
         {
-            return m_constantsData.SetConstant(inputIndex, value);
+            if (m_constantsData.SetConstant(inputIndex, value))
+            {
+                MarkConstantModified(inputIndex);
+                return true;
+            }
+            return false;
         }
 
         template <typename T>
         bool ShaderResourceGroupData::SetConstant(ShaderInputConstantIndex inputIndex, const T& value, uint32_t arrayIndex)
         {
-            return m_constantsData.SetConstant(inputIndex, value, arrayIndex);
+            if (m_constantsData.SetConstant(inputIndex, value, arrayIndex))
+            {
+                MarkConstantModified(inputIndex);
+                return true;
+            }
+            return false;
         }
 
         template <typename T>
         bool ShaderResourceGroupData::SetConstantArray(ShaderInputConstantIndex inputIndex, AZStd::array_view<T> values)
         {
-            return m_constantsData.SetConstantArray(inputIndex, values);
+            if (m_constantsData.SetConstantArray(inputIndex, values))
+            {
+                MarkConstantModified(inputIndex);
+                return true;
+            }
+            return false;
         }
 
         template <typename T>
@@ -241,7 +309,12 @@ namespace AZ
         template <typename T>
         bool ShaderResourceGroupData::SetConstantMatrixRows(ShaderInputConstantIndex inputIndex, const T& value, uint32_t rowCount)
         {
-            return m_constantsData.SetConstantMatrixRows(inputIndex, value, rowCount);
+            if (m_constantsData.SetConstantMatrixRows(inputIndex, value, rowCount))
+            {
+                MarkConstantModified(inputIndex);
+                return true;
+            }
+            return false;
         }
 
         template<typename TShaderInput, typename TShaderInputDescriptor>
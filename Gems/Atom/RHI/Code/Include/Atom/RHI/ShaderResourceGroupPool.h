@@ -83,13 +83,15 @@ namespace AZ
             //////////////////////////////////////////////////////////////////////////
 
         private:
-            // Queues the shader resource group for compile and provides a new data packet (takes a lock).
+            // Queues the shader resource group for compile and provides a new data packet. Takes a shared lock,
+            // so groups can be queued from several threads at once without contending with each other.
             void QueueForCompile(ShaderResourceGroup& group, const ShaderResourceGroupData& groupData);
 
-            // Queues the shader resource group for compile. Legal to call on a queued group. Takes a lock.
+            // Queues the shader resource group for compile. Legal to call on a queued group. Takes a shared lock.
             void QueueForCompile(ShaderResourceGroup& group);
 
-            // Queues the shader resource group for compile. Legal to call on a queued group. Does NOT take a lock.
+            // Queues the shader resource group for compile. Legal to call on a queued group. Does NOT take a lock,
+            // the queue itself is lock-free.
             void QueueForCompileNoLock(ShaderResourceGroup& group);
 
             // Un-queues the shader resource group for compile. Legal to call on an un-queued group. Takes a lock.
@@ -98,6 +100,9 @@ namespace AZ
             // Compiles an SRG synchronously. 
             void Compile(ShaderResourceGroup& group, const ShaderResourceGroupData& groupData);
 
+            // Compiles the data bound on the group, limited to the resource types modified in the last few compiles.
+            void CompileGroup(ShaderResourceGroup& group);
+
             // Calculate diffs for updating the resource registry.
             void CalculateGroupDataDiff(ShaderResourceGroup& shaderResourceGroup, const ShaderResourceGroupData& groupData);
           
@@ -125,8 +130,9 @@ namespace AZ
             bool m_hasSamplerGroup = false;
             bool m_isCompiling = false;
 
+            // Queuing takes the lock shared, compiling and un-queuing take it exclusively.
             mutable AZStd::shared_mutex m_groupsToCompileMutex;
-            AZStd::vector<ShaderResourceGroup*> m_groupsToCompile;
+            AZStd::concurrent_vector<ShaderResourceGroup*> m_groupsToCompile;
 
             AZStd::mutex m_invalidateRegistryMutex;
             ShaderResourceGroupInvalidateRegistry m_invalidateRegistry;
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RHI.Reflect/PipelineStateCacheData.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        namespace
+        {
+            template <typename T>
+            void SortAndRemoveDuplicates(AZStd::vector<T>& elements)
+            {
+                const auto lessThan = [](const T& lhs, const T& rhs) { return lhs.m_hash < rhs.m_hash; };
+                const auto equalTo = [](const T& lhs, const T& rhs) { return lhs.m_hash == rhs.m_hash; };
+
+                AZStd::sort(elements.begin(), elements.end(), lessThan);
+                elements.erase(AZStd::unique(elements.begin(), elements.end(), equalTo), elements.end());
+            }
+
+            template <typename T>
+            void SortAndRemoveDuplicates(AZStd::vector<Ptr<T>>& elements)
+            {
+                const auto lessThan = [](const Ptr<T>& lhs, const Ptr<T>& rhs) { return lhs->GetHash() < rhs->GetHash(); };
+                const auto equalTo = [](const Ptr<T>& lhs, const Ptr<T>& rhs) { return lhs->GetHash() == rhs->GetHash(); };
+
+                AZStd::sort(elements.begin(), elements.end(), lessThan);
+                elements.erase(AZStd::unique(elements.begin(), elements.end(), equalTo), elements.end());
+            }
+
+            template <typename T>
+            const T* FindByHash(const AZStd::vector<Ptr<T>>& elements, HashValue64 hash)
+            {
+                auto it = AZStd::lower_bound(elements.begin(), elements.end(), hash,
+                    [](const Ptr<T>& element, HashValue64 value) { return element->GetHash() < value; });
+
+                if (it != elements.end() && (*it)->GetHash() == hash)
+                {
+                    return it->get();
+                }
+                return nullptr;
+            }
+        }
+
+        void PipelineStateCacheData::DrawRecord::Reflect(ReflectContext* context)
+        {
+            if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<DrawRecord>()
+                    ->Version(0)
+                    ->Field("m_hash", &DrawRecord::m_hash)
+                    ->Field("m_pipelineLayoutHash", &DrawRecord::m_pipelineLayoutHash)
+                    ->Field("m_vertexFunctionHash", &DrawRecord::m_vertexFunctionHash)
+                    ->Field("m_tessellationFunctionHash", &DrawRecord::m_tessellationFunctionHash)
+                    ->Field("m_fragmentFunctionHash", &DrawRecord::m_fragmentFunctionHash)
+                    ->Field("m_inputStreamLayout", &DrawRecord::m_inputStreamLayout)
+                    ->Field("m_renderAttachmentConfiguration", &DrawRecord::m_renderAttachmentConfiguration)
+                    ->Field("m_renderStates", &DrawRecord::m_renderStates);
+            }
+        }
+
+        void PipelineStateCacheData::DispatchRecord::Reflect(ReflectContext* context)
+        {
+            if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<DispatchRecord>()
+                    ->Version(0)
+                    ->Field("m_hash", &DispatchRecord::m_hash)
+                    ->Field("m_pipelineLayoutHash", &DispatchRecord::m_pipelineLayoutHash)
+                    ->Field("m_computeFunctionHash", &DispatchRecord::m_computeFunctionHash);
+            }
+        }
+
+        void PipelineStateCacheData::Reflect(ReflectContext* context)
+        {
+            DrawRecord::Reflect(context);
+            DispatchRecord::Reflect(context);
+
+            if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<PipelineStateCacheData>()
+                    ->Version(0)
+                    ->Field("m_drawRecords", &PipelineStateCacheData::m_drawRecords)
+                    ->Field("m_dispatchRecords", &PipelineStateCacheData::m_dispatchRecords)
+                    ->Field("m_shaderStageFunctions", &PipelineStateCacheData::m_shaderStageFunctions)
+                    ->Field("m_pipelineLayouts", &PipelineStateCacheData::m_pipelineLayouts);
+            }
+        }
+
+        Ptr<PipelineStateCacheData> PipelineStateCacheData::Create()
+        {
+            return aznew PipelineStateCacheData();
+        }
+
+        void PipelineStateCacheData::AddDrawRecord(const DrawRecord& record)
+        {
+            m_drawRecords.push_back(record);
+        }
+
+        void PipelineStateCacheData::AddDispatchRecord(const DispatchRecord& record)
+        {
+            m_dispatchRecords.push_back(record);
+        }
+
+        void PipelineStateCacheData::AddShaderStageFunction(ConstPtr<ShaderStageFunction> shaderStageFunction)
+        {
+            if (shaderStageFunction)
+            {
+                // The const_cast is required because serialization does not allow for ConstPtr.
+                m_shaderStageFunctions.emplace_back(const_cast<ShaderStageFunction*>(shaderStageFunction.get()));
+            }
+        }
+
+        void PipelineStateCacheData::AddPipelineLayout(ConstPtr<PipelineLayoutDescriptor> pipelineLayout)
+        {
+            if (pipelineLayout)
+            {
+                // The const_cast is required because serialization does not allow for ConstPtr.
+                m_pipelineLayouts.emplace_back(const_cast<PipelineLayoutDescriptor*>(pipelineLayout.get()));
+            }
+        }
+
+        void PipelineStateCacheData::Finalize()
+        {
+            SortAndRemoveDuplicates(m_drawRecords);
+            SortAndRemoveDuplicates(m_dispatchRecords);
+            SortAndRemoveDuplicates(m_shaderStageFunctions);
+            SortAndRemoveDuplicates(m_pipelineLayouts);
+        }
+
+        AZStd::array_view<PipelineStateCacheData::DrawRecord> PipelineStateCacheData::GetDrawRecords() const
+        {
+            return m_drawRecords;
+        }
+
+        AZStd::array_view<PipelineStateCacheData::DispatchRecord> PipelineStateCacheData::GetDispatchRecords() const
+        {
+            return m_dispatchRecords;
+        }
+
+        size_t PipelineStateCacheData::GetRecordCount() const
+        {
+            return m_drawRecords.size() + m_dispatchRecords.size();
+        }
+
+        const ShaderStageFunction* PipelineStateCacheData::FindShaderStageFunction(HashValue64 hash) const
+        {
+            return FindByHash(m_shaderStageFunctions, hash);
+        }
+
+        const PipelineLayoutDescriptor* PipelineStateCacheData::FindPipelineLayout(HashValue64 hash) const
+        {
+            return FindByHash(m_pipelineLayouts, hash);
+        }
+    }
+}
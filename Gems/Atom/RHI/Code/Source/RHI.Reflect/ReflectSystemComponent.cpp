@@ -24,6 +24,7 @@
 #include <Atom/RHI.Reflect/RenderStates.h>
 #include <Atom/RHI.Reflect/PipelineLayoutDescriptor.h>
 #include <Atom/RHI.Reflect/PipelineLibraryData.h>
+#include <Atom/RHI.Reflect/PipelineStateCacheData.h>
 #include <Atom/RHI.Reflect/ReflectSystemComponent.h>
 #include <Atom/RHI.Reflect/RenderAttachmentLayout.h>
 #include <Atom/RHI.Reflect/ResolveScopeAttachmentDescriptor.h>
@@ -67,6 +68,7 @@ namespace AZ
             MultisampleState::Reflect(context);
             RenderStates::Reflect(context);
             PipelineLibraryData::Reflect(context);
+            PipelineStateCacheData::Reflect(context);
             ReflectRenderStateEnums(context);
             ReflectSamplerStateEnums(context);
             //////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,126 @@ namespace AZ
 {
     namespace RHI
     {
+        namespace
+        {
+            /**
+             * Builds a sortable key. It iterates each scope and performs deactivations
+             * followed by activations on each attachment.
+             */
+            const uint32_t ATTACHMENT_BIT_COUNT = 16;
+            const uint32_t SCOPE_BIT_COUNT = 14;
+
+            enum class Action
+            {
+                ActivateImage = 0,
+                ActivateBuffer,
+                DeactivateImage,
+                DeactivateBuffer,
+            };
+
+            struct Command
+            {
+                Command(uint32_t scopeIndex, Action action, uint32_t attachmentIndex)
+                {
+                    m_bits.m_scopeIndex = scopeIndex;
+                    m_bits.m_action = (uint32_t)action;
+                    m_bits.m_attachmentIndex = attachmentIndex;
+                }
+
+                explicit Command(uint32_t command)
+                {
+                    m_command = command;
+                }
+
+                bool operator < (Command rhs) const
+                {
+                    return m_command < rhs.m_command;
+                }
+
+                struct Bits
+                {
+                    /// Sort by attachment index last
+                    uint32_t m_attachmentIndex : ATTACHMENT_BIT_COUNT;
+
+                    /// Sort by the action after the scope. First by deactivations, then by activations.
+                    uint32_t m_action : 2;
+
+                    /// Sort by scope index first.
+                    uint32_t m_scopeIndex : SCOPE_BIT_COUNT;
+                };
+
+                union
+                {
+                    Bits m_bits;
+
+                    uint32_t m_command = 0;
+                };
+            };
+
+            static_assert(sizeof(Command) == sizeof(uint32_t), "Commands are cached as their 32 bit keys.");
+        }
+
+        void FrameGraphCompiler::CompileCache::Clear()
+        {
+            m_hash = HashValue64{ 0 };
+            m_isValid = false;
+            m_scopeIds.clear();
+            m_transientBufferCount = 0;
+            m_transientImageCount = 0;
+            m_scopeLinks.clear();
+            m_transientBufferLifetimes.clear();
+            m_transientImageLifetimes.clear();
+            m_transientAttachmentCommands.clear();
+            m_memoryHint.reset();
+        }
+
+        void FrameGraphCompiler::CompileCache::Begin(HashValue64 hash, const FrameGraph& frameGraph)
+        {
+            Clear();
+            m_hash = hash;
+
+            const auto& scopes = frameGraph.GetScopes();
+            m_scopeIds.reserve(scopes.size());
+            for (const Scope* scope : scopes)
+            {
+                m_scopeIds.push_back(scope->GetId());
+            }
+
+            const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+            m_transientBufferCount = static_cast<uint32_t>(attachmentDatabase.GetTransientBufferAttachments().size());
+            m_transientImageCount = static_cast<uint32_t>(attachmentDatabase.GetTransientImageAttachments().size());
+        }
+
+        bool FrameGraphCompiler::CompileCache::Matches(HashValue64 hash, const FrameGraph& frameGraph) const
+        {
+            if (!m_isValid || m_hash != hash)
+            {
+                return false;
+            }
+
+            const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+            if (m_transientBufferCount != attachmentDatabase.GetTransientBufferAttachments().size() ||
+                m_transientImageCount != attachmentDatabase.GetTransientImageAttachments().size())
+            {
+                return false;
+            }
+
+            const auto& scopes = frameGraph.GetScopes();
+            if (m_scopeIds.size() != scopes.size())
+            {
+                return false;
+            }
+
+            for (size_t scopeIndex = 0; scopeIndex < scopes.size(); ++scopeIndex)
+            {
+                if (m_scopeIds[scopeIndex] != scopes[scopeIndex]->GetId())
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
         ResultCode FrameGraphCompiler::Init(Device& device)
         {
             if (Validation::IsEnabled())
@@ -62,6 +182,8 @@ namespace AZ
             {
                 m_imageViewCache.Clear();
                 m_bufferViewCache.Clear();
+                m_compileCache.Clear();
+                m_statistics = {};
 
                 ShutdownInternal();
                 DeviceObject::Shutdown();
@@ -94,6 +216,80 @@ namespace AZ
             return AZ::Success();
         }
 
+        HashValue64 FrameGraphCompiler::ComputeCompileHash(const FrameGraphCompileRequest& request) const
+        {
+            AZ_ATOM_PROFILE_FUNCTION("RHI", "FrameGraphCompiler: ComputeCompileHash");
+
+            const FrameGraph& frameGraph = *request.m_frameGraph;
+
+            HashValue64 hash = TypeHash64(request.m_compileFlags);
+
+            // A different pool invalidates the memory hint.
+            hash = TypeHash64(request.m_transientAttachmentPool, hash);
+            if (request.m_transientAttachmentPool)
+            {
+                hash = TypeHash64(request.m_transientAttachmentPool->GetDescriptor().m_heapParameters.m_type, hash);
+            }
+
+            const auto& scopes = frameGraph.GetScopes();
+            hash = TypeHash64(static_cast<uint32_t>(scopes.size()), hash);
+
+            for (const Scope* scope : scopes)
+            {
+                hash = TypeHash64(scope->GetId().GetHash(), hash);
+                hash = TypeHash64(scope->GetHardwareQueueClass(), hash);
+
+                const auto& consumers = frameGraph.GetConsumers(*scope);
+                hash = TypeHash64(static_cast<uint32_t>(consumers.size()), hash);
+                for (const Scope* consumer : consumers)
+                {
+                    hash = TypeHash64(consumer->GetIndex(), hash);
+                }
+
+                const auto& transientAttachments = scope->GetTransientAttachments();
+                hash = TypeHash64(static_cast<uint32_t>(transientAttachments.size()), hash);
+                for (const ScopeAttachment* scopeAttachment : transientAttachments)
+                {
+                    hash = TypeHash64(scopeAttachment->GetFrameAttachment().GetId().GetHash(), hash);
+                }
+            }
+
+            const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+
+            const auto& transientBuffers = attachmentDatabase.GetTransientBufferAttachments();
+            hash = TypeHash64(static_cast<uint32_t>(transientBuffers.size()), hash);
+            for (const BufferFrameAttachment* transientBuffer : transientBuffers)
+            {
+                hash = TypeHash64(transientBuffer->GetId().GetHash(), hash);
+                hash = transientBuffer->GetBufferDescriptor().GetHash(hash);
+                hash = TypeHash64(transientBuffer->GetFirstScope()->GetIndex(), hash);
+                hash = TypeHash64(transientBuffer->GetLastScope()->GetIndex(), hash);
+            }
+
+            const auto& transientImages = attachmentDatabase.GetTransientImageAttachments();
+            hash = TypeHash64(static_cast<uint32_t>(transientImages.size()), hash);
+            for (const ImageFrameAttachment* transientImage : transientImages)
+            {
+                hash = TypeHash64(transientImage->GetId().GetHash(), hash);
+                hash = transientImage->GetImageDescriptor().GetHash(hash);
+                hash = TypeHash64(transientImage->GetSupportedQueueMask(), hash);
+                hash = TypeHash64(transientImage->GetFirstScope()->GetIndex(), hash);
+                hash = TypeHash64(transientImage->GetLastScope()->GetIndex(), hash);
+            }
+
+            return hash;
+        }
+
+        const FrameGraphCompilerStatistics& FrameGraphCompiler::GetStatistics() const
+        {
+            return m_statistics;
+        }
+
+        void FrameGraphCompiler::ResetStatistics()
+        {
+            m_statistics = {};
+        }
+
         /**
          * The entry point for FrameGraph compilation. Frame Graph compilation is broken into several phases:
          * 
@@ -118,6 +314,9 @@ namespace AZ
          *
          *          The final phase is to compile the platform specific scopes and hand-off compilation to the platform-specific
          *          implementation, which may introduce more phases specific to the platform API.
+         *
+         *      Phases 1 and 2 re-use the results of the previous compile when the topology of the graph is unchanged.
+         *      See ComputeCompileHash for the inputs that are compared.
          */
         MessageOutcome FrameGraphCompiler::Compile(const FrameGraphCompileRequest& request)
         {
@@ -129,8 +328,17 @@ namespace AZ
                 return outcome;
             }
 
+            const AZStd::sys_time_t compileStartTime = AZStd::GetTimeNowTicks();
+
             FrameGraph& frameGraph = *request.m_frameGraph;
 
+            const HashValue64 compileHash = ComputeCompileHash(request);
+            m_isCompileCacheHit = m_compileCache.Matches(compileHash, frameGraph);
+            if (!m_isCompileCacheHit)
+            {
+                m_compileCache.Begin(compileHash, frameGraph);
+            }
+
             /// [Phase 1] Compiles the cross-queue scope graph.
             CompileQueueCentricScopeGraph(frameGraph, request.m_compileFlags);
 
@@ -141,6 +349,8 @@ namespace AZ
                 request.m_compileFlags,
                 request.m_statisticsFlags);
 
+            m_compileCache.m_isValid = true;
+
             /// [Phase 3] Compiles buffer / image views and assigns them to scope attachments.
             CompileResourceViews(frameGraph.GetAttachmentDatabase());
 
@@ -155,7 +365,26 @@ namespace AZ
             }
 
             /// Perform platform-specific compilation.
-            return CompileInternal(request);
+            outcome = CompileInternal(request);
+
+            const AZStd::sys_time_t compileTime = AZStd::GetTimeNowTicks() - compileStartTime;
+            m_statistics.m_lastCompileTime = compileTime;
+            m_statistics.m_lastCompileCacheHit = m_isCompileCacheHit;
+            if (outcome.IsSuccess())
+            {
+                ++m_statistics.m_compileCount;
+                m_statistics.m_compileTime += compileTime;
+                m_statistics.m_cacheHitCount += m_isCompileCacheHit ? 1 : 0;
+            }
+
+            m_isCompileCacheHit = false;
+            return outcome;
+        }
+
+        void FrameGraphCompiler::LinkScopesByQueues(Scope* producer, Scope* consumer)
+        {
+            Scope::LinkProducerConsumerByQueues(producer, consumer);
+            m_compileCache.m_scopeLinks.push_back({ producer->GetIndex(), consumer->GetIndex() });
         }
 
         void FrameGraphCompiler::CompileQueueCentricScopeGraph(
@@ -173,6 +402,16 @@ namespace AZ
                 }
             }
 
+            if (m_isCompileCacheHit)
+            {
+                const auto& scopes = frameGraph.GetScopes();
+                for (const CompileCache::ScopeLink& scopeLink : m_compileCache.m_scopeLinks)
+                {
+                    Scope::LinkProducerConsumerByQueues(scopes[scopeLink.m_producerScopeIndex], scopes[scopeLink.m_consumerScopeIndex]);
+                }
+                return;
+            }
+
             /**
              * Build the per-queue graph by first linking scopes on the same queue
              * with their neighbors. This is because the queue is going to execute serially.
@@ -184,7 +423,7 @@ namespace AZ
                     const uint32_t hardwareQueueClassIdx = static_cast<uint32_t>(consumer->GetHardwareQueueClass());
                     if (producer[hardwareQueueClassIdx])
                     {
-                        Scope::LinkProducerConsumerByQueues(producer[hardwareQueueClassIdx], consumer);
+                        LinkScopesByQueues(producer[hardwareQueueClassIdx], consumer);
                     }
                     producer[hardwareQueueClassIdx] = consumer;
                 }
@@ -237,7 +476,7 @@ namespace AZ
 
                         if (foundEarlierConsumerOnSameQueue == false)
                         {
-                            Scope::LinkProducerConsumerByQueues(producerScopeLast, currentScope);
+                            LinkScopesByQueues(producerScopeLast, currentScope);
                         }
                     }
                 }
@@ -482,60 +721,43 @@ namespace AZ
 
             AZ_ATOM_PROFILE_FUNCTION("RHI", "FrameGraphCompiler: CompileTransientAttachments");
 
-            ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
-
-            /**
-             * Builds a sortable key. It iterates each scope and performs deactivations
-             * followed by activations on each attachment.
-             */
-            const uint32_t ATTACHMENT_BIT_COUNT = 16;
-            const uint32_t SCOPE_BIT_COUNT = 14;
-
-            enum class Action
-            {
-                ActivateImage = 0,
-                ActivateBuffer,
-                DeactivateImage,
-                DeactivateBuffer,
-            };
+            const auto& scopes = frameGraph.GetScopes();
+            const auto& transientBufferGraphAttachments = attachmentDatabase.GetTransientBufferAttachments();
+            const auto& transientImageGraphAttachments = attachmentDatabase.GetTransientImageAttachments();
 
-            struct Command
+            if (m_isCompileCacheHit)
             {
-                Command(uint32_t scopeIndex, Action action, uint32_t attachmentIndex)
+                // The lifetimes are recorded after extension, which makes the extension unnecessary.
+                for (size_t attachmentIndex = 0; attachmentIndex < transientBufferGraphAttachments.size(); ++attachmentIndex)
                 {
-                    m_bits.m_scopeIndex = scopeIndex;
-                    m_bits.m_action = (uint32_t)action;
-                    m_bits.m_attachmentIndex = attachmentIndex;
+                    const CompileCache::Lifetime& lifetime = m_compileCache.m_transientBufferLifetimes[attachmentIndex];
+                    transientBufferGraphAttachments[attachmentIndex]->m_firstScope = scopes[lifetime.m_firstScopeIndex];
+                    transientBufferGraphAttachments[attachmentIndex]->m_lastScope = scopes[lifetime.m_lastScopeIndex];
                 }
 
-                bool operator < (Command rhs) const
+                for (size_t attachmentIndex = 0; attachmentIndex < transientImageGraphAttachments.size(); ++attachmentIndex)
                 {
-                    return m_command < rhs.m_command;
+                    const CompileCache::Lifetime& lifetime = m_compileCache.m_transientImageLifetimes[attachmentIndex];
+                    transientImageGraphAttachments[attachmentIndex]->m_firstScope = scopes[lifetime.m_firstScopeIndex];
+                    transientImageGraphAttachments[attachmentIndex]->m_lastScope = scopes[lifetime.m_lastScopeIndex];
                 }
+            }
+            else
+            {
+                ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
 
-                struct Bits
+                m_compileCache.m_transientBufferLifetimes.reserve(transientBufferGraphAttachments.size());
+                for (const BufferFrameAttachment* transientBuffer : transientBufferGraphAttachments)
                 {
-                    /// Sort by attachment index last
-                    uint32_t m_attachmentIndex : ATTACHMENT_BIT_COUNT;
-
-                    /// Sort by the action after the scope. First by deactivations, then by activations.
-                    uint32_t m_action : 2;
-
-                    /// Sort by scope index first.
-                    uint32_t m_scopeIndex : SCOPE_BIT_COUNT;
-                };
+                    m_compileCache.m_transientBufferLifetimes.push_back({ transientBuffer->GetFirstScope()->GetIndex(), transientBuffer->GetLastScope()->GetIndex() });
+                }
 
-                union
+                m_compileCache.m_transientImageLifetimes.reserve(transientImageGraphAttachments.size());
+                for (const ImageFrameAttachment* transientImage : transientImageGraphAttachments)
                 {
-                    Bits m_bits;
-
-                    uint32_t m_command = 0;
-                };
-            };
-
-            const auto& scopes = frameGraph.GetScopes();
-            const auto& transientBufferGraphAttachments = attachmentDatabase.GetTransientBufferAttachments();
-            const auto& transientImageGraphAttachments = attachmentDatabase.GetTransientImageAttachments();
+                    m_compileCache.m_transientImageLifetimes.push_back({ transientImage->GetFirstScope()->GetIndex(), transientImage->GetLastScope()->GetIndex() });
+                }
+            }
 
             AZ_Assert(scopes.size() < AZ_BIT(SCOPE_BIT_COUNT),
                 "Exceeded maximum number of allowed scopes");
@@ -545,53 +767,62 @@ namespace AZ
 
             AZStd::vector<Buffer*> transientBuffers(transientBufferGraphAttachments.size());
             AZStd::vector<Image*> transientImages(transientImageGraphAttachments.size());
-            AZStd::vector<Command> commands;
-            commands.reserve((transientBufferGraphAttachments.size() + transientImageGraphAttachments.size()) * 2);
-
-            if (CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing))
+            if (!m_isCompileCacheHit)
             {
-                const uint32_t ScopeIndexFirst = 0;
-                const uint32_t ScopeIndexLast = static_cast<uint32_t>(scopes.size() - 1);
+                AZStd::vector<Command> commands;
+                commands.reserve((transientBufferGraphAttachments.size() + transientImageGraphAttachments.size()) * 2);
 
-                // Generate commands for each transient buffer: one for activation, and one for deactivation.
-                for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
+                if (CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing))
                 {
-                    commands.emplace_back(ScopeIndexFirst, Action::ActivateBuffer, attachmentIndex);
-                    commands.emplace_back(ScopeIndexLast, Action::DeactivateBuffer, attachmentIndex);
-                }
+                    const uint32_t ScopeIndexFirst = 0;
+                    const uint32_t ScopeIndexLast = static_cast<uint32_t>(scopes.size() - 1);
 
-                // Generate commands for each transient image: one for activation, and one for deactivation.
-                for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
-                {
-                    commands.emplace_back(ScopeIndexFirst, Action::ActivateImage, attachmentIndex);
-                    commands.emplace_back(ScopeIndexLast, Action::DeactivateImage, attachmentIndex);
+                    // Generate commands for each transient buffer: one for activation, and one for deactivation.
+                    for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
+                    {
+                        commands.emplace_back(ScopeIndexFirst, Action::ActivateBuffer, attachmentIndex);
+                        commands.emplace_back(ScopeIndexLast, Action::DeactivateBuffer, attachmentIndex);
+                    }
+
+                    // Generate commands for each transient image: one for activation, and one for deactivation.
+                    for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
+                    {
+                        commands.emplace_back(ScopeIndexFirst, Action::ActivateImage, attachmentIndex);
+                        commands.emplace_back(ScopeIndexLast, Action::DeactivateImage, attachmentIndex);
+                    }
                 }
-            }
-            else
-            {
-                // Generate commands for each transient buffer: one for activation, and one for deactivation.
-                for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
+                else
                 {
-                    BufferFrameAttachment* transientBuffer = transientBufferGraphAttachments[attachmentIndex];
-                    const uint32_t scopeIndexFirst = transientBuffer->GetFirstScope()->GetIndex();
-                    const uint32_t scopeIndexLast = transientBuffer->GetLastScope()->GetIndex();
-                    commands.emplace_back(scopeIndexFirst, Action::ActivateBuffer, attachmentIndex);
-                    commands.emplace_back(scopeIndexLast, Action::DeactivateBuffer, attachmentIndex);
+                    // Generate commands for each transient buffer: one for activation, and one for deactivation.
+                    for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientBufferGraphAttachments.size(); ++attachmentIndex)
+                    {
+                        BufferFrameAttachment* transientBuffer = transientBufferGraphAttachments[attachmentIndex];
+                        const uint32_t scopeIndexFirst = transientBuffer->GetFirstScope()->GetIndex();
+                        const uint32_t scopeIndexLast = transientBuffer->GetLastScope()->GetIndex();
+                        commands.emplace_back(scopeIndexFirst, Action::ActivateBuffer, attachmentIndex);
+                        commands.emplace_back(scopeIndexLast, Action::DeactivateBuffer, attachmentIndex);
+                    }
+
+                    // Generate commands for each transient image: one for activation, and one for deactivation.
+                    for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
+                    {
+                        ImageFrameAttachment* transientImage = transientImageGraphAttachments[attachmentIndex];
+                        const uint32_t scopeIndexFirst = transientImage->GetFirstScope()->GetIndex();
+                        const uint32_t scopeIndexLast = transientImage->GetLastScope()->GetIndex();
+                        commands.emplace_back(scopeIndexFirst, Action::ActivateImage, attachmentIndex);
+                        commands.emplace_back(scopeIndexLast, Action::DeactivateImage, attachmentIndex);
+                    }
                 }
 
-                // Generate commands for each transient image: one for activation, and one for deactivation.
-                for (uint32_t attachmentIndex = 0; attachmentIndex < (uint32_t)transientImageGraphAttachments.size(); ++attachmentIndex)
+                AZStd::sort(commands.begin(), commands.end());
+
+                m_compileCache.m_transientAttachmentCommands.reserve(commands.size());
+                for (Command command : commands)
                 {
-                    ImageFrameAttachment* transientImage = transientImageGraphAttachments[attachmentIndex];
-                    const uint32_t scopeIndexFirst = transientImage->GetFirstScope()->GetIndex();
-                    const uint32_t scopeIndexLast = transientImage->GetLastScope()->GetIndex();
-                    commands.emplace_back(scopeIndexFirst, Action::ActivateImage, attachmentIndex);
-                    commands.emplace_back(scopeIndexLast, Action::DeactivateImage, attachmentIndex);
+                    m_compileCache.m_transientAttachmentCommands.push_back(command.m_command);
                 }
             }
 
-            AZStd::sort(commands.begin(), commands.end());
-
             auto processCommands = [&](TransientAttachmentPoolCompileFlags compileFlags, TransientAttachmentStatistics::MemoryUsage* memoryHint = nullptr)
             {
                 transientAttachmentPool.Begin(compileFlags, memoryHint);
@@ -600,8 +831,9 @@ namespace AZ
 
                 bool allocateResources = !CheckBitsAny(compileFlags, TransientAttachmentPoolCompileFlags::DontAllocateResources);
 
-                for (Command command : commands)
+                for (uint32_t commandKey : m_compileCache.m_transientAttachmentCommands)
                 {
+                    const Command command(commandKey);
                     const uint32_t scopeIndex = command.m_bits.m_scopeIndex;
                     const uint32_t attachmentIndex = command.m_bits.m_attachmentIndex;
                     const Action action = (Action)command.m_bits.m_action;
@@ -697,9 +929,10 @@ namespace AZ
                 transientAttachmentPool.End();
             };
 
-            AZStd::optional<TransientAttachmentStatistics::MemoryUsage> memoryUsage;
-            // Check if we need to do two passes (one for calculating the size and the second one for allocating the resources)
-            if (transientAttachmentPool.GetDescriptor().m_heapParameters.m_type == HeapAllocationStrategy::MemoryHint)
+            AZStd::optional<TransientAttachmentStatistics::MemoryUsage>& memoryUsage = m_compileCache.m_memoryHint;
+            // Check if we need to do two passes (one for calculating the size and the second one for allocating the resources).
+            // The size only depends on the cached commands, so the first pass is skipped when they are re-used.
+            if (transientAttachmentPool.GetDescriptor().m_heapParameters.m_type == HeapAllocationStrategy::MemoryHint && !memoryUsage)
             {
                 // First pass to calculate size needed.
                 processCommands(TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
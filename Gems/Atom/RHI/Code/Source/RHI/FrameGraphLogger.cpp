@@ -9,6 +9,7 @@
 #include <Atom/RHI/FrameGraphLogger.h>
 #include <Atom/RHI/FrameGraph.h>
 #include <Atom/RHI/FrameGraphAttachmentDatabase.h>
+#include <Atom/RHI/FrameGraphCompiler.h>
 #include <Atom/RHI/ImageScopeAttachment.h>
 #include <Atom/RHI/BufferScopeAttachment.h>
 #include <AzCore/Debug/EventTrace.h>
@@ -133,6 +134,34 @@ namespace AZ
             DumpGraphVis(frameGraph);
         }
 
+        void FrameGraphLogger::Log(
+            const FrameGraphCompilerStatistics& compilerStatistics,
+            FrameSchedulerLogVerbosity logVerbosity)
+        {
+            if (logVerbosity == FrameSchedulerLogVerbosity::None)
+            {
+                return;
+            }
+
+            const double ticksToMilliseconds = 1000.0 / static_cast<double>(AZStd::GetTimeTicksPerSecond());
+            const double averageCompileTime = compilerStatistics.m_compileCount
+                ? static_cast<double>(compilerStatistics.m_compileTime) / static_cast<double>(compilerStatistics.m_compileCount)
+                : 0.0;
+            const double cacheHitRate = compilerStatistics.m_compileCount
+                ? static_cast<double>(compilerStatistics.m_cacheHitCount) / static_cast<double>(compilerStatistics.m_compileCount)
+                : 0.0;
+
+            AZ_Printf("FrameGraph", "FrameGraph Compile\n");
+            AZ_Printf("FrameGraph", "\tCompile Time: %.3f ms (%s)\n",
+                static_cast<double>(compilerStatistics.m_lastCompileTime) * ticksToMilliseconds,
+                compilerStatistics.m_lastCompileCacheHit ? "cached" : "full");
+            AZ_Printf("FrameGraph", "\tAverage Compile Time: %.3f ms\n", averageCompileTime * ticksToMilliseconds);
+            AZ_Printf("FrameGraph", "\tCache Hit Rate: %.1f%% (%llu of %llu)\n",
+                cacheHitRate * 100.0,
+                static_cast<unsigned long long>(compilerStatistics.m_cacheHitCount),
+                static_cast<unsigned long long>(compilerStatistics.m_compileCount));
+        }
+
         void FrameGraphLogger::DumpGraphVis(const FrameGraph& frameGraph)
         {
             const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
@@ -28,7 +28,9 @@
 #include <AzCore/Debug/EventTrace.h>
 #include <AzCore/Jobs/Algorithms.h>
 #include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 
 namespace AZ
 {
@@ -198,6 +200,7 @@ namespace AZ
                 }
 
                 FrameGraphLogger::Log(*m_frameGraph, compileRequest.m_logVerbosity);
+                FrameGraphLogger::Log(m_frameGraphCompiler->GetStatistics(), compileRequest.m_logVerbosity);
 
                 // Builds the scope execution schedule using the compiled graph.
                 m_frameGraphExecuter->Begin(*m_frameGraph);
@@ -269,13 +272,17 @@ namespace AZ
 
                 resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileGroupsBeginFunction)>(compileGroupsBeginFunction);
 
-                // Iterate over each SRG pool and fork jobs to compile SRGs.
-                const uint32_t compilesPerJob = m_compileRequest.m_shaderResourceGroupCompilesPerJob;
+                // Iterate over each SRG pool and fork jobs to compile SRGs. The compiles of a pool are spread evenly
+                // across the worker threads, without going below the requested minimum number of compiles per job.
+                const uint32_t compilesPerJobMin = AZStd::max(m_compileRequest.m_shaderResourceGroupCompilesPerJob, 1u);
+                const AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+                const uint32_t workerThreadCount = jobContext ? AZStd::max(jobContext->GetJobManager().GetNumWorkerThreads(), 1u) : 1u;
                 AZ::JobCompletion jobCompletion;
 
-                const auto compileIntervalsFunction = [compilesPerJob, &jobCompletion](ShaderResourceGroupPool* srgPool)
+                const auto compileIntervalsFunction = [compilesPerJobMin, workerThreadCount, &jobCompletion](ShaderResourceGroupPool* srgPool)
                 {
                     const uint32_t compilesInPool = srgPool->GetGroupsToCompileCount();
+                    const uint32_t compilesPerJob = AZStd::max(DivideByMultiple(compilesInPool, workerThreadCount), compilesPerJobMin);
                     const uint32_t jobCount = DivideByMultiple(compilesInPool, compilesPerJob);
 
                     for (uint32_t i = 0; i < jobCount; ++i)
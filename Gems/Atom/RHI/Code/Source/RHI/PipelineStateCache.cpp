@@ -9,6 +9,9 @@
 #include <Atom/RHI/CpuProfiler.h>
 #include <Atom/RHI/PipelineStateCache.h>
 #include <Atom/RHI/Factory.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/parallel/exponential_backoff.h>
 
@@ -16,6 +19,91 @@ namespace AZ
 {
     namespace RHI
     {
+        namespace
+        {
+            // Statistics counters are only incremented by their owning thread, so a plain load and store
+            // is enough and avoids a locked read-modify-write on the fast path.
+            template <typename T>
+            void IncrementCounter(AZStd::atomic<T>& counter, T value = 1)
+            {
+                counter.store(counter.load(AZStd::memory_order_relaxed) + value, AZStd::memory_order_relaxed);
+            }
+
+            HashValue64 GetHashOrZero(const ConstPtr<ShaderStageFunction>& shaderStageFunction)
+            {
+                return shaderStageFunction ? shaderStageFunction->GetHash() : HashValue64{ 0 };
+            }
+
+            // A zero hash refers to an unused (null) function.
+            bool FindShaderStageFunction(const PipelineStateCacheData& cacheData, HashValue64 hash, ConstPtr<ShaderStageFunction>& shaderStageFunction)
+            {
+                shaderStageFunction = cacheData.FindShaderStageFunction(hash);
+                return shaderStageFunction || hash == HashValue64{ 0 };
+            }
+
+            // Rebuilds the descriptor of a record. Fails if the record references data missing from the cache data,
+            // or if the rebuilt descriptor doesn't hash to the recorded value (e.g. the hashing has changed).
+            bool BuildDescriptor(const PipelineStateCacheData& cacheData, const PipelineStateCacheData::DrawRecord& record, PipelineStateDescriptorForDraw& descriptor)
+            {
+                descriptor.m_pipelineLayoutDescriptor = cacheData.FindPipelineLayout(record.m_pipelineLayoutHash);
+                if (!descriptor.m_pipelineLayoutDescriptor ||
+                    !FindShaderStageFunction(cacheData, record.m_vertexFunctionHash, descriptor.m_vertexFunction) ||
+                    !FindShaderStageFunction(cacheData, record.m_tessellationFunctionHash, descriptor.m_tessellationFunction) ||
+                    !FindShaderStageFunction(cacheData, record.m_fragmentFunctionHash, descriptor.m_fragmentFunction))
+                {
+                    return false;
+                }
+
+                descriptor.m_inputStreamLayout = record.m_inputStreamLayout;
+                descriptor.m_renderAttachmentConfiguration = record.m_renderAttachmentConfiguration;
+                descriptor.m_renderStates = record.m_renderStates;
+                return descriptor.GetHash() == record.m_hash;
+            }
+
+            bool BuildDescriptor(const PipelineStateCacheData& cacheData, const PipelineStateCacheData::DispatchRecord& record, PipelineStateDescriptorForDispatch& descriptor)
+            {
+                descriptor.m_pipelineLayoutDescriptor = cacheData.FindPipelineLayout(record.m_pipelineLayoutHash);
+                descriptor.m_computeFunction = cacheData.FindShaderStageFunction(record.m_computeFunctionHash);
+                if (!descriptor.m_pipelineLayoutDescriptor || !descriptor.m_computeFunction)
+                {
+                    return false;
+                }
+
+                return descriptor.GetHash() == record.m_hash;
+            }
+
+            void AddRecord(PipelineStateCacheData& cacheData, HashValue64 hash, const PipelineStateDescriptorForDraw& descriptor)
+            {
+                PipelineStateCacheData::DrawRecord record;
+                record.m_hash = hash;
+                record.m_pipelineLayoutHash = descriptor.m_pipelineLayoutDescriptor->GetHash();
+                record.m_vertexFunctionHash = GetHashOrZero(descriptor.m_vertexFunction);
+                record.m_tessellationFunctionHash = GetHashOrZero(descriptor.m_tessellationFunction);
+                record.m_fragmentFunctionHash = GetHashOrZero(descriptor.m_fragmentFunction);
+                record.m_inputStreamLayout = descriptor.m_inputStreamLayout;
+                record.m_renderAttachmentConfiguration = descriptor.m_renderAttachmentConfiguration;
+                record.m_renderStates = descriptor.m_renderStates;
+
+                cacheData.AddDrawRecord(record);
+                cacheData.AddPipelineLayout(descriptor.m_pipelineLayoutDescriptor);
+                cacheData.AddShaderStageFunction(descriptor.m_vertexFunction);
+                cacheData.AddShaderStageFunction(descriptor.m_tessellationFunction);
+                cacheData.AddShaderStageFunction(descriptor.m_fragmentFunction);
+            }
+
+            void AddRecord(PipelineStateCacheData& cacheData, HashValue64 hash, const PipelineStateDescriptorForDispatch& descriptor)
+            {
+                PipelineStateCacheData::DispatchRecord record;
+                record.m_hash = hash;
+                record.m_pipelineLayoutHash = descriptor.m_pipelineLayoutDescriptor->GetHash();
+                record.m_computeFunctionHash = descriptor.m_computeFunction->GetHash();
+
+                cacheData.AddDispatchRecord(record);
+                cacheData.AddPipelineLayout(descriptor.m_pipelineLayoutDescriptor);
+                cacheData.AddShaderStageFunction(descriptor.m_computeFunction);
+            }
+        }
+
         Ptr<PipelineStateCache> PipelineStateCache::Create(Device& device)
         {
             return aznew PipelineStateCache(device);
@@ -25,6 +113,14 @@ namespace AZ
             : m_device{&device}
         {}
 
+        PipelineStateCache::~PipelineStateCache()
+        {
+            for (size_t i = 0; i < m_globalLibrarySet.size(); ++i)
+            {
+                CancelWarmup(PipelineLibraryHandle(i));
+            }
+        }
+
         void PipelineStateCache::ValidateCacheIntegrity() const
         {
 #if defined(AZ_ENABLE_TRACING)
@@ -38,6 +134,7 @@ namespace AZ
                 if (!m_globalLibraryActiveBits[i])
                 {
                     AZ_Assert(readOnlyCache.empty(), "Inactive library has pipeline states in its global entry.");
+                    AZ_Assert(globalLibraryEntry.m_warmupCache.empty(), "Inactive library has warmed up pipeline states.");
                 }
 
                 PipelineStateSet readOnlyCacheCopy = readOnlyCache;
@@ -66,6 +163,11 @@ namespace AZ
 
         void PipelineStateCache::Reset()
         {
+            for (size_t i = 0; i < m_globalLibrarySet.size(); ++i)
+            {
+                CancelWarmup(PipelineLibraryHandle(i));
+            }
+
             AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
 
             for (size_t i = 0; i < m_globalLibrarySet.size(); ++i)
@@ -117,6 +219,8 @@ namespace AZ
         {
             if (handle.IsValid())
             {
+                CancelWarmup(handle);
+
                 AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
                 AZ_Assert(m_globalLibraryActiveBits[handle.GetIndex()], "Releasing a library that is no longer valid.");
 
@@ -125,6 +229,7 @@ namespace AZ
                 GlobalLibraryEntry& libraryEntry = m_globalLibrarySet[handle.GetIndex()];
                 libraryEntry.m_readOnlyCache.clear();
                 libraryEntry.m_serializedData = nullptr;
+                libraryEntry.m_warmupData = nullptr;
 
                 m_globalLibraryActiveBits[handle.GetIndex()] = false;
                 m_libraryFreeList.push_back(handle);
@@ -135,11 +240,21 @@ namespace AZ
         {
             if (handle.IsValid())
             {
+                CancelWarmup(handle);
+
                 AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
                 ResetLibraryImpl(handle);
             }
         }
 
+        void PipelineStateCache::CancelWarmup(PipelineLibraryHandle handle)
+        {
+            GlobalLibraryEntry& libraryEntry = m_globalLibrarySet[handle.GetIndex()];
+            libraryEntry.m_warmupCancelled = true;
+            WaitForWarmup(handle);
+            libraryEntry.m_warmupCancelled = false;
+        }
+
         void PipelineStateCache::ResetLibraryImpl(PipelineLibraryHandle handle)
         {
             m_threadLibrarySet.ForEach([handle](ThreadLibrarySet& librarySet)
@@ -155,6 +270,7 @@ namespace AZ
             libraryEntry.m_readOnlyCache.clear();
             libraryEntry.m_pendingCacheMutex.lock();
             libraryEntry.m_pendingCache.clear();
+            libraryEntry.m_warmupCache.clear();
             libraryEntry.m_pendingCacheMutex.unlock();
         }
 
@@ -204,6 +320,232 @@ namespace AZ
             return nullptr;
         }
 
+        ConstPtr<PipelineStateCacheData> PipelineStateCache::GetLibraryCacheData(PipelineLibraryHandle handle) const
+        {
+            if (handle.IsNull())
+            {
+                return nullptr;
+            }
+
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+
+            const GlobalLibraryEntry& entry = m_globalLibrarySet[handle.GetIndex()];
+
+            Ptr<PipelineStateCacheData> cacheData = PipelineStateCacheData::Create();
+
+            // Pipeline states that failed to compile are left out, and neither are their warmup records carried over.
+            AZStd::vector<HashValue64> failedHashes;
+
+            const auto addPipelineStates = [&cacheData, &failedHashes](const PipelineStateSet& pipelineStateSet)
+            {
+                for (const PipelineStateEntry& pipelineStateEntry : pipelineStateSet)
+                {
+                    if (!pipelineStateEntry.m_pipelineState->IsInitialized())
+                    {
+                        failedHashes.push_back(pipelineStateEntry.m_hash);
+                    }
+                    else if (const auto* drawDescriptor = AZStd::get_if<PipelineStateDescriptorForDraw>(&pipelineStateEntry.m_pipelineStateDescriptorVariant))
+                    {
+                        AddRecord(*cacheData, pipelineStateEntry.m_hash, *drawDescriptor);
+                    }
+                    else if (const auto* dispatchDescriptor = AZStd::get_if<PipelineStateDescriptorForDispatch>(&pipelineStateEntry.m_pipelineStateDescriptorVariant))
+                    {
+                        AddRecord(*cacheData, pipelineStateEntry.m_hash, *dispatchDescriptor);
+                    }
+                }
+            };
+
+            // No acquires are in flight while the exclusive lock is held, so the pending cache is stable.
+            addPipelineStates(entry.m_readOnlyCache);
+            addPipelineStates(entry.m_pendingCache);
+
+            // Warmed up pipeline states that haven't been acquired are carried over through their warmup records below.
+            for (const auto& warmupEntry : entry.m_warmupCache)
+            {
+                if (!warmupEntry.m_pipelineState->IsInitialized())
+                {
+                    failedHashes.push_back(warmupEntry.m_hash);
+                }
+            }
+
+            if (entry.m_warmupData)
+            {
+                AZStd::sort(failedHashes.begin(), failedHashes.end());
+
+                const PipelineStateCacheData& warmupData = *entry.m_warmupData;
+                for (const PipelineStateCacheData::DrawRecord& record : warmupData.GetDrawRecords())
+                {
+                    PipelineStateDescriptorForDraw descriptor;
+                    if (!AZStd::binary_search(failedHashes.begin(), failedHashes.end(), record.m_hash) && BuildDescriptor(warmupData, record, descriptor))
+                    {
+                        AddRecord(*cacheData, record.m_hash, descriptor);
+                    }
+                }
+
+                for (const PipelineStateCacheData::DispatchRecord& record : warmupData.GetDispatchRecords())
+                {
+                    PipelineStateDescriptorForDispatch descriptor;
+                    if (!AZStd::binary_search(failedHashes.begin(), failedHashes.end(), record.m_hash) && BuildDescriptor(warmupData, record, descriptor))
+                    {
+                        AddRecord(*cacheData, record.m_hash, descriptor);
+                    }
+                }
+            }
+
+            cacheData->Finalize();
+            return cacheData;
+        }
+
+        void PipelineStateCache::WarmupLibrary(PipelineLibraryHandle handle, ConstPtr<PipelineStateCacheData> cacheData, JobPolicy jobPolicy)
+        {
+            if (handle.IsNull() || !cacheData)
+            {
+                return;
+            }
+
+            GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
+
+            {
+                AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+                AZ_Assert(m_globalLibraryActiveBits[handle.GetIndex()], "Warming up a library that is no longer valid.");
+                globalLibraryEntry.m_warmupData = cacheData;
+            }
+
+            const uint32_t recordCount = static_cast<uint32_t>(cacheData->GetRecordCount());
+            if (recordCount == 0)
+            {
+                return;
+            }
+
+            const AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+            if (jobPolicy == JobPolicy::Serial || !jobContext)
+            {
+                WarmupRecords(handle, *cacheData, Interval(0, recordCount));
+                return;
+            }
+
+            // Spread the records evenly across the worker threads. The jobs are not waited on; they are only
+            // waited for (and cancelled) when the library is reset or released.
+            const uint32_t workerThreadCount = AZStd::max(jobContext->GetJobManager().GetNumWorkerThreads(), 1u);
+            const uint32_t recordsPerJob = DivideByMultiple(recordCount, workerThreadCount);
+            const uint32_t jobCount = DivideByMultiple(recordCount, recordsPerJob);
+
+            globalLibraryEntry.m_warmupJobCount += jobCount;
+
+            for (uint32_t i = 0; i < jobCount; ++i)
+            {
+                const Interval interval(i * recordsPerJob, AZStd::min((i + 1) * recordsPerJob, recordCount));
+
+                const auto warmupRecordsLambda = [this, handle, cacheData, interval]()
+                {
+                    WarmupRecords(handle, *cacheData, interval);
+                    --m_globalLibrarySet[handle.GetIndex()].m_warmupJobCount;
+                };
+
+                AZ::Job* warmupJob = AZ::CreateJobFunction(AZStd::move(warmupRecordsLambda), true, nullptr);
+                warmupJob->Start();
+            }
+        }
+
+        void PipelineStateCache::WaitForWarmup(PipelineLibraryHandle handle) const
+        {
+            if (handle.IsNull())
+            {
+                return;
+            }
+
+            const GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
+
+            AZStd::exponential_backoff backoff;
+            while (globalLibraryEntry.m_warmupJobCount > 0)
+            {
+                backoff.wait();
+            }
+        }
+
+        void PipelineStateCache::WarmupRecords(PipelineLibraryHandle handle, const PipelineStateCacheData& cacheData, Interval interval)
+        {
+            AZ_ATOM_PROFILE_FUNCTION("RHI", "PipelineStateCache: WarmupRecords");
+
+            const GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
+            ThreadStatistics& statistics = m_threadLibrarySet.GetStorage()[handle.GetIndex()].m_statistics;
+
+            const AZStd::array_view<PipelineStateCacheData::DrawRecord> drawRecords = cacheData.GetDrawRecords();
+            const AZStd::array_view<PipelineStateCacheData::DispatchRecord> dispatchRecords = cacheData.GetDispatchRecords();
+            const uint32_t drawRecordCount = static_cast<uint32_t>(drawRecords.size());
+
+            uint32_t skippedRecordCount = 0;
+            for (uint32_t recordIndex = interval.m_min; recordIndex < interval.m_max && !globalLibraryEntry.m_warmupCancelled; ++recordIndex)
+            {
+                if (recordIndex < drawRecordCount)
+                {
+                    PipelineStateDescriptorForDraw descriptor;
+                    if (!BuildDescriptor(cacheData, drawRecords[recordIndex], descriptor))
+                    {
+                        ++skippedRecordCount;
+                        continue;
+                    }
+                    IncrementCounter<uint64_t>(statistics.m_warmupCount);
+                    WarmupPipelineState(handle, descriptor);
+                }
+                else
+                {
+                    PipelineStateDescriptorForDispatch descriptor;
+                    if (!BuildDescriptor(cacheData, dispatchRecords[recordIndex - drawRecordCount], descriptor))
+                    {
+                        ++skippedRecordCount;
+                        continue;
+                    }
+                    IncrementCounter<uint64_t>(statistics.m_warmupCount);
+                    WarmupPipelineState(handle, descriptor);
+                }
+            }
+
+            AZ_Warning("PipelineStateCache", skippedRecordCount == 0, "Skipped %u pipeline state records that don't match their cache data.", skippedRecordCount);
+        }
+
+        PipelineStateCache::Statistics PipelineStateCache::GetStatistics() const
+        {
+            Statistics statistics;
+
+            m_threadLibrarySet.ForEach([&statistics](const ThreadLibrarySet& threadLibrarySet)
+            {
+                for (const ThreadLibraryEntry& threadLibraryEntry : threadLibrarySet)
+                {
+                    const ThreadStatistics& threadStatistics = threadLibraryEntry.m_statistics;
+                    statistics.m_readOnlyCacheHitCount += threadStatistics.m_readOnlyCacheHitCount.load(AZStd::memory_order_relaxed);
+                    statistics.m_threadLocalCacheHitCount += threadStatistics.m_threadLocalCacheHitCount.load(AZStd::memory_order_relaxed);
+                    statistics.m_pendingCacheHitCount += threadStatistics.m_pendingCacheHitCount.load(AZStd::memory_order_relaxed);
+                    statistics.m_warmupCacheHitCount += threadStatistics.m_warmupCacheHitCount.load(AZStd::memory_order_relaxed);
+                    statistics.m_compileCount += threadStatistics.m_compileCount.load(AZStd::memory_order_relaxed);
+                    statistics.m_compileFailureCount += threadStatistics.m_compileFailureCount.load(AZStd::memory_order_relaxed);
+                    statistics.m_compileTime += threadStatistics.m_compileTime.load(AZStd::memory_order_relaxed);
+                    statistics.m_warmupCount += threadStatistics.m_warmupCount.load(AZStd::memory_order_relaxed);
+                }
+            });
+
+            return statistics;
+        }
+
+        void PipelineStateCache::ResetStatistics()
+        {
+            m_threadLibrarySet.ForEach([](ThreadLibrarySet& threadLibrarySet)
+            {
+                for (ThreadLibraryEntry& threadLibraryEntry : threadLibrarySet)
+                {
+                    ThreadStatistics& threadStatistics = threadLibraryEntry.m_statistics;
+                    threadStatistics.m_readOnlyCacheHitCount = 0;
+                    threadStatistics.m_threadLocalCacheHitCount = 0;
+                    threadStatistics.m_pendingCacheHitCount = 0;
+                    threadStatistics.m_warmupCacheHitCount = 0;
+                    threadStatistics.m_compileCount = 0;
+                    threadStatistics.m_compileFailureCount = 0;
+                    threadStatistics.m_compileTime = 0;
+                    threadStatistics.m_warmupCount = 0;
+                }
+            });
+        }
+
         void PipelineStateCache::Compact()
         {
             AZ_ATOM_PROFILE_FUNCTION("RHI", "PipelineStateCache: Compact");
@@ -284,41 +626,31 @@ namespace AZ
             GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
             PipelineStateHash pipelineStateHash = descriptor.GetHash();
 
+            // The thread storage is needed for the statistics even on the fast path. Access to it is cached
+            // per thread and takes no lock.
+            ThreadLibrarySet& threadLibrarySet = m_threadLibrarySet.GetStorage();
+            ThreadLibraryEntry& threadLibraryEntry = threadLibrarySet[handle.GetIndex()];
+
             // Search the read-only cache first.
             if (const PipelineState* pipelineState = FindPipelineState(globalLibraryEntry.m_readOnlyCache, descriptor))
             {
+                IncrementCounter<uint64_t>(threadLibraryEntry.m_statistics.m_readOnlyCacheHitCount);
                 return pipelineState;
             }
 
             // Search the thread-local cache next.
             {
-                ThreadLibrarySet& threadLibrarySet = m_threadLibrarySet.GetStorage();
-                ThreadLibraryEntry& threadLibraryEntry = threadLibrarySet[handle.GetIndex()];
                 PipelineStateSet& threadLocalCache = threadLibraryEntry.m_threadLocalCache;
 
                 if (const PipelineState* pipelineState = FindPipelineState(threadLocalCache, descriptor))
                 {
+                    IncrementCounter<uint64_t>(threadLibraryEntry.m_statistics.m_threadLocalCacheHitCount);
                     return pipelineState;
                 }
 
                 // No entry in the thread-local set. Request a pipeline state from the pending cache and add
                 // it to the thread-local cache to reduce contention on the pending cache.
                 {
-                    // Lazy-init the library on first access.
-                    if (!threadLibraryEntry.m_library)
-                    {
-                        Ptr<PipelineLibrary> pipelineLibrary = Factory::Get().CreatePipelineLibrary();
-                        RHI::ResultCode resultCode = pipelineLibrary->Init(*m_device, globalLibraryEntry.m_serializedData.get());
-                        if (resultCode != RHI::ResultCode::Success)
-                        {
-                            AZ_Warning("PipelineStateCache", false, "Failed to initialize pipeline library. PipelineLibrary usage is disabled.");
-                        }
-
-                        // We store a valid pointer even if initialization failed, to avoid attempting
-                        // to re-create it with every access.
-                        threadLibraryEntry.m_library = AZStd::move(pipelineLibrary);
-                    }
-
                     ConstPtr<PipelineState> pipelineState = CompilePipelineState(globalLibraryEntry, threadLibraryEntry, descriptor, pipelineStateHash);
 
                     [[maybe_unused]] bool success = InsertPipelineState(threadLocalCache, PipelineStateEntry(pipelineStateHash, pipelineState, descriptor));
@@ -345,9 +677,25 @@ namespace AZ
                 // Another thread may have started compiling this pipeline state. Check the pending cache.
                 if (const PipelineState* pipeline = FindPipelineState(pendingCache, descriptor))
                 {
+                    IncrementCounter<uint64_t>(threadLibraryEntry.m_statistics.m_pendingCacheHitCount);
                     return pipeline;
                 }
 
+                // Warmup compiles descriptors rebuilt from recorded data, which compare equal to the application's by
+                // content. Move a match to the pending cache under this descriptor.
+                auto warmupIt = globalLibraryEntry.m_warmupCache.find(PipelineStateEntry(pipelineStateHash, nullptr, descriptor));
+                if (warmupIt != globalLibraryEntry.m_warmupCache.end())
+                {
+                    ConstPtr<PipelineState> warmedPipelineState = warmupIt->m_pipelineState;
+                    globalLibraryEntry.m_warmupCache.erase(warmupIt);
+
+                    [[maybe_unused]] bool success = InsertPipelineState(pendingCache, PipelineStateEntry(pipelineStateHash, warmedPipelineState, descriptor));
+                    AZ_Assert(success, "PipelineStateEntry already exists in the pending cache.");
+
+                    IncrementCounter<uint64_t>(threadLibraryEntry.m_statistics.m_warmupCacheHitCount);
+                    return warmedPipelineState;
+                }
+
                 // We need to create and insert the pipeline state into the locked cache. Create the pipeline state
                 // but don't initialize it yet. We can safely allocate the 'empty' instance and cache it.
                 pipelineState = Factory::Get().CreatePipelineState();
@@ -356,6 +704,58 @@ namespace AZ
                 AZ_Assert(success, "PipelineStateEntry already exists in the pending cache.");
             }
 
+            // We no longer have the lock, but we own compilation of the pipeline state.
+            InitPipelineState(globalLibraryEntry, threadLibraryEntry, descriptor, *pipelineState);
+            return AZStd::move(pipelineState);
+        }
+
+        void PipelineStateCache::WarmupPipelineState(PipelineLibraryHandle handle, const PipelineStateDescriptor& descriptor)
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+
+            GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
+            ThreadLibraryEntry& threadLibraryEntry = m_threadLibrarySet.GetStorage()[handle.GetIndex()];
+            const PipelineStateHash pipelineStateHash = descriptor.GetHash();
+
+            Ptr<PipelineState> pipelineState;
+
+            {
+                AZStd::lock_guard<AZStd::mutex> pendingLock(globalLibraryEntry.m_pendingCacheMutex);
+
+                // The same record may be warmed up more than once, e.g. by a repeated WarmupLibrary call.
+                if (FindPipelineState(globalLibraryEntry.m_warmupCache, descriptor))
+                {
+                    return;
+                }
+
+                pipelineState = Factory::Get().CreatePipelineState();
+                InsertPipelineState(globalLibraryEntry.m_warmupCache, PipelineStateEntry(pipelineStateHash, pipelineState, descriptor));
+            }
+
+            InitPipelineState(globalLibraryEntry, threadLibraryEntry, descriptor, *pipelineState);
+        }
+
+        void PipelineStateCache::InitPipelineState(
+            GlobalLibraryEntry& globalLibraryEntry,
+            ThreadLibraryEntry& threadLibraryEntry,
+            const PipelineStateDescriptor& descriptor,
+            PipelineState& pipelineState)
+        {
+            // Lazy-init the library on first access.
+            if (!threadLibraryEntry.m_library)
+            {
+                Ptr<PipelineLibrary> pipelineLibrary = Factory::Get().CreatePipelineLibrary();
+                RHI::ResultCode resultCode = pipelineLibrary->Init(*m_device, globalLibraryEntry.m_serializedData.get());
+                if (resultCode != RHI::ResultCode::Success)
+                {
+                    AZ_Warning("PipelineStateCache", false, "Failed to initialize pipeline library. PipelineLibrary usage is disabled.");
+                }
+
+                // We store a valid pointer even if initialization failed, to avoid attempting
+                // to re-create it with every access.
+                threadLibraryEntry.m_library = AZStd::move(pipelineLibrary);
+            }
+
             ResultCode resultCode = ResultCode::InvalidArgument;
 
             // Increment the pending compile count on the global entry, which tracks how many pipeline states
@@ -372,26 +772,35 @@ namespace AZ
                 pipelineLibrary = nullptr;
             }
 
-            // We no longer have the lock, but we own compilation of the pipeline state. Use the
-            // thread-local library to perform compilation without blocking other threads.
+            const AZStd::sys_time_t compileStartTime = AZStd::GetTimeNowTicks();
+
+            // Use the thread-local library to perform compilation without blocking other threads.
             switch (descriptor.GetType())
             {
             case PipelineStateType::Draw:
-                resultCode = pipelineState->Init(*m_device, static_cast<const PipelineStateDescriptorForDraw&>(descriptor), pipelineLibrary);
+                resultCode = pipelineState.Init(*m_device, static_cast<const PipelineStateDescriptorForDraw&>(descriptor), pipelineLibrary);
                 break;
 
             case PipelineStateType::Dispatch:
-                resultCode = pipelineState->Init(*m_device, static_cast<const PipelineStateDescriptorForDispatch&>(descriptor), pipelineLibrary);
+                resultCode = pipelineState.Init(*m_device, static_cast<const PipelineStateDescriptorForDispatch&>(descriptor), pipelineLibrary);
                 break;
 
             case PipelineStateType::RayTracing:
-                resultCode = pipelineState->Init(*m_device, static_cast<const PipelineStateDescriptorForRayTracing&>(descriptor), pipelineLibrary);
+                resultCode = pipelineState.Init(*m_device, static_cast<const PipelineStateDescriptorForRayTracing&>(descriptor), pipelineLibrary);
                 break;
 
             default:
                 AZ_Assert(false, "Invalid pipeline state descriptor type specified.");
             }
 
+            ThreadStatistics& statistics = threadLibraryEntry.m_statistics;
+            IncrementCounter<AZStd::sys_time_t>(statistics.m_compileTime, AZStd::GetTimeNowTicks() - compileStartTime);
+            IncrementCounter<uint64_t>(statistics.m_compileCount);
+            if (resultCode != ResultCode::Success)
+            {
+                IncrementCounter<uint64_t>(statistics.m_compileFailureCount);
+            }
+
             if (Validation::IsEnabled())
             {
                 --globalLibraryEntry.m_pendingCompileCount;
@@ -401,7 +810,6 @@ namespace AZ
             // it. Instead, the pipeline state remains uninitialized.
 
             AZ_Error("PipelineStateCache", resultCode == ResultCode::Success, "Failed to compile pipeline state. It will remain in an initialized state.");
-            return AZStd::move(pipelineState);
         }
 
         PipelineStateCache::PipelineStateEntry::PipelineStateEntry(PipelineStateHash hash, ConstPtr<PipelineState> pipelineState, const PipelineStateDescriptor& descriptor)
@@ -9,11 +9,33 @@
 #include <Atom/RHI/ShaderResourceGroupPool.h>
 #include <Atom/RHI/BufferView.h>
 #include <Atom/RHI/ImageView.h>
+#include <Atom/RHI.Reflect/Limits.h>
 
 namespace AZ
 {
     namespace RHI
     {
+        namespace
+        {
+            void MergeInterval(Interval& interval, const Interval& other)
+            {
+                if (other.m_max == other.m_min)
+                {
+                    return;
+                }
+
+                if (interval.m_max == interval.m_min)
+                {
+                    interval = other;
+                }
+                else
+                {
+                    interval.m_min = AZStd::min(interval.m_min, other.m_min);
+                    interval.m_max = AZStd::max(interval.m_max, other.m_max);
+                }
+            }
+        }
+
         void ShaderResourceGroup::Compile(const ShaderResourceGroupData& groupData, CompileMode compileMode /*= CompileMode::Async*/)
         {
             switch (compileMode)
@@ -40,6 +62,16 @@ namespace AZ
             return m_isQueuedForCompile;
         }
 
+        bool ShaderResourceGroup::IsResourceTypeEnabledForCompilation(ShaderResourceGroupData::ResourceTypeMask resourceTypeMask) const
+        {
+            return (m_compileUpdateMask & static_cast<uint32_t>(resourceTypeMask)) != 0;
+        }
+
+        Interval ShaderResourceGroup::GetConstantsCompileInterval() const
+        {
+            return m_compileConstantsInterval;
+        }
+
         const ShaderResourceGroupPool* ShaderResourceGroup::GetPool() const
         {
             return static_cast<const ShaderResourceGroupPool*>(Resource::GetPool());
@@ -58,6 +90,46 @@ namespace AZ
         void ShaderResourceGroup::SetData(const ShaderResourceGroupData& data)
         {
             m_data = data;
+            MergeInterval(m_pendingConstantsInterval, data.GetConstantsUpdateInterval());
+            EnableResourceTypeCompilation(data.GetUpdateMask());
+        }
+
+        void ShaderResourceGroup::EnableResourceTypeCompilation(ShaderResourceGroupData::ResourceTypeMask resourceTypeMask)
+        {
+            m_pendingUpdateMask.fetch_or(static_cast<uint32_t>(resourceTypeMask));
+        }
+
+        void ShaderResourceGroup::BeginCompile()
+        {
+            const uint32_t pendingUpdateMask = m_pendingUpdateMask.exchange(0);
+            for (uint32_t resourceTypeIndex = 0; resourceTypeIndex < ShaderResourceGroupData::ResourceTypeCount; ++resourceTypeIndex)
+            {
+                if (pendingUpdateMask & AZ_BIT(resourceTypeIndex))
+                {
+                    m_resourceTypeIteration[resourceTypeIndex] = 0;
+                }
+            }
+            m_compileUpdateMask |= pendingUpdateMask;
+
+            MergeInterval(m_compileConstantsInterval, m_pendingConstantsInterval);
+            m_pendingConstantsInterval = Interval();
+        }
+
+        void ShaderResourceGroup::EndCompile()
+        {
+            for (uint32_t resourceTypeIndex = 0; resourceTypeIndex < ShaderResourceGroupData::ResourceTypeCount; ++resourceTypeIndex)
+            {
+                if ((m_compileUpdateMask & AZ_BIT(resourceTypeIndex)) &&
+                    ++m_resourceTypeIteration[resourceTypeIndex] >= Limits::Device::FrameCountMax)
+                {
+                    m_compileUpdateMask &= ~AZ_BIT(resourceTypeIndex);
+                }
+            }
+
+            if (!IsResourceTypeEnabledForCompilation(ShaderResourceGroupData::ResourceTypeMask::ConstantDataMask))
+            {
+                m_compileConstantsInterval = Interval();
+            }
         }
 
         void ShaderResourceGroup::ReportMemoryUsage(MemoryStatisticsBuilder& builder) const
@@ -34,6 +34,10 @@ namespace AZ
             m_imageViews.resize(layout->GetGroupSizeForImages());
             m_bufferViews.resize(layout->GetGroupSizeForBuffers());
             m_samplers.resize(layout->GetGroupSizeForSamplers());
+
+            // Everything in freshly created data is considered modified, so that the first compile uploads it in full.
+            m_updateMask = ResourceTypeMask::All;
+            m_constantsUpdateInterval = Interval(0, static_cast<uint32_t>(m_constantsData.GetConstantData().size()));
         }
 
         const ShaderResourceGroupLayout* ShaderResourceGroupData::GetLayout() const
@@ -126,6 +130,7 @@ namespace AZ
                     }
                     isValidAll &= isValid;
                 }
+                MarkModified(ResourceTypeMask::ImageViewMask);
                 return isValidAll;
             }
             return false;
@@ -146,6 +151,7 @@ namespace AZ
                     }
                     isValidAll &= isValid;
                 }
+                MarkModified(ResourceTypeMask::ImageViewUnboundedArrayMask);
                 return isValidAll;
             }
             return false;
@@ -172,6 +178,7 @@ namespace AZ
                     }
                     isValidAll &= isValid;
                 }
+                MarkModified(ResourceTypeMask::BufferViewMask);
                 return isValidAll;
             }
             return false;
@@ -192,6 +199,7 @@ namespace AZ
                     }
                     isValidAll &= isValid;
                 }
+                MarkModified(ResourceTypeMask::BufferViewUnboundedArrayMask);
                 return isValidAll;
             }
             return false;
@@ -211,6 +219,7 @@ namespace AZ
                 {
                     m_samplers[interval.m_min + arrayIndex + i] = samplers[i];
                 }
+                MarkModified(ResourceTypeMask::SamplerMask);
                 return true;
             }
             return false;
@@ -223,17 +232,32 @@ namespace AZ
 
         bool ShaderResourceGroupData::SetConstantRaw(ShaderInputConstantIndex inputIndex, const void* bytes, uint32_t byteOffset, uint32_t byteCount)
         {
-            return m_constantsData.SetConstantRaw(inputIndex, bytes, byteOffset, byteCount);
+            if (m_constantsData.SetConstantRaw(inputIndex, bytes, byteOffset, byteCount))
+            {
+                MarkConstantsModified(GetLayout()->GetConstantsLayout()->GetInterval(inputIndex).m_min + byteOffset, byteCount);
+                return true;
+            }
+            return false;
         }
 
         bool ShaderResourceGroupData::SetConstantData(const void* bytes, uint32_t byteCount)
         {
-            return m_constantsData.SetConstantData(bytes, byteCount);
+            if (m_constantsData.SetConstantData(bytes, byteCount))
+            {
+                MarkConstantsModified(0, byteCount);
+                return true;
+            }
+            return false;
         }
 
         bool ShaderResourceGroupData::SetConstantData(const void* bytes, uint32_t byteOffset, uint32_t byteCount)
         {
-            return m_constantsData.SetConstantData(bytes, byteOffset, byteCount);
+            if (m_constantsData.SetConstantData(bytes, byteOffset, byteCount))
+            {
+                MarkConstantsModified(byteOffset, byteCount);
+                return true;
+            }
+            return false;
         }
         
         const RHI::ConstPtr<RHI::ImageView>& ShaderResourceGroupData::GetImageView(RHI::ShaderInputImageIndex inputIndex, uint32_t arrayIndex) const
@@ -335,5 +359,51 @@ namespace AZ
             return m_constantsData.GetConstantData();
         }
 
+        ShaderResourceGroupData::ResourceTypeMask ShaderResourceGroupData::GetUpdateMask() const
+        {
+            return m_updateMask;
+        }
+
+        Interval ShaderResourceGroupData::GetConstantsUpdateInterval() const
+        {
+            return m_constantsUpdateInterval;
+        }
+
+        void ShaderResourceGroupData::ResetUpdateMask()
+        {
+            m_updateMask = ResourceTypeMask::None;
+            m_constantsUpdateInterval = Interval();
+        }
+
+        void ShaderResourceGroupData::MarkModified(ResourceTypeMask resourceTypeMask)
+        {
+            m_updateMask |= resourceTypeMask;
+        }
+
+        void ShaderResourceGroupData::MarkConstantsModified(uint32_t byteOffset, uint32_t byteCount)
+        {
+            if (byteCount == 0)
+            {
+                return;
+            }
+
+            if (m_constantsUpdateInterval.m_max == m_constantsUpdateInterval.m_min)
+            {
+                m_constantsUpdateInterval = Interval(byteOffset, byteOffset + byteCount);
+            }
+            else
+            {
+                m_constantsUpdateInterval.m_min = AZStd::min(m_constantsUpdateInterval.m_min, byteOffset);
+                m_constantsUpdateInterval.m_max = AZStd::max(m_constantsUpdateInterval.m_max, byteOffset + byteCount);
+            }
+            MarkModified(ResourceTypeMask::ConstantDataMask);
+        }
+
+        void ShaderResourceGroupData::MarkConstantModified(ShaderInputConstantIndex inputIndex)
+        {
+            const Interval interval = GetLayout()->GetConstantsLayout()->GetInterval(inputIndex);
+            MarkConstantsModified(interval.m_min, interval.m_max - interval.m_min);
+        }
+
     } // namespace RHI
 } // namespace AZ
@@ -67,8 +67,9 @@ namespace AZ
             {
                 const ShaderResourceGroupLayout* layout = GetLayout();
 
-                // Pre-initialize the data so that we can build view diffs later.
-                group.m_data = ShaderResourceGroupData(layout);
+                // Pre-initialize the data so that we can build view diffs later. Fresh data flags every
+                // resource type as modified, so the first compiles write the group in full.
+                group.SetData(ShaderResourceGroupData(layout));
 
                 // Cache off the binding slot for one less indirection.
                 group.m_bindingSlot = layout->GetBindingSlot();
@@ -109,7 +110,7 @@ namespace AZ
 
         void ShaderResourceGroupPool::QueueForCompile(ShaderResourceGroup& shaderResourceGroup, const ShaderResourceGroupData& groupData)
         {
-            AZStd::lock_guard<AZStd::shared_mutex> lock(m_groupsToCompileMutex);
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_groupsToCompileMutex);
 
             AZ_Assert(!shaderResourceGroup.IsQueuedForCompile(), "Attempting to compile an SRG that's already been queued for compile. Only compile an SRG once per frame.");            
 
@@ -122,16 +123,24 @@ namespace AZ
 
         void ShaderResourceGroupPool::QueueForCompile(ShaderResourceGroup& group)
         {
-            AZStd::lock_guard<AZStd::shared_mutex> lock(m_groupsToCompileMutex);
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_groupsToCompileMutex);
+
+            // The group is recompiled because a resource bound to it was invalidated, which requires its views to be rebuilt.
+            group.EnableResourceTypeCompilation(
+                ShaderResourceGroupData::ResourceTypeMask::BufferViewMask |
+                ShaderResourceGroupData::ResourceTypeMask::ImageViewMask |
+                ShaderResourceGroupData::ResourceTypeMask::BufferViewUnboundedArrayMask |
+                ShaderResourceGroupData::ResourceTypeMask::ImageViewUnboundedArrayMask);
+
             QueueForCompileNoLock(group);
         }
 
         void ShaderResourceGroupPool::QueueForCompileNoLock(ShaderResourceGroup& group)
         {
-            if (!group.m_isQueuedForCompile)
+            bool isQueuedForCompile = false;
+            if (group.m_isQueuedForCompile.compare_exchange_strong(isQueuedForCompile, true))
             {
-                group.m_isQueuedForCompile = true;
-                m_groupsToCompile.emplace_back(&group);
+                group.m_compileQueueIndex = m_groupsToCompile.push_back(&group);
             }
         }
 
@@ -141,7 +150,9 @@ namespace AZ
             if (shaderResourceGroup.m_isQueuedForCompile)
             {
                 shaderResourceGroup.m_isQueuedForCompile = false;
-                m_groupsToCompile.erase(AZStd::find(m_groupsToCompile.begin(), m_groupsToCompile.end(), &shaderResourceGroup));
+
+                // The queue can't be erased from concurrently, so the slot is cleared and skipped at compile time.
+                m_groupsToCompile[shaderResourceGroup.m_compileQueueIndex] = nullptr;
             }
         }
 
@@ -149,7 +160,14 @@ namespace AZ
         {
             CalculateGroupDataDiff(group, groupData);
             group.SetData(groupData);
+            CompileGroup(group);
+        }
+
+        void ShaderResourceGroupPool::CompileGroup(ShaderResourceGroup& group)
+        {
+            group.BeginCompile();
             CompileGroupInternal(group, group.GetData());
+            group.EndCompile();
         }
 
         void ShaderResourceGroupPool::CalculateGroupDataDiff(ShaderResourceGroup& shaderResourceGroup, const ShaderResourceGroupData& groupData)
@@ -239,7 +257,7 @@ namespace AZ
         uint32_t ShaderResourceGroupPool::GetGroupsToCompileCount() const
         {
             AZ_Assert(m_isCompiling, "You must call this function within a CompileGroups{Begin, End} region!");
-            return static_cast<uint32_t>(m_groupsToCompile.size());
+            return m_groupsToCompile.size();
         }
 
         void ShaderResourceGroupPool::CompileGroupsForInterval(Interval interval)
@@ -249,14 +267,17 @@ namespace AZ
             AZ_Assert(m_isCompiling, "You must call CompileGroupsBegin() first!");
             AZ_Assert(
                 interval.m_max >= interval.m_min &&
-                interval.m_max <= static_cast<uint32_t>(m_groupsToCompile.size()),
+                interval.m_max <= m_groupsToCompile.size(),
                 "You must specify a valid interval for compilation");
 
             for (uint32_t i = interval.m_min; i < interval.m_max; ++i)
             {
                 ShaderResourceGroup* group = m_groupsToCompile[i];
-                CompileGroupInternal(*group, group->GetData());
-                group->m_isQueuedForCompile = false;
+                if (group)
+                {
+                    CompileGroup(*group);
+                    group->m_isQueuedForCompile = false;
+                }
             }
         }
 
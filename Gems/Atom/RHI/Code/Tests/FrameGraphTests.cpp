@@ -437,6 +437,130 @@ namespace UnitTest
             }
         }
 
+        void BuildCrossQueueGraph(RHI::FrameGraph& frameGraph, bool useAsyncCompute)
+        {
+            frameGraph.Begin();
+
+            RHI::BufferScopeAttachmentDescriptor desc;
+            desc.m_attachmentId = m_state->m_bufferAttachments[0].m_id;
+            desc.m_bufferViewDescriptor = RHI::BufferViewDescriptor::CreateRaw(0, BufferSize);
+
+            frameGraph.BeginScope(*m_state->m_scopes[0]);
+            frameGraph.SetHardwareQueueClass(RHI::HardwareQueueClass::Graphics);
+            frameGraph.GetAttachmentDatabase().ImportBuffer(m_state->m_bufferAttachments[0].m_id, m_state->m_bufferAttachments[0].m_buffer);
+            frameGraph.UseShaderAttachment(desc, RHI::ScopeAttachmentAccess::ReadWrite);
+            frameGraph.EndScope();
+
+            frameGraph.BeginScope(*m_state->m_scopes[1]);
+            frameGraph.SetHardwareQueueClass(useAsyncCompute ? RHI::HardwareQueueClass::Compute : RHI::HardwareQueueClass::Graphics);
+            frameGraph.UseShaderAttachment(desc, RHI::ScopeAttachmentAccess::Read);
+            frameGraph.EndScope();
+
+            frameGraph.End();
+        }
+
+        void TestCompileCache()
+        {
+            RHI::FrameGraph frameGraph;
+            RHI::FrameGraphCompiler& frameGraphCompiler = *m_state->m_frameGraphCompiler;
+            frameGraphCompiler.ResetStatistics();
+
+            const auto compile = [&]()
+            {
+                RHI::FrameGraphCompileRequest request;
+                request.m_frameGraph = &frameGraph;
+                return frameGraphCompiler.Compile(request).IsSuccess();
+            };
+
+            for (uint32_t frameIdx = 0; frameIdx < FrameIterationCount; ++frameIdx)
+            {
+                BuildCrossQueueGraph(frameGraph, true);
+                ASSERT_TRUE(compile());
+
+                // The cross-queue link must be rebuilt from the cache on every frame.
+                const RHI::Scope* producer = m_state->m_scopes[0].get();
+                const RHI::Scope* consumer = m_state->m_scopes[1].get();
+                EXPECT_EQ(producer->GetConsumerByQueue(RHI::HardwareQueueClass::Compute), consumer);
+                EXPECT_EQ(consumer->GetProducerByQueue(RHI::HardwareQueueClass::Graphics), producer);
+                EXPECT_EQ(frameGraphCompiler.GetStatistics().m_lastCompileCacheHit, frameIdx > 0);
+            }
+
+            EXPECT_EQ(frameGraphCompiler.GetStatistics().m_compileCount, FrameIterationCount);
+            EXPECT_EQ(frameGraphCompiler.GetStatistics().m_cacheHitCount, FrameIterationCount - 1);
+
+            // Moving a scope to another queue changes the topology.
+            BuildCrossQueueGraph(frameGraph, false);
+            ASSERT_TRUE(compile());
+            EXPECT_FALSE(frameGraphCompiler.GetStatistics().m_lastCompileCacheHit);
+            EXPECT_EQ(m_state->m_scopes[0]->GetConsumerByQueue(RHI::HardwareQueueClass::Compute), nullptr);
+            EXPECT_EQ(m_state->m_scopes[0]->GetConsumerOnSameQueue(), m_state->m_scopes[1].get());
+
+            BuildCrossQueueGraph(frameGraph, false);
+            ASSERT_TRUE(compile());
+            EXPECT_TRUE(frameGraphCompiler.GetStatistics().m_lastCompileCacheHit);
+            EXPECT_EQ(m_state->m_scopes[0]->GetConsumerOnSameQueue(), m_state->m_scopes[1].get());
+
+            // Requesting different compile flags invalidates the cache as well.
+            BuildCrossQueueGraph(frameGraph, false);
+            {
+                RHI::FrameGraphCompileRequest request;
+                request.m_frameGraph = &frameGraph;
+                request.m_compileFlags = RHI::FrameSchedulerCompileFlags::DisableAsyncQueues;
+                ASSERT_TRUE(frameGraphCompiler.Compile(request).IsSuccess());
+            }
+            EXPECT_FALSE(frameGraphCompiler.GetStatistics().m_lastCompileCacheHit);
+            EXPECT_EQ(frameGraphCompiler.GetStatistics().m_cacheHitCount, FrameIterationCount);
+        }
+
+        void TestCompileCacheHashCollision()
+        {
+            RHI::FrameGraph frameGraph;
+            RHI::FrameGraphCompiler& frameGraphCompiler = *m_state->m_frameGraphCompiler;
+
+            BuildCrossQueueGraph(frameGraph, true);
+            {
+                RHI::FrameGraphCompileRequest request;
+                request.m_frameGraph = &frameGraph;
+                ASSERT_TRUE(frameGraphCompiler.Compile(request).IsSuccess());
+            }
+
+            // A graph with a single, different scope whose hash collides with the recorded one. Replaying the recorded
+            // link would index past its scopes.
+            frameGraph.Begin();
+            frameGraph.BeginScope(*m_state->m_scopes[2]);
+            frameGraph.EndScope();
+            frameGraph.End();
+
+            RHI::FrameGraphCompileRequest request;
+            request.m_frameGraph = &frameGraph;
+            frameGraphCompiler.m_compileCache.m_hash = frameGraphCompiler.ComputeCompileHash(request);
+
+            ASSERT_TRUE(frameGraphCompiler.Compile(request).IsSuccess());
+            EXPECT_FALSE(frameGraphCompiler.GetStatistics().m_lastCompileCacheHit);
+            EXPECT_EQ(m_state->m_scopes[2]->GetConsumerByQueue(RHI::HardwareQueueClass::Compute), nullptr);
+            ASSERT_EQ(frameGraphCompiler.m_compileCache.m_scopeIds.size(), 1);
+            EXPECT_EQ(frameGraphCompiler.m_compileCache.m_scopeIds[0], m_state->m_scopes[2]->GetId());
+
+            // The same scope count with different scope ids is a miss as well.
+            BuildCrossQueueGraph(frameGraph, true);
+            RHI::FrameGraphCompileRequest crossQueueRequest;
+            crossQueueRequest.m_frameGraph = &frameGraph;
+            ASSERT_TRUE(frameGraphCompiler.Compile(crossQueueRequest).IsSuccess());
+
+            frameGraph.Begin();
+            frameGraph.BeginScope(*m_state->m_scopes[2]);
+            frameGraph.EndScope();
+            frameGraph.BeginScope(*m_state->m_scopes[3]);
+            frameGraph.EndScope();
+            frameGraph.End();
+
+            frameGraphCompiler.m_compileCache.m_hash = frameGraphCompiler.ComputeCompileHash(request);
+            ASSERT_TRUE(frameGraphCompiler.Compile(request).IsSuccess());
+            EXPECT_FALSE(frameGraphCompiler.GetStatistics().m_lastCompileCacheHit);
+            EXPECT_EQ(m_state->m_scopes[2]->GetConsumerByQueue(RHI::HardwareQueueClass::Compute), nullptr);
+            EXPECT_EQ(m_state->m_scopes[2]->GetConsumerOnSameQueue(), m_state->m_scopes[3].get());
+        }
+
     private:
         static const uint32_t FrameIterationCount = 32;
         static const uint32_t ImageCount = 256;
@@ -493,4 +617,14 @@ namespace UnitTest
     {
         TestScopeGraph();
     }
+
+    TEST_F(FrameGraphTests, TestCompileCache)
+    {
+        TestCompileCache();
+    }
+
+    TEST_F(FrameGraphTests, TestCompileCacheHashCollision)
+    {
+        TestCompileCacheHashCollision();
+    }
 }
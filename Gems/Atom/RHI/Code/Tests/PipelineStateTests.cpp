@@ -14,8 +14,11 @@
 #include <Atom/RHI/PipelineStateCache.h>
 
 #include <Atom/RHI.Reflect/PipelineLayoutDescriptor.h>
+#include <Atom/RHI.Reflect/ReflectSystemComponent.h>
 
 #include <AzCore/Math/Random.h>
+#include <AzCore/Serialization/ObjectStream.h>
+#include <AzCore/Serialization/Utils.h>
 
 namespace UnitTest
 {
@@ -64,6 +67,32 @@ namespace UnitTest
             return desc;
         }
 
+        // Randomly scrambled render states don't necessarily survive serialization (e.g. NaN floats), so descriptors
+        // which are saved in cache data only vary the depth bias.
+        RHI::PipelineStateDescriptorForDraw CreateSerializablePipelineStateDescriptor(uint32_t index)
+        {
+            RHI::PipelineStateDescriptorForDraw desc = CreatePipelineStateDescriptor(0);
+            desc.m_renderStates = RHI::RenderStates();
+            desc.m_renderStates.m_rasterState.m_depthBias = static_cast<int32_t>(index);
+            return desc;
+        }
+
+        AZStd::vector<char> SerializeCacheData(const RHI::PipelineStateCacheData& cacheData)
+        {
+            AZStd::vector<char> buffer;
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> outStream(&buffer);
+
+            AZ::ObjectStream* objStream = AZ::ObjectStream::Create(&outStream, *m_serializeContext, AZ::ObjectStream::ST_BINARY);
+            EXPECT_TRUE(objStream->WriteClass(&cacheData));
+            EXPECT_TRUE(objStream->Finalize());
+            return buffer;
+        }
+
+        RHI::ConstPtr<RHI::PipelineStateCacheData> DeserializeCacheData(const AZStd::vector<char>& buffer)
+        {
+            return AZ::Utils::LoadObjectFromBuffer<RHI::PipelineStateCacheData>(buffer.data(), buffer.size(), m_serializeContext.get());
+        }
+
         void ValidateCacheIntegrity(RHI::Ptr<RHI::PipelineStateCache>& cache) const
         {
             cache->ValidateCacheIntegrity();
@@ -76,6 +105,10 @@ namespace UnitTest
             RHITestFixture::SetUp();
             m_factory.reset(aznew Factory());
 
+            m_serializeContext = AZStd::make_unique<SerializeContext>();
+            RHI::ReflectSystemComponent::Reflect(m_serializeContext.get());
+            AZ::Name::Reflect(m_serializeContext.get());
+
             m_pipelineLayout = RHI::PipelineLayoutDescriptor::Create();
             m_pipelineLayout->Finalize();
         }
@@ -84,12 +117,14 @@ namespace UnitTest
         {
             m_pipelineLayout = nullptr;
 
+            m_serializeContext.reset();
             m_factory.reset();
             RHITestFixture::TearDown();
         }
 
         RHI::Ptr<RHI::PipelineLayoutDescriptor> m_pipelineLayout;
         AZStd::unique_ptr<Factory> m_factory;
+        AZStd::unique_ptr<SerializeContext> m_serializeContext;
     };
 
     TEST_F(PipelineStateTests, PipelineState_CreateEmpty_Test)
@@ -362,4 +397,137 @@ namespace UnitTest
             }
         }
     }
+
+    TEST_F(PipelineStateTests, PipelineStateCache_CacheData_IsDeterministic)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+
+        static const uint32_t PipelineStateCountMax = 64;
+        static const size_t ThreadCountMax = 4;
+
+        AZStd::vector<RHI::PipelineStateDescriptorForDraw> descriptors;
+        for (uint32_t i = 0; i < PipelineStateCountMax; ++i)
+        {
+            descriptors.push_back(CreateSerializablePipelineStateDescriptor(i));
+        }
+
+        // Acquire the pipeline states in order on a single thread.
+        RHI::Ptr<RHI::PipelineStateCache> serialCache = RHI::PipelineStateCache::Create(*device);
+        RHI::PipelineLibraryHandle serialHandle = serialCache->CreateLibrary(nullptr);
+        for (const RHI::PipelineStateDescriptorForDraw& descriptor : descriptors)
+        {
+            serialCache->AcquirePipelineState(serialHandle, descriptor);
+        }
+
+        // Acquire them in reverse on several threads, half of them before a compaction, with duplicate requests.
+        RHI::Ptr<RHI::PipelineStateCache> threadedCache = RHI::PipelineStateCache::Create(*device);
+        RHI::PipelineLibraryHandle threadedHandle = threadedCache->CreateLibrary(nullptr);
+        for (uint32_t i = PipelineStateCountMax; i > PipelineStateCountMax / 2; --i)
+        {
+            threadedCache->AcquirePipelineState(threadedHandle, descriptors[i - 1]);
+        }
+        threadedCache->Compact();
+
+        ThreadTester::Dispatch(ThreadCountMax, [&]([[maybe_unused]] size_t threadIndex)
+        {
+            for (uint32_t i = PipelineStateCountMax; i > 0; --i)
+            {
+                threadedCache->AcquirePipelineState(threadedHandle, descriptors[i - 1]);
+            }
+        });
+
+        RHI::ConstPtr<RHI::PipelineStateCacheData> serialCacheData = serialCache->GetLibraryCacheData(serialHandle);
+        RHI::ConstPtr<RHI::PipelineStateCacheData> threadedCacheData = threadedCache->GetLibraryCacheData(threadedHandle);
+        ASSERT_NE(serialCacheData, nullptr);
+        ASSERT_NE(threadedCacheData, nullptr);
+
+        // Every pipeline state is recorded exactly once.
+        EXPECT_EQ(serialCache->GetStatistics().m_compileCount, PipelineStateCountMax);
+        EXPECT_EQ(serialCacheData->GetDrawRecords().size(), PipelineStateCountMax);
+        EXPECT_EQ(serialCacheData->FindPipelineLayout(m_pipelineLayout->GetHash()), m_pipelineLayout.get());
+
+        for (size_t i = 1; i < serialCacheData->GetDrawRecords().size(); ++i)
+        {
+            EXPECT_LT(serialCacheData->GetDrawRecords()[i - 1].m_hash, serialCacheData->GetDrawRecords()[i].m_hash);
+        }
+
+        EXPECT_EQ(SerializeCacheData(*serialCacheData), SerializeCacheData(*threadedCacheData));
+    }
+
+    TEST_F(PipelineStateTests, PipelineStateCache_Warmup_CompilesRecordedPipelineStates)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+
+        static const uint32_t PipelineStateCountMax = 32;
+
+        AZStd::vector<RHI::PipelineStateDescriptorForDraw> descriptors;
+        for (uint32_t i = 0; i < PipelineStateCountMax; ++i)
+        {
+            descriptors.push_back(CreateSerializablePipelineStateDescriptor(i));
+        }
+
+        // Record the pipeline states of a first session and round-trip them through serialization.
+        AZStd::vector<char> buffer;
+        {
+            RHI::Ptr<RHI::PipelineStateCache> pipelineStateCache = RHI::PipelineStateCache::Create(*device);
+            RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary(nullptr);
+            for (const RHI::PipelineStateDescriptorForDraw& descriptor : descriptors)
+            {
+                pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor);
+            }
+            buffer = SerializeCacheData(*pipelineStateCache->GetLibraryCacheData(libraryHandle));
+        }
+
+        RHI::ConstPtr<RHI::PipelineStateCacheData> cacheData = DeserializeCacheData(buffer);
+        ASSERT_NE(cacheData, nullptr);
+        EXPECT_EQ(cacheData->GetRecordCount(), PipelineStateCountMax);
+
+        // Warming up a second session compiles every recorded pipeline state.
+        RHI::Ptr<RHI::PipelineStateCache> pipelineStateCache = RHI::PipelineStateCache::Create(*device);
+        RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary(nullptr);
+        pipelineStateCache->WarmupLibrary(libraryHandle, cacheData, RHI::JobPolicy::Serial);
+
+        RHI::PipelineStateCache::Statistics statistics = pipelineStateCache->GetStatistics();
+        EXPECT_EQ(statistics.m_warmupCount, PipelineStateCountMax);
+        EXPECT_EQ(statistics.m_compileCount, PipelineStateCountMax);
+        EXPECT_EQ(statistics.m_compileFailureCount, 0u);
+
+        pipelineStateCache->Compact();
+        ValidateCacheIntegrity(pipelineStateCache);
+        pipelineStateCache->ResetStatistics();
+
+        // The descriptors of the application reference their own layout, so they take over the warmed up pipeline
+        // states by hash instead of compiling them again.
+        AZStd::vector<const RHI::PipelineState*> pipelineStates;
+        for (const RHI::PipelineStateDescriptorForDraw& descriptor : descriptors)
+        {
+            const RHI::PipelineState* pipelineState = pipelineStateCache->AcquirePipelineState(libraryHandle, descriptor);
+            ASSERT_NE(pipelineState, nullptr);
+            EXPECT_TRUE(pipelineState->IsInitialized());
+            pipelineStates.push_back(pipelineState);
+        }
+
+        statistics = pipelineStateCache->GetStatistics();
+        EXPECT_EQ(statistics.m_warmupCacheHitCount, PipelineStateCountMax);
+        EXPECT_EQ(statistics.m_readOnlyCacheHitCount, 0u);
+        EXPECT_EQ(statistics.m_compileCount, 0u);
+
+        // Once taken over, they're cached under the application's descriptors like any other pipeline state.
+        pipelineStateCache->Compact();
+        ValidateCacheIntegrity(pipelineStateCache);
+        pipelineStateCache->ResetStatistics();
+
+        for (size_t i = 0; i < descriptors.size(); ++i)
+        {
+            EXPECT_EQ(pipelineStateCache->AcquirePipelineState(libraryHandle, descriptors[i]), pipelineStates[i]);
+        }
+
+        statistics = pipelineStateCache->GetStatistics();
+        EXPECT_EQ(statistics.m_readOnlyCacheHitCount, PipelineStateCountMax);
+        EXPECT_EQ(statistics.m_warmupCacheHitCount, 0u);
+        EXPECT_EQ(statistics.m_compileCount, 0u);
+
+        // The warmup records are carried over into the next session's data.
+        EXPECT_EQ(SerializeCacheData(*pipelineStateCache->GetLibraryCacheData(libraryHandle)), buffer);
+    }
 }
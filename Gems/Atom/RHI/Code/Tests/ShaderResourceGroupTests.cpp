@@ -698,6 +698,89 @@ namespace UnitTest
         TestGetConstantVectorsInvalidCase(srgLayout);
     }
 
+    TEST_F(ShaderResourceGroupTests, SRGDataUpdateMask_SetConstants_TracksModifiedInterval)
+    {
+        using ResourceTypeMask = RHI::ShaderResourceGroupData::ResourceTypeMask;
+
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+        const RHI::ConstantsLayout* constantsLayout = srgLayout->GetConstantsLayout();
+        const RHI::ShaderInputConstantIndex vector2index = srgLayout->FindShaderInputConstantIndex(Name("m_vector2"));
+        const RHI::ShaderInputConstantIndex vector4index = srgLayout->FindShaderInputConstantIndex(Name("m_vector4"));
+
+        RHI::ShaderResourceGroupData srgData = PrepareSRGData(srgLayout);
+
+        // Fresh data is entirely modified.
+        EXPECT_EQ(srgData.GetUpdateMask(), ResourceTypeMask::All);
+        EXPECT_EQ(srgData.GetConstantsUpdateInterval(), RHI::Interval(0, constantsLayout->GetDataSize()));
+
+        srgData.ResetUpdateMask();
+        EXPECT_EQ(srgData.GetUpdateMask(), ResourceTypeMask::None);
+        EXPECT_EQ(srgData.GetConstantsUpdateInterval(), RHI::Interval());
+
+        EXPECT_TRUE(srgData.SetConstant(vector2index, Vector2(1.0f, 2.0f)));
+        EXPECT_EQ(srgData.GetUpdateMask(), ResourceTypeMask::ConstantDataMask);
+        EXPECT_EQ(srgData.GetConstantsUpdateInterval(), constantsLayout->GetInterval(vector2index));
+
+        EXPECT_TRUE(srgData.SetConstant(vector4index, Vector4(1.0f, 2.0f, 3.0f, 4.0f)));
+        EXPECT_EQ(srgData.GetConstantsUpdateInterval(),
+            RHI::Interval(constantsLayout->GetInterval(vector2index).m_min, constantsLayout->GetInterval(vector4index).m_max));
+
+        // Failed writes don't mark anything.
+        srgData.ResetUpdateMask();
+        AZ_TEST_START_ASSERTTEST;
+        EXPECT_FALSE(srgData.SetConstant(vector4index, Vector3(1.0f, 2.0f, 3.0f)));
+        AZ_TEST_STOP_ASSERTTEST(1);
+        EXPECT_EQ(srgData.GetUpdateMask(), ResourceTypeMask::None);
+
+        const RHI::ImageView* imageView = nullptr;
+        EXPECT_TRUE(srgData.SetImageView(srgLayout->FindShaderInputImageIndex(Name("m_readImage")), imageView, 0));
+        EXPECT_EQ(srgData.GetUpdateMask(), ResourceTypeMask::ImageViewMask);
+    }
+
+    TEST_F(ShaderResourceGroupTests, SRGCompile_UnmodifiedResourceTypes_RetireAfterFrameCountMaxCompiles)
+    {
+        using ResourceTypeMask = RHI::ShaderResourceGroupData::ResourceTypeMask;
+
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+        const RHI::ShaderInputConstantIndex vector2index = srgLayout->FindShaderInputConstantIndex(Name("m_vector2"));
+
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::Ptr<RHI::ShaderResourceGroupPool> srgPool = RHI::Factory::Get().CreateShaderResourceGroupPool();
+        RHI::ShaderResourceGroupPoolDescriptor descriptor;
+        descriptor.m_layout = srgLayout.get();
+        srgPool->Init(*device, descriptor);
+
+        RHI::Ptr<RHI::ShaderResourceGroup> srg = RHI::Factory::Get().CreateShaderResourceGroup();
+        srgPool->InitGroup(*srg);
+
+        RHI::ShaderResourceGroupData srgData(*srg);
+
+        // Every buffered copy of the compiled data has to be written once after the group is created.
+        srg->Compile(srgData, RHI::ShaderResourceGroup::CompileMode::Sync);
+        srgData.ResetUpdateMask();
+        EXPECT_TRUE(srg->IsResourceTypeEnabledForCompilation(ResourceTypeMask::All));
+
+        for (uint32_t i = 1; i < RHI::Limits::Device::FrameCountMax; ++i)
+        {
+            srg->Compile(srgData, RHI::ShaderResourceGroup::CompileMode::Sync);
+        }
+        EXPECT_FALSE(srg->IsResourceTypeEnabledForCompilation(ResourceTypeMask::All));
+
+        EXPECT_TRUE(srgData.SetConstant(vector2index, Vector2(1.0f, 2.0f)));
+        srg->Compile(srgData, RHI::ShaderResourceGroup::CompileMode::Sync);
+        srgData.ResetUpdateMask();
+        EXPECT_TRUE(srg->IsResourceTypeEnabledForCompilation(ResourceTypeMask::ConstantDataMask));
+        EXPECT_FALSE(srg->IsResourceTypeEnabledForCompilation(ResourceTypeMask::ImageViewMask | ResourceTypeMask::BufferViewMask));
+        EXPECT_EQ(srg->GetConstantsCompileInterval(), srgLayout->GetConstantsLayout()->GetInterval(vector2index));
+
+        for (uint32_t i = 1; i < RHI::Limits::Device::FrameCountMax; ++i)
+        {
+            srg->Compile(srgData, RHI::ShaderResourceGroup::CompileMode::Sync);
+        }
+        EXPECT_FALSE(srg->IsResourceTypeEnabledForCompilation(ResourceTypeMask::ConstantDataMask));
+        EXPECT_EQ(srg->GetConstantsCompileInterval(), RHI::Interval());
+    }
+
     TEST_F(ShaderResourceGroupTests, TestShaderResourceGroupLayoutHash)
     {
         const Name imageName("m_image");
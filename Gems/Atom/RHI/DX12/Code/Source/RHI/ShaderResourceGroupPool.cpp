@@ -215,12 +215,27 @@ namespace AZ
             ShaderResourceGroup& group = static_cast<ShaderResourceGroup&>(groupBase);
             group.m_compiledDataIndex = (group.m_compiledDataIndex + 1) % RHI::Limits::Device::FrameCountMax;
 
-            if (m_constantBufferSize)
+            using ResourceTypeMask = RHI::ShaderResourceGroupData::ResourceTypeMask;
+
+            // Only the parts of the group modified within the last FrameCountMax compiles are rewritten, the rest
+            // of the compiled data in this slot is already up to date.
+            if (m_constantBufferSize && group.IsResourceTypeEnabledForCompilation(ResourceTypeMask::ConstantDataMask))
             {
-                memcpy(group.GetCompiledData().m_cpuConstantAddress, groupData.GetConstantData().data(), groupData.GetConstantData().size());
+                const RHI::Interval constantsInterval = group.GetConstantsCompileInterval();
+                const uint32_t constantDataSize = static_cast<uint32_t>(groupData.GetConstantData().size());
+                const uint32_t byteMin = AZStd::min(constantsInterval.m_min, constantDataSize);
+                const uint32_t byteMax = AZStd::min(constantsInterval.m_max, constantDataSize);
+                if (byteMax > byteMin)
+                {
+                    memcpy(
+                        group.GetCompiledData().m_cpuConstantAddress + byteMin,
+                        groupData.GetConstantData().data() + byteMin,
+                        byteMax - byteMin);
+                }
             }
 
-            if (m_viewsDescriptorTableSize)
+            if (m_viewsDescriptorTableSize &&
+                group.IsResourceTypeEnabledForCompilation(ResourceTypeMask::BufferViewMask | ResourceTypeMask::ImageViewMask))
             {
                 const DescriptorTable descriptorTable(
                     group.m_viewsDescriptorTable.GetOffset() + group.m_compiledDataIndex * m_viewsDescriptorTableSize,
@@ -229,12 +244,14 @@ namespace AZ
                 UpdateViewsDescriptorTable(descriptorTable, groupData);
             }
 
-            if (m_unboundedArrayCount)
+            if (m_unboundedArrayCount &&
+                group.IsResourceTypeEnabledForCompilation(
+                    ResourceTypeMask::BufferViewUnboundedArrayMask | ResourceTypeMask::ImageViewUnboundedArrayMask))
             {
                 UpdateUnboundedArrayDescriptorTables(group, groupData);
             }
 
-            if (m_samplersDescriptorTableSize)
+            if (m_samplersDescriptorTableSize && group.IsResourceTypeEnabledForCompilation(ResourceTypeMask::SamplerMask))
             {
                 const DescriptorTable descriptorTable(
                     group.m_samplersDescriptorTable.GetOffset() + group.m_compiledDataIndex * m_samplersDescriptorTableSize,
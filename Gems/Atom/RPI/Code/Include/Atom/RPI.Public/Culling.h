@@ -27,6 +27,7 @@
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 
 #include <Atom/RPI.Public/View.h>
+#include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RHI/DrawList.h>
 
 #include <AtomCore/std/parallel/concurrency_checker.h>
@@ -89,6 +90,10 @@ namespace AZ
                 float m_lodSelectionRadius = 1.0f;
 
                 LodOverride m_lodOverride = NoLodOverride;
+
+                //! Streaming images sampled by the object. Each view the object is added to requests their mips for the object's
+                //! approximate size on screen, see StreamingImage::SetTargetMipForScreenSize.
+                AZStd::vector<Data::Instance<StreamingImage>> m_streamingImages;
             };
             LodData m_lodData;
 
@@ -239,7 +244,8 @@ namespace AZ
 
             //! Performs render culling and lod selection for a View, then adds the visible renderpackets to that View.
             //! Must be called between BeginCulling() and EndCulling(), once for each active scene/view pair.
-            //! Will create child jobs under the parentJob to do the processing in parallel.
+            //! Will create child jobs under the parentJob to do the processing in parallel, each job culling a fixed number
+            //! of cullables (see r_CullWorkPerBatch) and writing the visible draw packets to the view's per-thread draw lists.
             //! Can be called in parallel (i.e. to perform culling on multiple views at the same time).
             void ProcessCullables(const Scene& scene, View& view, AZ::Job& parentJob);
 
@@ -261,8 +267,15 @@ namespace AZ
                 return m_debugCtx;
             }
 
-            static const size_t WorkListCapacity = 5;
-            using WorkListType = AZStd::fixed_vector<AzFramework::IVisibilityScene::NodeData, WorkListCapacity>;
+            //! A contiguous range of the entries in one visible node. Nodes with more entries than fit in a work item
+            //! are split across several work items, so each culling job processes about the same number of entries.
+            struct WorkListEntry
+            {
+                AzFramework::IVisibilityScene::EnumeratedNodeData m_nodeData;
+                uint32_t m_firstEntry = 0;
+                uint32_t m_entryCount = 0;
+            };
+            using WorkListType = AZStd::vector<WorkListEntry>;
 
         protected:
             size_t CountObjectsInScene();
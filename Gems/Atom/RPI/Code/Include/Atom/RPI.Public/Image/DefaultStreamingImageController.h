@@ -14,10 +14,21 @@
 #include <Atom/RPI.Public/Image/StreamingImageContext.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 
+#include <AzCore/std/containers/fixed_vector.h>
+
 namespace AZ
 {
     namespace RPI
     {
+        //! The streaming controller used by the image system pools.
+        //! Every update it picks a target mip chain for each image from the most detailed mip requested through
+        //! StreamingImage::SetTargetMip that frame. Images are expanded towards their target in priority order, the images
+        //! requested for the most detailed mips first. Images nobody requested keep their mips, except for newly attached
+        //! images which are expanded to their most detailed mip once, like before any request is made.
+        //! The estimated memory of all images is kept within the budget of the pool. When the requested mips and the initial
+        //! expansions don't fit, mips that are more detailed than requested and mips of images that weren't requested this
+        //! frame are trimmed, least recently used first. Expansions that still don't fit are reduced or deferred to a later
+        //! update.
         class DefaultStreamingImageController final
             : public StreamingImageController
         {
@@ -25,9 +36,72 @@ namespace AZ
         public:
             AZ_RTTI(DefaultStreamingImageController, "{C733B6FC-4918-42CE-A9A5-B68FF7F6C77D}", StreamingImageController)
 
+            //! Streaming statistics of the last update.
+            struct Statistics
+            {
+                //! The number of images attached to the controller.
+                size_t m_imageCount = 0;
+
+                //! The number of images which had a target mip requested since the previous update.
+                size_t m_requestedImageCount = 0;
+
+                //! The estimated memory of the resident and queued mip chains of all images.
+                size_t m_memoryUsageInBytes = 0;
+
+                //! The budget the memory usage is kept in. Zero means the budget isn't limited.
+                size_t m_memoryBudgetInBytes = 0;
+
+                //! The number of images queued for expansion.
+                uint32_t m_expandedImageCount = 0;
+
+                //! The number of images which were trimmed.
+                uint32_t m_trimmedImageCount = 0;
+
+                //! The number of images which didn't get all the mips they wanted, because of the budget or the expansion limit.
+                uint32_t m_deferredImageCount = 0;
+            };
+
             static Data::Instance<DefaultStreamingImageController> FindOrCreate(const Data::Asset<DefaultStreamingImageControllerAsset>& asset);
 
+            //! Returns the statistics of the last update. Must be called from the thread that updates the pool.
+            const Statistics& GetStatistics() const;
+
         private:
+            // The limit of images queued for expansion in one update, to avoid hitches from too many uploads at once.
+            static constexpr uint32_t MaxExpandsPerUpdate = 20;
+
+            // The streaming state the controller keeps for each image. It's only accessed in UpdateInternal, which is serialized
+            // by the base controller.
+            class Context final
+                : public StreamingImageContext
+            {
+            public:
+                AZ_CLASS_ALLOCATOR(Context, AZ::ThreadPoolAllocator, 0);
+
+                // Whether the image still has to be expanded to its most detailed mip after being attached.
+                mutable bool m_pendingInitialExpand = true;
+
+                // The resident size in bytes of the image for each mip chain level. Filled in the first time the image is updated.
+                mutable AZStd::fixed_vector<size_t, RHI::Limits::Image::MipCountMax> m_residentSizes;
+            };
+
+            // An image considered for streaming in an update.
+            struct ImageEntry
+            {
+                const Context* m_context = nullptr;
+                StreamingImage* m_image = nullptr;
+                size_t m_lastAccessTimestamp = 0;
+                uint16_t m_requestedMip = RHI::Limits::Image::MipCountMax;
+                uint16_t m_streamingMipChain = 0;
+                uint16_t m_targetMipChain = 0;
+                uint16_t m_tailMipChain = 0;
+
+                bool IsRequested() const
+                {
+                    return m_requestedMip < RHI::Limits::Image::MipCountMax;
+                }
+            };
+
             // Standard init for InstanceData subclass
             DefaultStreamingImageController() = default;
             static Data::Instance<DefaultStreamingImageController> CreateInternal(Data::AssetData* assetData);
@@ -39,8 +113,16 @@ namespace AZ
             void UpdateInternal(size_t timestamp, const StreamingImageContextList& contexts) override;
             ///////////////////////////////////////////////////////////////////
 
-            // A work queue for doing initial setup after an image is attached.
-            AZStd::vector<StreamingImageContextPtr> m_recentlyAttachedContexts;
+            // Trims images until the memory usage and the requested expansions fit in the budget. Returns the new memory usage.
+            size_t TrimToBudget(size_t memoryUsage, size_t requestedMemory, size_t memoryBudget);
+
+            // Queues the expansions in priority order, as far as the budget allows. Returns the new memory usage.
+            size_t ExpandWithinBudget(size_t memoryUsage, size_t memoryBudget);
+
+            // Reused every update to avoid allocating.
+            AZStd::vector<ImageEntry> m_entries;
+
+            Statistics m_statistics;
         };
     }
 }
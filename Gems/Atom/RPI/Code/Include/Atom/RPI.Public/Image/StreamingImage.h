@@ -85,6 +85,10 @@ namespace AZ
             //! 
             //! A value of 0 is the most detailed mip level. The value is clamped to the last mip in the chain.
             void SetTargetMip(uint16_t targetMipLevel);
+
+            //! Requests the mip level with about one texel per pixel when the image spans the given number of pixels on screen,
+            //! through SetTargetMip. Like SetTargetMip, it has to be called every frame the image is used.
+            void SetTargetMipForScreenSize(float screenSizeInPixels);
             
             const Data::Instance<StreamingImagePool>& GetPool() const;
 
@@ -115,6 +119,18 @@ namespace AZ
             //! Returns the most detailed mip level currently resident in memory, where a value of 0 is the highest detailed mip.
             uint16_t GetResidentMipLevel();
 
+            //! Returns the number of mip chains in the image. The last one is the tail mip chain, which is always resident.
+            size_t GetMipChainCount() const;
+
+            //! Returns the index of the mip chain which holds the mip level. The mip level is clamped to the last mip in the image.
+            size_t GetMipChainIndex(size_t mipLevel) const;
+
+            //! Returns the most detailed mip chain that is either resident or queued for expansion.
+            size_t GetStreamingMipChainLevel() const;
+
+            //! Returns the size in bytes of the image data when the mip chain and all the less detailed ones are resident.
+            size_t GetResidentSizeInBytes(size_t mipChainLevel) const;
+
         private:
             StreamingImage() = default;
 
@@ -51,6 +51,9 @@ namespace AZ
 
             const RHI::StreamingImagePool* GetRHIPool() const;
 
+            //! Returns the controller which streams the images of the pool, for instance to query its statistics.
+            const StreamingImageController* GetController() const;
+
         private:
             StreamingImagePool() = default;
 
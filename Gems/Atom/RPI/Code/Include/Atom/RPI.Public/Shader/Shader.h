@@ -26,6 +26,7 @@ namespace AZ
     namespace RHI
     {
         class PipelineStateCache;
+        class PipelineStateCacheData;
     }
 
     namespace RPI
@@ -153,6 +154,9 @@ namespace AZ
             void Shutdown();
 
             ConstPtr<RHI::PipelineLibraryData> LoadPipelineLibrary() const;
+            ConstPtr<RHI::PipelineStateCacheData> LoadPipelineStateCacheData() const;
+
+            //! Saves the pipeline library and the recorded pipeline states used to warm it up.
             void SavePipelineLibrary() const;
 
             ///////////////////////////////////////////////////////////////////
@@ -178,6 +182,9 @@ namespace AZ
             //! Returns the path to the pipeline library cache file.
             AZStd::string GetPipelineLibraryPath() const;
 
+            //! Returns the path to the file recording the pipeline states of the pipeline library.
+            AZStd::string GetPipelineStateCacheDataPath() const;
+
             //! A strong reference to the shader asset.
             Data::Asset<ShaderAsset> m_asset;
 
@@ -44,6 +44,8 @@ namespace AZ
     {
         AZ_CVAR(bool, r_CullInParallel, true, nullptr, ConsoleFunctorFlags::Null, "");
         AZ_CVAR(uint32_t, r_CullWorkPerBatch, 500, nullptr, ConsoleFunctorFlags::Null, "");
+        AZ_CVAR(uint32_t, r_StreamingImageScreenHeight, 1080, nullptr, ConsoleFunctorFlags::Null,
+            "The screen height in pixels the mips of the streaming images of visible objects are requested for");
 
         void DebugDrawWorldCoordinateAxes(AuxGeomDraw* auxGeom)
         {
@@ -267,18 +269,104 @@ namespace AZ
             return m_visScene->GetEntryCount();
         }
 
+        //! The view-dependent terms used for lod selection and depth sorting. These only depend on the view, so they're
+        //! computed once per view instead of once for every visible cullable.
+        struct ViewLodSelection
+        {
+            explicit ViewLodSelection(const View& view)
+            {
+                const Matrix4x4& viewToClip = view.GetViewToClipMatrix();
+                //the [1][1] element of a perspective projection matrix stores cot(FovY/2) (equal to 2*nearPlaneDistance/nearPlaneHeight),
+                //which is used to determine the (vertical) projected size in screen space
+                m_yScale = viewToClip.GetElement(1, 1);
+                m_isPerspective = viewToClip.GetElement(3, 3) == 0.f;
+
+                const Matrix4x4& viewToWorld = view.GetViewToWorldMatrix();
+                m_cameraPos = viewToWorld.GetTranslation();
+                m_cameraForward = -viewToWorld.GetBasisZAsVector3();
+            }
+
+            Vector3 m_cameraPos;
+            Vector3 m_cameraForward;
+            float m_yScale = 1.0f;
+            bool m_isPerspective = true;
+        };
+
+        static uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, const ViewLodSelection& lodSelection, RPI::View& view)
+        {
+#ifdef AZ_CULL_PROFILE_DETAILED
+            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+#endif
+
+            const float approxScreenPercentage = ModelLodUtils::ApproxScreenPercentage(
+                pos, lodData.m_lodSelectionRadius, lodSelection.m_cameraPos, lodSelection.m_yScale, lodSelection.m_isPerspective);
+
+            if (!lodData.m_streamingImages.empty())
+            {
+                const float screenSizeInPixels = approxScreenPercentage * static_cast<float>(static_cast<uint32_t>(r_StreamingImageScreenHeight));
+                for (const Data::Instance<StreamingImage>& streamingImage : lodData.m_streamingImages)
+                {
+                    streamingImage->SetTargetMipForScreenSize(screenSizeInPixels);
+                }
+            }
+
+            //all draw packets of a cullable share the same depth, so this is the same value View::AddDrawPacket() would calculate for each of them
+            const float depth = (pos - lodSelection.m_cameraPos).Dot(lodSelection.m_cameraForward);
+
+            uint32_t numVisibleDrawPackets = 0;
+
+            auto addLodToDrawPacket = [&](const Cullable::LodData::Lod& lod)
+            {
+#ifdef AZ_CULL_PROFILE_VERBOSE
+                AZ_PROFILE_SCOPE_DYNAMIC(Debug::ProfileCategory::AzRender, "add draw packets: %zu", lod.m_drawPackets.size());
+#endif
+                numVisibleDrawPackets += static_cast<uint32_t>(lod.m_drawPackets.size());   //don't want to pay the cost of aznumeric_cast<> here so using static_cast<> instead
+                for (const RHI::DrawPacket* drawPacket : lod.m_drawPackets)
+                {
+                    view.AddDrawPacket(drawPacket, depth);
+                }
+            };
+
+            if (lodData.m_lodOverride == Cullable::NoLodOverride)
+            {
+                for (const Cullable::LodData::Lod& lod : lodData.m_lods)
+                {
+                    //Note that this supports overlapping lod ranges (to suport cross-fading lods, for example)
+                    if (approxScreenPercentage >= lod.m_screenCoverageMin && approxScreenPercentage <= lod.m_screenCoverageMax)
+                    {
+                        addLodToDrawPacket(lod);
+                    }
+                }
+            }
+            else if(lodData.m_lodOverride < lodData.m_lods.size())
+            {
+                addLodToDrawPacket(lodData.m_lods.at(lodData.m_lodOverride));
+            }
+
+            return numVisibleDrawPackets;
+        }
+
         class AddObjectsToViewJob final
             : public Job
         {
         public:
             AZ_CLASS_ALLOCATOR(AddObjectsToViewJob, ThreadPoolAllocator, 0);
 
+            //! Data shared by all the jobs processing the same view
             struct JobData
             {
+                JobData(const View& view)
+                    : m_lodSelection(view)
+                {
+                }
+
                 CullingDebugContext* m_debugCtx = nullptr;
+                //! Looked up once per view so the jobs don't need to lock the debug context, null when stats are disabled
+                CullingDebugContext::CullStats* m_cullStats = nullptr;
                 const Scene* m_scene = nullptr;
                 View* m_view = nullptr;
                 Frustum m_frustum;
+                ViewLodSelection m_lodSelection;
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
                 MaskedOcclusionCulling* m_maskedOcclusionCulling = nullptr;
 #endif
@@ -289,10 +377,10 @@ namespace AZ
             CullingScene::WorkListType m_worklist;
 
         public:
-            AddObjectsToViewJob(const AZStd::shared_ptr<AddObjectsToViewJob::JobData>& jobData, CullingScene::WorkListType& worklist)
+            AddObjectsToViewJob(const AZStd::shared_ptr<AddObjectsToViewJob::JobData>& jobData, CullingScene::WorkListType&& worklist)
                 : Job(true, nullptr)        //auto-deletes, no JobContext
                 , m_jobData(jobData)
-                , m_worklist(worklist)
+                , m_worklist(AZStd::move(worklist))
             {
             }
 
@@ -301,129 +389,117 @@ namespace AZ
             {
                 AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
 
-                const View::UsageFlags viewFlags = m_jobData->m_view->GetUsageFlags();
-                const RHI::DrawListMask drawListMask = m_jobData->m_view->GetDrawListMask();
+                const JobData& jobData = *m_jobData;
+                const View::UsageFlags viewFlags = jobData.m_view->GetUsageFlags();
+                const RHI::DrawListMask drawListMask = jobData.m_view->GetDrawListMask();
                 uint32_t numDrawPackets = 0;
                 uint32_t numVisibleCullables = 0;
 
-                for (const AzFramework::IVisibilityScene::NodeData& nodeData : m_worklist)
+                for (const CullingScene::WorkListEntry& workListEntry : m_worklist)
                 {
+                    const AzFramework::IVisibilityScene::EnumeratedNodeData& nodeData = workListEntry.m_nodeData;
+                    AzFramework::VisibilityEntry* const* entries = nodeData.m_entries->data() + workListEntry.m_firstEntry;
+
                     //If a node is entirely contained within the frustum, then we can skip the fine grained culling.
-                    bool nodeIsContainedInFrustum = ShapeIntersection::Contains(m_jobData->m_frustum, nodeData.m_bounds);
+                    bool nodeIsContainedInFrustum = ShapeIntersection::Contains(jobData.m_frustum, nodeData.m_bounds);
+                    const bool fineCull = !nodeIsContainedInFrustum && jobData.m_debugCtx->m_enableFrustumCulling;
 
 #ifdef AZ_CULL_PROFILE_VERBOSE
                     AZ_PROFILE_SCOPE_DYNAMIC(Debug::ProfileCategory::AzRender, "process node (view: %s, skip fine cull: %d",
-                        m_view->GetName().GetCStr(), nodeIsContainedInFrustum ? 1 : 0);
+                        jobData.m_view->GetName().GetCStr(), nodeIsContainedInFrustum ? 1 : 0);
 #endif
 
-                    if (nodeIsContainedInFrustum || !m_jobData->m_debugCtx->m_enableFrustumCulling)
+                    for (uint32_t entryIndex = 0; entryIndex < workListEntry.m_entryCount; ++entryIndex)
                     {
-                        //Add all objects within this node to the view, without any extra culling
-                        for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
+                        AzFramework::VisibilityEntry* visibleEntry = entries[entryIndex];
+                        if (!(visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable))
                         {
-                            {
-                                if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
-                                {
-                                    Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
+                            continue;
+                        }
 
-                                    if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
-                                        c->m_cullData.m_hideFlags & viewFlags ||
-                                        c->m_cullData.m_scene != m_jobData->m_scene ||       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
-                                        c->m_isHidden)
-                                    {
-                                        continue;
-                                    }
+                        Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
 
-#if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
-                                    if (TestOcclusionCulling(visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
-#endif
-                                    {
-                                        numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *m_jobData->m_view);
-                                        ++numVisibleCullables;
-                                        c->m_isVisible = true;
-                                    }
-                                }
-                            }
+                        if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
+                            c->m_cullData.m_hideFlags & viewFlags ||
+                            c->m_cullData.m_scene != jobData.m_scene ||       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
+                            c->m_isHidden)
+                        {
+                            continue;
                         }
-                    }
-                    else
-                    {
+
                         //Do fine-grained culling before adding objects to the view
-                        for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
+                        if (fineCull)
                         {
-                            if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
+                            IntersectResult res = ShapeIntersection::Classify(jobData.m_frustum, c->m_cullData.m_boundingSphere);
+                            if (res == IntersectResult::Exterior ||
+                                (res != IntersectResult::Interior && !ShapeIntersection::Overlaps(jobData.m_frustum, c->m_cullData.m_boundingObb)))
                             {
-                                Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
-
-                                if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
-                                    c->m_cullData.m_hideFlags & viewFlags ||
-                                    c->m_cullData.m_scene != m_jobData->m_scene ||       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
-                                    c->m_isHidden)
-                                {
-                                    continue;
-                                }
+                                continue;
+                            }
+                        }
 
-                                IntersectResult res = ShapeIntersection::Classify(m_jobData->m_frustum, c->m_cullData.m_boundingSphere);
-                                if (res == IntersectResult::Exterior)
-                                {
-                                    continue;
-                                }
-                                else if (res == IntersectResult::Interior || ShapeIntersection::Overlaps(m_jobData->m_frustum, c->m_cullData.m_boundingObb))
-                                {
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
-                                    if (TestOcclusionCulling(visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
+                        if (TestOcclusionCulling(visibleEntry) != MaskedOcclusionCulling::CullingResult::VISIBLE)
+                        {
+                            continue;
+                        }
 #endif
-                                    {
-                                        numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *m_jobData->m_view);
-                                        ++numVisibleCullables;
-                                        c->m_isVisible = true;
-                                    }
-                                }
-                            }
+
+                        numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, jobData.m_lodSelection, *jobData.m_view);
+                        ++numVisibleCullables;
+
+                        //The jobs of the other views write the same flag, only write it once to avoid bouncing the cache line between them
+                        if (!c->m_isVisible)
+                        {
+                            c->m_isVisible = true;
                         }
                     }
 
-                    if (m_jobData->m_debugCtx->m_debugDraw && (m_jobData->m_view->GetName() == m_jobData->m_debugCtx->m_currentViewSelectionName))
+                    if (jobData.m_debugCtx->m_debugDraw && (jobData.m_view->GetName() == jobData.m_debugCtx->m_currentViewSelectionName))
                     {
                         AZ_PROFILE_SCOPE(Debug::ProfileCategory::AzRender, "debug draw culling");
 
-                        AuxGeomDrawPtr auxGeomPtr = AuxGeomFeatureProcessorInterface::GetDrawQueueForScene(m_jobData->m_scene);
+                        AuxGeomDrawPtr auxGeomPtr = AuxGeomFeatureProcessorInterface::GetDrawQueueForScene(jobData.m_scene);
                         if (auxGeomPtr)
                         {
-                            //Draw the node bounds
+                            //Draw the node bounds, nodes that are split across several work items are only drawn by the first one
                             // "Fully visible" nodes are nodes that are fully inside the frustum. "Partially visible" nodes intersect the edges of the frustum.
                             // Since the nodes of an octree have lots of overlapping boxes with coplanar edges, it's easier to view these separately, so
                             // we have a few debug booleans to toggle which ones to draw.
-                            if (nodeIsContainedInFrustum && m_jobData->m_debugCtx->m_drawFullyVisibleNodes)
-                            {
-                                auxGeomPtr->DrawAabb(nodeData.m_bounds, Colors::Lime, RPI::AuxGeomDraw::DrawStyle::Line, RPI::AuxGeomDraw::DepthTest::Off);
-                            }
-                            else if (!nodeIsContainedInFrustum && m_jobData->m_debugCtx->m_drawPartiallyVisibleNodes)
+                            if (workListEntry.m_firstEntry == 0)
                             {
-                                auxGeomPtr->DrawAabb(nodeData.m_bounds, Colors::Yellow, RPI::AuxGeomDraw::DrawStyle::Line, RPI::AuxGeomDraw::DepthTest::Off);
+                                if (nodeIsContainedInFrustum && jobData.m_debugCtx->m_drawFullyVisibleNodes)
+                                {
+                                    auxGeomPtr->DrawAabb(nodeData.m_bounds, Colors::Lime, RPI::AuxGeomDraw::DrawStyle::Line, RPI::AuxGeomDraw::DepthTest::Off);
+                                }
+                                else if (!nodeIsContainedInFrustum && jobData.m_debugCtx->m_drawPartiallyVisibleNodes)
+                                {
+                                    auxGeomPtr->DrawAabb(nodeData.m_bounds, Colors::Yellow, RPI::AuxGeomDraw::DrawStyle::Line, RPI::AuxGeomDraw::DepthTest::Off);
+                                }
                             }
 
                             //Draw bounds on individual objects
-                            if (m_jobData->m_debugCtx->m_drawBoundingBoxes || m_jobData->m_debugCtx->m_drawBoundingSpheres || m_jobData->m_debugCtx->m_drawLodRadii)
+                            if (jobData.m_debugCtx->m_drawBoundingBoxes || jobData.m_debugCtx->m_drawBoundingSpheres || jobData.m_debugCtx->m_drawLodRadii)
                             {
-                                for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
+                                for (uint32_t entryIndex = 0; entryIndex < workListEntry.m_entryCount; ++entryIndex)
                                 {
+                                    AzFramework::VisibilityEntry* visibleEntry = entries[entryIndex];
                                     if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
                                     {
                                         Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
-                                        if (m_jobData->m_debugCtx->m_drawBoundingBoxes)
+                                        if (jobData.m_debugCtx->m_drawBoundingBoxes)
                                         {
                                             auxGeomPtr->DrawObb(c->m_cullData.m_boundingObb, Matrix3x4::Identity(),
                                                 nodeIsContainedInFrustum ? Colors::Lime : Colors::Yellow, AuxGeomDraw::DrawStyle::Line);
                                         }
 
-                                        if (m_jobData->m_debugCtx->m_drawBoundingSpheres)
+                                        if (jobData.m_debugCtx->m_drawBoundingSpheres)
                                         {
                                             auxGeomPtr->DrawSphere(c->m_cullData.m_boundingSphere.GetCenter(), c->m_cullData.m_boundingSphere.GetRadius(),
                                                 Color(0.5f, 0.5f, 0.5f, 0.3f), AuxGeomDraw::DrawStyle::Shaded);
                                         }
 
-                                        if (m_jobData->m_debugCtx->m_drawLodRadii)
+                                        if (jobData.m_debugCtx->m_drawLodRadii)
                                         {
                                             auxGeomPtr->DrawSphere(c->m_cullData.m_boundingSphere.GetCenter(),
                                                 c->m_lodData.m_lodSelectionRadius,
@@ -436,14 +512,12 @@ namespace AZ
                     }
                 }
 
-                if (m_jobData->m_debugCtx->m_enableStats)
+                if (jobData.m_cullStats)
                 {
-                    CullingDebugContext::CullStats& cullStats = m_jobData->m_debugCtx->GetCullStatsForView(m_jobData->m_view);
-
                     //no need for mutex here since these are all atomics
-                    cullStats.m_numVisibleDrawPackets += numDrawPackets;
-                    cullStats.m_numVisibleCullables += numVisibleCullables;
-                    ++cullStats.m_numJobs;
+                    jobData.m_cullStats->m_numVisibleDrawPackets += numDrawPackets;
+                    jobData.m_cullStats->m_numVisibleCullables += numVisibleCullables;
+                    ++jobData.m_cullStats->m_numJobs;
                 }
             }
 
@@ -585,10 +659,9 @@ namespace AZ
             }
 #endif
 
-            WorkListType worklist;
-
-            AZStd::shared_ptr<AddObjectsToViewJob::JobData> jobData = AZStd::make_shared<AddObjectsToViewJob::JobData>();
+            AZStd::shared_ptr<AddObjectsToViewJob::JobData> jobData = AZStd::make_shared<AddObjectsToViewJob::JobData>(view);
             jobData->m_debugCtx = &m_debugCtx;
+            jobData->m_cullStats = m_debugCtx.m_enableStats ? &m_debugCtx.GetCullStatsForView(&view) : nullptr;
             jobData->m_scene = &scene;
             jobData->m_view = &view;
             jobData->m_frustum = frustum;
@@ -596,29 +669,56 @@ namespace AZ
             jobData->m_maskedOcclusionCulling = maskedOcclusionCulling;
 #endif
 
-            auto nodeVisitorLambda = [this, jobData, &parentJob, &frustum, &worklist](const AzFramework::IVisibilityScene::NodeData& nodeData) -> void
+            //Split the visible entries into work items of a fixed size so the jobs have an even amount of work, independent of how the
+            //entries are distributed over the nodes. This also keeps the number of jobs in flight low, reducing job-system overhead.
+            const uint32_t entriesPerWorkItem = AZ::GetMax(static_cast<uint32_t>(r_CullWorkPerBatch), 1u);
+            WorkListType worklist;
+            uint32_t worklistEntryCount = 0;
+
+            auto startJob = [&parentJob, &jobData, &worklist, &worklistEntryCount]()
+            {
+                AddObjectsToViewJob* job = aznew AddObjectsToViewJob(jobData, AZStd::move(worklist)); //pool allocated (cheap), auto-deletes when job finishes
+                worklist.clear();
+                worklistEntryCount = 0;
+                parentJob.SetContinuation(job);
+                job->Start();
+            };
+
+            auto nodeVisitorLambda = [entriesPerWorkItem, &startJob, &worklist, &worklistEntryCount](const AzFramework::IVisibilityScene::NodeData& nodeData) -> void
             {
                 AZ_PROFILE_SCOPE(Debug::ProfileCategory::AzRender, "nodeVisitorLambda()");
                 AZ_Assert(nodeData.m_entries.size() > 0, "should not get called with 0 entries");
-                AZ_Assert(worklist.size() < worklist.capacity(), "we should always have room to push a node on the queue");
 
-                //Queue up a small list of work items (NodeData*) which will be pushed to a worker job (AddObjectsToViewJob) once the queue is full.
-                //This reduces the number of jobs in flight, reducing job-system overhead.
-                worklist.emplace_back(AZStd::move(nodeData));
-
-                if (worklist.size() == worklist.capacity())
+                //Queue up ranges of the node's entries until there are enough for a work item, then push them to a worker job (AddObjectsToViewJob).
+                const uint32_t nodeEntryCount = aznumeric_cast<uint32_t>(nodeData.m_entries.size());
+                uint32_t firstEntry = 0;
+                while (firstEntry < nodeEntryCount)
                 {
-                    //Kick off a job to process the (full) worklist
-                    AddObjectsToViewJob* job = aznew AddObjectsToViewJob(jobData, worklist); //pool allocated (cheap), auto-deletes when job finishes
-                    worklist.clear();
-                    parentJob.SetContinuation(job);
-                    job->Start();
+                    const uint32_t entryCount = AZ::GetMin(nodeEntryCount - firstEntry, entriesPerWorkItem - worklistEntryCount);
+                    worklist.push_back({ { nodeData.m_bounds, &nodeData.m_entries }, firstEntry, entryCount });
+                    firstEntry += entryCount;
+                    worklistEntryCount += entryCount;
+
+                    if (worklistEntryCount == entriesPerWorkItem)
+                    {
+                        //Kick off a job to process the (full) worklist
+                        startJob();
+                    }
                 }
             };
 
             if (m_debugCtx.m_enableFrustumCulling)
             {
-                m_visScene->Enumerate(frustum, nodeVisitorLambda);                    
+                //Walk the octree across the job workers, then split the visible nodes into work items on this thread.
+                AzFramework::IVisibilityScene::NodeDataBuckets visibleNodeBuckets;
+                m_visScene->EnumerateParallel(frustum, visibleNodeBuckets);
+                for (const AzFramework::IVisibilityScene::NodeDataBucket& bucket : visibleNodeBuckets)
+                {
+                    for (const AzFramework::IVisibilityScene::EnumeratedNodeData& nodeData : bucket)
+                    {
+                        nodeVisitorLambda({ nodeData.m_bounds, *nodeData.m_entries });
+                    }
+                }
             }
             else
             {
@@ -627,68 +727,14 @@ namespace AZ
 
             if (worklist.size() > 0)
             {
-                AZStd::shared_ptr<AddObjectsToViewJob::JobData> remainingJobData = AZStd::make_shared<AddObjectsToViewJob::JobData>();
-                remainingJobData->m_debugCtx = &m_debugCtx;
-                remainingJobData->m_scene = &scene;
-                remainingJobData->m_view = &view;
-                remainingJobData->m_frustum = frustum;
-#if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
-                remainingJobData->m_maskedOcclusionCulling = maskedOcclusionCulling;
-#endif
                 //Kick off a job to process any remaining workitems
-                AddObjectsToViewJob* job = aznew AddObjectsToViewJob(remainingJobData, worklist); //pool allocated (cheap), auto-deletes when job finishes
-                parentJob.SetContinuation(job);
-                job->Start();
+                startJob();
             }
         }
 
         uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view)
         {
-#ifdef AZ_CULL_PROFILE_DETAILED
-            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
-#endif
-
-            const Matrix4x4& viewToClip = view.GetViewToClipMatrix();
-            //the [1][1] element of a perspective projection matrix stores cot(FovY/2) (equal to 2*nearPlaneDistance/nearPlaneHeight),
-            //which is used to determine the (vertical) projected size in screen space
-            const float yScale = viewToClip.GetElement(1, 1);
-            const bool isPerspective = viewToClip.GetElement(3, 3) == 0.f;
-            const Vector3 cameraPos = view.GetViewToWorldMatrix().GetTranslation();
-
-            const float approxScreenPercentage = ModelLodUtils::ApproxScreenPercentage(
-                pos, lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
-
-            uint32_t numVisibleDrawPackets = 0;
-
-            auto addLodToDrawPacket = [&](const Cullable::LodData::Lod& lod)
-            {
-#ifdef AZ_CULL_PROFILE_VERBOSE
-                AZ_PROFILE_SCOPE_DYNAMIC(Debug::ProfileCategory::AzRender, "add draw packets: %zu", lod.m_drawPackets.size());
-#endif
-                numVisibleDrawPackets += static_cast<uint32_t>(lod.m_drawPackets.size());   //don't want to pay the cost of aznumeric_cast<> here so using static_cast<> instead
-                for (const RHI::DrawPacket* drawPacket : lod.m_drawPackets)
-                {
-                    view.AddDrawPacket(drawPacket, pos);
-                }
-            };
-
-            if (lodData.m_lodOverride == Cullable::NoLodOverride)
-            {
-                for (const Cullable::LodData::Lod& lod : lodData.m_lods)
-                {
-                    //Note that this supports overlapping lod ranges (to suport cross-fading lods, for example)
-                    if (approxScreenPercentage >= lod.m_screenCoverageMin && approxScreenPercentage <= lod.m_screenCoverageMax)
-                    {
-                        addLodToDrawPacket(lod);
-                    }
-                }
-            }
-            else if(lodData.m_lodOverride < lodData.m_lods.size())
-            {
-                addLodToDrawPacket(lodData.m_lods.at(lodData.m_lodOverride));
-            }
-
-            return numVisibleDrawPackets;
+            return AddLodDataToView(pos, lodData, ViewLodSelection(view), view);
         }
 
         void CullingScene::Activate(const Scene* parentScene)
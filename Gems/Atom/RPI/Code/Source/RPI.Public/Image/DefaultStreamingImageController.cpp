@@ -9,9 +9,13 @@
 #include <Atom/RPI.Public/Image/DefaultStreamingImageController.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 
+#include <Atom/RHI/StreamingImagePool.h>
+
 #include <AtomCore/Instance/InstanceDatabase.h>
 
+#include <AzCore/Debug/EventTrace.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/sort.h>
 
 namespace AZ
 {
@@ -50,39 +54,201 @@ namespace AZ
             return RHI::ResultCode::Success;
         }
 
+        const DefaultStreamingImageController::Statistics& DefaultStreamingImageController::GetStatistics() const
+        {
+            return m_statistics;
+        }
+
         StreamingImageContextPtr DefaultStreamingImageController::CreateContextInternal()
         {
-            StreamingImageContextPtr context = aznew StreamingImageContext();
-            m_recentlyAttachedContexts.emplace_back(context);
-            return context;
+            return aznew Context();
         }
 
         void DefaultStreamingImageController::UpdateInternal(size_t timestamp, const StreamingImageContextList& contexts)
         {
+            AZ_TRACE_METHOD();
             AZ_UNUSED(timestamp);
-            AZ_UNUSED(contexts);
 
-            const uint32_t maxExpandsCount = 20;
-            uint32_t mipsExpandsPerUpdate = 0;
+            const RHI::StreamingImagePool* pool = GetRHIPool();
+            const size_t memoryBudget = pool ? static_cast<size_t>(pool->GetDescriptor().m_budgetInBytes) : 0;
+
+            m_statistics = {};
+            m_statistics.m_memoryBudgetInBytes = memoryBudget;
 
-            // [GFX TODO] [ATOM-551] Streaming image control of DefaultStreamingImageController
-            // For now we always stream in all the mips. Of course we need to make this smarter at some point.
-            if (!m_recentlyAttachedContexts.empty())
+            // Gather the images with the mip chain each of them should be streamed to.
+            m_entries.clear();
+            size_t memoryUsage = 0;
+            size_t requestedMemory = 0;
+            for (const StreamingImageContext& streamingContext : contexts)
             {
-                for (auto& context : m_recentlyAttachedContexts)
+                const Context& context = static_cast<const Context&>(streamingContext);
+                StreamingImage* image = context.TryGetImage();
+                if (!image)
                 {
-                    if (StreamingImage* image = context->TryGetImage())
+                    continue;
+                }
+
+                if (context.m_residentSizes.empty())
+                {
+                    for (size_t mipChain = 0; mipChain < image->GetMipChainCount(); ++mipChain)
                     {
-                        QueueExpandToMipChainLevel(image, 0);
-                        mipsExpandsPerUpdate++;
-                        if (mipsExpandsPerUpdate >= maxExpandsCount)
-                        {
-                            break;
-                        }
+                        context.m_residentSizes.push_back(image->GetResidentSizeInBytes(mipChain));
                     }
                 }
-                m_recentlyAttachedContexts.erase(m_recentlyAttachedContexts.begin(), m_recentlyAttachedContexts.begin() + mipsExpandsPerUpdate);
+
+                ImageEntry entry;
+                entry.m_context = &context;
+                entry.m_image = image;
+                entry.m_lastAccessTimestamp = context.GetLastAccessTimestamp();
+                entry.m_requestedMip = context.GetTargetMip();
+                entry.m_streamingMipChain = static_cast<uint16_t>(image->GetStreamingMipChainLevel());
+                entry.m_tailMipChain = static_cast<uint16_t>(image->GetMipChainCount() - 1);
+
+                if (entry.IsRequested())
+                {
+                    entry.m_targetMipChain = static_cast<uint16_t>(image->GetMipChainIndex(entry.m_requestedMip));
+                    context.m_pendingInitialExpand = false;
+                    ++m_statistics.m_requestedImageCount;
+
+                    if (entry.m_targetMipChain < entry.m_streamingMipChain)
+                    {
+                        requestedMemory += context.m_residentSizes[entry.m_targetMipChain] - context.m_residentSizes[entry.m_streamingMipChain];
+                    }
+                }
+                else if (context.m_pendingInitialExpand)
+                {
+                    // A newly attached image needs room for its most detailed mip just like a requested one, otherwise it would
+                    // never be expanded once the budget is full.
+                    entry.m_targetMipChain = 0;
+                    requestedMemory += context.m_residentSizes[0] - context.m_residentSizes[entry.m_streamingMipChain];
+                }
+                else
+                {
+                    entry.m_targetMipChain = entry.m_streamingMipChain;
+                }
+
+                memoryUsage += context.m_residentSizes[entry.m_streamingMipChain];
+                m_entries.push_back(entry);
             }
+
+            if (memoryBudget && memoryUsage + requestedMemory > memoryBudget)
+            {
+                memoryUsage = TrimToBudget(memoryUsage, requestedMemory, memoryBudget);
+            }
+
+            memoryUsage = ExpandWithinBudget(memoryUsage, memoryBudget);
+
+            m_statistics.m_imageCount = m_entries.size();
+            m_statistics.m_memoryUsageInBytes = memoryUsage;
+        }
+
+        size_t DefaultStreamingImageController::TrimToBudget(size_t memoryUsage, size_t requestedMemory, size_t memoryBudget)
+        {
+            // Mips more detailed than what was requested go first, they aren't needed at all. Then the mips of images that weren't
+            // requested this frame, least recently used first. Images waiting for their initial expansion are left alone.
+            AZStd::sort(m_entries.begin(), m_entries.end(),
+                [](const ImageEntry& lhs, const ImageEntry& rhs)
+                {
+                    if (lhs.IsRequested() != rhs.IsRequested())
+                    {
+                        return lhs.IsRequested();
+                    }
+                    return lhs.m_lastAccessTimestamp < rhs.m_lastAccessTimestamp;
+                });
+
+            for (ImageEntry& entry : m_entries)
+            {
+                if (memoryUsage + requestedMemory <= memoryBudget)
+                {
+                    break;
+                }
+
+                const uint16_t trimLimit = entry.IsRequested() || entry.m_context->m_pendingInitialExpand ? entry.m_targetMipChain : entry.m_tailMipChain;
+                uint16_t mipChain = entry.m_streamingMipChain;
+                while (mipChain < trimLimit && memoryUsage + requestedMemory > memoryBudget)
+                {
+                    const auto& residentSizes = entry.m_context->m_residentSizes;
+                    memoryUsage -= residentSizes[mipChain] - residentSizes[mipChain + 1];
+                    ++mipChain;
+                }
+
+                if (mipChain != entry.m_streamingMipChain)
+                {
+                    TrimToMipChainLevel(entry.m_image, mipChain);
+                    entry.m_streamingMipChain = mipChain;
+                    if (!entry.IsRequested())
+                    {
+                        // Don't expand what was just trimmed to make room.
+                        entry.m_targetMipChain = mipChain;
+                        entry.m_context->m_pendingInitialExpand = false;
+                    }
+                    ++m_statistics.m_trimmedImageCount;
+                }
+            }
+
+            return memoryUsage;
+        }
+
+        size_t DefaultStreamingImageController::ExpandWithinBudget(size_t memoryUsage, size_t memoryBudget)
+        {
+            // Requested images go first, the ones requested for the most detailed mips (so the largest on screen) first. Images
+            // nobody requested yet come after them.
+            AZStd::sort(m_entries.begin(), m_entries.end(),
+                [](const ImageEntry& lhs, const ImageEntry& rhs)
+                {
+                    if (lhs.m_requestedMip != rhs.m_requestedMip)
+                    {
+                        return lhs.m_requestedMip < rhs.m_requestedMip;
+                    }
+                    return lhs.m_lastAccessTimestamp > rhs.m_lastAccessTimestamp;
+                });
+
+            uint32_t expandCount = 0;
+            for (ImageEntry& entry : m_entries)
+            {
+                if (entry.m_targetMipChain >= entry.m_streamingMipChain)
+                {
+                    continue;
+                }
+
+                if (expandCount >= MaxExpandsPerUpdate)
+                {
+                    ++m_statistics.m_deferredImageCount;
+                    continue;
+                }
+
+                // Give the image as much of the detail it wants as fits in the budget.
+                const auto& residentSizes = entry.m_context->m_residentSizes;
+                const size_t currentSize = residentSizes[entry.m_streamingMipChain];
+                uint16_t mipChain = entry.m_targetMipChain;
+                while (memoryBudget && mipChain < entry.m_streamingMipChain && memoryUsage + residentSizes[mipChain] - currentSize > memoryBudget)
+                {
+                    ++mipChain;
+                }
+
+                if (mipChain < entry.m_streamingMipChain)
+                {
+                    QueueExpandToMipChainLevel(entry.m_image, mipChain);
+                    memoryUsage += residentSizes[mipChain] - currentSize;
+                    entry.m_streamingMipChain = mipChain;
+                    ++expandCount;
+                }
+
+                if (mipChain == entry.m_targetMipChain)
+                {
+                    if (!entry.IsRequested())
+                    {
+                        entry.m_context->m_pendingInitialExpand = false;
+                    }
+                }
+                else
+                {
+                    ++m_statistics.m_deferredImageCount;
+                }
+            }
+
+            m_statistics.m_expandedImageCount = expandCount;
+            return memoryUsage;
         }
     }
 }
@@ -244,12 +244,62 @@ namespace AZ
                 m_streamingController->OnSetTargetMip(this, targetMipLevel);
             }
         }
+
+        void StreamingImage::SetTargetMipForScreenSize(float screenSizeInPixels)
+        {
+            const RHI::ImageDescriptor& descriptor = GetDescriptor();
+            const uint32_t screenSize = static_cast<uint32_t>(AZStd::max(screenSizeInPixels, 1.0f));
+
+            // Each mip halves the size, pick the smallest one that still covers the screen size
+            uint32_t mipSize = AZStd::max(descriptor.m_size.m_width, descriptor.m_size.m_height);
+            uint16_t targetMipLevel = 0;
+            while (targetMipLevel + 1 < descriptor.m_mipLevels && (mipSize >> 1) >= screenSize)
+            {
+                mipSize >>= 1;
+                ++targetMipLevel;
+            }
+
+            SetTargetMip(targetMipLevel);
+        }
         
         uint16_t StreamingImage::GetResidentMipLevel()
         {
             return m_image->GetResidentMipLevel();
         }
 
+        size_t StreamingImage::GetMipChainCount() const
+        {
+            return m_mipChains.size();
+        }
+
+        size_t StreamingImage::GetMipChainIndex(size_t mipLevel) const
+        {
+            const size_t mipLevelCount = GetDescriptor().m_mipLevels;
+            return m_imageAsset->GetMipChainIndex(AZStd::min(mipLevel, mipLevelCount - 1));
+        }
+
+        size_t StreamingImage::GetStreamingMipChainLevel() const
+        {
+            return m_state.m_streamingTarget;
+        }
+
+        size_t StreamingImage::GetResidentSizeInBytes(size_t mipChainLevel) const
+        {
+            AZ_Assert(mipChainLevel < m_mipChains.size(), "Exceeded number of mip chains.");
+
+            const RHI::ImageDescriptor& descriptor = GetDescriptor();
+            const size_t mipLevelBegin = m_imageAsset->GetMipLevel(mipChainLevel);
+
+            size_t sizeInBytes = 0;
+            for (size_t mipLevel = mipLevelBegin; mipLevel < descriptor.m_mipLevels; ++mipLevel)
+            {
+                const RHI::ImageSubresourceLayout layout =
+                    RHI::GetImageSubresourceLayout(descriptor, RHI::ImageSubresource(static_cast<uint16_t>(mipLevel), 0));
+                sizeInBytes += static_cast<size_t>(layout.m_bytesPerImage) * layout.m_size.m_depth * descriptor.m_arraySize;
+            }
+            return sizeInBytes;
+        }
+
         RHI::ResultCode StreamingImage::TrimToMipChainLevel(size_t mipChainIndex)
         {
             AZ_Assert(mipChainIndex < m_mipChains.size(), "Exceeded number of mip chains.");
@@ -172,6 +172,11 @@ namespace AZ
             image->TrimToMipChainLevel(mipChainIndex);
         }
 
+        const RHI::StreamingImagePool* StreamingImageController::GetRHIPool() const
+        {
+            return m_pool;
+        }
+
         StreamingImageContextPtr StreamingImageController::CreateContextInternal()
         {
             return aznew StreamingImageContext();
@@ -101,5 +101,10 @@ namespace AZ
         {
             return m_pool.get();
         }
+
+        const StreamingImageController* StreamingImagePool::GetController() const
+        {
+            return m_controller.get();
+        }
     }
 }
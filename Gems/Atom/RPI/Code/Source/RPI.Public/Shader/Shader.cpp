@@ -112,6 +112,14 @@ namespace AZ
 
                 m_pipelineLibraryHandle = pipelineLibraryHandle;
                 m_pipelineStateCache = pipelineStateCache;
+
+                // Compile the pipeline states recorded in previous sessions on background jobs, so that they're
+                // ready by the time they are first requested.
+                ConstPtr<RHI::PipelineStateCacheData> cacheData = LoadPipelineStateCacheData();
+                if (cacheData)
+                {
+                    pipelineStateCache->WarmupLibrary(pipelineLibraryHandle, cacheData);
+                }
             }
 
             const Name& drawListName = shaderAsset.GetDrawListName();
@@ -258,6 +266,15 @@ namespace AZ
             return nullptr;
         }
 
+        ConstPtr<RHI::PipelineStateCacheData> Shader::LoadPipelineStateCacheData() const
+        {
+            if (IO::FileIOBase::GetInstance())
+            {
+                return Utils::LoadObjectFromFile<RHI::PipelineStateCacheData>(GetPipelineStateCacheDataPath());
+            }
+            return nullptr;
+        }
+
         void Shader::SavePipelineLibrary() const
         {
             if (auto* fileIOBase = IO::FileIOBase::GetInstance())
@@ -271,6 +288,16 @@ namespace AZ
                     fileIOBase->ResolvePath(pipelineLibraryPath.c_str(), pipelineLibraryPathResolved, AZ_MAX_PATH_LEN);
                     Utils::SaveObjectToFile(pipelineLibraryPathResolved, DataStream::ST_BINARY, serializedData.get());
                 }
+
+                RHI::ConstPtr<RHI::PipelineStateCacheData> cacheData = m_pipelineStateCache->GetLibraryCacheData(m_pipelineLibraryHandle);
+                if (cacheData && cacheData->GetRecordCount() > 0)
+                {
+                    const AZStd::string cacheDataPath = GetPipelineStateCacheDataPath();
+
+                    char cacheDataPathResolved[AZ_MAX_PATH_LEN] = { 0 };
+                    fileIOBase->ResolvePath(cacheDataPath.c_str(), cacheDataPathResolved, AZ_MAX_PATH_LEN);
+                    Utils::SaveObjectToFile(cacheDataPathResolved, DataStream::ST_BINARY, cacheData.get());
+                }
             }
             else
             {
@@ -290,6 +317,18 @@ namespace AZ
             return AZStd::string::format("@user@/Atom/PipelineStateCache/%s/%s_%s_%d.bin", platformName.GetCStr(), shaderName.GetCStr(), uuidString.data(), instanceId.m_subId);
         }
 
+        AZStd::string Shader::GetPipelineStateCacheDataPath() const
+        {
+            const Data::InstanceId& instanceId = GetId();
+            Name platformName = RHI::Factory::Get().GetName();
+            Name shaderName = m_asset->GetName();
+
+            AZStd::string uuidString;
+            instanceId.m_guid.ToString<AZStd::string>(uuidString, false, false);
+
+            return AZStd::string::format("@user@/Atom/PipelineStateCache/%s/%s_%s_%d_states.bin", platformName.GetCStr(), shaderName.GetCStr(), uuidString.data(), instanceId.m_subId);
+        }
+
         ShaderOptionGroup Shader::CreateShaderOptionGroup() const
         {
             return ShaderOptionGroup(m_asset->GetShaderOptionGroupLayout());
@@ -114,6 +114,10 @@ namespace AZ
         void ShaderResourceGroup::Compile()
         {
             m_shaderResourceGroup->Compile(m_data);
+
+            // The RHI group holds its own copy of the data along with the modifications, so only changes made
+            // after this point need to be uploaded by the next compile.
+            m_data.ResetUpdateMask();
         }
 
         bool ShaderResourceGroup::IsQueuedForCompile() const
@@ -433,7 +433,7 @@ namespace UnitTest
             return poolAsset;
         }
 
-        AZ::Data::Asset<AZ::RPI::StreamingImageAsset> BuildTestImage()
+        AZ::Data::Asset<AZ::RPI::StreamingImageAsset> BuildTestImage(const AZ::Data::AssetId& poolAssetId = {})
         {
             using namespace AZ;
 
@@ -460,7 +460,7 @@ namespace UnitTest
             assetCreator.AddMipChainAsset(*mipHead.Get());
             assetCreator.AddMipChainAsset(*mipMiddle.Get());
             assetCreator.AddMipChainAsset(*mipTail.Get());
-            assetCreator.SetPoolAssetId(m_defaultPool->GetAssetId());
+            assetCreator.SetPoolAssetId(poolAssetId.IsValid() ? poolAssetId : m_defaultPool->GetAssetId());
 
             Data::Asset<RPI::StreamingImageAsset> imageAsset;
             EXPECT_TRUE(assetCreator.End(imageAsset));
@@ -727,4 +727,134 @@ namespace UnitTest
 
         RPI::ImageSystemInterface::Get()->Update();
     }
+
+    TEST_F(StreamingImageTests, DefaultController_RequestedMipsExceedBudget_LeastRecentlyUsedImagesAreTrimmed)
+    {
+        using namespace AZ;
+
+        // The test image is 64x64 RGBA8 with 2 array slices, split into mip chains of 1, 2 and 3 mips.
+        const size_t fullSize = 43680;
+        const size_t middleSize = 10912;
+        const size_t tailSize = 672;
+        {
+            Data::Instance<RPI::StreamingImage> sizingImage = RPI::StreamingImage::FindOrCreate(BuildTestImage());
+            ASSERT_EQ(3u, sizingImage->GetMipChainCount());
+            EXPECT_EQ(fullSize, sizingImage->GetResidentSizeInBytes(0));
+            EXPECT_EQ(middleSize, sizingImage->GetResidentSizeInBytes(1));
+            EXPECT_EQ(tailSize, sizingImage->GetResidentSizeInBytes(2));
+        }
+
+        // Room for one image with all its mips next to one with only its tail, but not for a second image with more than its tail.
+        const size_t budgetInBytes = fullSize + tailSize + (middleSize - tailSize) / 2;
+        Data::Instance<RPI::StreamingImagePool> pool = RPI::StreamingImagePool::FindOrCreate(BuildImagePoolAsset(budgetInBytes));
+        const auto* controller = azrtti_cast<const RPI::DefaultStreamingImageController*>(pool->GetController());
+        ASSERT_NE(nullptr, controller);
+
+        Data::Asset<RPI::StreamingImageAsset> imageAssetA = BuildTestImage(pool->GetAssetId());
+        Data::Asset<RPI::StreamingImageAsset> imageAssetB = BuildTestImage(pool->GetAssetId());
+        Data::Instance<RPI::StreamingImage> imageA = RPI::StreamingImage::FindOrCreate(imageAssetA);
+        Data::Instance<RPI::StreamingImage> imageB = RPI::StreamingImage::FindOrCreate(imageAssetB);
+        const uint16_t tailMipLevel = static_cast<uint16_t>(imageAssetA->GetMipLevel(2));
+
+        auto imageSystem = RPI::ImageSystemInterface::Get();
+
+        // Both images are visible, A the closest. A gets all its mips, B's request doesn't fit next to it.
+        imageA->SetTargetMip(0);
+        imageB->SetTargetMip(1);
+        imageSystem->Update();
+        EXPECT_EQ(0, imageA->GetResidentMipLevel());
+        EXPECT_EQ(tailMipLevel, imageB->GetResidentMipLevel());
+        EXPECT_EQ(2u, controller->GetStatistics().m_imageCount);
+        EXPECT_EQ(2u, controller->GetStatistics().m_requestedImageCount);
+        EXPECT_EQ(1u, controller->GetStatistics().m_expandedImageCount);
+        EXPECT_EQ(1u, controller->GetStatistics().m_deferredImageCount);
+        EXPECT_EQ(0u, controller->GetStatistics().m_trimmedImageCount);
+        EXPECT_EQ(fullSize + tailSize, controller->GetStatistics().m_memoryUsageInBytes);
+        EXPECT_EQ(budgetInBytes, controller->GetStatistics().m_memoryBudgetInBytes);
+
+        // Only B is visible now, so A is trimmed to make room for it.
+        imageB->SetTargetMip(0);
+        imageSystem->Update();
+        EXPECT_EQ(tailMipLevel, imageA->GetResidentMipLevel());
+        EXPECT_EQ(0, imageB->GetResidentMipLevel());
+        EXPECT_EQ(1u, controller->GetStatistics().m_trimmedImageCount);
+        EXPECT_EQ(1u, controller->GetStatistics().m_expandedImageCount);
+        EXPECT_EQ(0u, controller->GetStatistics().m_deferredImageCount);
+        EXPECT_EQ(fullSize + tailSize, controller->GetStatistics().m_memoryUsageInBytes);
+
+        // Without requests nothing is trimmed or expanded, there is no pressure on the budget.
+        imageSystem->Update();
+        EXPECT_EQ(tailMipLevel, imageA->GetResidentMipLevel());
+        EXPECT_EQ(0, imageB->GetResidentMipLevel());
+        EXPECT_EQ(0u, controller->GetStatistics().m_requestedImageCount);
+        EXPECT_EQ(0u, controller->GetStatistics().m_trimmedImageCount);
+        EXPECT_EQ(0u, controller->GetStatistics().m_expandedImageCount);
+    }
+
+    TEST_F(StreamingImageTests, DefaultController_BudgetFullWhenImageIsAttached_LeastRecentlyUsedImageIsTrimmedForInitialExpand)
+    {
+        using namespace AZ;
+
+        // Sizes of the test image, see DefaultController_RequestedMipsExceedBudget_LeastRecentlyUsedImagesAreTrimmed
+        const size_t fullSize = 43680;
+        const size_t tailSize = 672;
+
+        // Room for one image with all its mips next to one with only its tail.
+        const size_t budgetInBytes = fullSize + tailSize;
+        Data::Instance<RPI::StreamingImagePool> pool = RPI::StreamingImagePool::FindOrCreate(BuildImagePoolAsset(budgetInBytes));
+        const auto* controller = azrtti_cast<const RPI::DefaultStreamingImageController*>(pool->GetController());
+        ASSERT_NE(nullptr, controller);
+
+        auto imageSystem = RPI::ImageSystemInterface::Get();
+
+        // A takes all the budget but its tail.
+        Data::Asset<RPI::StreamingImageAsset> imageAssetA = BuildTestImage(pool->GetAssetId());
+        Data::Instance<RPI::StreamingImage> imageA = RPI::StreamingImage::FindOrCreate(imageAssetA);
+        const uint16_t tailMipLevel = static_cast<uint16_t>(imageAssetA->GetMipLevel(2));
+        imageA->SetTargetMip(0);
+        imageSystem->Update();
+        EXPECT_EQ(0, imageA->GetResidentMipLevel());
+
+        // B is attached while nobody uses A anymore. B has to get its initial expansion, so A is trimmed to make room.
+        Data::Instance<RPI::StreamingImage> imageB = RPI::StreamingImage::FindOrCreate(BuildTestImage(pool->GetAssetId()));
+        imageSystem->Update();
+        EXPECT_EQ(tailMipLevel, imageA->GetResidentMipLevel());
+        EXPECT_EQ(0, imageB->GetResidentMipLevel());
+        EXPECT_EQ(0u, controller->GetStatistics().m_requestedImageCount);
+        EXPECT_EQ(1u, controller->GetStatistics().m_trimmedImageCount);
+        EXPECT_EQ(1u, controller->GetStatistics().m_expandedImageCount);
+        EXPECT_EQ(0u, controller->GetStatistics().m_deferredImageCount);
+        EXPECT_EQ(fullSize + tailSize, controller->GetStatistics().m_memoryUsageInBytes);
+    }
+
+    TEST_F(StreamingImageTests, SetTargetMipForScreenSize_ImageSpansScreenSize_ExpandsToMatchingMip)
+    {
+        using namespace AZ;
+
+        Data::Instance<RPI::StreamingImagePool> pool = RPI::StreamingImagePool::FindOrCreate(BuildImagePoolAsset(1024 * 1024));
+        Data::Asset<RPI::StreamingImageAsset> imageAsset = BuildTestImage(pool->GetAssetId());
+        Data::Instance<RPI::StreamingImage> image = RPI::StreamingImage::FindOrCreate(imageAsset);
+        const uint16_t tailMipLevel = static_cast<uint16_t>(imageAsset->GetMipLevel(2));
+
+        auto imageSystem = RPI::ImageSystemInterface::Get();
+
+        // The image is 64x64. The mips of the tail are less detailed than 4 pixels need, so only the tail stays resident.
+        image->SetTargetMip(tailMipLevel);
+        imageSystem->Update();
+        ASSERT_EQ(tailMipLevel, image->GetResidentMipLevel());
+
+        image->SetTargetMipForScreenSize(4.0f);
+        imageSystem->Update();
+        EXPECT_EQ(tailMipLevel, image->GetResidentMipLevel());
+
+        // 20 pixels need the 32x32 mip, which is the first mip of the middle mip chain.
+        image->SetTargetMipForScreenSize(20.0f);
+        imageSystem->Update();
+        EXPECT_EQ(imageAsset->GetMipLevel(1), image->GetResidentMipLevel());
+
+        // Anything larger than the image needs its most detailed mip.
+        image->SetTargetMipForScreenSize(500.0f);
+        imageSystem->Update();
+        EXPECT_EQ(0, image->GetResidentMipLevel());
+    }
 }
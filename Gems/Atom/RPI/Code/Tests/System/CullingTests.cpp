@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/View.h>
+
+#include <Atom/RHI/DrawPacketBuilder.h>
+#include <Atom/RHI/RHISystemInterface.h>
+
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzFramework/Visibility/OctreeSystemComponent.h>
+
+#include <AzTest/AzTest.h>
+
+#include <Common/RPITestFixture.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    class CullingTests
+        : public RPITestFixture
+    {
+    protected:
+        static constexpr uint32_t LodCount = 3;
+
+        void SetUp() override
+        {
+            RPITestFixture::SetUp();
+
+            m_octreeSystemComponent = new AzFramework::OctreeSystemComponent;
+
+            m_scene = Scene::CreateScene(SceneDescriptor());
+            m_scene->Activate();
+
+            m_drawListTag = RHI::RHISystemInterface::Get()->GetDrawListTagRegistry()->AcquireTag(AZ::Name("cullingTest"));
+            m_drawListMask.set(m_drawListTag.GetIndex());
+
+            // Every lod has a single draw packet and the lods cover all screen coverages, so each visible cullable adds one draw packet
+            const float screenCoverageMin[LodCount] = { 0.1f, 0.01f, 0.0f };
+            const float screenCoverageMax[LodCount] = { AZStd::numeric_limits<float>::max(), 0.1f, 0.01f };
+            RHI::DrawPacketBuilder builder;
+            for (uint32_t lodIndex = 0; lodIndex < LodCount; ++lodIndex)
+            {
+                builder.Begin(nullptr);
+                RHI::DrawPacketBuilder::DrawRequest drawRequest;
+                drawRequest.m_listTag = m_drawListTag;
+                builder.AddDrawItem(drawRequest);
+                m_drawPackets.emplace_back(builder.End());
+
+                Cullable::LodData::Lod lod;
+                lod.m_screenCoverageMin = screenCoverageMin[lodIndex];
+                lod.m_screenCoverageMax = screenCoverageMax[lodIndex];
+                lod.m_drawPackets.push_back(m_drawPackets.back().get());
+                m_lods.push_back(AZStd::move(lod));
+            }
+        }
+
+        void TearDown() override
+        {
+            for (Cullable& cullable : m_cullables)
+            {
+                m_scene->GetCullingScene()->UnregisterCullable(cullable);
+            }
+            m_cullables = {};
+            m_lods = {};
+            m_drawPackets = {};
+
+            RHI::RHISystemInterface::Get()->GetDrawListTagRegistry()->ReleaseTag(m_drawListTag);
+
+            m_scene = nullptr;
+            delete m_octreeSystemComponent;
+
+            RPITestFixture::TearDown();
+        }
+
+        //! Fills the scene with randomly placed cullables in a cube centered on the origin. Every tenth cullable is hidden.
+        void CreateCullables(size_t count, float halfExtent)
+        {
+            AZ::SimpleLcgRandom random(1234);
+
+            // The visibility entries point back at the cullables, so the vector can't grow once they're registered
+            m_cullables.reserve(count);
+            for (size_t index = 0; index < count; ++index)
+            {
+                const Vector3 center = (Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()) * 2.0f - Vector3(1.0f)) * halfExtent;
+                const float radius = 0.5f + random.GetRandomFloat();
+                const Aabb aabb = Aabb::CreateCenterRadius(center, radius);
+
+                Cullable& cullable = m_cullables.emplace_back();
+                cullable.m_cullData.m_boundingSphere = Sphere(center, radius);
+                cullable.m_cullData.m_boundingObb = Obb::CreateFromAabb(aabb);
+                cullable.m_cullData.m_drawListMask.set();
+                cullable.m_cullData.m_scene = m_scene.get();
+                cullable.m_cullData.m_visibilityEntry.m_boundingVolume = aabb;
+                cullable.m_cullData.m_visibilityEntry.m_userData = &cullable;
+                cullable.m_cullData.m_visibilityEntry.m_typeFlags = AzFramework::VisibilityEntry::TYPE_RPI_Cullable;
+                cullable.m_lodData.m_lods = m_lods;
+                cullable.m_lodData.m_lodSelectionRadius = radius;
+                cullable.m_isHidden = (index % 10) == 0;
+
+                m_scene->GetCullingScene()->RegisterOrUpdateCullable(cullable);
+            }
+        }
+
+        //! Creates up to six views at the origin, looking along the positive and negative world axes.
+        AZStd::vector<ViewPtr> CreateViews(size_t count)
+        {
+            const Matrix3x4 rotations[] =
+            {
+                Matrix3x4::CreateIdentity(),
+                Matrix3x4::CreateRotationZ(Constants::HalfPi),
+                Matrix3x4::CreateRotationZ(Constants::Pi),
+                Matrix3x4::CreateRotationZ(-Constants::HalfPi),
+                Matrix3x4::CreateRotationX(Constants::HalfPi),
+                Matrix3x4::CreateRotationX(-Constants::HalfPi)
+            };
+
+            AZStd::vector<ViewPtr> views;
+            for (size_t index = 0; index < AZStd::min(count, AZ_ARRAY_SIZE(rotations)); ++index)
+            {
+                ViewPtr view = View::CreateView(AZ::Name(AZStd::string::format("CullingTestView%zu", index)), View::UsageCamera);
+                view->SetDrawListMask(m_drawListMask);
+                view->SetCameraTransform(rotations[index]);
+                views.push_back(AZStd::move(view));
+            }
+            return views;
+        }
+
+        //! Culls the scene against the views the same way Scene::PrepareRender() does, with one ProcessCullables() job per view.
+        void Cull(const AZStd::vector<ViewPtr>& views)
+        {
+            CullingScene* cullingScene = m_scene->GetCullingScene();
+            cullingScene->BeginCulling(views);
+
+            AZ::JobCompletion completion;
+            for (const ViewPtr& view : views)
+            {
+                AZ::Job* processCullablesJob = AZ::CreateJobFunction([cullingScene, scene = m_scene.get(), view = view.get()](AZ::Job& thisJob)
+                    {
+                        cullingScene->ProcessCullables(*scene, *view, thisJob);
+                    },
+                    true, nullptr); //auto-deletes
+                processCullablesJob->SetDependent(&completion);
+                processCullablesJob->Start();
+            }
+            completion.StartAndWaitForCompletion();
+
+            cullingScene->EndCulling();
+        }
+
+        //! Discards the draw items that were added to the views' draw lists.
+        void ResetDrawLists(const AZStd::vector<ViewPtr>& views)
+        {
+            for (const ViewPtr& view : views)
+            {
+                view->SetDrawListMask(m_drawListMask);
+            }
+        }
+
+        //! The same visibility test the culling jobs do, done for each cullable individually.
+        bool IsVisible(const Cullable& cullable, const View& view) const
+        {
+            const Frustum frustum = Frustum::CreateFromMatrixColumnMajor(view.GetWorldToClipMatrix());
+            if (cullable.m_isHidden)
+            {
+                return false;
+            }
+            const IntersectResult result = ShapeIntersection::Classify(frustum, cullable.m_cullData.m_boundingSphere);
+            return result == IntersectResult::Interior ||
+                (result == IntersectResult::Overlaps && ShapeIntersection::Overlaps(frustum, cullable.m_cullData.m_boundingObb));
+        }
+
+        AzFramework::OctreeSystemComponent* m_octreeSystemComponent = nullptr;
+        ScenePtr m_scene;
+        RHI::DrawListTag m_drawListTag;
+        RHI::DrawListMask m_drawListMask;
+        AZStd::vector<AZStd::unique_ptr<const RHI::DrawPacket>> m_drawPackets;
+        AZStd::vector<Cullable::LodData::Lod> m_lods;
+        AZStd::vector<Cullable> m_cullables;
+    };
+
+    TEST_F(CullingTests, ProcessCullables_MultipleViews_MatchesPerCullableVisibility)
+    {
+        CreateCullables(20000, 200.0f);
+        AZStd::vector<ViewPtr> views = CreateViews(6);
+
+        CullingScene* cullingScene = m_scene->GetCullingScene();
+        cullingScene->GetDebugContext().m_enableStats = true;
+        Cull(views);
+
+        AZStd::vector<bool> expectedVisible(m_cullables.size(), false);
+        for (const ViewPtr& view : views)
+        {
+            uint32_t expectedVisibleCount = 0;
+            for (size_t index = 0; index < m_cullables.size(); ++index)
+            {
+                if (IsVisible(m_cullables[index], *view))
+                {
+                    ++expectedVisibleCount;
+                    expectedVisible[index] = true;
+                }
+            }
+
+            const CullingDebugContext::CullStats& cullStats = cullingScene->GetDebugContext().GetCullStatsForView(view.get());
+            EXPECT_GT(expectedVisibleCount, 0u);
+            EXPECT_EQ(expectedVisibleCount, cullStats.m_numVisibleCullables.load());
+            EXPECT_EQ(expectedVisibleCount, cullStats.m_numVisibleDrawPackets.load());
+            EXPECT_GT(cullStats.m_numJobs.load(), 0u);
+        }
+
+        for (size_t index = 0; index < m_cullables.size(); ++index)
+        {
+            EXPECT_EQ(expectedVisible[index], m_cullables[index].m_isVisible);
+        }
+
+        cullingScene->GetDebugContext().m_enableStats = false;
+        ResetDrawLists(views);
+    }
+
+    TEST_F(CullingTests, ProcessCullables_LodOverride_AddsOverriddenLodOnly)
+    {
+        CreateCullables(1000, 50.0f);
+        AZStd::vector<ViewPtr> views = CreateViews(1);
+
+        for (Cullable& cullable : m_cullables)
+        {
+            cullable.m_lodData.m_lodOverride = LodCount - 1;
+
+            // Add an extra draw packet to the overridden lod so it can be told apart from the lods that would be selected
+            cullable.m_lodData.m_lods.back().m_drawPackets.push_back(m_drawPackets.back().get());
+        }
+
+        CullingScene* cullingScene = m_scene->GetCullingScene();
+        cullingScene->GetDebugContext().m_enableStats = true;
+        Cull(views);
+
+        const CullingDebugContext::CullStats& cullStats = cullingScene->GetDebugContext().GetCullStatsForView(views[0].get());
+        EXPECT_GT(cullStats.m_numVisibleCullables.load(), 0u);
+        EXPECT_EQ(cullStats.m_numVisibleCullables * 2, cullStats.m_numVisibleDrawPackets.load());
+
+        cullingScene->GetDebugContext().m_enableStats = false;
+        ResetDrawLists(views);
+    }
+
+#if defined(HAVE_BENCHMARK)
+    //! Gives the benchmark access to the scene setup of the CullingTests fixture.
+    class CullingBenchmarkEnvironment
+        : public CullingTests
+    {
+    public:
+        using CullingTests::SetUp;
+        using CullingTests::TearDown;
+        using CullingTests::CreateCullables;
+        using CullingTests::CreateViews;
+        using CullingTests::Cull;
+        using CullingTests::ResetDrawLists;
+
+        void TestBody() override {}
+    };
+
+    //! Culls 1M cullables against 6 views with the stub RHI. The benchmark argument is the number of job worker threads,
+    //! so comparing the runs shows how culling scales with the core count.
+    class CullingBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        static constexpr size_t CullableCount = 1000000;
+        static constexpr size_t ViewCount = 6;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            m_environment.reset(new CullingBenchmarkEnvironment());
+            m_environment->SetUp();
+            m_environment->CreateCullables(CullableCount, 1000.0f);
+            m_views = m_environment->CreateViews(ViewCount);
+
+            AZ::JobManagerDesc jobManagerDesc;
+            for (int64_t worker = 0; worker < state.range(0); ++worker)
+            {
+                jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+
+            // The culling jobs are created in the global context, so temporarily replace the one created by the test fixture
+            m_priorJobContext = AZ::JobContext::GetGlobalContext();
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+        }
+
+        void TearDown([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            AZ::JobContext::SetGlobalContext(m_priorJobContext);
+            m_jobContext = nullptr;
+            m_jobManager = nullptr;
+
+            m_environment->ResetDrawLists(m_views);
+            m_views = {};
+            m_environment->TearDown();
+            m_environment.reset();
+        }
+
+    protected:
+        AZStd::unique_ptr<CullingBenchmarkEnvironment> m_environment;
+        AZStd::vector<ViewPtr> m_views;
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+        AZ::JobContext* m_priorJobContext = nullptr;
+    };
+
+    BENCHMARK_DEFINE_F(CullingBenchmarkFixture, BM_ProcessCullables)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_environment->Cull(m_views);
+
+            state.PauseTiming();
+            m_environment->ResetDrawLists(m_views);
+            state.ResumeTiming();
+        }
+
+        state.counters["WorkerThreads"] = static_cast<double>(state.range(0));
+        state.SetItemsProcessed(state.iterations() * CullableCount * ViewCount);
+    }
+
+    BENCHMARK_REGISTER_F(CullingBenchmarkFixture, BM_ProcessCullables)
+        ->RangeMultiplier(2)
+        ->Range(1, 32)
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+#endif
+} // namespace UnitTest
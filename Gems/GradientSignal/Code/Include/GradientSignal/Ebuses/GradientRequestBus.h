@@ -10,6 +10,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace GradientSignal
 {
@@ -49,6 +50,26 @@ namespace GradientSignal
         */
         virtual float GetValue(const GradientSampleParams& sampleParams) const = 0;
 
+        /**
+        * Given a list of positions, generate values for all of them. This has the same thread-safety requirements as GetValue().
+        * The default implementation calls GetValue() once per position. Gradients should override it to process the whole
+        * batch at once, which avoids paying for an EBus dispatch per position through each link of a gradient chain.
+        * @param positions The input list of positions to query.
+        * @param outValues The output list of values. This list is expected to be the same size as the positions list.
+        */
+        virtual void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+        {
+            AZ_Assert(positions.size() == outValues.size(), "input and output lists are different sizes (%zu vs %zu).",
+                positions.size(), outValues.size());
+
+            GradientSampleParams sampleParams;
+            for (size_t index = 0; index < positions.size(); index++)
+            {
+                sampleParams.m_position = positions[index];
+                outValues[index] = GetValue(sampleParams);
+            }
+        }
+
         /**
         * Call to check the hierarchy to see if a given entityId exists in the gradient signal chain
         */
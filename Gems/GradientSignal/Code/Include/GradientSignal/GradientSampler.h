@@ -33,6 +33,9 @@ namespace GradientSignal
 
         inline float GetValue(const GradientSampleParams& sampleParams) const;
 
+        //! Batched version of GetValue. outValues is expected to be the same size as positions.
+        inline void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const;
+
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const;
 
         AZ::EntityId m_gradientId;
@@ -146,4 +149,75 @@ namespace GradientSignal
 
         return output * m_opacity;
     }
+
+    inline void GradientSampler::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZ_Assert(positions.size() == outValues.size(), "input and output lists are different sizes (%zu vs %zu).",
+            positions.size(), outValues.size());
+
+        // Anything that doesn't get written below (no gradient, no handler, cyclic reference) should produce 0.
+        AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+
+        if (m_opacity <= 0.0f || !m_gradientId.IsValid())
+        {
+            return;
+        }
+
+        //apply transform if set
+        AZStd::vector<AZ::Vector3> transformedPositions;
+        const bool useTransform = m_enableTransform && GradientSamplerUtil::AreTransformParamsSet(*this);
+        if (useTransform)
+        {
+            AZ::Matrix3x4 matrix3x4;
+            matrix3x4.SetFromEulerDegrees(m_rotate);
+            matrix3x4.MultiplyByScale(m_scale);
+            matrix3x4.SetTranslation(m_translate);
+
+            transformedPositions.reserve(positions.size());
+            for (const auto& position : positions)
+            {
+                transformedPositions.emplace_back(matrix3x4 * position);
+            }
+        }
+
+        {
+            // Block other threads from accessing the surface data bus while we are in GetValues, see GetValue() for details.
+            auto& surfaceDataContext = SurfaceData::SurfaceDataSystemRequestBus::GetOrCreateContext(false);
+            typename SurfaceData::SurfaceDataSystemRequestBus::Context::DispatchLockGuard scopeLock(surfaceDataContext.m_contextMutex);
+
+            if (m_isRequestInProgress)
+            {
+                AZ_ErrorOnce("GradientSignal", !m_isRequestInProgress, "Detected cyclic dependences with gradient entity references");
+                return;
+            }
+
+            m_isRequestInProgress = true;
+
+            GradientRequestBus::Event(m_gradientId, &GradientRequestBus::Events::GetValues,
+                useTransform ? transformedPositions : positions, outValues);
+
+            if (m_invertInput)
+            {
+                for (float& value : outValues)
+                {
+                    value = 1.0f - value;
+                }
+            }
+
+            //apply levels if set
+            if (m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this))
+            {
+                GetLevels(outValues, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
+            }
+
+            m_isRequestInProgress = false;
+        }
+
+        if (m_opacity != 1.0f)
+        {
+            ScaleValues(outValues, m_opacity);
+        }
+    }
 }
@@ -8,6 +8,9 @@
 #pragma once
 
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Math/Vector3.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/SystemAllocator.h>
 
@@ -32,6 +35,12 @@ namespace GradientSignal
         */
         float GenerateOctaveNoise(float x, float y, float z, int octaves, float persistence, float initialFrequency = 1.0f);
 
+        /**
+        * Batched version of GenerateOctaveNoise that evaluates four positions at a time with SIMD.
+        * outValues is expected to be the same size as positions.
+        */
+        void GenerateOctaveNoise(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues, int octaves, float persistence, float initialFrequency = 1.0f);
+
         /**
         * Creates a Perlin noise factor value based on a position
         */
@@ -40,6 +49,11 @@ namespace GradientSignal
     protected:
         void PrepareTable(int seed);
 
+        /**
+        * Creates Perlin noise factor values for four positions at once
+        */
+        AZ::Simd::Vec4::FloatType GenerateNoise(AZ::Simd::Vec4::FloatArgType x, AZ::Simd::Vec4::FloatArgType y, AZ::Simd::Vec4::FloatArgType z);
+
     private:
         AZStd::array<int, 512> m_permutationTable;
     };
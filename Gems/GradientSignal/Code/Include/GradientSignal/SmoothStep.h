@@ -27,6 +27,9 @@ namespace GradientSignal
 
         inline float GetSmoothedValue(float inputValue) const;
 
+        //! Batched version of GetSmoothedValue that processes the list of values in place.
+        void GetSmoothedValues(AZStd::vector<float>& inOutValues) const;
+
         float m_falloffMidpoint = 0.5f;
         float m_falloffRange = 0.5f;
         float m_falloffStrength = 0.25f;
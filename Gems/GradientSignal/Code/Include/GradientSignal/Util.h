@@ -12,6 +12,8 @@
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/Math/Matrix3x4.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/containers/vector.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 
 namespace LmbrCentral
@@ -120,4 +122,87 @@ namespace GradientSignal
 
         return AZ::Lerp(outputMin, outputMax, inputCorrected);
     }
+
+    //////////////////////////////////////////////////////////////////////////
+    // SIMD variants of the helpers above. Each one processes four values at once and
+    // produces the same results as calling the scalar version on each value.
+
+    inline AZ::Simd::Vec4::FloatType GetRatio(float a, float b, AZ::Simd::Vec4::FloatArgType t)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        if (a == b)
+        {
+            return Vec4::Select(Vec4::ZeroFloat(), Vec4::Splat(1.0f), Vec4::CmpLtEq(t, Vec4::Splat(a)));
+        }
+
+        return Vec4::Clamp(Vec4::Div(Vec4::Sub(t, Vec4::Splat(a)), Vec4::Splat(b - a)), Vec4::ZeroFloat(), Vec4::Splat(1.0f));
+    }
+
+    inline AZ::Simd::Vec4::FloatType GetSmoothStep(AZ::Simd::Vec4::FloatArgType t)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        return Vec4::Mul(Vec4::Mul(t, t), Vec4::Sub(Vec4::Splat(3.0f), Vec4::Mul(Vec4::Splat(2.0f), t)));
+    }
+
+    inline AZ::Simd::Vec4::FloatType GetLevels(AZ::Simd::Vec4::FloatArgType input, float inputMid, float inputMin, float inputMax, float outputMin, float outputMax)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+
+        const Vec4::FloatType clampedInput = Vec4::Clamp(input, zero, one);
+        inputMid = AZ::GetClamp(inputMid, 0.01f, 10.0f);
+        inputMin = AZ::GetClamp(inputMin, 0.0f, 1.0f);
+        inputMax = AZ::GetClamp(inputMax, 0.0f, 1.0f);
+        outputMin = AZ::GetClamp(outputMin, 0.0f, 1.0f);
+        outputMax = AZ::GetClamp(outputMax, 0.0f, 1.0f);
+
+        Vec4::FloatType inputCorrected;
+        if (inputMin == inputMax)
+        {
+            inputCorrected = Vec4::Select(zero, one, Vec4::CmpLtEq(clampedInput, Vec4::Splat(inputMin)));
+        }
+        else
+        {
+            inputCorrected = Vec4::Min(
+                Vec4::Div(Vec4::Max(Vec4::Sub(clampedInput, Vec4::Splat(inputMin)), zero), Vec4::Splat(inputMax - inputMin)), one);
+
+            // There's no vectorized pow, so only pay for the per-lane powf when the midpoint actually changes the curve.
+            if (inputMid != 1.0f)
+            {
+                float values[4];
+                Vec4::StoreUnaligned(values, inputCorrected);
+                for (float& value : values)
+                {
+                    value = powf(value, 1.0f / inputMid);
+                }
+                inputCorrected = Vec4::LoadUnaligned(values);
+            }
+        }
+
+        return Vec4::Madd(Vec4::Splat(outputMax - outputMin), inputCorrected, Vec4::Splat(outputMin));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Batched helpers that process a whole list of gradient values in place.
+
+    //! Clamps every value to [min, max].
+    void ClampValues(AZStd::vector<float>& inOutValues, float min, float max);
+
+    //! Replaces every value with 1 - clamp(value, 0, 1).
+    void InvertValues(AZStd::vector<float>& inOutValues);
+
+    //! Replaces every value with 0 if it is <= threshold, or 1 otherwise.
+    void ThresholdValues(AZStd::vector<float>& inOutValues, float threshold);
+
+    //! Multiplies every value by scale.
+    void ScaleValues(AZStd::vector<float>& inOutValues, float scale);
+
+    //! Applies GetRatio(a, b, value) to every value.
+    void GetRatio(AZStd::vector<float>& inOutValues, float a, float b);
+
+    //! Applies GetLevels() to every value.
+    void GetLevels(AZStd::vector<float>& inOutValues, float inputMid, float inputMin, float inputMax, float outputMin, float outputMax);
 } // namespace GradientSignal
@@ -134,6 +134,14 @@ namespace GradientSignal
         return m_configuration.m_value;
     }
 
+    void ConstantGradientComponent::GetValues([[maybe_unused]] const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_Assert(positions.size() == outValues.size(), "input and output lists are different sizes (%zu vs %zu).",
+            positions.size(), outValues.size());
+
+        AZStd::fill(outValues.begin(), outValues.end(), m_configuration.m_value);
+    }
+
     float ConstantGradientComponent::GetConstantValue() const
     {
         return m_configuration.m_value;
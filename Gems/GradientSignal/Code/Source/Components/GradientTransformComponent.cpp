@@ -328,6 +328,30 @@ namespace GradientSignal
 
         AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
 
+        TransformPositionToUVWUnlocked(inPosition, outUVW, shouldNormalizeOutput, wasPointRejected);
+    }
+
+    void GradientTransformComponent::TransformPositionsToUVW(const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<AZ::Vector3>& outUVW,
+        const bool shouldNormalizeOutput, AZStd::vector<bool>& wasPointRejected) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZ_Assert(inPositions.size() == outUVW.size() && inPositions.size() == wasPointRejected.size(),
+            "input and output lists are different sizes.");
+
+        // Lock once for the whole batch instead of once per position.
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        for (size_t index = 0; index < inPositions.size(); index++)
+        {
+            bool rejected = false;
+            TransformPositionToUVWUnlocked(inPositions[index], outUVW[index], shouldNormalizeOutput, rejected);
+            wasPointRejected[index] = rejected;
+        }
+    }
+
+    void GradientTransformComponent::TransformPositionToUVWUnlocked(const AZ::Vector3& inPosition, AZ::Vector3& outUVW, const bool shouldNormalizeOutput, bool& wasPointRejected) const
+    {
         //transforming coordinate into "local" relative space of shape bounds
         outUVW = m_shapeTransformInverse * inPosition;
 
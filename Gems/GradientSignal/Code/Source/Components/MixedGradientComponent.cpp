@@ -255,13 +255,60 @@ namespace GradientSignal
         return false;
     }
 
+    namespace MixedGradientDetails
+    {
+        // Combines a single layer value with the accumulated result of the previous layers.
+        AZ_FORCE_INLINE float MixLayer(MixedGradientLayer::MixingOperation operation, float opacity, float result, float current)
+        {
+            float operationResult = 0.0f;
+
+            // unpremultiplied alpha (we clamp the end result)
+            const float currentUnpremultiplied = current / opacity;
+            switch (operation)
+            {
+            default:
+            case MixedGradientLayer::MixingOperation::Initialize:
+                //reset the result of the mixed/combined layers to the current value
+                result = 0.0f;
+                operationResult = currentUnpremultiplied;
+                break;
+            case MixedGradientLayer::MixingOperation::Multiply:
+                operationResult = result * currentUnpremultiplied;
+                break;
+            case MixedGradientLayer::MixingOperation::Add:
+                operationResult = result + currentUnpremultiplied;
+                break;
+            case MixedGradientLayer::MixingOperation::Subtract:
+                operationResult = result - currentUnpremultiplied;
+                break;
+            case MixedGradientLayer::MixingOperation::Min:
+                operationResult = AZStd::min(currentUnpremultiplied, result);
+                break;
+            case MixedGradientLayer::MixingOperation::Max:
+                operationResult = AZStd::max(currentUnpremultiplied, result);
+                break;
+            case MixedGradientLayer::MixingOperation::Average:
+                operationResult = (result + currentUnpremultiplied) / 2.0f;
+                break;
+            case MixedGradientLayer::MixingOperation::Normal:
+                operationResult = currentUnpremultiplied;
+                break;
+            case MixedGradientLayer::MixingOperation::Overlay:
+                operationResult = (result >= 0.5f) ? (1.0f - (2.0f * (1.0f - result) * (1.0f - currentUnpremultiplied))) : (2.0f * result * currentUnpremultiplied);
+                break;
+            }
+
+            // blend layers (re-applying opacity, which is why we needed to use unpremultiplied)
+            return (result * (1.0f - opacity)) + (operationResult * opacity);
+        }
+    }
+
     float MixedGradientComponent::GetValue(const GradientSampleParams& sampleParams) const
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
 
         //accumulate the mixed/combined result of all layers and operations
         float result = 0.0f;
-        float operationResult = 0.0f;
 
         for (const auto& layer : m_configuration.m_layers)
         {
@@ -269,48 +316,41 @@ namespace GradientSignal
             if (layer.m_enabled && layer.m_gradientSampler.m_opacity != 0.0f)
             {
                 // this includes leveling and opacity result, we need unpremultiplied opacity to combine properly
-                float current = layer.m_gradientSampler.GetValue(sampleParams);
-                // unpremultiplied alpha (we clamp the end result)
-                float currentUnpremultiplied = current / layer.m_gradientSampler.m_opacity;
-                switch (layer.m_operation)
+                const float current = layer.m_gradientSampler.GetValue(sampleParams);
+                result = MixedGradientDetails::MixLayer(layer.m_operation, layer.m_gradientSampler.m_opacity, result, current);
+            }
+        }
+
+        return AZ::GetClamp(result, 0.0f, 1.0f);
+    }
+
+    void MixedGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZ_Assert(positions.size() == outValues.size(), "input and output lists are different sizes (%zu vs %zu).",
+            positions.size(), outValues.size());
+
+        //accumulate the mixed/combined result of all layers and operations
+        AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+        AZStd::vector<float> layerValues(positions.size());
+
+        for (const auto& layer : m_configuration.m_layers)
+        {
+            // added check to prevent opacity of 0.0, which will bust when we unpremultiply the alpha out
+            if (layer.m_enabled && layer.m_gradientSampler.m_opacity != 0.0f)
+            {
+                // this includes leveling and opacity result, we need unpremultiplied opacity to combine properly
+                layer.m_gradientSampler.GetValues(positions, layerValues);
+                for (size_t index = 0; index < outValues.size(); index++)
                 {
-                default:
-                case MixedGradientLayer::MixingOperation::Initialize:
-                    //reset the result of the mixed/combined layers to the current value
-                    result = 0.0f;
-                    operationResult = currentUnpremultiplied;
-                    break;
-                case MixedGradientLayer::MixingOperation::Multiply:
-                    operationResult = result * currentUnpremultiplied;
-                    break;
-                case MixedGradientLayer::MixingOperation::Add:
-                    operationResult = result + currentUnpremultiplied;
-                    break;
-                case MixedGradientLayer::MixingOperation::Subtract:
-                    operationResult = result - currentUnpremultiplied;
-                    break;
-                case MixedGradientLayer::MixingOperation::Min:
-                    operationResult = AZStd::min(currentUnpremultiplied, result);
-                    break;
-                case MixedGradientLayer::MixingOperation::Max:
-                    operationResult = AZStd::max(currentUnpremultiplied, result);
-                    break;
-                case MixedGradientLayer::MixingOperation::Average:
-                    operationResult = (result + currentUnpremultiplied) / 2.0f;
-                    break;
-                case MixedGradientLayer::MixingOperation::Normal:
-                    operationResult = currentUnpremultiplied;
-                    break;
-                case MixedGradientLayer::MixingOperation::Overlay:
-                    operationResult = (result >= 0.5f) ? (1.0f - (2.0f * (1.0f - result) * (1.0f - currentUnpremultiplied))) : (2.0f * result * currentUnpremultiplied);
-                    break;
+                    outValues[index] = MixedGradientDetails::MixLayer(
+                        layer.m_operation, layer.m_gradientSampler.m_opacity, outValues[index], layerValues[index]);
                 }
-                // blend layers (re-applying opacity, which is why we needed to use unpremultiplied)
-                result = (result * (1.0f - layer.m_gradientSampler.m_opacity)) + (operationResult * layer.m_gradientSampler.m_opacity);
             }
         }
 
-        return AZ::GetClamp(result, 0.0f, 1.0f);
+        ClampValues(outValues, 0.0f, 1.0f);
     }
 
     bool MixedGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
@@ -181,6 +181,61 @@ namespace GradientSignal
         return AZ::GetClamp(output, 0.0f, 1.0f);
     }
 
+    void PosterizeGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        m_configuration.m_gradientSampler.GetValues(positions, outValues);
+
+        const float bands = AZ::GetMax(static_cast<float>(m_configuration.m_bands), 2.0f);
+
+        // Every mode produces (band + offset) / divisor, so pick those once for the whole batch.
+        // See GetValue() for a description of each mode.
+        float offset = 0.0f;
+        float divisor = bands;
+        switch (m_configuration.m_mode)
+        {
+            default:
+            case PosterizeGradientConfig::ModeType::Floor:
+                break;
+            case PosterizeGradientConfig::ModeType::Round:
+                offset = 0.5f;
+                break;
+            case PosterizeGradientConfig::ModeType::Ceiling:
+                offset = 1.0f;
+                break;
+            case PosterizeGradientConfig::ModeType::Ps:
+                divisor = bands - 1.0f;
+                break;
+        }
+
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        const Vec4::FloatType bandsValue = Vec4::Splat(bands);
+        const Vec4::FloatType maxBand = Vec4::Splat(bands - 1.0f);
+        const Vec4::FloatType offsetValue = Vec4::Splat(offset);
+        const Vec4::FloatType divisorValue = Vec4::Splat(divisor);
+
+        const size_t count = outValues.size();
+        const size_t simdCount = count & ~static_cast<size_t>(3);
+        float* values = outValues.data();
+
+        for (size_t index = 0; index < simdCount; index += 4)
+        {
+            const Vec4::FloatType input = Vec4::Clamp(Vec4::LoadUnaligned(&values[index]), zero, one);
+            const Vec4::FloatType band = Vec4::Clamp(Vec4::Floor(Vec4::Mul(input, bandsValue)), zero, maxBand);
+            const Vec4::FloatType output = Vec4::Div(Vec4::Add(band, offsetValue), divisorValue);
+            Vec4::StoreUnaligned(&values[index], Vec4::Clamp(output, zero, one));
+        }
+
+        for (size_t index = simdCount; index < count; index++)
+        {
+            const float input = AZ::GetClamp(values[index], 0.0f, 1.0f);
+            const float band = AZ::GetClamp(floorf(input * bands), 0.0f, bands - 1.0f);
+            values[index] = AZ::GetClamp((band + offset) / divisor, 0.0f, 1.0f);
+        }
+    }
+
     bool PosterizeGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
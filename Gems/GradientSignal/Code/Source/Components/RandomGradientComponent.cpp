@@ -135,6 +135,24 @@ namespace GradientSignal
         return false;
     }
 
+    namespace RandomGradientDetails
+    {
+        float GetRandomValue(const AZ::Vector3& uvw, AZStd::size_t seed)
+        {
+            //generating stable pseudo-random noise from a position based hash 
+            float x = uvw.GetX();
+            float y = uvw.GetY();
+            AZStd::size_t result = 0;
+
+            AZStd::hash_combine<float>(result, x * seed + y);
+            AZStd::hash_combine<float>(result, y * seed + x);
+            AZStd::hash_combine<float>(result, x * y * seed);
+
+            //always returns [0.0,1.0]
+            return static_cast<float>(result % std::numeric_limits<AZ::u8>::max()) / static_cast<float>(std::numeric_limits<AZ::u8>::max());
+        }
+    }
+
     float RandomGradientComponent::GetValue(const GradientSampleParams& sampleParams) const
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
@@ -148,23 +166,34 @@ namespace GradientSignal
 
         if (!wasPointRejected)
         {
-            //generating stable pseudo-random noise from a position based hash 
-            float x = uvw.GetX();
-            float y = uvw.GetY();
-            AZStd::size_t result = 0;
             const AZStd::size_t seed = m_configuration.m_randomSeed + AZStd::size_t(2); // Add 2 to avoid seeds 0 and 1, which can create strange patterns with this particular algorithm
-
-            AZStd::hash_combine<float>(result, x * seed + y);
-            AZStd::hash_combine<float>(result, y * seed + x);
-            AZStd::hash_combine<float>(result, x * y * seed);
-
-            //always returns [0.0,1.0]
-            return static_cast<float>(result % std::numeric_limits<AZ::u8>::max()) / static_cast<float>(std::numeric_limits<AZ::u8>::max());
+            return RandomGradientDetails::GetRandomValue(uvw, seed);
         }
 
         return 0.0f;
     }
 
+    void RandomGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZ_Assert(positions.size() == outValues.size(), "input and output lists are different sizes (%zu vs %zu).",
+            positions.size(), outValues.size());
+
+        AZStd::vector<AZ::Vector3> uvws(positions);
+        AZStd::vector<bool> wasPointRejected(positions.size(), false);
+        const bool shouldNormalizeOutput = false;
+        GradientTransformRequestBus::Event(
+            GetEntityId(), &GradientTransformRequestBus::Events::TransformPositionsToUVW, positions, uvws, shouldNormalizeOutput, wasPointRejected);
+
+        const AZStd::size_t seed = m_configuration.m_randomSeed + AZStd::size_t(2); // Add 2 to avoid seeds 0 and 1, see GetValue()
+
+        for (size_t index = 0; index < positions.size(); index++)
+        {
+            outValues[index] = wasPointRejected[index] ? 0.0f : RandomGradientDetails::GetRandomValue(uvws[index], seed);
+        }
+    }
+
     int RandomGradientComponent::GetRandomSeed() const
     {
         return m_configuration.m_randomSeed;
@@ -174,6 +174,36 @@ namespace GradientSignal
         return GetRatio(m_configuration.m_falloffWidth, 0.0f, distance);
     }
 
+    void ShapeAreaFalloffGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZ_Assert(positions.size() == outValues.size(), "input and output lists are different sizes (%zu vs %zu).",
+            positions.size(), outValues.size());
+
+        // Gather all of the distances with a single bus dispatch. If there's no shape, every distance stays at 0.
+        AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+        LmbrCentral::ShapeComponentRequestsBus::Event(m_configuration.m_shapeEntityId,
+            [&positions, &outValues](LmbrCentral::ShapeComponentRequests* shape)
+            {
+                for (size_t index = 0; index < positions.size(); index++)
+                {
+                    outValues[index] = shape->DistanceFromPoint(positions[index]);
+                }
+            });
+
+        if (m_configuration.m_falloffWidth == 0.0f)
+        {
+            for (float& value : outValues)
+            {
+                value = (value > 0.0f) ? 0.0f : 1.0f;
+            }
+            return;
+        }
+
+        GetRatio(outValues, m_configuration.m_falloffWidth, 0.0f);
+    }
+
     AZ::EntityId ShapeAreaFalloffGradientComponent::GetShapeEntityId() const
     {
         return m_configuration.m_shapeEntityId;
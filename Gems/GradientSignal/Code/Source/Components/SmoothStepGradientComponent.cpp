@@ -176,6 +176,12 @@ namespace GradientSignal
         return output;
     }
 
+    void SmoothStepGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        m_configuration.m_gradientSampler.GetValues(positions, outValues);
+        m_configuration.m_smoothStep.GetSmoothedValues(outValues);
+    }
+
     bool SmoothStepGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
@@ -217,6 +217,34 @@ namespace GradientSignal
         return GetRatio(m_configuration.m_altitudeMin, m_configuration.m_altitudeMax, position.GetZ());
     }
 
+    void SurfaceAltitudeGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_Assert(positions.size() == outValues.size(), "input and output lists are different sizes (%zu vs %zu).",
+            positions.size(), outValues.size());
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        // Query every position with a single bus dispatch, reusing the same point list for each query.
+        // Points that don't produce a surface keep the minimum altitude, which GetRatio() maps to 0.
+        AZStd::fill(outValues.begin(), outValues.end(), m_configuration.m_altitudeMin);
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+            [this, &positions, &outValues](SurfaceData::SurfaceDataSystemRequests* surfaceDataSystem)
+            {
+                SurfaceData::SurfacePointList points;
+                for (size_t index = 0; index < positions.size(); index++)
+                {
+                    points.clear();
+                    surfaceDataSystem->GetSurfacePoints(positions[index], m_configuration.m_surfaceTagsToSample, points);
+                    if (!points.empty())
+                    {
+                        outValues[index] = points.front().m_position.GetZ();
+                    }
+                }
+            });
+
+        GetRatio(outValues, m_configuration.m_altitudeMin, m_configuration.m_altitudeMax);
+    }
+
     void SurfaceAltitudeGradientComponent::OnCompositionChanged()
     {
         m_dirty = true;
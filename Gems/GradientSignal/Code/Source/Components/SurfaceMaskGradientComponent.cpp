@@ -183,6 +183,43 @@ namespace GradientSignal
         return result;
     }
 
+    void SurfaceMaskGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZ_Assert(positions.size() == outValues.size(), "input and output lists are different sizes (%zu vs %zu).",
+            positions.size(), outValues.size());
+
+        AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+
+        if (m_configuration.m_surfaceTagList.empty())
+        {
+            return;
+        }
+
+        // Query every position with a single bus dispatch, reusing the same point list for each query.
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+            [this, &positions, &outValues](SurfaceData::SurfaceDataSystemRequests* surfaceDataSystem)
+            {
+                SurfaceData::SurfacePointList points;
+                for (size_t index = 0; index < positions.size(); index++)
+                {
+                    points.clear();
+                    surfaceDataSystem->GetSurfacePoints(positions[index], m_configuration.m_surfaceTagList, points);
+
+                    float result = 0.0f;
+                    for (const auto& point : points)
+                    {
+                        for (const auto& maskPair : point.m_masks)
+                        {
+                            result = AZ::GetMax(AZ::GetClamp(maskPair.second, 0.0f, 1.0f), result);
+                        }
+                    }
+                    outValues[index] = result;
+                }
+            });
+    }
+
     size_t SurfaceMaskGradientComponent::GetNumTags() const
     {
         return m_configuration.GetNumTags();
@@ -239,6 +239,60 @@ namespace GradientSignal
         }
     }
 
+    void SurfaceSlopeGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_Assert(positions.size() == outValues.size(), "input and output lists are different sizes (%zu vs %zu).",
+            positions.size(), outValues.size());
+
+        const float angleMin = AZ::DegToRad(AZ::GetClamp(m_configuration.m_slopeMin, 0.0f, 90.0f));
+        const float angleMax = AZ::DegToRad(AZ::GetClamp(m_configuration.m_slopeMax, 0.0f, 90.0f));
+
+        // Points without a surface produce 0 regardless of the ramp type, so track them separately.
+        AZStd::vector<bool> pointFound(positions.size(), false);
+
+        // Query every position with a single bus dispatch, reusing the same point list for each query.
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+            [this, &positions, &outValues, &pointFound](SurfaceData::SurfaceDataSystemRequests* surfaceDataSystem)
+            {
+                SurfaceData::SurfacePointList points;
+                for (size_t index = 0; index < positions.size(); index++)
+                {
+                    points.clear();
+                    surfaceDataSystem->GetSurfacePoints(positions[index], m_configuration.m_surfaceTagsToSample, points);
+                    if (!points.empty())
+                    {
+                        AZ_Assert(points.front().m_normal.GetNormalized().IsClose(points.front().m_normal), "Surface normals are expected to be normalized");
+                        // Convert slope back to an angle so that we can lerp in "angular space", see GetValue().
+                        outValues[index] = acosf(points.front().m_normal.GetZ());
+                        pointFound[index] = true;
+                    }
+                }
+            });
+
+        switch (m_configuration.m_rampType)
+        {
+            case SurfaceSlopeGradientConfig::RampType::SMOOTH_STEP:
+                GetRatio(outValues, angleMin, angleMax);
+                m_configuration.m_smoothStep.GetSmoothedValues(outValues);
+                break;
+            case SurfaceSlopeGradientConfig::RampType::LINEAR_RAMP_UP:
+                GetRatio(outValues, angleMin, angleMax);
+                break;
+            case SurfaceSlopeGradientConfig::RampType::LINEAR_RAMP_DOWN:
+            default:
+                GetRatio(outValues, angleMax, angleMin);
+                break;
+        }
+
+        for (size_t index = 0; index < positions.size(); index++)
+        {
+            if (!pointFound[index])
+            {
+                outValues[index] = 0.0f;
+            }
+        }
+    }
+
     float SurfaceSlopeGradientComponent::GetSlopeMin() const
     {
         return m_configuration.m_slopeMin;
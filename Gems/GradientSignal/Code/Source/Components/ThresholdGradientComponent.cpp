@@ -145,6 +145,12 @@ namespace GradientSignal
         return output;
     }
 
+    void ThresholdGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        m_configuration.m_gradientSampler.GetValues(positions, outValues);
+        ThresholdValues(outValues, m_configuration.m_threshold);
+    }
+
     bool ThresholdGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
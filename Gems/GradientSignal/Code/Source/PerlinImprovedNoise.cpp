@@ -60,6 +60,48 @@ namespace GradientSignal
         {
             return a + x * (b - a);
         }
+
+        // SIMD versions of the helpers above, operating on four values at a time.
+
+        AZ_FORCE_INLINE AZ::Simd::Vec4::FloatType Gradient(AZ::Simd::Vec4::Int32ArgType hash, AZ::Simd::Vec4::FloatArgType x, AZ::Simd::Vec4::FloatArgType y, AZ::Simd::Vec4::FloatArgType z)
+        {
+            using Vec4 = AZ::Simd::Vec4;
+
+            // Branchless form of the switch statement above:
+            //   u = (h < 8) ? x : y
+            //   v = (h < 4) ? y : ((h == 12 || h == 14) ? x : z)
+            //   result = ((h & 1) ? -u : u) + ((h & 2) ? -v : v)
+            const Vec4::Int32Type h = Vec4::And(hash, Vec4::Splat(0xF));
+            const Vec4::FloatType uIsX = Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(8)));
+            const Vec4::FloatType vIsY = Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(4)));
+            const Vec4::FloatType vIsX = Vec4::CastToFloat(Vec4::Or(Vec4::CmpEq(h, Vec4::Splat(12)), Vec4::CmpEq(h, Vec4::Splat(14))));
+
+            const Vec4::FloatType u = Vec4::Select(x, y, uIsX);
+            const Vec4::FloatType v = Vec4::Select(y, Vec4::Select(x, z, vIsX), vIsY);
+
+            // Flip the sign bits of u and v based on the low two bits of the hash.
+            const Vec4::Int32Type zero = Vec4::ZeroInt();
+            const Vec4::FloatType signBit = Vec4::CastToFloat(Vec4::Splat(static_cast<int32_t>(0x80000000)));
+            const Vec4::FloatType negateU = Vec4::CastToFloat(Vec4::CmpNeq(Vec4::And(h, Vec4::Splat(1)), zero));
+            const Vec4::FloatType negateV = Vec4::CastToFloat(Vec4::CmpNeq(Vec4::And(h, Vec4::Splat(2)), zero));
+
+            return Vec4::Add(Vec4::Xor(u, Vec4::And(negateU, signBit)), Vec4::Xor(v, Vec4::And(negateV, signBit)));
+        }
+
+        AZ_FORCE_INLINE AZ::Simd::Vec4::FloatType Fade(AZ::Simd::Vec4::FloatArgType t)
+        {
+            using Vec4 = AZ::Simd::Vec4;
+
+            // 6t^5 - 15t^4 + 10t^3, see the scalar version above
+            const Vec4::FloatType inner = Vec4::Madd(t, Vec4::Sub(Vec4::Mul(t, Vec4::Splat(6.0f)), Vec4::Splat(15.0f)), Vec4::Splat(10.0f));
+            return Vec4::Mul(Vec4::Mul(Vec4::Mul(t, t), t), inner);
+        }
+
+        AZ_FORCE_INLINE AZ::Simd::Vec4::FloatType Lerp(AZ::Simd::Vec4::FloatArgType a, AZ::Simd::Vec4::FloatArgType b, AZ::Simd::Vec4::FloatArgType x)
+        {
+            using Vec4 = AZ::Simd::Vec4;
+            return Vec4::Madd(x, Vec4::Sub(b, a), a);
+        }
     }
 
     PerlinImprovedNoise::PerlinImprovedNoise(int seed)
@@ -87,6 +129,60 @@ namespace GradientSignal
         return total / maxValue;
     }
 
+    void PerlinImprovedNoise::GenerateOctaveNoise(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues, int octaves, float persistence, float initialFrequency)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        AZ_Assert(positions.size() == outValues.size(), "input and output lists are different sizes (%zu vs %zu).",
+            positions.size(), outValues.size());
+
+        // The normalization factor is the same for every position, so compute it up front.
+        float maxValue = 0.0f;
+        float amplitude = 1.0f;
+        for (int i = 0; i < octaves; ++i)
+        {
+            maxValue += amplitude;
+            amplitude *= persistence;
+        }
+        if (maxValue <= 0.0f)
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        const size_t count = positions.size();
+        const size_t simdCount = count & ~static_cast<size_t>(3);
+        const Vec4::FloatType maxValueVec = Vec4::Splat(maxValue);
+
+        for (size_t index = 0; index < simdCount; index += 4)
+        {
+            const AZ::Vector3* p = &positions[index];
+            const Vec4::FloatType x = Vec4::LoadImmediate(p[0].GetX(), p[1].GetX(), p[2].GetX(), p[3].GetX());
+            const Vec4::FloatType y = Vec4::LoadImmediate(p[0].GetY(), p[1].GetY(), p[2].GetY(), p[3].GetY());
+            const Vec4::FloatType z = Vec4::LoadImmediate(p[0].GetZ(), p[1].GetZ(), p[2].GetZ(), p[3].GetZ());
+
+            Vec4::FloatType total = Vec4::ZeroFloat();
+            float frequency = initialFrequency;
+            amplitude = 1.0f;
+            for (int i = 0; i < octaves; ++i)
+            {
+                const Vec4::FloatType frequencyVec = Vec4::Splat(frequency);
+                const Vec4::FloatType noise = GenerateNoise(Vec4::Mul(x, frequencyVec), Vec4::Mul(y, frequencyVec), Vec4::Mul(z, frequencyVec));
+                total = Vec4::Madd(noise, Vec4::Splat(amplitude), total);
+                amplitude *= persistence;
+                frequency *= 2.0f;
+            }
+
+            Vec4::StoreUnaligned(&outValues[index], Vec4::Div(total, maxValueVec));
+        }
+
+        for (size_t index = simdCount; index < count; index++)
+        {
+            const AZ::Vector3& position = positions[index];
+            outValues[index] = GenerateOctaveNoise(position.GetX(), position.GetY(), position.GetZ(), octaves, persistence, initialFrequency);
+        }
+    }
+
     float PerlinImprovedNoise::GenerateNoise(float x, float y, float z)
     {
         const int fx = (int)std::floor(x);
@@ -133,6 +229,65 @@ namespace GradientSignal
         return (PerlinImprovedNoiseDetails::Lerp(y1, y2, w) + 1.0f) / 2.0f;
     }
 
+    AZ::Simd::Vec4::FloatType PerlinImprovedNoise::GenerateNoise(AZ::Simd::Vec4::FloatArgType x, AZ::Simd::Vec4::FloatArgType y, AZ::Simd::Vec4::FloatArgType z)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        const Vec4::FloatType floorX = Vec4::Floor(x);
+        const Vec4::FloatType floorY = Vec4::Floor(y);
+        const Vec4::FloatType floorZ = Vec4::Floor(z);
+        const Vec4::FloatType xf = Vec4::Sub(x, floorX);
+        const Vec4::FloatType yf = Vec4::Sub(y, floorY);
+        const Vec4::FloatType zf = Vec4::Sub(z, floorZ);
+        const Vec4::FloatType u = PerlinImprovedNoiseDetails::Fade(xf);
+        const Vec4::FloatType v = PerlinImprovedNoiseDetails::Fade(yf);
+        const Vec4::FloatType w = PerlinImprovedNoiseDetails::Fade(zf);
+
+        const Vec4::Int32Type mask = Vec4::Splat(255);
+        int32_t xi0[4];
+        int32_t yi0[4];
+        int32_t zi0[4];
+        Vec4::StoreUnaligned(xi0, Vec4::And(Vec4::ConvertToInt(floorX), mask));
+        Vec4::StoreUnaligned(yi0, Vec4::And(Vec4::ConvertToInt(floorY), mask));
+        Vec4::StoreUnaligned(zi0, Vec4::And(Vec4::ConvertToInt(floorZ), mask));
+
+        // The permutation table lookups are gathers, so they're done one lane at a time.
+        const AZStd::array<int, 512>& p = m_permutationTable;
+        int32_t aaa[4], aba[4], aab[4], abb[4], baa[4], bba[4], bab[4], bbb[4];
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            const int xi1 = xi0[lane] + 1;
+            const int yi1 = yi0[lane] + 1;
+            const int zi1 = zi0[lane] + 1;
+            aaa[lane] = p[p[p[xi0[lane]] + yi0[lane]] + zi0[lane]];
+            aba[lane] = p[p[p[xi0[lane]] + yi1] + zi0[lane]];
+            aab[lane] = p[p[p[xi0[lane]] + yi0[lane]] + zi1];
+            abb[lane] = p[p[p[xi0[lane]] + yi1] + zi1];
+            baa[lane] = p[p[p[xi1] + yi0[lane]] + zi0[lane]];
+            bba[lane] = p[p[p[xi1] + yi1] + zi0[lane]];
+            bab[lane] = p[p[p[xi1] + yi0[lane]] + zi1];
+            bbb[lane] = p[p[p[xi1] + yi1] + zi1];
+        }
+
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        const Vec4::FloatType xf1 = Vec4::Sub(xf, one);
+        const Vec4::FloatType yf1 = Vec4::Sub(yf, one);
+        const Vec4::FloatType zf1 = Vec4::Sub(zf, one);
+
+        using PerlinImprovedNoiseDetails::Gradient;
+        using PerlinImprovedNoiseDetails::Lerp;
+
+        Vec4::FloatType x1 = Lerp(Gradient(Vec4::LoadUnaligned(aaa), xf, yf, zf), Gradient(Vec4::LoadUnaligned(baa), xf1, yf, zf), u);
+        Vec4::FloatType x2 = Lerp(Gradient(Vec4::LoadUnaligned(aba), xf, yf1, zf), Gradient(Vec4::LoadUnaligned(bba), xf1, yf1, zf), u);
+        const Vec4::FloatType y1 = Lerp(x1, x2, v);
+        x1 = Lerp(Gradient(Vec4::LoadUnaligned(aab), xf, yf, zf1), Gradient(Vec4::LoadUnaligned(bab), xf1, yf, zf1), u);
+        x2 = Lerp(Gradient(Vec4::LoadUnaligned(abb), xf, yf1, zf1), Gradient(Vec4::LoadUnaligned(bbb), xf1, yf1, zf1), u);
+        const Vec4::FloatType y2 = Lerp(x1, x2, v);
+
+        // For convenience we bound it to 0 - 1 (theoretical min/max before is -1 - 1)
+        return Vec4::Mul(Vec4::Add(Lerp(y1, y2, w), one), Vec4::Splat(0.5f));
+    }
+
     void PerlinImprovedNoise::PrepareTable(int seed)
     {
         AZStd::array<int, 256> randtable;
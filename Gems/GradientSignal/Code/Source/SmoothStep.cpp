@@ -70,4 +70,33 @@ namespace GradientSignal
                 ;
         }
     }
+
+    void SmoothStep::GetSmoothedValues(AZStd::vector<float>& inOutValues) const
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        const float valueFalloffStrength = AZ::GetClamp(m_falloffStrength, 0.0f, 1.0f);
+        const float min = m_falloffMidpoint - m_falloffRange / 2.0f;
+        const float max = m_falloffMidpoint + m_falloffRange / 2.0f;
+
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+
+        const size_t count = inOutValues.size();
+        const size_t simdCount = count & ~static_cast<size_t>(3);
+        float* values = inOutValues.data();
+
+        for (size_t index = 0; index < simdCount; index += 4)
+        {
+            const Vec4::FloatType value = Vec4::Clamp(Vec4::LoadUnaligned(&values[index]), zero, one);
+            const Vec4::FloatType result1 = GetSmoothStep(GetRatio(min, min + valueFalloffStrength, value));
+            const Vec4::FloatType result2 = GetSmoothStep(GetRatio(max - valueFalloffStrength, max, value));
+            Vec4::StoreUnaligned(&values[index], Vec4::Mul(result1, Vec4::Sub(one, result2)));
+        }
+
+        for (size_t index = simdCount; index < count; index++)
+        {
+            values[index] = GetSmoothedValue(values[index]);
+        }
+    }
 }
@@ -74,4 +74,90 @@ namespace GradientSignal
     {
         return point - bounds.GetMin();
     }
+
+    namespace UtilInternal
+    {
+        // Runs simdOp over the values four at a time, and scalarOp over any leftover values at the end.
+        template<typename SimdOp, typename ScalarOp>
+        void ProcessValues(AZStd::vector<float>& inOutValues, SimdOp&& simdOp, ScalarOp&& scalarOp)
+        {
+            using Vec4 = AZ::Simd::Vec4;
+
+            const size_t count = inOutValues.size();
+            const size_t simdCount = count & ~static_cast<size_t>(3);
+            float* values = inOutValues.data();
+
+            for (size_t index = 0; index < simdCount; index += 4)
+            {
+                Vec4::StoreUnaligned(&values[index], simdOp(Vec4::LoadUnaligned(&values[index])));
+            }
+
+            for (size_t index = simdCount; index < count; index++)
+            {
+                values[index] = scalarOp(values[index]);
+            }
+        }
+    }
+
+    void ClampValues(AZStd::vector<float>& inOutValues, float min, float max)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        const Vec4::FloatType minValue = Vec4::Splat(min);
+        const Vec4::FloatType maxValue = Vec4::Splat(max);
+
+        UtilInternal::ProcessValues(inOutValues,
+            [&](Vec4::FloatArgType value) { return Vec4::Clamp(value, minValue, maxValue); },
+            [&](float value) { return AZ::GetClamp(value, min, max); });
+    }
+
+    void InvertValues(AZStd::vector<float>& inOutValues)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+
+        UtilInternal::ProcessValues(inOutValues,
+            [&](Vec4::FloatArgType value) { return Vec4::Sub(one, Vec4::Clamp(value, zero, one)); },
+            [](float value) { return 1.0f - AZ::GetClamp(value, 0.0f, 1.0f); });
+    }
+
+    void ThresholdValues(AZStd::vector<float>& inOutValues, float threshold)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        const Vec4::FloatType thresholdValue = Vec4::Splat(threshold);
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+
+        UtilInternal::ProcessValues(inOutValues,
+            [&](Vec4::FloatArgType value) { return Vec4::Select(zero, one, Vec4::CmpLtEq(value, thresholdValue)); },
+            [&](float value) { return value <= threshold ? 0.0f : 1.0f; });
+    }
+
+    void ScaleValues(AZStd::vector<float>& inOutValues, float scale)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        const Vec4::FloatType scaleValue = Vec4::Splat(scale);
+
+        UtilInternal::ProcessValues(inOutValues,
+            [&](Vec4::FloatArgType value) { return Vec4::Mul(value, scaleValue); },
+            [&](float value) { return value * scale; });
+    }
+
+    void GetRatio(AZStd::vector<float>& inOutValues, float a, float b)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        UtilInternal::ProcessValues(inOutValues,
+            [&](Vec4::FloatArgType value) { return GetRatio(a, b, value); },
+            [&](float value) { return GetRatio(a, b, value); });
+    }
+
+    void GetLevels(AZStd::vector<float>& inOutValues, float inputMid, float inputMin, float inputMax, float outputMin, float outputMax)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        UtilInternal::ProcessValues(inOutValues,
+            [&](Vec4::FloatArgType value) { return GetLevels(value, inputMid, inputMin, inputMax, outputMin, outputMax); },
+            [&](float value) { return GetLevels(value, inputMid, inputMin, inputMax, outputMin, outputMax); });
+    }
 }
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <benchmark/benchmark.h>
+
+#include "Tests/GradientSignalTestMocks.h"
+
+#include <Source/Components/GradientTransformComponent.h>
+#include <Source/Components/InvertGradientComponent.h>
+#include <Source/Components/LevelsGradientComponent.h>
+#include <Source/Components/PerlinGradientComponent.h>
+#include <Source/Components/PosterizeGradientComponent.h>
+#include <Source/Components/SmoothStepGradientComponent.h>
+#include <Source/Components/ThresholdGradientComponent.h>
+
+namespace UnitTest
+{
+    //! Compares querying a gradient one point at a time against querying it in a single batch.
+    //! Every benchmark queries a 1024 x 1024 grid of points through a GradientSampler, the same way
+    //! vegetation and surface queries would.
+    class GradientSignalBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        enum class GradientType
+        {
+            Perlin,
+            Levels,
+            SmoothStep,
+            Posterize,
+            Threshold,
+            Invert
+        };
+
+        static constexpr int GridSize = 1024;
+
+        void SetUp([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            AZ::ComponentApplication::Descriptor appDesc;
+            appDesc.m_memoryBlocksByteSize = 128 * 1024 * 1024;
+            m_systemEntity = m_app.Create(appDesc);
+            m_app.AddEntity(m_systemEntity);
+
+            m_positions.reserve(GridSize * GridSize);
+            for (int y = 0; y < GridSize; ++y)
+            {
+                for (int x = 0; x < GridSize; ++x)
+                {
+                    m_positions.emplace_back(static_cast<float>(x), static_cast<float>(y), 0.0f);
+                }
+            }
+            m_values.resize(m_positions.size());
+        }
+
+        void TearDown([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            m_positions = {};
+            m_values = {};
+            m_shapeHandler.reset();
+            m_entities.clear();
+            m_app.Destroy();
+            m_systemEntity = nullptr;
+        }
+
+        //! Creates a Perlin gradient, and optionally a second gradient that modifies the Perlin output.
+        //! Returns the id of the entity that should be sampled.
+        AZ::EntityId CreateTestGradient(GradientType gradientType)
+        {
+            auto perlinEntity = AZStd::make_unique<AZ::Entity>();
+            GradientSignal::PerlinGradientConfig perlinConfig;
+            perlinConfig.m_randomSeed = 7878;
+            perlinConfig.m_octave = 4;
+            CreateComponent<GradientSignal::PerlinGradientComponent>(perlinEntity.get(), perlinConfig);
+            CreateComponent<GradientSignal::GradientTransformComponent>(perlinEntity.get(), GradientSignal::GradientTransformConfig());
+            CreateComponent<MockShapeComponent>(perlinEntity.get());
+            m_shapeHandler = AZStd::make_unique<MockShapeComponentHandler>(perlinEntity->GetId());
+            m_shapeHandler->m_GetLocalBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3::CreateZero(), AZ::Vector3(GridSize));
+            ActivateEntity(perlinEntity.get());
+
+            const AZ::EntityId perlinId = perlinEntity->GetId();
+            m_entities.emplace_back(AZStd::move(perlinEntity));
+
+            if (gradientType == GradientType::Perlin)
+            {
+                return perlinId;
+            }
+
+            auto entity = AZStd::make_unique<AZ::Entity>();
+            switch (gradientType)
+            {
+            case GradientType::Levels:
+            {
+                GradientSignal::LevelsGradientConfig config;
+                config.m_gradientSampler.m_gradientId = perlinId;
+                config.m_inputMin = 0.2f;
+                config.m_inputMax = 0.8f;
+                CreateComponent<GradientSignal::LevelsGradientComponent>(entity.get(), config);
+                break;
+            }
+            case GradientType::SmoothStep:
+            {
+                GradientSignal::SmoothStepGradientConfig config;
+                config.m_gradientSampler.m_gradientId = perlinId;
+                CreateComponent<GradientSignal::SmoothStepGradientComponent>(entity.get(), config);
+                break;
+            }
+            case GradientType::Posterize:
+            {
+                GradientSignal::PosterizeGradientConfig config;
+                config.m_gradientSampler.m_gradientId = perlinId;
+                config.m_bands = 5;
+                CreateComponent<GradientSignal::PosterizeGradientComponent>(entity.get(), config);
+                break;
+            }
+            case GradientType::Threshold:
+            {
+                GradientSignal::ThresholdGradientConfig config;
+                config.m_gradientSampler.m_gradientId = perlinId;
+                CreateComponent<GradientSignal::ThresholdGradientComponent>(entity.get(), config);
+                break;
+            }
+            case GradientType::Invert:
+            default:
+            {
+                GradientSignal::InvertGradientConfig config;
+                config.m_gradientSampler.m_gradientId = perlinId;
+                CreateComponent<GradientSignal::InvertGradientComponent>(entity.get(), config);
+                break;
+            }
+            }
+            ActivateEntity(entity.get());
+
+            const AZ::EntityId id = entity->GetId();
+            m_entities.emplace_back(AZStd::move(entity));
+            return id;
+        }
+
+        void RunGetValueBenchmark(::benchmark::State& state, GradientType gradientType)
+        {
+            GradientSignal::GradientSampler gradientSampler;
+            gradientSampler.m_gradientId = CreateTestGradient(gradientType);
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                GradientSignal::GradientSampleParams params;
+                for (size_t index = 0; index < m_positions.size(); ++index)
+                {
+                    params.m_position = m_positions[index];
+                    m_values[index] = gradientSampler.GetValue(params);
+                }
+                benchmark::DoNotOptimize(m_values.data());
+            }
+
+            state.SetItemsProcessed(state.iterations() * m_positions.size());
+        }
+
+        void RunGetValuesBenchmark(::benchmark::State& state, GradientType gradientType)
+        {
+            GradientSignal::GradientSampler gradientSampler;
+            gradientSampler.m_gradientId = CreateTestGradient(gradientType);
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                gradientSampler.GetValues(m_positions, m_values);
+                benchmark::DoNotOptimize(m_values.data());
+            }
+
+            state.SetItemsProcessed(state.iterations() * m_positions.size());
+        }
+
+    protected:
+        template <typename Component, typename Configuration>
+        void CreateComponent(AZ::Entity* entity, const Configuration& config)
+        {
+            m_app.RegisterComponentDescriptor(Component::CreateDescriptor());
+            entity->CreateComponent<Component>(config);
+        }
+
+        template <typename Component>
+        void CreateComponent(AZ::Entity* entity)
+        {
+            m_app.RegisterComponentDescriptor(Component::CreateDescriptor());
+            entity->CreateComponent<Component>();
+        }
+
+        void ActivateEntity(AZ::Entity* entity)
+        {
+            entity->Init();
+            entity->Activate();
+        }
+
+        AZ::ComponentApplication m_app;
+        AZ::Entity* m_systemEntity = nullptr;
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> m_entities;
+        AZStd::unique_ptr<MockShapeComponentHandler> m_shapeHandler;
+        AZStd::vector<AZ::Vector3> m_positions;
+        AZStd::vector<float> m_values;
+    };
+
+#define GRADIENT_SIGNAL_BENCHMARK_PAIR(GradientName)                                                                    \
+    BENCHMARK_DEFINE_F(GradientSignalBenchmarkFixture, BM_##GradientName##Gradient_GetValue)(benchmark::State& state)   \
+    {                                                                                                                   \
+        RunGetValueBenchmark(state, GradientType::GradientName);                                                        \
+    }                                                                                                                   \
+    BENCHMARK_DEFINE_F(GradientSignalBenchmarkFixture, BM_##GradientName##Gradient_GetValues)(benchmark::State& state)  \
+    {                                                                                                                   \
+        RunGetValuesBenchmark(state, GradientType::GradientName);                                                       \
+    }                                                                                                                   \
+    BENCHMARK_REGISTER_F(GradientSignalBenchmarkFixture, BM_##GradientName##Gradient_GetValue)                          \
+        ->Unit(::benchmark::kMillisecond);                                                                              \
+    BENCHMARK_REGISTER_F(GradientSignalBenchmarkFixture, BM_##GradientName##Gradient_GetValues)                         \
+        ->Unit(::benchmark::kMillisecond);
+
+    GRADIENT_SIGNAL_BENCHMARK_PAIR(Perlin)
+    GRADIENT_SIGNAL_BENCHMARK_PAIR(Levels)
+    GRADIENT_SIGNAL_BENCHMARK_PAIR(SmoothStep)
+    GRADIENT_SIGNAL_BENCHMARK_PAIR(Posterize)
+    GRADIENT_SIGNAL_BENCHMARK_PAIR(Threshold)
+    GRADIENT_SIGNAL_BENCHMARK_PAIR(Invert)
+
+#undef GRADIENT_SIGNAL_BENCHMARK_PAIR
+}
+
+#endif
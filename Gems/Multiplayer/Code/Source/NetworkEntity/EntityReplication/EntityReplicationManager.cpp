@@ -37,6 +37,8 @@ namespace Multiplayer
     constexpr uint32_t ReplicationManagerPacketOverhead = 16;
 
     AZ_CVAR(bool, bg_replicationWindowImmediateAddRemove, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Update replication windows immediately on visibility Add/Removes.");
+    AZ_CVAR(uint32_t, sv_ReplicationBandwidthLimit, 0, nullptr, AZ::ConsoleFunctorFlags::Null, "The number of bytes of entity updates that may be sent to a connection per second, 0 for no limit. Entities that don't fit are sent in a later frame.");
+    AZ_CVAR(float, sv_ReplicationMinPriority, 0.0001f, nullptr, AZ::ConsoleFunctorFlags::Null, "The lowest priority an entity accumulates per second while waiting to be sent, so that distant entities are still sent eventually.");
 
     EntityReplicationManager::EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode updateMode)
         : m_updateMode(updateMode)
@@ -119,23 +121,23 @@ namespace Multiplayer
     void EntityReplicationManager::SendEntityUpdatesPacketHelper
     (
         AZ::TimeMs hostTimeMs,
-        EntityReplicatorList& toSendList,
+        EntityUpdateList& toSendList,
         uint32_t maxPayloadSize,
         AzNetworking::IConnection& connection
     )
     {
         uint32_t pendingPacketSize = 0;
-        EntityReplicatorList replicatorUpdatedList;
+        AZStd::vector<EntityReplicator*> replicatorUpdatedList;
         MultiplayerPackets::EntityUpdates entityUpdatePacket;
         entityUpdatePacket.SetHostTimeMs(hostTimeMs);
         entityUpdatePacket.SetHostFrameId(GetNetworkTime()->GetHostFrameId());
         // Serialize everything
         while (!toSendList.empty())
         {
-            EntityReplicator* replicator = toSendList.front();
-            NetworkEntityUpdateMessage updateMessage(replicator->GenerateUpdatePacket());
+            EntityUpdate& entityUpdate = toSendList.front();
+            EntityReplicator* replicator = entityUpdate.m_replicator;
 
-            const uint32_t nextMessageSize = updateMessage.GetEstimatedSerializeSize();
+            const uint32_t nextMessageSize = entityUpdate.m_updateMessage.GetEstimatedSerializeSize();
 
             // Check if we are over our limits
             const bool payloadFull = (pendingPacketSize + nextMessageSize > maxPayloadSize);
@@ -147,7 +149,7 @@ namespace Multiplayer
             }
 
             pendingPacketSize += nextMessageSize;
-            entityUpdatePacket.ModifyEntityMessages().push_back(updateMessage);
+            entityUpdatePacket.ModifyEntityMessages().push_back(AZStd::move(entityUpdate.m_updateMessage));
             replicatorUpdatedList.push_back(replicator);
             toSendList.pop_front();
 
@@ -175,17 +177,18 @@ namespace Multiplayer
         }
     }
 
-    EntityReplicationManager::EntityReplicatorList EntityReplicationManager::GenerateEntityUpdateList()
+    EntityReplicationManager::EntityUpdateList EntityReplicationManager::GenerateEntityUpdateList()
     {
         if (m_replicationWindow == nullptr)
         {
-            return EntityReplicatorList();
+            return EntityUpdateList();
         }
 
-        // Generate a list of all our entities that need updates
-        EntityReplicatorList toSendList;
+        m_sendScheduler.SetBandwidthLimit(sv_ReplicationBandwidthLimit);
+        m_sendScheduler.SetMinPriority(sv_ReplicationMinPriority);
+        m_sendScheduler.BeginSend(m_frameTimeMs);
 
-        uint32_t proxySendCount = 0;
+        // Gather all our entities that need updates
         for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end();)
         {
             bool clearPendingSend = true;
@@ -213,21 +216,9 @@ namespace Multiplayer
                     if (canSend && propPublisher->RequiresSerialization())
                     {
                         clearPendingSend = false;
-                        if (!propPublisher->IsRemoteReplicatorEstablished())
-                        {
-                            m_remoteEntitiesPendingCreation.insert(entityId);
-                        }
-
-                        if (replicator->GetRemoteNetworkRole() == NetEntityRole::Autonomous ||
-                            replicator->GetBoundLocalNetworkRole() == NetEntityRole::Autonomous)
-                        {
-                            toSendList.push_back(replicator);
-                        }
-                        else if (proxySendCount < m_replicationWindow->GetMaxProxyEntityReplicatorSendCount())
-                        {
-                            toSendList.push_back(replicator);
-                            ++proxySendCount;
-                        }
+                        const bool isAutonomous = replicator->GetRemoteNetworkRole() == NetEntityRole::Autonomous ||
+                            replicator->GetBoundLocalNetworkRole() == NetEntityRole::Autonomous;
+                        m_sendScheduler.AddCandidate(entityId, replicator, replicator->GetReplicationPriority(), isAutonomous);
                     }
                 }
             }
@@ -235,6 +226,7 @@ namespace Multiplayer
             if (clearPendingSend)
             {
                 m_remoteEntitiesPendingCreation.erase(*iter);
+                m_sendScheduler.RemoveEntity(*iter);
                 iter = m_replicatorsPendingSend.erase(iter);
             }
             else
@@ -243,21 +235,43 @@ namespace Multiplayer
             }
         }
 
+        // Serialize the entities in priority order until we run out of proxy sends or bandwidth, the rest wait for a later send with the priority they accumulated
+        EntityUpdateList toSendList;
+        uint32_t proxySendCount = 0;
+        for (const EntityReplicationScheduler::Candidate& candidate : m_sendScheduler.SortCandidates())
+        {
+            if (!candidate.m_alwaysSend)
+            {
+                if ((proxySendCount >= m_replicationWindow->GetMaxProxyEntityReplicatorSendCount()) || !m_sendScheduler.HasBudget())
+                {
+                    // Candidates are sorted with the ones that are always sent first, so nothing after this gets sent either
+                    break;
+                }
+                ++proxySendCount;
+            }
+
+            EntityReplicator* replicator = candidate.m_replicator;
+            PropertyPublisher* propPublisher = replicator->GetPropertyPublisher();
+            if (!propPublisher->IsRemoteReplicatorEstablished())
+            {
+                m_remoteEntitiesPendingCreation.insert(candidate.m_netEntityId);
+            }
+
+            // prep a replication record for send, at this point, everything needs to be sent
+            propPublisher->PrepareSerialization();
+            toSendList.push_back(EntityUpdate{ replicator, replicator->GenerateUpdatePacket() });
+            m_sendScheduler.MarkSent(candidate.m_netEntityId, toSendList.back().m_updateMessage.GetEstimatedSerializeSize());
+        }
+
         return toSendList;
     }
 
     void EntityReplicationManager::SendEntityUpdates(AZ::TimeMs hostTimeMs)
     {
-        EntityReplicatorList toSendList = GenerateEntityUpdateList();
+        EntityUpdateList toSendList = GenerateEntityUpdateList();
     
         AZLOG(NET_ReplicationInfo, "Sending %zd updates from %d to %d", toSendList.size(), (uint8_t)GetNetworkEntityManager()->GetHostId(), (uint8_t)GetRemoteHostId());
     
-        // prep a replication record for send, at this point, everything needs to be sent
-        for (EntityReplicator* replicator : toSendList)
-        {
-            replicator->GetPropertyPublisher()->PrepareSerialization();
-        }
-    
         // While our to send list is not empty, build up another packet to send
         do
         {
@@ -328,6 +342,7 @@ namespace Multiplayer
         {
             m_replicatorsPendingRemoval.clear();
             m_replicatorsPendingSend.clear();
+            m_sendScheduler.Clear();
         }
 
         m_entityReplicatorMap.clear();
@@ -939,7 +954,10 @@ namespace Multiplayer
             {
                 if (newWindowIter->first && (newWindowIter->first.GetNetEntityId() < currWindowIter->first))
                 {
-                    AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole);
+                    if (EntityReplicator* entityReplicator = AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole))
+                    {
+                        entityReplicator->SetReplicationPriority(newWindowIter->second.m_priority);
+                    }
                     ++newWindowIter;
                 }
                 else if (newWindowIter->first.GetNetEntityId() > currWindowIter->first)
@@ -959,6 +977,7 @@ namespace Multiplayer
                     {
                         currReplicator = AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole);
                     }
+                    currReplicator->SetReplicationPriority(newWindowIter->second.m_priority);
                     currReplicator->ClearPendingRemoval();
                     ++newWindowIter;
                     ++currWindowIter;
@@ -968,7 +987,10 @@ namespace Multiplayer
             // Do remaining adds
             while (newWindowIter != newWindow.end())
             {
-                AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole);
+                if (EntityReplicator* entityReplicator = AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole))
+                {
+                    entityReplicator->SetReplicationPriority(newWindowIter->second.m_priority);
+                }
                 ++newWindowIter;
             }
 
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <Source/NetworkEntity/EntityReplication/EntityReplicator.h>
+#include <Source/NetworkEntity/EntityReplication/EntityReplicationScheduler.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/EntityDomains/IEntityDomain.h>
 #include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
@@ -114,10 +115,15 @@ namespace Multiplayer
         using RpcMessages = AZStd::list<NetworkEntityRpcMessage>;
         bool DispatchOrphanedRpc(NetworkEntityRpcMessage& message, EntityReplicator* entityReplicator);
 
-        using EntityReplicatorList = AZStd::deque<EntityReplicator*>;
-        EntityReplicatorList GenerateEntityUpdateList();
+        struct EntityUpdate
+        {
+            EntityReplicator* m_replicator = nullptr;
+            NetworkEntityUpdateMessage m_updateMessage;
+        };
+        using EntityUpdateList = AZStd::deque<EntityUpdate>;
+        EntityUpdateList GenerateEntityUpdateList();
 
-        void SendEntityUpdatesPacketHelper(AZ::TimeMs hostTimeMs, EntityReplicatorList& toSendList, uint32_t maxPayloadSize, AzNetworking::IConnection& connection);
+        void SendEntityUpdatesPacketHelper(AZ::TimeMs hostTimeMs, EntityUpdateList& toSendList, uint32_t maxPayloadSize, AzNetworking::IConnection& connection);
 
         void SendEntityUpdates(AZ::TimeMs hostTimeMs);
         void SendEntityRpcs(RpcMessages& deferredRpcs, bool reliable);
@@ -183,6 +189,7 @@ namespace Multiplayer
         AZStd::deque<NetEntityId> m_entitiesPendingActivation;
         AZStd::set<NetEntityId> m_replicatorsPendingRemoval;
         AZStd::unordered_set<NetEntityId> m_replicatorsPendingSend;
+        EntityReplicationScheduler m_sendScheduler;
 
         // Deferred RPC Sends
         RpcMessages m_deferredRpcMessagesReliable;
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/EntityReplication/EntityReplicationScheduler.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    // Unspent budget is kept for at most this long, which bounds the burst sent after a few quiet frames
+    static constexpr int64_t MaxBufferedBudgetMs = 100;
+
+    void EntityReplicationScheduler::SetBandwidthLimit(uint32_t bytesPerSecond)
+    {
+        if (m_bytesPerSecond != bytesPerSecond)
+        {
+            m_bytesPerSecond = bytesPerSecond;
+            m_availableBytes = (aznumeric_cast<int64_t>(m_bytesPerSecond) * MaxBufferedBudgetMs) / 1000;
+        }
+    }
+
+    void EntityReplicationScheduler::SetMinPriority(float minPriority)
+    {
+        m_minPriority = minPriority;
+    }
+
+    void EntityReplicationScheduler::BeginSend(AZ::TimeMs sendTimeMs)
+    {
+        const AZ::TimeMs elapsedMs = (m_lastSendTimeMs > AZ::TimeMs{ 0 } && sendTimeMs > m_lastSendTimeMs)
+            ? sendTimeMs - m_lastSendTimeMs
+            : AZ::TimeMs{ 0 };
+        m_lastSendTimeMs = sendTimeMs;
+        m_elapsedSeconds = static_cast<float>(elapsedMs) / 1000.0f;
+        m_candidates.clear();
+
+        if (m_bytesPerSecond > 0)
+        {
+            const int64_t bytesPerSecond = aznumeric_cast<int64_t>(m_bytesPerSecond);
+            const int64_t refillMs = AZStd::min(aznumeric_cast<int64_t>(elapsedMs), MaxBufferedBudgetMs);
+            const int64_t maxBufferedBytes = (bytesPerSecond * MaxBufferedBudgetMs) / 1000;
+            m_availableBytes = AZStd::min(m_availableBytes + (bytesPerSecond * refillMs) / 1000, maxBufferedBytes);
+        }
+    }
+
+    void EntityReplicationScheduler::AddCandidate(NetEntityId netEntityId, EntityReplicator* replicator, float priority, bool alwaysSend)
+    {
+        float& accumulatedPriority = m_accumulatedPriorities[netEntityId];
+        accumulatedPriority += AZStd::max(priority, m_minPriority) * m_elapsedSeconds;
+        m_candidates.push_back(Candidate{ netEntityId, replicator, accumulatedPriority, alwaysSend });
+    }
+
+    const EntityReplicationScheduler::CandidateList& EntityReplicationScheduler::SortCandidates()
+    {
+        AZStd::sort(m_candidates.begin(), m_candidates.end(), [](const Candidate& lhs, const Candidate& rhs)
+        {
+            if (lhs.m_alwaysSend != rhs.m_alwaysSend)
+            {
+                return lhs.m_alwaysSend;
+            }
+            if (lhs.m_sendPriority != rhs.m_sendPriority)
+            {
+                return lhs.m_sendPriority > rhs.m_sendPriority;
+            }
+            // Keep the order stable between sends when priorities tie, for instance on the first send
+            return lhs.m_netEntityId < rhs.m_netEntityId;
+        });
+        return m_candidates;
+    }
+
+    bool EntityReplicationScheduler::HasBudget() const
+    {
+        return (m_bytesPerSecond == 0) || (m_availableBytes > 0);
+    }
+
+    void EntityReplicationScheduler::MarkSent(NetEntityId netEntityId, uint32_t byteCount)
+    {
+        auto iter = m_accumulatedPriorities.find(netEntityId);
+        if (iter != m_accumulatedPriorities.end())
+        {
+            iter->second = 0.0f;
+        }
+        if (m_bytesPerSecond > 0)
+        {
+            m_availableBytes -= byteCount;
+        }
+    }
+
+    void EntityReplicationScheduler::RemoveEntity(NetEntityId netEntityId)
+    {
+        m_accumulatedPriorities.erase(netEntityId);
+    }
+
+    void EntityReplicationScheduler::Clear()
+    {
+        m_accumulatedPriorities.clear();
+        m_candidates.clear();
+    }
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    class EntityReplicator;
+
+    //! @class EntityReplicationScheduler
+    //! @brief Decides which entities go into the entity update packets of a single connection.
+    //! Every entity with changes to send accumulates its replication priority for the time it has been waiting, and entities are
+    //! sent in order of their accumulated priority until the byte budget of the connection is spent. Entities that don't make it
+    //! into a send keep what they accumulated, so less important entities are delayed instead of starved.
+    class EntityReplicationScheduler
+    {
+    public:
+        struct Candidate
+        {
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            EntityReplicator* m_replicator = nullptr;
+            float m_sendPriority = 0.0f;
+            bool m_alwaysSend = false;
+        };
+        using CandidateList = AZStd::vector<Candidate>;
+
+        //! Sets the rate the byte budget refills at.
+        //! @param bytesPerSecond the number of bytes the connection may send per second, 0 for no limit
+        void SetBandwidthLimit(uint32_t bytesPerSecond);
+
+        //! Sets the lowest priority an entity accumulates, so that entities with no or very low replication priority are still sent eventually.
+        //! @param minPriority the lowest priority an entity accumulates per second
+        void SetMinPriority(float minPriority);
+
+        //! Starts scheduling a send, refilling the byte budget for the time elapsed since the previous send.
+        //! @param sendTimeMs the time of this send
+        void BeginSend(AZ::TimeMs sendTimeMs);
+
+        //! Adds an entity with changes to send, accumulating its priority for the time elapsed since the previous send.
+        //! @param netEntityId the entity with changes to send
+        //! @param replicator  the replicator of the entity, not used by the scheduler
+        //! @param priority    the replication priority of the entity, usually based on the distance to the remote endpoint
+        //! @param alwaysSend  true if the entity is sent regardless of priority and budget, used for autonomous entities
+        void AddCandidate(NetEntityId netEntityId, EntityReplicator* replicator, float priority, bool alwaysSend);
+
+        //! Sorts the candidates added since BeginSend, entities that are always sent first and the rest by accumulated priority.
+        //! @return the candidates in the order they should be sent
+        const CandidateList& SortCandidates();
+
+        //! Returns true if there is budget left to send more entities.
+        //! @return true if there is budget left to send more entities
+        bool HasBudget() const;
+
+        //! Records that an entity was sent, resetting its accumulated priority and charging its size to the budget.
+        //! @param netEntityId the entity that was sent
+        //! @param byteCount   the size of the update that was sent
+        void MarkSent(NetEntityId netEntityId, uint32_t byteCount);
+
+        //! Forgets the accumulated priority of an entity that no longer has changes to send.
+        //! @param netEntityId the entity to remove
+        void RemoveEntity(NetEntityId netEntityId);
+
+        //! Forgets the accumulated priority of all entities.
+        void Clear();
+
+    private:
+        AZStd::unordered_map<NetEntityId, float> m_accumulatedPriorities;
+        CandidateList m_candidates;
+        AZ::TimeMs m_lastSendTimeMs = AZ::TimeMs{ 0 };
+        float m_elapsedSeconds = 0.0f;
+        float m_minPriority = 0.0f;
+        int64_t m_availableBytes = 0;
+        uint32_t m_bytesPerSecond = 0;
+    };
+}
@@ -67,6 +67,12 @@ namespace Multiplayer
 
         AZ::TimeMs GetResendTimeoutTimeMs() const;
 
+        //! The replication window priority of this entity for the remote endpoint, higher priorities are sent sooner.
+        //! @{
+        void SetReplicationPriority(float priority);
+        float GetReplicationPriority() const;
+        //! @}
+
         PropertyPublisher* GetPropertyPublisher();
         const PropertyPublisher* GetPropertyPublisher() const;
         PropertySubscriber* GetPropertySubscriber();
@@ -132,6 +138,7 @@ namespace Multiplayer
         AzNetworking::IConnection* m_connection;
         NetEntityRole m_boundLocalNetworkRole;
         NetEntityRole m_remoteNetworkRole;
+        float m_replicationPriority = 0.0f;
 
         bool m_wasMigrated = false;
         bool m_isForwardingRpc = false;
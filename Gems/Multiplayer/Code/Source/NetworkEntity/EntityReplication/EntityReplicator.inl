@@ -51,6 +51,16 @@ namespace Multiplayer
         m_wasMigrated = wasMigrated;
     }
 
+    inline void EntityReplicator::SetReplicationPriority(float priority)
+    {
+        m_replicationPriority = priority;
+    }
+
+    inline float EntityReplicator::GetReplicationPriority() const
+    {
+        return m_replicationPriority;
+    }
+
     inline PropertyPublisher* EntityReplicator::GetPropertyPublisher()
     {
         return m_propertyPublisher.get();
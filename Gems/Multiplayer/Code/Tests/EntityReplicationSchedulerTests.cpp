@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+#include <Source/NetworkEntity/EntityReplication/EntityReplicationScheduler.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class EntityReplicationSchedulerTests
+        : public AllocatorsFixture
+    {
+    };
+
+    TEST_F(EntityReplicationSchedulerTests, SortCandidates_AlwaysSendFirstThenAccumulatedPriority)
+    {
+        EntityReplicationScheduler scheduler;
+        scheduler.BeginSend(AZ::TimeMs{ 1000 });
+        scheduler.BeginSend(AZ::TimeMs{ 1100 });
+        scheduler.AddCandidate(NetEntityId{ 1 }, nullptr, 0.1f, false);
+        scheduler.AddCandidate(NetEntityId{ 2 }, nullptr, 0.5f, false);
+        scheduler.AddCandidate(NetEntityId{ 3 }, nullptr, 0.0f, true);
+        scheduler.AddCandidate(NetEntityId{ 4 }, nullptr, 0.3f, false);
+
+        const EntityReplicationScheduler::CandidateList& candidates = scheduler.SortCandidates();
+        ASSERT_EQ(candidates.size(), 4u);
+        EXPECT_EQ(candidates[0].m_netEntityId, NetEntityId{ 3 });
+        EXPECT_EQ(candidates[1].m_netEntityId, NetEntityId{ 2 });
+        EXPECT_EQ(candidates[2].m_netEntityId, NetEntityId{ 4 });
+        EXPECT_EQ(candidates[3].m_netEntityId, NetEntityId{ 1 });
+    }
+
+    TEST_F(EntityReplicationSchedulerTests, MarkSent_UnsentEntityOvertakesHigherPriorityEntity)
+    {
+        EntityReplicationScheduler scheduler;
+        scheduler.BeginSend(AZ::TimeMs{ 1000 });
+
+        // Only one entity is sent per frame, the low priority entity has to wait until its accumulated priority is the highest
+        AZ::TimeMs sendTimeMs = AZ::TimeMs{ 1000 };
+        bool lowPrioritySent = false;
+        for (uint32_t frame = 0; frame < 8 && !lowPrioritySent; ++frame)
+        {
+            sendTimeMs = sendTimeMs + AZ::TimeMs{ 100 };
+            scheduler.BeginSend(sendTimeMs);
+            scheduler.AddCandidate(NetEntityId{ 1 }, nullptr, 1.0f, false);
+            scheduler.AddCandidate(NetEntityId{ 2 }, nullptr, 0.25f, false);
+
+            const EntityReplicationScheduler::Candidate& sent = scheduler.SortCandidates().front();
+            scheduler.MarkSent(sent.m_netEntityId, 0);
+            lowPrioritySent = (sent.m_netEntityId == NetEntityId{ 2 });
+        }
+        EXPECT_TRUE(lowPrioritySent);
+    }
+
+    TEST_F(EntityReplicationSchedulerTests, MarkSent_BudgetRefillsWithElapsedTime)
+    {
+        EntityReplicationScheduler scheduler;
+        scheduler.SetBandwidthLimit(10000);
+        scheduler.BeginSend(AZ::TimeMs{ 1000 });
+
+        // The budget starts with the 100ms the scheduler is allowed to buffer
+        EXPECT_TRUE(scheduler.HasBudget());
+        scheduler.MarkSent(NetEntityId{ 1 }, 1000);
+        EXPECT_FALSE(scheduler.HasBudget());
+
+        scheduler.BeginSend(AZ::TimeMs{ 1010 });
+        EXPECT_TRUE(scheduler.HasBudget());
+        scheduler.MarkSent(NetEntityId{ 1 }, 101);
+        EXPECT_FALSE(scheduler.HasBudget());
+
+        scheduler.SetBandwidthLimit(0);
+        EXPECT_TRUE(scheduler.HasBudget());
+    }
+
+#if defined(HAVE_BENCHMARK)
+    //! Simulates the entity updates a server sends to its clients, with every client seeing a full replication window of
+    //! entities at random distances that change every few frames. The benchmark argument is the bandwidth limit per client in
+    //! bytes per second, the counters report the resulting bandwidth and how long nearby entities wait between updates.
+    class EntityReplicationSchedulerBenchmark
+        : public AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t ClientCount = 200;
+        static constexpr uint32_t EntityCount = 256;
+        static constexpr uint32_t NearEntityCount = 32;
+        static constexpr AZ::TimeMs FrameTimeMs = AZ::TimeMs{ 33 };
+
+        struct SimulatedEntity
+        {
+            float m_priority = 0.0f;
+            uint32_t m_updateSize = 0;
+            bool m_pendingSend = false;
+            AZ::TimeMs m_lastSendTimeMs = AZ::TimeMs{ 0 };
+        };
+
+        struct SimulatedClient
+        {
+            EntityReplicationScheduler m_scheduler;
+            AZStd::vector<SimulatedEntity> m_entities;
+        };
+
+        void SetUp(::benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+
+            AZ::SimpleLcgRandom random(1234);
+            m_clients = AZStd::make_unique<AZStd::vector<SimulatedClient>>(ClientCount);
+            for (SimulatedClient& client : *m_clients)
+            {
+                client.m_scheduler.SetBandwidthLimit(aznumeric_cast<uint32_t>(state.range(0)));
+                client.m_entities.resize(EntityCount);
+                for (uint32_t index = 0; index < EntityCount; ++index)
+                {
+                    // The first entities are the nearby ones, the priority matches ServerToClientReplicationWindow
+                    const float distance = (index < NearEntityCount) ? 2.0f + 8.0f * random.GetRandomFloat() : 10.0f + 490.0f * random.GetRandomFloat();
+                    client.m_entities[index].m_priority = 1.0f / (distance * distance);
+                    client.m_entities[index].m_updateSize = 16 + random.GetRandom() % 112;
+                }
+            }
+            m_timeMs = AZ::TimeMs{ 1000 };
+            m_sentBytes = 0;
+            m_nearSendCount = 0;
+            m_nearWaitMs = 0;
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_clients.reset();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void SimulateFrame(AZ::SimpleLcgRandom& random)
+        {
+            m_timeMs = m_timeMs + FrameTimeMs;
+            for (SimulatedClient& client : *m_clients)
+            {
+                client.m_scheduler.BeginSend(m_timeMs);
+                for (uint32_t index = 0; index < EntityCount; ++index)
+                {
+                    SimulatedEntity& entity = client.m_entities[index];
+                    // Roughly a third of the entities change every frame, changes of unsent entities merge into one update
+                    entity.m_pendingSend = entity.m_pendingSend || (random.GetRandom() % 3) == 0;
+                    if (entity.m_pendingSend)
+                    {
+                        client.m_scheduler.AddCandidate(NetEntityId{ index }, nullptr, entity.m_priority, false);
+                    }
+                }
+
+                for (const EntityReplicationScheduler::Candidate& candidate : client.m_scheduler.SortCandidates())
+                {
+                    if (!client.m_scheduler.HasBudget())
+                    {
+                        break;
+                    }
+                    const uint32_t index = aznumeric_cast<uint32_t>(candidate.m_netEntityId);
+                    SimulatedEntity& entity = client.m_entities[index];
+                    client.m_scheduler.MarkSent(candidate.m_netEntityId, entity.m_updateSize);
+                    entity.m_pendingSend = false;
+                    m_sentBytes += entity.m_updateSize;
+                    if (index < NearEntityCount && entity.m_lastSendTimeMs > AZ::TimeMs{ 0 })
+                    {
+                        m_nearWaitMs += aznumeric_cast<int64_t>(m_timeMs - entity.m_lastSendTimeMs);
+                        ++m_nearSendCount;
+                    }
+                    entity.m_lastSendTimeMs = m_timeMs;
+                }
+            }
+        }
+
+        AZStd::unique_ptr<AZStd::vector<SimulatedClient>> m_clients;
+        AZ::TimeMs m_timeMs = AZ::TimeMs{ 0 };
+        uint64_t m_sentBytes = 0;
+        uint64_t m_nearSendCount = 0;
+        int64_t m_nearWaitMs = 0;
+    };
+
+    BENCHMARK_DEFINE_F(EntityReplicationSchedulerBenchmark, BM_ScheduleEntityUpdates)(benchmark::State& state)
+    {
+        AZ::SimpleLcgRandom random(5678);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            SimulateFrame(random);
+        }
+
+        const double simulatedSeconds = static_cast<double>(state.iterations()) * static_cast<double>(FrameTimeMs) / 1000.0;
+        state.counters["BytesPerClientPerSecond"] = static_cast<double>(m_sentBytes) / (ClientCount * simulatedSeconds);
+        state.counters["NearEntityUpdateIntervalMs"] = m_nearSendCount ? static_cast<double>(m_nearWaitMs) / m_nearSendCount : 0.0;
+        state.SetItemsProcessed(state.iterations() * ClientCount * EntityCount);
+    }
+
+    BENCHMARK_REGISTER_F(EntityReplicationSchedulerBenchmark, BM_ScheduleEntityUpdates)
+        ->Arg(0)
+        ->Arg(8 * 1024)
+        ->Arg(32 * 1024)
+        ->Arg(64 * 1024)
+        ->Unit(benchmark::kMicrosecond);
+#endif
+}
@@ -69,6 +69,8 @@ set(FILES
     Source/EntityDomains/FullOwnershipEntityDomain.h
     Source/NetworkEntity/EntityReplication/EntityReplicationManager.cpp
     Source/NetworkEntity/EntityReplication/EntityReplicationManager.h
+    Source/NetworkEntity/EntityReplication/EntityReplicationScheduler.cpp
+    Source/NetworkEntity/EntityReplication/EntityReplicationScheduler.h
     Source/NetworkEntity/EntityReplication/EntityReplicator.cpp
     Source/NetworkEntity/EntityReplication/EntityReplicator.h
     Source/NetworkEntity/EntityReplication/EntityReplicator.inl
@@ -32,6 +32,17 @@ namespace SurfaceData
         using MutexType = AZStd::recursive_mutex;
 
         virtual void ModifySurfacePoints(SurfacePointList& surfacePointList) const = 0;
+
+        //! Modify a batch of surface point lists.
+        //! The default implementation modifies one list at a time; modifiers should override this if they can share work
+        //! across the batch, such as taking locks or dispatching to other buses just once.
+        virtual void ModifySurfacePointsFromList(AZStd::vector<SurfacePointList>& surfacePointLists) const
+        {
+            for (auto& surfacePointList : surfacePointLists)
+            {
+                ModifySurfacePoints(surfacePointList);
+            }
+        }
     };
 
     typedef AZ::EBus<SurfaceDataModifierRequests> SurfaceDataModifierRequestBus;
@@ -31,6 +31,18 @@ namespace SurfaceData
         using MutexType = AZStd::recursive_mutex;
 
         virtual void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const = 0;
+
+        //! Get the surface points for a batch of input positions.  The points for inPositions[i] get appended to surfacePointLists[i].
+        //! The default implementation queries one position at a time; providers should override this if they can share work
+        //! across the batch, such as taking locks or dispatching to other buses just once.
+        virtual void GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<SurfacePointList>& surfacePointLists) const
+        {
+            AZ_Assert(inPositions.size() == surfacePointLists.size(), "Input position list and surface point lists are different sizes.");
+            for (size_t index = 0; index < inPositions.size(); index++)
+            {
+                GetSurfacePoints(inPositions[index], surfacePointLists[index]);
+            }
+        }
     };
 
     typedef AZ::EBus<SurfaceDataProviderRequests> SurfaceDataProviderRequestBus;
@@ -149,20 +149,46 @@ namespace SurfaceData
 
         if (m_shapeBoundsIsValid)
         {
-            const AZ::Vector3 rayOrigin = AZ::Vector3(inPosition.GetX(), inPosition.GetY(), m_shapeBounds.GetMax().GetZ());
-            const AZ::Vector3 rayDirection = -AZ::Vector3::CreateAxisZ();
-            float intersectionDistance = 0.0f;
-            bool hitShape = false;
-            LmbrCentral::ShapeComponentRequestsBus::EventResult(hitShape, GetEntityId(), &LmbrCentral::ShapeComponentRequestsBus::Events::IntersectRay, rayOrigin, rayDirection, intersectionDistance);
-            if (hitShape)
+            LmbrCentral::ShapeComponentRequestsBus::Event(GetEntityId(), [&](LmbrCentral::ShapeComponentRequests* shape)
             {
-                SurfacePoint point;
-                point.m_entityId = GetEntityId();
-                point.m_position = rayOrigin + intersectionDistance * rayDirection;
-                point.m_normal = AZ::Vector3::CreateAxisZ();
-                AddMaxValueForMasks(point.m_masks, m_configuration.m_providerTags, 1.0f);
-                surfacePointList.push_back(point);
-            }
+                AddSurfacePointIfHit(shape, inPosition, surfacePointList);
+            });
+        }
+    }
+
+    void SurfaceDataShapeComponent::GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<SurfacePointList>& surfacePointLists) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+        AZ_Assert(inPositions.size() == surfacePointLists.size(), "Input position list and surface point lists are different sizes.");
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_shapeBoundsIsValid)
+        {
+            // Dispatch to the shape once for the whole batch instead of once per point.
+            LmbrCentral::ShapeComponentRequestsBus::Event(GetEntityId(), [&](LmbrCentral::ShapeComponentRequests* shape)
+            {
+                for (size_t index = 0; index < inPositions.size(); index++)
+                {
+                    AddSurfacePointIfHit(shape, inPositions[index], surfacePointLists[index]);
+                }
+            });
+        }
+    }
+
+    void SurfaceDataShapeComponent::AddSurfacePointIfHit(LmbrCentral::ShapeComponentRequests* shape, const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const
+    {
+        const AZ::Vector3 rayOrigin = AZ::Vector3(inPosition.GetX(), inPosition.GetY(), m_shapeBounds.GetMax().GetZ());
+        const AZ::Vector3 rayDirection = -AZ::Vector3::CreateAxisZ();
+        float intersectionDistance = 0.0f;
+        if (shape->IntersectRay(rayOrigin, rayDirection, intersectionDistance))
+        {
+            SurfacePoint point;
+            point.m_entityId = GetEntityId();
+            point.m_position = rayOrigin + intersectionDistance * rayDirection;
+            point.m_normal = AZ::Vector3::CreateAxisZ();
+            AddMaxValueForMasks(point.m_masks, m_configuration.m_providerTags, 1.0f);
+            surfacePointList.push_back(point);
         }
     }
 
@@ -174,17 +200,42 @@ namespace SurfaceData
 
         if (m_shapeBoundsIsValid && !m_configuration.m_modifierTags.empty())
         {
-            const AZ::EntityId entityId = GetEntityId();
-            for (auto& point : surfacePointList)
+            LmbrCentral::ShapeComponentRequestsBus::Event(GetEntityId(), [&](LmbrCentral::ShapeComponentRequests* shape)
+            {
+                ModifySurfacePointsInShape(shape, surfacePointList);
+            });
+        }
+    }
+
+    void SurfaceDataShapeComponent::ModifySurfacePointsFromList(AZStd::vector<SurfacePointList>& surfacePointLists) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_shapeBoundsIsValid && !m_configuration.m_modifierTags.empty())
+        {
+            // Dispatch to the shape once for the whole batch instead of once per point.
+            LmbrCentral::ShapeComponentRequestsBus::Event(GetEntityId(), [&](LmbrCentral::ShapeComponentRequests* shape)
+            {
+                for (auto& surfacePointList : surfacePointLists)
+                {
+                    ModifySurfacePointsInShape(shape, surfacePointList);
+                }
+            });
+        }
+    }
+
+    void SurfaceDataShapeComponent::ModifySurfacePointsInShape(LmbrCentral::ShapeComponentRequests* shape, SurfacePointList& surfacePointList) const
+    {
+        const AZ::EntityId entityId = GetEntityId();
+        for (auto& point : surfacePointList)
+        {
+            if (point.m_entityId != entityId && m_shapeBounds.Contains(point.m_position))
             {
-                if (point.m_entityId != entityId && m_shapeBounds.Contains(point.m_position))
+                if (shape->IsPointInside(point.m_position))
                 {
-                    bool inside = false;
-                    LmbrCentral::ShapeComponentRequestsBus::EventResult(inside, GetEntityId(), &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInside, point.m_position);
-                    if (inside)
-                    {
-                        AddMaxValueForMasks(point.m_masks, m_configuration.m_modifierTags, 1.0f);
-                    }
+                    AddMaxValueForMasks(point.m_masks, m_configuration.m_modifierTags, 1.0f);
                 }
             }
         }
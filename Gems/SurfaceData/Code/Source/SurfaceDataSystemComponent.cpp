@@ -9,6 +9,8 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/sort.h>
 
 #include "SurfaceDataSystemComponent.h"
@@ -100,11 +102,15 @@ namespace SurfaceData
     void SurfaceDataSystemComponent::Activate()
     {
         SurfaceDataSystemRequestBus::Handler::BusConnect();
+        SurfaceDataSystemNotificationBus::Handler::BusConnect();
     }
 
     void SurfaceDataSystemComponent::Deactivate()
     {
+        SurfaceDataSystemNotificationBus::Handler::BusDisconnect();
         SurfaceDataSystemRequestBus::Handler::BusDisconnect();
+
+        InvalidateCachedRegions(AZ::Aabb::CreateNull());
     }
 
     SurfaceDataRegistryHandle SurfaceDataSystemComponent::RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry)
@@ -178,6 +184,14 @@ namespace SurfaceData
         SurfaceDataSystemNotificationBus::Broadcast(&SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, AZ::EntityId(), dirtyBounds, dirtyBounds);
     }
 
+    void SurfaceDataSystemComponent::OnSurfaceChanged([[maybe_unused]] const AZ::EntityId& entityId, const AZ::Aabb& oldBounds, const AZ::Aabb& newBounds)
+    {
+        // Every surface change, whether it comes from a provider / modifier registration update, a RefreshSurfaceData call,
+        // or a direct broadcast, is routed through this notification, so it's the one place we need to invalidate the cache.
+        InvalidateCachedRegions(oldBounds);
+        InvalidateCachedRegions(newBounds);
+    }
+
     void SurfaceDataSystemComponent::GetSurfacePoints(const AZ::Vector3& inPosition, const SurfaceTagVector& desiredTags, SurfacePointList& surfacePointList) const
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
@@ -230,6 +244,31 @@ namespace SurfaceData
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
 
+        RegionCacheKey key;
+        key.m_regionMin = AZ::Vector2(inRegion.GetMin().GetX(), inRegion.GetMin().GetY());
+        key.m_regionMax = AZ::Vector2(inRegion.GetMax().GetX(), inRegion.GetMax().GetY());
+        key.m_stepSize = stepSize;
+        key.m_desiredTags = desiredTags;
+
+        // Repeated queries over unchanged surfaces (such as vegetation sectors refilling) can be served directly from the cache.
+        if (FindCachedRegion(key, surfacePointListPerPosition))
+        {
+            return;
+        }
+
+        // Capture the cache generation before querying so that if a surface changes while we're building the results,
+        // we don't put the potentially-stale results into the cache.
+        const AZ::u64 cacheGeneration = m_regionCacheGeneration.load();
+
+        GetSurfacePointsFromRegionInternal(inRegion, stepSize, desiredTags, surfacePointListPerPosition);
+
+        AddCachedRegion(key, surfacePointListPerPosition, cacheGeneration);
+    }
+
+    void SurfaceDataSystemComponent::GetSurfacePointsFromRegionInternal(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags, SurfacePointListPerPosition& surfacePointListPerPosition) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
         AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
 
         surfacePointListPerPosition.clear();
@@ -248,9 +287,16 @@ namespace SurfaceData
         const bool hasDesiredTags = HasValidTags(desiredTags);
         const bool hasModifierTags = hasDesiredTags && HasMatchingTags(desiredTags, m_registeredModifierTags);
 
-        // Loop through each data provider, and query all the points for each one.  This allows us to check the tags and the overall
-        // AABB bounds just once per provider, instead of once per point.  It also allows for an eventual optimization in which we could send
-        // the list of points directly into each SurfaceDataProvider.
+        // Scratch lists for the batches, reused across providers and modifiers. They're local to the call because the registration
+        // mutex is recursive, so a provider querying surface data from inside a batch would otherwise overwrite the batch in flight.
+        AZStd::vector<AZ::Vector3> batchPositions;
+        AZStd::vector<SurfacePointList> batchPointLists;
+        AZStd::vector<size_t> batchIndices;
+
+        // Loop through each data provider, and send it the batch of all the points it overlaps.  This allows us to check the tags and
+        // the overall AABB bounds just once per provider, instead of once per point, and lets each provider share work across the batch.
+        // The per-position lists are swapped into the batch and back out again rather than copied, so batching doesn't cost any
+        // extra point copies.
         for (const auto& entryPair : m_registeredSurfaceDataProviders)
         {
             const SurfaceDataRegistryEntry& entry = entryPair.second;
@@ -260,14 +306,32 @@ namespace SurfaceData
                 ( alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion) )
                 )
             {
-                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+                batchPositions.clear();
+                batchIndices.clear();
+                for (size_t index = 0; index < surfacePointListPerPosition.size(); index++)
                 {
-                    const auto& point2d = surfacePointListAndPoint.first;
-                    SurfacePointList& surfacePointList = surfacePointListAndPoint.second;
+                    const auto& point2d = surfacePointListPerPosition[index].first;
                     AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
                     if (alwaysApplies || entry.m_bounds.Contains(point3d))
                     {
-                        SurfaceDataProviderRequestBus::Event(entryPair.first, &SurfaceDataProviderRequestBus::Events::GetSurfacePoints, point3d, surfacePointList);
+                        batchPositions.push_back(point3d);
+                        batchIndices.push_back(index);
+                    }
+                }
+
+                if (!batchIndices.empty())
+                {
+                    batchPointLists.resize(batchIndices.size());
+                    for (size_t batchIndex = 0; batchIndex < batchIndices.size(); batchIndex++)
+                    {
+                        AZStd::swap(batchPointLists[batchIndex], surfacePointListPerPosition[batchIndices[batchIndex]].second);
+                    }
+
+                    SurfaceDataProviderRequestBus::Event(entryPair.first, &SurfaceDataProviderRequestBus::Events::GetSurfacePointsFromList, batchPositions, batchPointLists);
+
+                    for (size_t batchIndex = 0; batchIndex < batchIndices.size(); batchIndex++)
+                    {
+                        AZStd::swap(batchPointLists[batchIndex], surfacePointListPerPosition[batchIndices[batchIndex]].second);
                     }
                 }
             }
@@ -285,19 +349,35 @@ namespace SurfaceData
 
             if (alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion))
             {
-                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+                batchIndices.clear();
+                for (size_t index = 0; index < surfacePointListPerPosition.size(); index++)
                 {
-                    const auto& point2d = surfacePointListAndPoint.first;
-                    SurfacePointList& surfacePointList = surfacePointListAndPoint.second;
-                    if (!surfacePointList.empty())
+                    const auto& point2d = surfacePointListPerPosition[index].first;
+                    if (!surfacePointListPerPosition[index].second.empty())
                     {
                         AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
                         if (alwaysApplies || entry.m_bounds.Contains(point3d))
                         {
-                            SurfaceDataModifierRequestBus::Event(entryPair.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePoints, surfacePointList);
+                            batchIndices.push_back(index);
                         }
                     }
                 }
+
+                if (!batchIndices.empty())
+                {
+                    batchPointLists.resize(batchIndices.size());
+                    for (size_t batchIndex = 0; batchIndex < batchIndices.size(); batchIndex++)
+                    {
+                        AZStd::swap(batchPointLists[batchIndex], surfacePointListPerPosition[batchIndices[batchIndex]].second);
+                    }
+
+                    SurfaceDataModifierRequestBus::Event(entryPair.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePointsFromList, batchPointLists);
+
+                    for (size_t batchIndex = 0; batchIndex < batchIndices.size(); batchIndex++)
+                    {
+                        AZStd::swap(batchPointLists[batchIndex], surfacePointListPerPosition[batchIndices[batchIndex]].second);
+                    }
+                }
             }
         }
 
@@ -315,6 +395,152 @@ namespace SurfaceData
         }
     }
 
+    bool SurfaceDataSystemComponent::RegionCacheKey::operator==(const RegionCacheKey& rhs) const
+    {
+        return m_regionMin == rhs.m_regionMin
+            && m_regionMax == rhs.m_regionMax
+            && m_stepSize == rhs.m_stepSize
+            && m_desiredTags == rhs.m_desiredTags;
+    }
+
+    size_t SurfaceDataSystemComponent::RegionCacheKeyHasher::operator()(const RegionCacheKey& key) const
+    {
+        size_t hash = 0;
+        AZStd::hash_combine(hash, key.m_regionMin.GetX(), key.m_regionMin.GetY());
+        AZStd::hash_combine(hash, key.m_regionMax.GetX(), key.m_regionMax.GetY());
+        AZStd::hash_combine(hash, key.m_stepSize.GetX(), key.m_stepSize.GetY());
+        for (const auto& tag : key.m_desiredTags)
+        {
+            AZStd::hash_combine(hash, static_cast<AZ::u32>(tag));
+        }
+        return hash;
+    }
+
+    bool SurfaceDataSystemComponent::FindCachedRegion(const RegionCacheKey& key, SurfacePointListPerPosition& surfacePointListPerPosition) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZStd::shared_ptr<const SurfacePointListPerPosition> cachedResults;
+        {
+            AZStd::lock_guard<decltype(m_regionCacheMutex)> cacheLock(m_regionCacheMutex);
+
+            auto cacheItr = m_regionCache.find(key);
+            if (cacheItr == m_regionCache.end())
+            {
+                return false;
+            }
+
+            // Move the entry to the front of the LRU list.
+            m_regionCacheLru.splice(m_regionCacheLru.begin(), m_regionCacheLru, cacheItr->second.m_lruEntry);
+
+            cachedResults = cacheItr->second.m_surfacePointListPerPosition;
+        }
+
+        // The cached results are never modified, so they can be copied out without holding the lock, even if the entry gets
+        // evicted or invalidated in the meantime.
+        surfacePointListPerPosition = *cachedResults;
+        return true;
+    }
+
+    void SurfaceDataSystemComponent::AddCachedRegion(const RegionCacheKey& key, const SurfacePointListPerPosition& surfacePointListPerPosition, AZ::u64 cacheGeneration) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        // Don't bother caching results that would push everything else out of the cache.
+        const size_t sizeInBytes = GetCachedRegionSizeInBytes(surfacePointListPerPosition);
+        if (sizeInBytes > s_maxCachedRegionBytes)
+        {
+            return;
+        }
+
+        // Copy the results before taking the lock so that other threads can keep using the cache meanwhile.
+        AZStd::shared_ptr<const SurfacePointListPerPosition> cachedResults = AZStd::make_shared<SurfacePointListPerPosition>(surfacePointListPerPosition);
+
+        AZStd::lock_guard<decltype(m_regionCacheMutex)> cacheLock(m_regionCacheMutex);
+
+        // A surface changed while the results were being generated, so they might already be out of date.
+        if (cacheGeneration != m_regionCacheGeneration.load())
+        {
+            return;
+        }
+
+        EraseCachedRegion(key);
+
+        // Evict the least-recently-used regions until the new one fits.
+        while (!m_regionCacheLru.empty() && (m_regionCacheSizeInBytes + sizeInBytes > s_maxCachedRegionBytes))
+        {
+            EraseCachedRegion(m_regionCacheLru.back());
+        }
+
+        m_regionCacheLru.push_front(key);
+        RegionCacheEntry& entry = m_regionCache[key];
+        entry.m_surfacePointListPerPosition = AZStd::move(cachedResults);
+        entry.m_sizeInBytes = sizeInBytes;
+        entry.m_lruEntry = m_regionCacheLru.begin();
+        m_regionCacheSizeInBytes += sizeInBytes;
+    }
+
+    void SurfaceDataSystemComponent::EraseCachedRegion(const RegionCacheKey& key) const
+    {
+        auto cacheItr = m_regionCache.find(key);
+        if (cacheItr != m_regionCache.end())
+        {
+            m_regionCacheSizeInBytes -= cacheItr->second.m_sizeInBytes;
+            m_regionCacheLru.erase(cacheItr->second.m_lruEntry);
+            m_regionCache.erase(cacheItr);
+        }
+    }
+
+    size_t SurfaceDataSystemComponent::GetCachedRegionSizeInBytes(const SurfacePointListPerPosition& surfacePointListPerPosition)
+    {
+        // This is an estimate of the heap memory a copy of the results uses.  The tag weight maps are counted as one node per
+        // entry plus their buckets.
+        size_t sizeInBytes = surfacePointListPerPosition.size() * sizeof(SurfacePointListPerPosition::value_type);
+        for (const auto& positionEntry : surfacePointListPerPosition)
+        {
+            sizeInBytes += positionEntry.second.size() * sizeof(SurfacePoint);
+            for (const SurfacePoint& point : positionEntry.second)
+            {
+                sizeInBytes += point.m_masks.size() * (sizeof(SurfaceTagWeightMap::value_type) + 2 * sizeof(void*));
+                sizeInBytes += point.m_masks.bucket_count() * sizeof(void*);
+            }
+        }
+        return sizeInBytes;
+    }
+
+    void SurfaceDataSystemComponent::InvalidateCachedRegions(const AZ::Aabb& dirtyBounds)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZStd::lock_guard<decltype(m_regionCacheMutex)> cacheLock(m_regionCacheMutex);
+
+        ++m_regionCacheGeneration;
+
+        // An invalid AABB means that the change isn't constrained to any specific area, so everything needs to be refreshed.
+        if (!dirtyBounds.IsValid())
+        {
+            m_regionCache.clear();
+            m_regionCacheLru.clear();
+            m_regionCacheSizeInBytes = 0;
+            return;
+        }
+
+        for (auto lruItr = m_regionCacheLru.begin(); lruItr != m_regionCacheLru.end(); )
+        {
+            const AZ::Aabb cachedRegion = AZ::Aabb::CreateFromMinMax(
+                AZ::Vector3(lruItr->m_regionMin.GetX(), lruItr->m_regionMin.GetY(), dirtyBounds.GetMin().GetZ()),
+                AZ::Vector3(lruItr->m_regionMax.GetX(), lruItr->m_regionMax.GetY(), dirtyBounds.GetMax().GetZ()));
+
+            // Step past the entry before erasing it, since erasing it removes it from the LRU list.
+            const RegionCacheKey& key = *lruItr;
+            ++lruItr;
+            if (AabbOverlaps2D(cachedRegion, dirtyBounds))
+            {
+                EraseCachedRegion(key);
+            }
+        }
+    }
+
     void SurfaceDataSystemComponent::CombineSortAndFilterNeighboringPoints(SurfacePointList& sourcePointList, bool hasDesiredTags, const SurfaceTagVector& desiredTags) const
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
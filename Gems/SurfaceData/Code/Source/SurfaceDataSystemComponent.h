@@ -10,13 +10,19 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
+#include <SurfaceData/SurfaceDataSystemNotificationBus.h>
 
 namespace SurfaceData
 {
     class SurfaceDataSystemComponent
         : public AZ::Component
         , private SurfaceDataSystemRequestBus::Handler
+        , private SurfaceDataSystemNotificationBus::Handler
     {
     public:
         AZ_COMPONENT(SurfaceDataSystemComponent, "{6F334BAA-7BD5-45F8-A9BA-760667D25FA0}");
@@ -50,8 +56,44 @@ namespace SurfaceData
         void UpdateSurfaceDataModifier(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry) override;
 
         void RefreshSurfaceData(const AZ::Aabb& dirtyArea) override;
+
+        ////////////////////////////////////////////////////////////////////////
+        // SurfaceDataSystemNotificationBus implementation
+        void OnSurfaceChanged(const AZ::EntityId& entityId, const AZ::Aabb& oldBounds, const AZ::Aabb& newBounds) override;
+
     private:
         void CombineSortAndFilterNeighboringPoints(SurfacePointList& sourcePointList, bool hasDesiredTags, const SurfaceTagVector& desiredTags) const;
+        void GetSurfacePointsFromRegionInternal(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags, SurfacePointListPerPosition& surfacePointListPerPosition) const;
+
+        // Identifies a single GetSurfacePointsFromRegion query.  Only the XY dimensions of the region affect the results.
+        struct RegionCacheKey
+        {
+            AZ::Vector2 m_regionMin;
+            AZ::Vector2 m_regionMax;
+            AZ::Vector2 m_stepSize;
+            SurfaceTagVector m_desiredTags;
+
+            bool operator==(const RegionCacheKey& rhs) const;
+        };
+
+        struct RegionCacheKeyHasher
+        {
+            size_t operator()(const RegionCacheKey& key) const;
+        };
+
+        struct RegionCacheEntry
+        {
+            // Shared and immutable, so a hit only holds the cache lock long enough to take a reference to the results.
+            AZStd::shared_ptr<const SurfacePointListPerPosition> m_surfacePointListPerPosition;
+            size_t m_sizeInBytes = 0;
+            AZStd::list<RegionCacheKey>::iterator m_lruEntry;
+        };
+
+        bool FindCachedRegion(const RegionCacheKey& key, SurfacePointListPerPosition& surfacePointListPerPosition) const;
+        void AddCachedRegion(const RegionCacheKey& key, const SurfacePointListPerPosition& surfacePointListPerPosition, AZ::u64 cacheGeneration) const;
+        void InvalidateCachedRegions(const AZ::Aabb& dirtyBounds);
+        void EraseCachedRegion(const RegionCacheKey& key) const;
+        static size_t GetCachedRegionSizeInBytes(const SurfacePointListPerPosition& surfacePointListPerPosition);
 
         SurfaceDataRegistryHandle RegisterSurfaceDataProviderInternal(const SurfaceDataRegistryEntry& entry);
         SurfaceDataRegistryEntry UnregisterSurfaceDataProviderInternal(const SurfaceDataRegistryHandle& handle);
@@ -70,5 +112,16 @@ namespace SurfaceData
 
         //point vector reserved for reuse
         mutable SurfacePointList m_targetPointList;
+
+        //cache of GetSurfacePointsFromRegion results, invalidated whenever any surface changes within a cached region
+        //and limited by the approximate memory the results use, since the number of points per region varies a lot
+        static const size_t s_maxCachedRegionBytes = 64 * 1024 * 1024;
+        mutable AZStd::recursive_mutex m_regionCacheMutex;
+        mutable AZStd::unordered_map<RegionCacheKey, RegionCacheEntry, RegionCacheKeyHasher> m_regionCache;
+        mutable size_t m_regionCacheSizeInBytes = 0;
+        //least-recently-used order of the cached regions, most recent at the front
+        mutable AZStd::list<RegionCacheKey> m_regionCacheLru;
+        //incremented on every invalidation so that queries that started before a surface change don't cache stale results
+        AZStd::atomic<AZ::u64> m_regionCacheGeneration{ 0 };
     };
 }
@@ -162,19 +162,26 @@ namespace SurfaceData
         {
             auto enumerationCallback = [&](AzFramework::Terrain::TerrainDataRequests* terrain) -> bool
             {
-                if (terrain->GetTerrainAabb().Contains(inPosition))
+                AddTerrainSurfacePoint(terrain, inPosition, surfacePointList);
+                // Only one handler should exist.
+                return false;
+            };
+            AzFramework::Terrain::TerrainDataRequestBus::EnumerateHandlers(enumerationCallback);
+        }
+    }
+
+    void TerrainSurfaceDataSystemComponent::GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<SurfacePointList>& surfacePointLists) const
+    {
+        AZ_Assert(inPositions.size() == surfacePointLists.size(), "Input position list and surface point lists are different sizes.");
+
+        if (m_terrainBoundsIsValid)
+        {
+            // Look up the terrain handler once for the whole batch instead of once per point.
+            auto enumerationCallback = [&](AzFramework::Terrain::TerrainDataRequests* terrain) -> bool
+            {
+                for (size_t index = 0; index < inPositions.size(); index++)
                 {
-                    bool isTerrainValidAtPoint = false;
-                    const float terrainHeight = terrain->GetHeight(inPosition, AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR, &isTerrainValidAtPoint);
-                    const bool isHole = !isTerrainValidAtPoint;
-
-                    SurfacePoint point;
-                    point.m_entityId = GetEntityId();
-                    point.m_position = AZ::Vector3(inPosition.GetX(), inPosition.GetY(), terrainHeight);
-                    point.m_normal = terrain->GetNormal(inPosition);
-                    const AZ::Crc32 terrainTag = isHole ? Constants::s_terrainHoleTagCrc : Constants::s_terrainTagCrc;
-                    AddMaxValueForMasks(point.m_masks, terrainTag, 1.0f);
-                    surfacePointList.push_back(point);
+                    AddTerrainSurfacePoint(terrain, inPositions[index], surfacePointLists[index]);
                 }
                 // Only one handler should exist.
                 return false;
@@ -183,6 +190,24 @@ namespace SurfaceData
         }
     }
 
+    void TerrainSurfaceDataSystemComponent::AddTerrainSurfacePoint(AzFramework::Terrain::TerrainDataRequests* terrain, const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const
+    {
+        if (terrain->GetTerrainAabb().Contains(inPosition))
+        {
+            bool isTerrainValidAtPoint = false;
+            const float terrainHeight = terrain->GetHeight(inPosition, AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR, &isTerrainValidAtPoint);
+            const bool isHole = !isTerrainValidAtPoint;
+
+            SurfacePoint point;
+            point.m_entityId = GetEntityId();
+            point.m_position = AZ::Vector3(inPosition.GetX(), inPosition.GetY(), terrainHeight);
+            point.m_normal = terrain->GetNormal(inPosition);
+            const AZ::Crc32 terrainTag = isHole ? Constants::s_terrainHoleTagCrc : Constants::s_terrainTagCrc;
+            AddMaxValueForMasks(point.m_masks, terrainTag, 1.0f);
+            surfacePointList.push_back(point);
+        }
+    }
+
     AZ::Aabb TerrainSurfaceDataSystemComponent::GetSurfaceAabb() const
     {
         auto terrain = AzFramework::Terrain::TerrainDataRequestBus::FindFirstHandler();
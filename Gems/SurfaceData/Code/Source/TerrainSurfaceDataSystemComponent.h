@@ -15,6 +15,14 @@
 #include <SurfaceData/SurfaceDataModifierRequestBus.h>
 #include <SurfaceData/SurfaceDataProviderRequestBus.h>
 
+namespace AzFramework
+{
+    namespace Terrain
+    {
+        class TerrainDataRequests;
+    }
+}
+
 namespace SurfaceData
 {
     class TerrainSurfaceDataSystemConfig
@@ -59,6 +67,7 @@ namespace SurfaceData
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataProviderRequestBus
         void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const;
+        void GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<SurfacePointList>& surfacePointLists) const override;
 
         ////////////////////////////////////////////////////////////////////////////
         // CrySystemEvents
@@ -70,6 +79,8 @@ namespace SurfaceData
         void HeightmapModified(const AZ::Aabb& bounds) override;
 
     private:
+        void AddTerrainSurfacePoint(AzFramework::Terrain::TerrainDataRequests* terrain, const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const;
+
         void UpdateTerrainData(const AZ::Aabb& dirtyRegion);
         AZ::Aabb GetSurfaceAabb() const;
         SurfaceTagVector GetSurfaceTags() const;
@@ -20,6 +20,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Script/ScriptContext.h>
 #include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <SurfaceDataSystemComponent.h>
 #include <SurfaceDataModule.h>
 #include <SurfaceData/SurfaceDataProviderRequestBus.h>
@@ -81,6 +82,9 @@ class MockSurfaceProvider
             Unregister();
         }
 
+        // The number of positions this provider has been queried for, used to verify caching behavior.
+        mutable AZStd::atomic_int m_queryCount{ 0 };
+
     private:
         AZStd::unordered_map<AZStd::pair<float, float>, SurfaceData::SurfacePointList> m_GetSurfacePoints;
         SurfaceData::SurfaceTagVector m_tags;
@@ -172,6 +176,8 @@ class MockSurfaceProvider
         // SurfaceDataProviderRequestBus
         void GetSurfacePoints(const AZ::Vector3& inPosition, SurfaceData::SurfacePointList& surfacePointList) const override
         {
+            ++m_queryCount;
+
             auto surfacePoints = m_GetSurfacePoints.find(AZStd::make_pair(inPosition.GetX(), inPosition.GetY()));
 
             if (surfacePoints != m_GetSurfacePoints.end())
@@ -743,4 +749,124 @@ TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_DissimilarPoi
     }
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_RepeatedQueriesAreCached)
+{
+    // This test verifies that repeating an identical region query returns the same results without querying
+    // the surface providers again.
+
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider mockProvider(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f));
+
+    AZ::Vector2 stepSize(1.0f, 1.0f);
+    AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(4.0f));
+
+    SurfaceData::SurfacePointListPerPosition firstPointsPerPosition;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+        regionBounds, stepSize, providerTags, firstPointsPerPosition);
+    const int firstQueryCount = mockProvider.m_queryCount;
+    EXPECT_GT(firstQueryCount, 0);
+
+    SurfaceData::SurfacePointListPerPosition secondPointsPerPosition;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+        regionBounds, stepSize, providerTags, secondPointsPerPosition);
+    EXPECT_EQ(mockProvider.m_queryCount, firstQueryCount);
+
+    ASSERT_EQ(firstPointsPerPosition.size(), secondPointsPerPosition.size());
+    for (size_t index = 0; index < firstPointsPerPosition.size(); index++)
+    {
+        EXPECT_TRUE(firstPointsPerPosition[index].first == secondPointsPerPosition[index].first);
+        ASSERT_EQ(firstPointsPerPosition[index].second.size(), secondPointsPerPosition[index].second.size());
+        for (size_t pointIndex = 0; pointIndex < firstPointsPerPosition[index].second.size(); pointIndex++)
+        {
+            EXPECT_TRUE(firstPointsPerPosition[index].second[pointIndex].m_position == secondPointsPerPosition[index].second[pointIndex].m_position);
+        }
+    }
+
+    // A query with a different set of tags isn't the same query, so it shouldn't come from the cache.
+    SurfaceData::SurfacePointListPerPosition otherTagsPointsPerPosition;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+        regionBounds, stepSize, SurfaceData::SurfaceTagVector(), otherTagsPointsPerPosition);
+    EXPECT_GT(mockProvider.m_queryCount, firstQueryCount);
+}
+
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_RefreshInvalidatesOverlappingCachedRegions)
+{
+    // This test verifies that RefreshSurfaceData only invalidates the cached regions that it overlaps.
+
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider mockProvider(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f));
+
+    AZ::Vector2 stepSize(1.0f, 1.0f);
+    AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(4.0f));
+
+    auto queryRegion = [&]()
+    {
+        SurfaceData::SurfacePointListPerPosition availablePointsPerPosition;
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+            regionBounds, stepSize, providerTags, availablePointsPerPosition);
+        EXPECT_TRUE(ValidateRegionListSize(regionBounds, stepSize, availablePointsPerPosition));
+    };
+
+    queryRegion();
+    const int initialQueryCount = mockProvider.m_queryCount;
+
+    // Refreshing an area that doesn't overlap the query region leaves the cached results alone.
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(&SurfaceData::SurfaceDataSystemRequestBus::Events::RefreshSurfaceData,
+        AZ::Aabb::CreateFromMinMax(AZ::Vector3(16.0f), AZ::Vector3(20.0f)));
+    queryRegion();
+    EXPECT_EQ(mockProvider.m_queryCount, initialQueryCount);
+
+    // Refreshing an overlapping area causes the region to get queried again.
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(&SurfaceData::SurfaceDataSystemRequestBus::Events::RefreshSurfaceData,
+        AZ::Aabb::CreateFromMinMax(AZ::Vector3(2.0f), AZ::Vector3(3.0f)));
+    queryRegion();
+    EXPECT_EQ(mockProvider.m_queryCount, initialQueryCount * 2);
+}
+
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_CachedResultsAreNotAffectedByCallers)
+{
+    // This test verifies that the results handed out from the cache are copies, so a caller changing its list
+    // doesn't change what later queries get back.
+
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider mockProvider(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f));
+
+    AZ::Vector2 stepSize(1.0f, 1.0f);
+    AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(4.0f));
+
+    SurfaceData::SurfacePointListPerPosition firstPointsPerPosition;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+        regionBounds, stepSize, providerTags, firstPointsPerPosition);
+    const int firstQueryCount = mockProvider.m_queryCount;
+
+    SurfaceData::SurfacePointListPerPosition cachedPointsPerPosition;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+        regionBounds, stepSize, providerTags, cachedPointsPerPosition);
+    ASSERT_EQ(mockProvider.m_queryCount, firstQueryCount);
+    ASSERT_FALSE(cachedPointsPerPosition.empty());
+    cachedPointsPerPosition.front().second.clear();
+    cachedPointsPerPosition.pop_back();
+
+    SurfaceData::SurfacePointListPerPosition secondPointsPerPosition;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+        regionBounds, stepSize, providerTags, secondPointsPerPosition);
+    EXPECT_EQ(mockProvider.m_queryCount, firstQueryCount);
+
+    ASSERT_EQ(firstPointsPerPosition.size(), secondPointsPerPosition.size());
+    for (size_t index = 0; index < firstPointsPerPosition.size(); index++)
+    {
+        EXPECT_EQ(firstPointsPerPosition[index].second.size(), secondPointsPerPosition[index].second.size());
+    }
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -19,6 +19,7 @@ namespace Vegetation
     {
         AZStd::atomic_int m_areaTaskQueueCount{ 0 };
         AZStd::atomic_int m_areaTaskActiveCount{ 0 };
+        AZStd::atomic_int m_sectorsPerSecond{ 0 };
     };
 
     class DebugSystemData
@@ -136,13 +136,14 @@ namespace Vegetation
         if (serialize)
         {
             serialize->Class<AreaSystemConfig, AZ::ComponentConfig>()
-                ->Version(4, &AreaSystemUtil::UpdateVersion)
+                ->Version(5, &AreaSystemUtil::UpdateVersion)
                 ->Field("ViewRectangleSize", &AreaSystemConfig::m_viewRectangleSize)
                 ->Field("SectorDensity", &AreaSystemConfig::m_sectorDensity)
                 ->Field("SectorSizeInMeters", &AreaSystemConfig::m_sectorSizeInMeters)
                 ->Field("ThreadProcessingIntervalMs", &AreaSystemConfig::m_threadProcessingIntervalMs)
                 ->Field("SectorSearchPadding", &AreaSystemConfig::m_sectorSearchPadding)
                 ->Field("SectorPointSnapMode", &AreaSystemConfig::m_sectorPointSnapMode)
+                ->Field("MaxSectorProcessTimeMicroseconds", &AreaSystemConfig::m_maxSectorProcessTimeMicroseconds)
             ;
 
             AZ::EditContext* edit = serialize->GetEditContext();
@@ -173,6 +174,8 @@ namespace Vegetation
                     ->DataElement(AZ::Edit::UIHandlers::ComboBox, &AreaSystemConfig::m_sectorPointSnapMode, "Sector Point Snap Mode", "Controls whether vegetation placement points are located at the corner or the center of the cell.")
                     ->EnumAttribute(SnapMode::Corner, "Corner")
                     ->EnumAttribute(SnapMode::Center, "Center")
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &AreaSystemConfig::m_maxSectorProcessTimeMicroseconds, "Max Sector Process Time Microseconds", "Maximum number of microseconds allowed for creating and filling sectors each tick.  0 means unlimited.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0)
                 ;
             }
         }
@@ -186,6 +189,7 @@ namespace Vegetation
                 ->Property("sectorDensity", BehaviorValueProperty(&AreaSystemConfig::m_sectorDensity))
                 ->Property("sectorSizeInMeters", BehaviorValueProperty(&AreaSystemConfig::m_sectorSizeInMeters))
                 ->Property("threadProcessingIntervalMs", BehaviorValueProperty(&AreaSystemConfig::m_threadProcessingIntervalMs))
+                ->Property("maxSectorProcessTimeMicroseconds", BehaviorValueProperty(&AreaSystemConfig::m_maxSectorProcessTimeMicroseconds))
                 ->Property("sectorPointSnapMode",
                 [](AreaSystemConfig* config) { return static_cast<AZ::u8>(config->m_sectorPointSnapMode); },
                 [](AreaSystemConfig* config, const AZ::u8& i) { config->m_sectorPointSnapMode = static_cast<SnapMode>(i); })
@@ -732,6 +736,9 @@ namespace Vegetation
         m_worldToSector = 1.0f / m_configuration.m_sectorSizeInMeters;
         m_vegetationThreadTaskTimer -= deltaTime;
 
+        // Let the vegetation thread know that a new tick has started so that it can reset its sector processing budget.
+        m_threadData.m_tickCount.fetch_add(1, AZStd::memory_order_relaxed);
+
         // Check to see if any vegetation data has changed since last tick, and if so, offload the updates to a vegetation thread.
         // - If the thread is currently stopped, check for data changes and start up the thread if changes are detected.
         // - If the thread has an interrupt requested, wait for the interrupt to stop the thread before checking and potentially running again.
@@ -778,6 +785,7 @@ namespace Vegetation
                     m_cachedMainThreadData.m_sectorSizeInMeters = m_configuration.m_sectorSizeInMeters;
                     m_cachedMainThreadData.m_sectorDensity = m_configuration.m_sectorDensity;
                     m_cachedMainThreadData.m_sectorPointSnapMode = m_configuration.m_sectorPointSnapMode;
+                    m_cachedMainThreadData.m_maxSectorProcessTimeMicroseconds = m_configuration.m_maxSectorProcessTimeMicroseconds;
                 }
 
                 // Set the state to Dirty to signal the thread that it will need to pull a new copy of the main thread state data
@@ -1442,6 +1450,26 @@ namespace Vegetation
         VEG_PROFILE_METHOD(DebugSystemDataBus::BroadcastResult(m_debugData, &DebugSystemDataBus::Events::GetDebugData));
     }
 
+    void AreaSystemComponent::VegetationThreadTasks::RecordProcessedSector()
+    {
+        ++m_processedSectorCount;
+
+        // Publish the rate roughly once a second so that the stat is stable enough to read.
+        const auto currentTime = AZStd::chrono::steady_clock::now();
+        const auto elapsedMicroseconds = AZStd::chrono::microseconds(currentTime - m_processedSectorWindowStart).count();
+        if (elapsedMicroseconds >= 1000000)
+        {
+            if (m_debugData)
+            {
+                const float sectorsPerSecond = (m_processedSectorCount * 1000000.0f) / elapsedMicroseconds;
+                m_debugData->m_sectorsPerSecond.store(aznumeric_cast<int>(sectorsPerSecond), AZStd::memory_order_relaxed);
+            }
+
+            m_processedSectorCount = 0;
+            m_processedSectorWindowStart = currentTime;
+        }
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // PersistentThreadData
 
@@ -1494,7 +1522,17 @@ namespace Vegetation
 
             if (keepProcessing)
             {
+                if (IsSectorProcessBudgetExhausted(threadData))
+                {
+                    // We've used up this tick's budget, so wait for the main thread to start a new tick before doing more.
+                    // We keep looping instead of exiting so that interrupts and data changes are still picked up promptly.
+                    AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+                    continue;
+                }
+
+                const auto startTime = AZStd::chrono::steady_clock::now();
                 keepProcessing = UpdateOneSector(threadData, vegTasks);
+                m_budgetTimeUsed += AZStd::chrono::microseconds(AZStd::chrono::steady_clock::now() - startTime);
             }
         }
     }
@@ -1825,6 +1863,7 @@ namespace Vegetation
                 }
             }
 
+            vegTasks->RecordProcessedSector();
             return true;
         }
 
@@ -1832,4 +1871,23 @@ namespace Vegetation
         return false;
     }
 
+    bool AreaSystemComponent::UpdateContext::IsSectorProcessBudgetExhausted(const PersistentThreadData* threadData)
+    {
+        const int maxSectorProcessTimeMicroseconds = m_cachedMainThreadData.m_maxSectorProcessTimeMicroseconds;
+        if (maxSectorProcessTimeMicroseconds <= 0)
+        {
+            return false;
+        }
+
+        // Reset the budget whenever the main thread has started a new tick.
+        const AZ::u64 tickCount = threadData->m_tickCount.load(AZStd::memory_order_relaxed);
+        if (tickCount != m_budgetTickCount)
+        {
+            m_budgetTickCount = tickCount;
+            m_budgetTimeUsed = AZStd::chrono::microseconds(0);
+        }
+
+        return m_budgetTimeUsed.count() >= maxSectorProcessTimeMicroseconds;
+    }
+
 }
@@ -15,6 +15,7 @@
 #include <AzCore/std/parallel/semaphore.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <GradientSignal/Ebuses/SectorDataRequestBus.h>
 #include <SurfaceData/SurfaceDataSystemNotificationBus.h>
 #include <CrySystemBus.h>
@@ -50,7 +51,8 @@ namespace Vegetation
                    && m_sectorSizeInMeters == other.m_sectorSizeInMeters
                    && m_threadProcessingIntervalMs == other.m_threadProcessingIntervalMs
                    && m_sectorSearchPadding == other.m_sectorSearchPadding
-                   && m_sectorPointSnapMode == other.m_sectorPointSnapMode;
+                   && m_sectorPointSnapMode == other.m_sectorPointSnapMode
+                   && m_maxSectorProcessTimeMicroseconds == other.m_maxSectorProcessTimeMicroseconds;
         }
 
         int m_viewRectangleSize = 13;
@@ -59,6 +61,8 @@ namespace Vegetation
         int m_threadProcessingIntervalMs = 500;
         int m_sectorSearchPadding = 0;
         SnapMode m_sectorPointSnapMode = SnapMode::Corner;
+        //! Max time per tick the vegetation thread spends creating / filling sectors (0 = unlimited)
+        int m_maxSectorProcessTimeMicroseconds = 0;
     private:
         static const int s_maxViewRectangleSize;
         static const int s_maxSectorDensity;
@@ -272,6 +276,7 @@ namespace Vegetation
             int m_sectorSizeInMeters = 0;
             int m_sectorDensity = 0;
             SnapMode m_sectorPointSnapMode = SnapMode::Corner;
+            int m_maxSectorProcessTimeMicroseconds = 0;
         };
 
         // VegetationThreadTasks is the task queue that's used equally by the main thread and the vegetation thread.
@@ -306,6 +311,9 @@ namespace Vegetation
             void MarkDirtySectors(const AZ::Aabb& bounds, DirtySectors& dirtySet, float worldToSector, const ViewRect& viewRect);
             void AddUnregisteredVegetationArea(const VegetationAreaInfo& area, float worldToSector, const ViewRect& viewRect);
 
+            //! Counts a created / filled sector, and periodically publishes the rate to the debug data.
+            void RecordProcessedSector();
+
             //! 2D Array rolling window of sectors that store vegetation objects.
             using SectorRollingWindow = AZStd::unordered_map<SectorId, SectorInfo>;
             mutable AZStd::recursive_mutex m_sectorRollingWindowMutex;
@@ -339,6 +347,10 @@ namespace Vegetation
             //! Note: This is only updated from the vegetation thread when processing vegetation tasks.
             UnregisteredVegetationAreaMap m_unregisteredVegetationAreaSet;
 
+            //! Sector throughput tracking.  Only accessed from the vegetation thread.
+            size_t m_processedSectorCount = 0;
+            AZStd::chrono::steady_clock::time_point m_processedSectorWindowStart = AZStd::chrono::steady_clock::now();
+
             //! Cached pointer to the debug data.
             //! Note: This doesn't have an associated mutex because DebugData itself consists purely of atomics
             DebugData* m_debugData = nullptr;
@@ -375,6 +387,10 @@ namespace Vegetation
             };
             AZStd::atomic<VegetationDataSyncState> m_vegetationDataSyncState{ VegetationDataSyncState::Synchronized };
 
+            // Incremented by the main thread every tick.  The vegetation thread uses it to reset its per-tick sector
+            // processing budget.
+            AZStd::atomic<AZ::u64> m_tickCount{ 0 };
+
             //! Reset the states that can get recalculated when the vegetation thread is run.
             //! This does *not* reset the states on registered vegetation area lists, since those only
             //! get filled out once.
@@ -431,6 +447,7 @@ namespace Vegetation
         private:
             bool UpdateSectorWorkLists(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
             bool UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
+            bool IsSectorProcessBudgetExhausted(const PersistentThreadData* threadData);
 
             enum class UpdateMode
             {
@@ -447,6 +464,10 @@ namespace Vegetation
             // be recalculated.
             AZStd::vector<AZStd::pair<SectorId, UpdateMode>> m_updateWorkList;
 
+            // Time spent processing sectors during the main thread tick identified by m_budgetTickCount.
+            AZ::u64 m_budgetTickCount = 0;
+            AZStd::chrono::microseconds m_budgetTimeUsed{ 0 };
+
             // Sector counts of the number of expected sectors in the view rectangle vs the number of sectors
             // currently active.  These are used to "load balance" sector deletes and creates so that we don't have
             // too many sectors active at any one point in time.
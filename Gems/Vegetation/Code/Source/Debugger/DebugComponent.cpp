@@ -978,9 +978,10 @@ void DebugComponent::DrawDebugStats(AzFramework::DebugDisplayRequests& debugDisp
         40.0f, 22.0f, 0.7f,
         AZStd::string::format(
             "VegetationSystemStats:\nActive Instances Count: %d\nInstance Register Queue: %d\nInstance Unregister Queue: %d\nThread "
-            "Queue Count: %d\nThread Processing Count: %d",
+            "Queue Count: %d\nThread Processing Count: %d\nSectors Per Second: %d",
             instanceCount, createTaskCount, destroyTaskCount, m_debugData->m_areaTaskQueueCount.load(AZStd::memory_order_relaxed),
-            m_debugData->m_areaTaskActiveCount.load(AZStd::memory_order_relaxed))
+            m_debugData->m_areaTaskActiveCount.load(AZStd::memory_order_relaxed),
+            m_debugData->m_sectorsPerSecond.load(AZStd::memory_order_relaxed))
             .c_str(),
         false);
 }
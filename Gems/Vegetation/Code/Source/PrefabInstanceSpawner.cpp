@@ -187,7 +187,7 @@ namespace Vegetation
         bool validAsset = true;
 
         // Basic safety check:  Make sure the asset is a spawnable.
-        auto spawnableAsset = azrtti_cast<AzFramework::Spawnable*>(asset.GetData());
+        auto spawnableAsset = azrtti_cast<const AzFramework::Spawnable*>(asset.GetData());
         if (!spawnableAsset)
         {
             return false;
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: Apache-2.0 OR MIT
  *
  */
+#include "VegetationMocks.h"
 #include <AzTest/AzTest.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/Component/ComponentApplication.h>
@@ -19,8 +20,14 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include <Vegetation/Ebuses/AreaSystemRequestBus.h>
+#include <Vegetation/Ebuses/FilterRequestBus.h>
+#include <Vegetation/Ebuses/SystemConfigurationBus.h>
 #include <VegetationModule.h>
 #include <AreaSystemComponent.h>
+#include <Source/Components/DistanceBetweenFilterComponent.h>
+#include <AzFramework/Components/CameraBus.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
 
 namespace UnitTest
 {
@@ -159,5 +166,204 @@ namespace UnitTest
         // This test simply creates an environment that activates and deactivates the vegetation system components.
         // If it runs without asserting / crashing, then it is successful.
     }
-}
 
+    // Provides a flat surface with one point per query position.
+    struct FlatSurfaceHandler
+        : public MockSurfaceHandler
+    {
+        void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, [[maybe_unused]] const SurfaceData::SurfaceTagVector& desiredTags,
+            SurfaceData::SurfacePointListPerPosition& surfacePointListPerPosition) const override
+        {
+            surfacePointListPerPosition.clear();
+            for (float y = inRegion.GetMin().GetY(); y < inRegion.GetMax().GetY(); y += stepSize.GetY())
+            {
+                for (float x = inRegion.GetMin().GetX(); x < inRegion.GetMax().GetX(); x += stepSize.GetX())
+                {
+                    SurfaceData::SurfacePoint point;
+                    point.m_position = AZ::Vector3(x, y, 0.0f);
+                    point.m_normal = AZ::Vector3::CreateAxisZ();
+                    surfacePointListPerPosition.emplace_back(point.m_position, SurfaceData::SurfacePointList{ point });
+                }
+            }
+        }
+    };
+
+    // Places the view rectangle around the world origin.
+    struct MockCamera
+        : public Camera::CameraSystemRequestBus::Handler
+        , public MockTransformBus
+    {
+        MockCamera()
+        {
+            Camera::CameraSystemRequestBus::Handler::BusConnect();
+            AZ::TransformBus::Handler::BusConnect(m_cameraId);
+        }
+
+        ~MockCamera()
+        {
+            AZ::TransformBus::Handler::BusDisconnect();
+            Camera::CameraSystemRequestBus::Handler::BusDisconnect();
+        }
+
+        AZ::EntityId GetActiveCamera() override
+        {
+            return m_cameraId;
+        }
+
+        AZ::Vector3 GetWorldTranslation() override
+        {
+            return AZ::Vector3::CreateZero();
+        }
+
+        AZ::EntityId m_cameraId = AZ::EntityId(0x1234);
+    };
+
+    // A vegetation area that tries to claim every available point, keeping the ones accepted by the filters on its entity.
+    class MockFilteredArea
+        : public Vegetation::AreaRequestBus::Handler
+    {
+    public:
+        MockFilteredArea(AZ::EntityId entityId)
+            : m_entityId(entityId)
+        {
+            Vegetation::AreaRequestBus::Handler::BusConnect(m_entityId);
+        }
+
+        ~MockFilteredArea()
+        {
+            Vegetation::AreaRequestBus::Handler::BusDisconnect();
+        }
+
+        bool PrepareToClaim([[maybe_unused]] Vegetation::EntityIdStack& stackIds) override
+        {
+            return true;
+        }
+
+        void ClaimPositions([[maybe_unused]] Vegetation::EntityIdStack& stackIds, Vegetation::ClaimContext& context) override
+        {
+            Vegetation::InstanceData instanceData;
+            instanceData.m_id = m_entityId;
+
+            size_t numAvailablePoints = context.m_availablePoints.size();
+            for (size_t pointIndex = 0; pointIndex < numAvailablePoints; )
+            {
+                Vegetation::ClaimPoint& point = context.m_availablePoints[pointIndex];
+                instanceData.m_position = point.m_position;
+                instanceData.m_normal = point.m_normal;
+
+                bool accepted = true;
+                Vegetation::FilterRequestBus::EnumerateHandlersId(m_entityId, [&accepted, &instanceData](Vegetation::FilterRequestBus::Events* filter)
+                {
+                    accepted = filter->Evaluate(instanceData);
+                    return accepted;
+                });
+
+                if (accepted)
+                {
+                    if (!context.m_existedCallback(point, instanceData))
+                    {
+                        context.m_createdCallback(point, instanceData);
+                    }
+                    AZStd::swap(point, context.m_availablePoints.at(numAvailablePoints - 1));
+                    --numAvailablePoints;
+                }
+                else
+                {
+                    ++pointIndex;
+                }
+            }
+            context.m_availablePoints.resize(numAvailablePoints);
+
+            ++m_claimPositionsCount;
+        }
+
+        void UnclaimPosition([[maybe_unused]] const Vegetation::ClaimHandle handle) override
+        {
+        }
+
+        AZ::EntityId m_entityId;
+        AZStd::atomic_int m_claimPositionsCount{ 0 };
+    };
+
+    TEST_F(VegetationTestApp, Vegetation_AreaSystemComponent_SectorProcessBudgetMatchesUnlimitedFills)
+    {
+        // The sector processing budget only spreads the sector fills over more ticks. Filters that look at the
+        // neighboring instances (such as the DistanceBetween filter) must still see the same claims, so the placed
+        // instances are the same as without a budget.
+        m_application.RegisterComponentDescriptor(MockVegetationAreaServiceComponent::CreateDescriptor());
+
+        FlatSurfaceHandler surfaceHandler;
+        MockCamera camera;
+
+        // The filter radius is larger than the distance between points, so accepting a point rejects its neighbors,
+        // including the ones across sector boundaries.
+        Vegetation::DistanceBetweenFilterConfig filterConfig;
+        filterConfig.m_radiusMin = 0.6f;
+        filterConfig.m_boundMode = Vegetation::BoundMode::Radius;
+
+        AZ::Entity areaEntity;
+        areaEntity.CreateComponent<Vegetation::DistanceBetweenFilterComponent>(filterConfig);
+        areaEntity.CreateComponent<MockVegetationAreaServiceComponent>();
+        areaEntity.Init();
+        areaEntity.Activate();
+
+        const int viewRectangleSize = 4;
+        const int sectorSizeInMeters = 4;
+        const int sectorCount = viewRectangleSize * viewRectangleSize;
+        const float viewExtent = static_cast<float>(viewRectangleSize * sectorSizeInMeters);
+        const AZ::Aabb viewBounds = AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3(viewExtent));
+
+        auto placeInstances = [&](int maxSectorProcessTimeMicroseconds)
+        {
+            MockFilteredArea area(areaEntity.GetId());
+
+            Vegetation::AreaSystemConfig config;
+            config.m_viewRectangleSize = viewRectangleSize;
+            config.m_sectorSizeInMeters = sectorSizeInMeters;
+            config.m_sectorDensity = 8;
+            config.m_maxSectorProcessTimeMicroseconds = maxSectorProcessTimeMicroseconds;
+            Vegetation::SystemConfigurationRequestBus::Broadcast(&Vegetation::SystemConfigurationRequestBus::Events::UpdateSystemConfig, &config);
+            Vegetation::AreaSystemRequestBus::Broadcast(&Vegetation::AreaSystemRequestBus::Events::RegisterArea, areaEntity.GetId(), 0, 0, viewBounds);
+
+            // Tick until the vegetation thread has filled every sector in the view rectangle.
+            for (int tick = 0; (tick < 2000) && (area.m_claimPositionsCount < sectorCount); ++tick)
+            {
+                AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.01f, AZ::ScriptTimePoint());
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            }
+            EXPECT_EQ(area.m_claimPositionsCount.load(), sectorCount);
+
+            // This waits on the rolling window, so it can't return before the last fill has finished.
+            AZStd::vector<Vegetation::InstanceData> instances;
+            Vegetation::AreaSystemRequestBus::BroadcastResult(instances, &Vegetation::AreaSystemRequestBus::Events::GetInstancesInAabb, viewBounds);
+
+            AZStd::vector<AZ::Vector3> positions;
+            for (const auto& instance : instances)
+            {
+                positions.push_back(instance.m_position);
+            }
+            AZStd::sort(positions.begin(), positions.end(), [](const AZ::Vector3& lhs, const AZ::Vector3& rhs)
+            {
+                return AZStd::make_pair(lhs.GetY(), lhs.GetX()) < AZStd::make_pair(rhs.GetY(), rhs.GetX());
+            });
+
+            // Restart the vegetation system so that the next run starts from empty sectors.
+            m_systemEntity->Deactivate();
+            m_systemEntity->Activate();
+
+            return positions;
+        };
+
+        const AZStd::vector<AZ::Vector3> unlimitedPositions = placeInstances(0);
+        const AZStd::vector<AZ::Vector3> budgetedPositions = placeInstances(1);
+
+        ASSERT_FALSE(unlimitedPositions.empty());
+        ASSERT_EQ(unlimitedPositions.size(), budgetedPositions.size());
+        for (size_t index = 0; index < unlimitedPositions.size(); ++index)
+        {
+            EXPECT_TRUE(unlimitedPositions[index].IsClose(budgetedPositions[index]));
+        }
+
+        areaEntity.Deactivate();
+    }
+}